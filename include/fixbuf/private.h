@@ -33,6 +33,11 @@
 /** size of the buffer for OpenSSL error messages */
 #define FB_SSL_ERR_BUFSIZ   512
 
+#if defined(HAVE_OPENSSL) && defined(SSL_OP_ENABLE_KTLS)
+/** OpenSSL can hand the record layer of a TLS connection to the kernel */
+#define FB_ENABLE_KTLS 1
+#endif
+
 /**
  * An UDP Connection specifier.  These are managed by the
  * collector.  The collector creates one fbUDPConnSpec_t
@@ -100,6 +105,73 @@ typedef struct fbElementPositions_st {
     uint16_t  *positions;
 } fbElementPositions_t;
 
+/**
+ *  fbTemplateAccessorSlot_t caches, on a Template, the Field that an
+ *  fbFieldAccessor_t resolves to.  The slot for the accessor with ID `i` is
+ *  entry `i` of the Template's `accessor_slots`.  A slot is not modified
+ *  once it is published; a different result is stored in a new slot.
+ */
+typedef struct fbTemplateAccessorSlot_st fbTemplateAccessorSlot_t;
+struct fbTemplateAccessorSlot_st {
+    /** The element of the accessor that filled the slot. */
+    const fbInfoElement_t     *ie;
+    /** The Field the accessor resolves to; NULL if the template lacks it. */
+    const fbTemplateField_t   *field;
+    /** The next slot the Template allocated; all are freed with it. */
+    fbTemplateAccessorSlot_t  *next;
+    /** The `skip` of the accessor that filled the slot. */
+    uint16_t                   skip;
+};
+
+/**
+ *  fbTemplateAccessorSlots_t is the array of a Template's accessor slots.
+ *  It is replaced by a larger copy to make room for more accessors.
+ *  Readers do not lock, so an array that was replaced is kept, through
+ *  `prev`, until the Template is freed.
+ */
+typedef struct fbTemplateAccessorSlots_st fbTemplateAccessorSlots_t;
+struct fbTemplateAccessorSlots_st {
+    /** The array this one replaced, or NULL. */
+    fbTemplateAccessorSlots_t  *prev;
+    /** The number of entries in `slot`. */
+    uint32_t                    count;
+    /** The slots, indexed by accessor ID; NULL where none was filled. */
+    fbTemplateAccessorSlot_t   *slot[1];
+};
+
+/**
+ *  fbRecordCopyOp_t is one step of an fbRecordCopyPlan_t.  When `len` is
+ *  non-zero, the step copies `len` octets from `src_off` in the source
+ *  record to `dst_off` in the destination.  Otherwise, the step copies the
+ *  source Field at position `src_pos` to the destination Field at position
+ *  `dst_pos` by its type.
+ */
+typedef struct fbRecordCopyOp_st {
+    uint16_t  src_pos;
+    uint16_t  dst_pos;
+    uint16_t  src_off;
+    uint16_t  dst_off;
+    uint16_t  len;
+} fbRecordCopyOp_t;
+
+/**
+ *  fbRecordCopyPlan_t holds the steps fbRecordCopyToTemplate() uses to copy
+ *  records of one Template to the Template that owns the plan.
+ */
+typedef struct fbRecordCopyPlan_st fbRecordCopyPlan_t;
+struct fbRecordCopyPlan_st {
+    /** The next plan owned by the destination Template. */
+    fbRecordCopyPlan_t  *next;
+    /** The source Template.  Only compared, never dereferenced. */
+    const fbTemplate_t  *src_tmpl;
+    /** The `serial` of the source Template. */
+    uint32_t             src_serial;
+    /** The number of steps in `ops`. */
+    uint16_t             op_count;
+    /** The steps of the copy. */
+    fbRecordCopyOp_t    *ops;
+};
+
 /**
  * An IPFIX template or options template structure. Part of the private
  * interface. Applications should use the fbTemplate calls defined in public.h
@@ -114,10 +186,35 @@ struct fbTemplate_st {
     GHashTable            *indices;
     /** Field offset cache. For internal use by the transcoder. */
     uint16_t              *off_cache;
+    /**
+     * Fields resolved by fbFieldAccessor_t handles, indexed by accessor ID;
+     * see fbFieldAccessorGetField().  Read and replaced atomically.
+     */
+    fbTemplateAccessorSlots_t *accessor_slots;
+    /** Every slot allocated for `accessor_slots`, linked by `next`. */
+    fbTemplateAccessorSlot_t *accessor_slot_list;
+    /** Plans for copying records into this template, most recent first. */
+    fbRecordCopyPlan_t    *copy_plans;
+    /**
+     * Serial number that is unique to this template, so caches that are
+     * keyed by template notice when a freed template's address is reused.
+     */
+    uint32_t               serial;
+    /**
+     * Hash of the model, scope count, and fields; set when the template is
+     * interned.  See fbTemplateIntern().
+     */
+    uint32_t               fingerprint;
     /** Reference count */
     int                    ref_count;
     /** Count of information elements in template. */
     uint16_t               ie_count;
+    /**
+     * Count of the leading fixed-length information elements, those before
+     * the first variable-length element.  Their offsets are the same in
+     * the internal and external records.
+     */
+    uint16_t               fixed_prefix_count;
     /**
      * Count of scope information elements in template. If scope_count
      * is greater than 0, this template is an options template.
@@ -151,6 +248,7 @@ struct fbTemplate_st {
     gboolean               contains_list;
     /**
      * TRUE if this template has been activated (is no longer mutable).
+     * Set when a session first references it; see fbTemplateRetain().
      */
     gboolean               active;
     /**
@@ -158,6 +256,13 @@ struct fbTemplate_st {
      * defaulted length
      */
     gboolean               default_length;
+    /**
+     * TRUE if the template is in the process-wide intern table.  It may be
+     * shared by sessions in several threads, so its reference count is
+     * guarded by a lock; like every template's offset and accessor caches,
+     * those are published atomically.  See fbTemplateIntern().
+     */
+    gboolean               interned;
     /**
      * Template context. Created and owned by the application
      * when the listener calls the fbNewTemplateCallback_fn.
@@ -432,6 +537,24 @@ void
 fbTemplateRelease(
     fbTemplate_t  *tmpl);
 
+/**
+ * fbTemplateIntern
+ *
+ * Returns the template in the process-wide intern table that has the same
+ * information model, scope count, and fields as `tmpl`, adding `tmpl` to the
+ * table if there is none.  When a template is found, `tmpl` is freed.  The
+ * returned template holds a reference that the caller must release with
+ * fbTemplateRelease() once it has stored the template elsewhere.
+ *
+ * `tmpl` must be complete (its scope set) and must not be referenced.
+ *
+ * @param tmpl
+ *
+ */
+fbTemplate_t *
+fbTemplateIntern(
+    fbTemplate_t  *tmpl);
+
 /**
  * fbTemplateDebug
  *
@@ -865,6 +988,34 @@ fbExportMessage(
     size_t         msglen,
     GError       **err);
 
+/**
+ * fbExporterRotateDue
+ *
+ * Returns TRUE when a file exporter with fbExporterSetFileRotation() has
+ * reached the size or age limit of its current file.
+ *
+ * @param exporter
+ *
+ */
+gboolean
+fbExporterRotateDue(
+    const fbExporter_t  *exporter);
+
+/**
+ * fbExporterRotate
+ *
+ * Writes and closes the current file of a file exporter; the next message
+ * opens a new one.
+ *
+ * @param exporter
+ * @param err
+ *
+ */
+gboolean
+fbExporterRotate(
+    fbExporter_t  *exporter,
+    GError       **err);
+
 /**
  * fbExporterFree
  *
@@ -944,6 +1095,39 @@ fbCollectMessage(
     size_t         *msglen,
     GError        **err);
 
+/**
+ * fbCollectMessageInPlace
+ *
+ * Frames the next message of a memory-mapped file collector without
+ * copying it: sets `msgbase` to the start of the message within the
+ * mapping and `msglen` to its length.  The collector must be mapped;
+ * see fbCollectorIsMapped().
+ *
+ * @param collector
+ * @param msgbase
+ * @param msglen
+ * @param err
+ *
+ */
+gboolean
+fbCollectMessageInPlace(
+    fbCollector_t  *collector,
+    uint8_t       **msgbase,
+    size_t         *msglen,
+    GError        **err);
+
+/**
+ * fbCollectorIsMapped
+ *
+ * Returns TRUE if fbCollectorMapFile() mapped the collector's input.
+ *
+ * @param collector
+ *
+ */
+gboolean
+fbCollectorIsMapped(
+    const fbCollector_t  *collector);
+
 /**
  * fbCollectorGetFD
  *
@@ -966,6 +1150,56 @@ fbCollectorSetFD(
     fbCollector_t  *collector,
     int             fd);
 
+/**
+ * fbCollectorSetNonBlocking
+ *
+ * Makes the socket of a TCP, SCTP, or TLS collector non-blocking, so
+ * that fbCollectMessage() fails with FB_ERROR_NLREAD instead of waiting
+ * when the socket has no complete message.  A partial message stays in
+ * the receive buffer for the next call.  Fails when a translator is set,
+ * since translators read their input unbuffered.
+ *
+ * @param collector
+ * @param err
+ *
+ */
+gboolean
+fbCollectorSetNonBlocking(
+    fbCollector_t  *collector,
+    GError        **err);
+
+/**
+ * fbCollectorHasPendingMessages
+ *
+ * Returns TRUE if the collector holds messages that were read from its
+ * socket but not yet returned by fbCollectMessage(): datagrams left in
+ * the recvmmsg() ring of a batched UDP collector, a complete message
+ * in the receive buffer of a TCP or TLS collector, or input held by the
+ * decompressor of a compressed stream.  A listener must not block in
+ * poll() while this is TRUE.
+ *
+ * @param collector
+ *
+ */
+gboolean
+fbCollectorHasPendingMessages(
+    const fbCollector_t  *collector);
+
+/**
+ * fbCollectorIsReadable
+ *
+ * Returns TRUE if reading the next message from an active socket
+ * collector would not block: fbCollectorHasPendingMessages() is TRUE, or
+ * the socket has data ready, has reached end of stream, or has failed.
+ * Used to drain edge-triggered listener connections.
+ *
+ * @param collector
+ *
+ */
+gboolean
+fbCollectorIsReadable(
+    const fbCollector_t  *collector);
+
 /**
  * fbCollectorFree
  *
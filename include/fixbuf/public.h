@@ -164,9 +164,18 @@ typedef struct fbVarfield_st {
 typedef struct fbInfoModel_st fbInfoModel_t;
 
 /**
- *  An iterator over the information elements in an information model.
+ *  An iterator over the information elements in an information model.  The
+ *  members are private to libfixbuf; use fbInfoModelIterInit() and
+ *  fbInfoModelIterNext().
  */
-typedef GHashTableIter fbInfoModelIter_t;
+typedef struct fbInfoModelIter_st {
+    /** The model being visited */
+    const fbInfoModel_t  *model;
+    /** Position in the table of elements built into libfixbuf */
+    size_t                prebuilt_pos;
+    /** Position among the elements added to the model at run time */
+    GHashTableIter        overlay;
+} fbInfoModelIter_t;
 
 /**
  *  Convenience macro for creating full @ref fbInfoElement_t static
@@ -1420,6 +1429,39 @@ typedef struct fbRecord_st {
 #define FB_RECORD_INIT  {NULL, NULL, 0, 0, 0}
 
 
+/**
+ *  fbRecordView_t refers to a record in place in the message buffer of an
+ *  @ref fBuf_t, without decoding it.  It is filled by fBufNextView().
+ *
+ *  The record's data is in the wire format described by the external
+ *  template `tmpl`: in network byte order, with fixed-length fields possibly
+ *  encoded with reduced length and each variable-length field preceded by
+ *  its length.  When the template has no variable-length fields, the offset
+ *  of each field in `data` is given by its `offset` member.  Use
+ *  fbRecordViewGetFieldByPosition() to find a field's data for any template.
+ *
+ *  The `data` remains valid until the Buffer reads the next message.  The
+ *  `offsets` remain valid until the next call to fBufNextView().
+ *
+ *  @since libfixbuf 3.0.0
+ */
+typedef struct fbRecordView_st {
+    /** The external template that describes the bytes in `data`. */
+    const fbTemplate_t  *tmpl;
+    /** The record's data in the message buffer. */
+    const uint8_t       *data;
+    /** The number of bytes in `data`. */
+    size_t               datalen;
+    /**
+     * The offset of each field in `data` followed by the offset of the end
+     * of the record.  Used by fbRecordViewGetFieldByPosition().
+     */
+    const uint16_t      *offsets;
+    /** The template ID for `tmpl`. */
+    uint16_t             tid;
+} fbRecordView_t;
+
+
 /**
  *  fbRecordValue_t is used to access the value of a single Element (or Field)
  *  in an @ref fbRecord_t.
@@ -1730,6 +1772,8 @@ typedef enum fbTransport_en {
     /**
      * Secure, reliable stream transport via TLS over TCP.
      * Only available if fixbuf was built with OpenSSL support.
+     * With OpenSSL 3.0 or later, encryption is done by the kernel
+     * (kTLS) when the kernel and the negotiated cipher allow it.
      */
     FB_TLS_TCP,
     /**
@@ -2128,6 +2172,35 @@ typedef struct fbListenerGroupResult_st {
     fBuf_t                           *fbuf;
 } fbListenerGroupResult_t;
 
+/**
+ *  A pool of worker threads that reads the connections one listener
+ *  accepts (cf. fbListenerPoolAlloc()).  The internals of this structure
+ *  are private to libfixbuf.
+ */
+typedef struct fbListenerPool_st fbListenerPool_t;
+
+/**
+ *  Message function type for @ref fbListenerPool_t.  Pass this function as
+ *  the `onmsg` parameter of fbListenerPoolAlloc().
+ *
+ *  Fixbuf calls this function on the worker thread that owns a connection
+ *  each time a message arrives on it.  The buffer is positioned at the
+ *  start of the message and is not in automatic mode, so the function
+ *  reads records with fBufNext() until it fails with @ref FB_ERROR_EOM.
+ *  Returning FALSE closes the connection.
+ *
+ *  @param fbuf    the collection buffer of the connection
+ *  @param worker  index of the calling worker, less than the number of
+ *                 workers in the pool
+ *  @param udata   the `udata` passed to fbListenerPoolAlloc()
+ *  @return TRUE to keep reading the connection, FALSE to close it
+ *  @since libfixbuf 3.0.0
+ */
+typedef gboolean (*fbListenerPoolMessage_fn)(
+    fBuf_t        *fbuf,
+    unsigned int   worker,
+    void          *udata);
+
 /**
  *  A callback function that is called when a template is freed.  This
  *  function should be set during the @ref fbNewTemplateCallback_fn.
@@ -2175,6 +2248,89 @@ typedef void (*fbNewTemplateCallback_fn)(
     void                 **tmpl_ctx,
     fbTemplateCtxFree_fn  *tmpl_ctx_free_fn);
 
+/**
+ *  Counters of the work done by a Buffer, Collector, Exporter, or
+ *  Listener, filled by fBufGetStats(), fbCollectorGetStats(),
+ *  fbExporterGetStats(), and fbListenerGetStats().  Each object fills the
+ *  counters noted as its own and sets the others to 0.  All counts are
+ *  since the object was allocated.
+ *
+ *  The counters are plain integers updated by the thread using the object,
+ *  so counting takes no locks or atomic operations.  The exception is the
+ *  Exporter, whose writes are counted by the export thread in
+ *  asynchronous mode (fbExporterStartAsync()): its counters are updated
+ *  and read with relaxed atomic operations, still without a lock, and
+ *  fbExporterGetStats() may be called from any thread.  The counters may
+ *  be read from another thread for monitoring, but the values may lag and
+ *  are not a consistent snapshot.
+ *
+ *  @since libfixbuf 3.0.0
+ */
+typedef struct fbStats_st {
+    /** Messages read or emitted (Buffer, Collector, Exporter) */
+    uint64_t   messages;
+    /** Octets in the messages counted by `messages` */
+    uint64_t   message_octets;
+    /** Sets read or written, including template sets (Buffer) */
+    uint64_t   sets;
+    /**
+     *  Data records read or appended, including the options records a
+     *  Buffer consumes itself (Buffer)
+     */
+    uint64_t   records;
+    /** Template records read or exported (Buffer) */
+    uint64_t   templates_added;
+    /** Template withdrawals read or exported (Buffer) */
+    uint64_t   templates_withdrawn;
+    /**
+     *  Data sets skipped for want of a template, and templates ignored as
+     *  malformed (Buffer)
+     */
+    uint64_t   skipped;
+    /** Transcode plan lookups found in the plan cache (Buffer) */
+    uint64_t   plan_hits;
+    /** Transcode plan lookups that created a new plan (Buffer) */
+    uint64_t   plan_misses;
+    /** Decoded lists whose contents needed storage (Buffer) */
+    uint64_t   list_allocs;
+    /** Calls that read the file or socket (Collector) */
+    uint64_t   reads;
+    /** Octets returned by the calls counted by `reads` */
+    uint64_t   read_octets;
+    /** Calls that wrote the file or socket (Exporter) */
+    uint64_t   writes;
+    /** Octets accepted by the calls counted by `writes` */
+    uint64_t   write_octets;
+    /** Waits for input in poll() or its equivalent (Collector, Listener) */
+    uint64_t   polls;
+    /** Microseconds spent in the waits counted by `polls` */
+    uint64_t   poll_usec;
+    /** Connections accepted (Listener) */
+    uint64_t   connections;
+} fbStats_t;
+
+/**
+ *  A callback function that a Buffer calls at each message boundary: when
+ *  it has read the header of a message, or when it has handed a message to
+ *  its exporter.  Intended for tracing; the function runs on the thread
+ *  using the Buffer and should return quickly.  Set it with
+ *  fBufSetMessageCallback().
+ *
+ *  @param fbuf     the Buffer
+ *  @param msgbase  the message, starting with its header.  Valid only
+ *                  during the call.
+ *  @param msglen   the length of the message
+ *  @param emitted  FALSE for a message being read, TRUE for one emitted
+ *  @param app_ctx  the `app_ctx` passed to fBufSetMessageCallback()
+ *  @since libfixbuf 3.0.0
+ */
+typedef void (*fBufMessageCallback_fn)(
+    fBuf_t         *fbuf,
+    const uint8_t  *msgbase,
+    size_t          msglen,
+    gboolean        emitted,
+    void           *app_ctx);
+
 
 /**
  *  fbListSemantics_t defines the possible values for the semantics of
@@ -2264,6 +2420,14 @@ struct fbBasicList_st {
      *  defined in @ref fbListSemantics_t.
      */
     uint8_t             semantic;
+    /**
+     *  Nonzero when the storage for the list was allocated from the list
+     *  arena of an @ref fBuf_t (see fBufSetListArena()), in which case
+     *  clearing the list does not free it.  Also set when decoding the list
+     *  was deferred by fBufSetLazyLists().  Set by fixbuf.
+     *  @since libfixbuf 3.0.0
+     */
+    uint8_t             fromArena;
 };
 
 
@@ -2633,6 +2797,14 @@ struct fbSubTemplateList_st {
      *  defined in @ref fbListSemantics_t.
      */
     uint8_t              semantic;
+    /**
+     *  Nonzero when the storage for the list was allocated from the list
+     *  arena of an @ref fBuf_t (see fBufSetListArena()), in which case
+     *  clearing the list does not free it.  Also set when decoding the list
+     *  was deferred by fBufSetLazyLists().  Set by fixbuf.
+     *  @since libfixbuf 3.0.0
+     */
+    uint8_t              fromArena;
 };
 
 /**
@@ -2954,6 +3126,14 @@ struct fbSubTemplateMultiList_st {
      *  defined in @ref fbListSemantics_t.
      */
     uint8_t                         semantic;
+    /**
+     *  Nonzero when the storage for the list was allocated from the list
+     *  arena of an @ref fBuf_t (see fBufSetListArena()), in which case
+     *  clearing the list does not free it.  Also set when decoding the list
+     *  was deferred by fBufSetLazyLists().  Set by fixbuf.
+     *  @since libfixbuf 3.0.0
+     */
+    uint8_t                         fromArena;
 };
 
 
@@ -2988,6 +3168,13 @@ struct fbSubTemplateMultiListEntry_st {
      *  The ID of the template used to structure the data in this entry.
      */
     uint16_t             tmplID;
+    /**
+     *  Nonzero when the storage for the list was allocated from the list
+     *  arena of an @ref fBuf_t (see fBufSetListArena()), in which case
+     *  clearing the list does not free it.  Set by fixbuf.
+     *  @since libfixbuf 3.0.0
+     */
+    uint8_t              fromArena;
 };
 
 
@@ -3501,6 +3688,81 @@ void
 fbListenerFreeGroupResult(
     fbListenerGroupResult_t  *result);
 
+/**
+ *  Allocates a pool of `workers` threads that read the connections
+ *  accepted by `listener`, which must be a TCP, SCTP, or TLS listener.
+ *  Call fbListenerPoolRun() to start accepting connections.
+ *
+ *  Each connection is assigned to one worker.  That worker calls the
+ *  listener's @ref fbListenerAppInit_fn, creates the connection's
+ *  collector and buffer with a clone of the listener's session, calls
+ *  `onmsg` for each message, and on close calls the listener's @ref
+ *  fbListenerAppFree_fn, so all of a connection's state is used by one
+ *  thread.  The information model is shared by all workers; it should
+ *  hold every element the exporters use, since adding elements while
+ *  workers read is not thread-safe.
+ *
+ *  Workers read their connections without blocking and pass only
+ *  complete messages to `onmsg`, so a slow peer does not hold up the other
+ *  connections of its worker.  Listeners with an @ref fbListenerAppInit_fn
+ *  that attaches a translator (e.g., NetFlow v9) are not supported.
+ *
+ *  The workers' sessions are clones of the listener's session and share
+ *  its internal templates, so the application must not add or remove
+ *  internal templates in the listener's session while the pool exists.
+ *
+ *  While the listener has a pool, fbListenerWait(),
+ *  fbListenerWaitNoCollectors(), and fbListenerGroupWait() on it fail with
+ *  @ref FB_ERROR_SETUP.  A listener may have only one pool at a time.
+ *
+ *  @param listener  the listener to accept connections on
+ *  @param workers   the number of worker threads; must be at least 1
+ *  @param onmsg     the function to call for each message
+ *  @param udata     application data passed to `onmsg`
+ *  @param err       An error description, set on failure.
+ *  @return a new pool, or NULL on failure.
+ *  @since libfixbuf 3.0.0
+ */
+fbListenerPool_t *
+fbListenerPoolAlloc(
+    fbListener_t              *listener,
+    unsigned int               workers,
+    fbListenerPoolMessage_fn   onmsg,
+    void                      *udata,
+    GError                   **err);
+
+/**
+ *  Accepts connections on the pool's listener and hands each to a worker,
+ *  until fbListenerInterrupt() is called on the listener or an error
+ *  occurs.  Connections that fail before they are accepted are skipped,
+ *  and when the process runs out of descriptors or memory the function
+ *  waits for the workers to close connections and tries again.  In every
+ *  case the workers keep reading their connections when the function
+ *  returns, and it may be called again.
+ *
+ *  @param pool  a listener pool
+ *  @param err   An error description, set on failure: @ref FB_ERROR_NLREAD
+ *               if a signal interrupted the wait, @ref FB_ERROR_IO
+ *               otherwise.
+ *  @return TRUE if fbListenerInterrupt() was called, FALSE on failure.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbListenerPoolRun(
+    fbListenerPool_t  *pool,
+    GError           **err);
+
+/**
+ *  Stops the pool's workers, which close and free their connections, and
+ *  frees the pool.  Does not free the listener.
+ *
+ *  @param pool  a listener pool
+ *  @since libfixbuf 3.0.0
+ */
+void
+fbListenerPoolFree(
+    fbListenerPool_t  *pool);
+
 /**
  *  Returns an fBuf wrapped around an independently managed socket and a
  *  properly created listener for TCP connections.
@@ -3781,6 +4043,169 @@ fbSession_t *
 fBufGetSession(
     const fBuf_t  *fbuf);
 
+/**
+ *  Sets the maximum number of transcode plans a Buffer caches.
+ *
+ *  A transcode plan describes how to convert records between a pair of
+ *  templates.  The Buffer creates a plan the first time it reads or writes a
+ *  record using a particular pair of templates and caches it for use by
+ *  later records.  When the cache is full, the least recently used plan is
+ *  discarded to make room for a new one.
+ *
+ *  By default the cache has no limit, which is also the result of setting
+ *  `capacity` to 0.  Reducing the capacity immediately discards the least
+ *  recently used plans as necessary.
+ *
+ *  @param fbuf      an IPFIX message buffer
+ *  @param capacity  the maximum number of plans to cache, or 0 for no limit
+ *  @see fBufGetTranscodePlanCacheStats()
+ *  @since libfixbuf 3.0.0
+ */
+void
+fBufSetTranscodePlanCacheSize(
+    fBuf_t        *fbuf,
+    unsigned int   capacity);
+
+/**
+ *  Gets the number of transcode plan lookups on a Buffer that were satisfied
+ *  by the Buffer's plan cache and the number that required a new plan.  See
+ *  fBufSetTranscodePlanCacheSize() for details.  Either of `hits` or `misses`
+ *  may be NULL.
+ *
+ *  @param fbuf    an IPFIX message buffer
+ *  @param hits    set to the number of lookups found in the cache
+ *  @param misses  set to the number of lookups that created a new plan
+ *  @since libfixbuf 3.0.0
+ */
+void
+fBufGetTranscodePlanCacheStats(
+    const fBuf_t  *fbuf,
+    uint64_t      *hits,
+    uint64_t      *misses);
+
+/**
+ *  Fills `stats` with the counters of a Buffer: messages, sets, records,
+ *  templates, transcode plan lookups, and list allocations.  The counters
+ *  of its collector or exporter are read separately with
+ *  fbCollectorGetStats() or fbExporterGetStats().
+ *
+ *  @param fbuf   an IPFIX message buffer
+ *  @param stats  the counters to fill
+ *  @since libfixbuf 3.0.0
+ */
+void
+fBufGetStats(
+    const fBuf_t  *fbuf,
+    fbStats_t     *stats);
+
+/**
+ *  Sets a function that `fbuf` calls at each message boundary, for tracing
+ *  tools such as USDT probes or eBPF uprobes.  When no function is set,
+ *  the cost is one test per message.  Replaces any previous function; a
+ *  NULL `callback` removes it.
+ *
+ *  @param fbuf      an IPFIX message buffer
+ *  @param callback  the function to call, or NULL
+ *  @param app_ctx   passed to `callback`
+ *  @since libfixbuf 3.0.0
+ */
+void
+fBufSetMessageCallback(
+    fBuf_t                  *fbuf,
+    fBufMessageCallback_fn   callback,
+    void                    *app_ctx);
+
+/**
+ *  Specifies where a collection Buffer allocates the storage for the
+ *  contents of the @ref fbBasicList_t, @ref fbSubTemplateList_t, and @ref
+ *  fbSubTemplateMultiList_t structures it decodes, and when that storage is
+ *  released.  See fBufSetListArena().
+ *
+ *  @since libfixbuf 3.0.0
+ */
+typedef enum fbListArenaMode_en {
+    /**
+     *  Allocates each list individually.  The application must free the lists
+     *  with fBufListFree() or fbRecordFreeLists().  This is the default.
+     */
+    FB_LIST_ARENA_NONE = 0,
+    /**
+     *  Allocates lists from the Buffer's arena and releases them all when the
+     *  Buffer reads the next message.
+     */
+    FB_LIST_ARENA_MESSAGE,
+    /**
+     *  Allocates lists from the Buffer's arena and releases them all at the
+     *  next call to fBufNext(), fBufNextRecord(), or fBufNextBatch().
+     */
+    FB_LIST_ARENA_RECORD
+} fbListArenaMode_t;
+
+/**
+ *  Sets how a collection Buffer allocates the storage for the lists it
+ *  decodes.
+ *
+ *  When `mode` is other than @ref FB_LIST_ARENA_NONE, list storage is carved
+ *  from large blocks owned by the Buffer, which avoids an allocation per list
+ *  and lets the Buffer release all of the lists at once as described by @ref
+ *  fbListArenaMode_t.  The `fromArena` member of such lists is set, and
+ *  functions that clear or free lists (fBufListFree(), fbBasicListClear(),
+ *  and the like) ignore their storage, so calling fBufListFree() on the
+ *  records is allowed but unnecessary.  The application must not use the
+ *  lists after they have been released.  Lists that an application attaches
+ *  to a record inside arena storage are not freed by fBufListFree().
+ *
+ *  Setting the mode to @ref FB_LIST_ARENA_NONE releases the arena.
+ *
+ *  @param fbuf      an IPFIX message buffer
+ *  @param mode      how to allocate list storage
+ *  @since libfixbuf 3.0.0
+ */
+void
+fBufSetListArena(
+    fBuf_t             *fbuf,
+    fbListArenaMode_t   mode);
+
+/**
+ *  Sets whether a collection Buffer defers decoding the lists (@ref
+ *  fbBasicList_t, @ref fbSubTemplateList_t, and @ref
+ *  fbSubTemplateMultiList_t) in the records it reads.
+ *
+ *  When `lazy` is TRUE, reading a record only notes where each of its lists
+ *  is in the message, and a list is decoded the first time a function that
+ *  examines its contents is called on it---fbBasicListGetNextPtr(),
+ *  fbSubTemplateListCountElements(), fbSubTemplateMultiListGetFirstEntry(),
+ *  fbRecordFindAllElementValues(), and the like---or when it is exported.
+ *  Lists that the application never examines cost almost nothing to read.
+ *  The `semantic` member of a deferred list is set at once; the list's
+ *  other members do not describe its contents, which are available only
+ *  through those functions.
+ *
+ *  A deferred list refers to the message that `fbuf` is reading.  Before
+ *  `fbuf` reads another message or a template set, is given a new buffer
+ *  with fBufSetBuffer(), or is freed, it decodes the deferred lists that
+ *  have not yet been examined, so a list remains valid until it is cleared
+ *  as any other decoded list does.  When using fBufSetBuffer(), the
+ *  application must not change a buffer's contents until fBufNext() has
+ *  reported the end of its message or fBufSetBuffer() is called again.  Errors
+ *  in the encoding of a deferred list are logged when it is decoded rather
+ *  than returned when the record is read, and the list is left empty.
+ *  Clearing or freeing a deferred list does not decode it.  With a list
+ *  arena (see fBufSetListArena()), deferred lists are released along with
+ *  the arena and are not decoded when released.
+ *
+ *  Lazy decoding is off by default.
+ *
+ *  @param fbuf      an IPFIX message buffer
+ *  @param lazy      TRUE to defer decoding lists, FALSE to decode records
+ *                   completely when they are read
+ *  @since libfixbuf 3.0.0
+ */
+void
+fBufSetLazyLists(
+    fBuf_t    *fbuf,
+    gboolean   lazy);
+
 /**
  *  Frees a buffer. Also frees any associated session, exporter, or collector,
  *  closing exporting process or collecting process endpoint connections and
@@ -3906,6 +4331,36 @@ fBufAppend(
     size_t    recsize,
     GError  **err);
 
+/**
+ *  Appends an array of records to a buffer.  The effect is the same as
+ *  calling fBufAppend() on each record in turn, but the templates and the
+ *  state of the message and set are checked once for the array instead of
+ *  once per record.  All the records are described by the present internal
+ *  and export templates.  If the buffer is in automatic mode, messages are
+ *  emitted via fBufEmit() as they fill.
+ *
+ *  On failure, the records before the one that failed have been appended to
+ *  the buffer.
+ *
+ *  @param fbuf      an IPFIX message buffer
+ *  @param recs      pointer to an array of internal records
+ *  @param recsize   size of each internal record in bytes
+ *  @param count     number of records in `recs`
+ *  @param err       an error description, set on failure.
+ *                   Must not be NULL, as it is used internally in
+ *                   automatic mode to detect message restart.
+ *  @return TRUE on success, FALSE on failure.
+ *  @see fBufAppend()
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fBufAppendBatch(
+    fBuf_t   *fbuf,
+    uint8_t  *recs,
+    size_t    recsize,
+    size_t    count,
+    GError  **err);
+
 /**
  *  Emits the message currently in a buffer using the associated exporting
  *  process endpoint.
@@ -4035,6 +4490,48 @@ fBufNext(
     size_t   *recsize,
     GError  **err);
 
+/**
+ *  Retrieves several records from a Buffer associated with a collecting
+ *  process.
+ *
+ *  Reads the next record as described by fBufNext() into the first element
+ *  of the array at `recs`, then decodes the records that follow it in the
+ *  same data set into the subsequent elements, stopping at the end of the
+ *  set or when `max` records have been read.  Since a data set uses a single
+ *  external template and the internal template does not change, the
+ *  per-record work of finding the set and the transcode plan is done once
+ *  per set rather than once per record.
+ *
+ *  Each element of `recs` is `recsize` octets, and that is the space
+ *  available to each record.  The records are described by the internal
+ *  template previously set via fBufSetInternalTemplate().  On return,
+ *  `count` holds the number of records read.
+ *
+ *  If an error occurs when decoding a record other than the first, the
+ *  function returns TRUE and `count` covers the records decoded before it;
+ *  the error is reported by the next read from the Buffer.
+ *
+ *  @param fbuf      an IPFIX message buffer
+ *  @param recs      pointer to an array of internal record buffers
+ *  @param recsize   size of each element of `recs`, in octets
+ *  @param max       number of elements in `recs`
+ *  @param count     set to the number of records read
+ *  @param err       an error description, set on failure.
+ *                   Must not be NULL, as it is used internally in
+ *                   automatic mode to detect message restart.
+ *  @return TRUE on success, FALSE if no record could be read.
+ *  @see fBufNext()
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fBufNextBatch(
+    fBuf_t   *fbuf,
+    uint8_t  *recs,
+    size_t    recsize,
+    size_t    max,
+    size_t   *count,
+    GError  **err);
+
 /**
  *  Sets the internal template on a Buffer and gets its next record.
  *
@@ -4065,6 +4562,35 @@ fBufNextRecord(
     fbRecord_t  *record,
     GError     **err);
 
+/**
+ *  Retrieves a view of the next record from a Buffer associated with a
+ *  collecting process without transcoding the record.
+ *
+ *  Reads and processes any templates and options templates and fills `view`
+ *  with the template, template ID, and location in the message buffer of the
+ *  next data record, as described by @ref fbRecordView_t.  Nothing is copied
+ *  and no memory is allocated for the record, and no internal template is
+ *  needed.  If the buffer is in automatic mode, may cause a message to be
+ *  read via fBufNextMessage() if there are no more records available in the
+ *  message buffer.
+ *
+ *  This function may be combined with fBufNext() on the same Buffer; each
+ *  call consumes one record.
+ *
+ *  @param fbuf      an IPFIX message buffer
+ *  @param view      the view to fill with the next record
+ *  @param err       an error description, set on failure.
+ *                   Must not be NULL, as it is used internally in
+ *                   automatic mode to detect message restart.
+ *  @return TRUE on success, FALSE on failure.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fBufNextView(
+    fBuf_t          *fbuf,
+    fbRecordView_t  *view,
+    GError         **err);
+
 /**
  *  Reads a new message into a buffer using the associated collecting
  *  process endpoint. Called by fBufNext() on end of message in automatic
@@ -4146,6 +4672,12 @@ fBufNextCollectionTemplate(
  *  An Information Model is required to create Templates and Sessions. Each
  *  application should have only one Information Model.
  *
+ *  The default elements are not copied into the model: every model shares a
+ *  read-only table that is generated when libfixbuf is built and is searched
+ *  with a perfect hash, so allocation performs no per-element work.  Elements
+ *  added later are kept in the model and take precedence over a default
+ *  element with the same ID.
+ *
  *  Exits the application on allocation failure.
  *
  *  [IANA-managed]: https://www.iana.org/assignments/ipfix/ipfix.xhtml
@@ -4893,6 +5425,65 @@ fbTemplateFindFieldByIdent(
     uint16_t             skip);
 
 
+/**
+ *  A field accessor is a handle for repeatedly finding one Information
+ *  Element in records of many Templates.  Each Template remembers the Field
+ *  that an accessor found in it, so after the first search of a Template,
+ *  finding the Field with fbFieldAccessorGetField() or getting its value with
+ *  fbRecordGetValueForAccessor() takes constant time.  The internals of this
+ *  structure are private to libfixbuf.
+ *
+ *  Since a Template's cache is updated as the accessor is used, an accessor
+ *  must not be used on a Template while another thread is using an accessor
+ *  on that same Template.
+ *
+ *  @since libfixbuf 3.0.0
+ */
+typedef struct fbFieldAccessor_st fbFieldAccessor_t;
+
+/**
+ *  Allocates and returns a field accessor that finds the field using `ie`
+ *  that fbTemplateFindFieldByElement() would return when given a NULL
+ *  `position` and the same `skip`.  Use fbFieldAccessorFree() to free it.
+ *
+ *  @param ie       The info element to search for
+ *  @param skip     The number of matching fields to ignore
+ *  @return A new field accessor
+ *  @since libfixbuf 3.0.0
+ */
+fbFieldAccessor_t *
+fbFieldAccessorAlloc(
+    const fbInfoElement_t  *ie,
+    uint16_t                skip);
+
+/**
+ *  Frees a field accessor.  Does nothing if `accessor` is NULL.
+ *
+ *  @param accessor The field accessor to free
+ *  @since libfixbuf 3.0.0
+ */
+void
+fbFieldAccessorFree(
+    fbFieldAccessor_t  *accessor);
+
+/**
+ *  Returns the Field of Template `tmpl` that `accessor` finds, or NULL if
+ *  `tmpl` does not contain it.  The result is cached on `tmpl` once `tmpl`
+ *  is no longer being built; that is, once it has been added to a Session.
+ *  The cache is updated without locking, so the function may be called on
+ *  a Template that several threads share.
+ *
+ *  @param accessor The field accessor to use
+ *  @param tmpl     The template to be searched
+ *  @return The field object or NULL if not found
+ *  @since libfixbuf 3.0.0
+ */
+const fbTemplateField_t *
+fbFieldAccessorGetField(
+    const fbFieldAccessor_t  *accessor,
+    const fbTemplate_t       *tmpl);
+
+
 /**
  *  Searches a Template for a TemplateField by an @ref fbInfoElement_t's
  *  datatype.
@@ -5330,6 +5921,30 @@ uint16_t
 fbRecordGetFieldCount(
     const fbRecord_t  *record);
 
+/**
+ *  Returns a pointer to the data of the field at `position` in the record
+ *  referenced by `view` and sets the referent of `len`, when not NULL, to
+ *  its length.  Returns NULL if `position` is not less than the number of
+ *  fields in the view's template.
+ *
+ *  The data is in network byte order and is in the length given by the
+ *  template, which may be a reduced-length encoding.  For variable-length
+ *  fields the length prefix is skipped, and for fields of type @ref
+ *  FB_BASIC_LIST, @ref FB_SUB_TMPL_LIST, and @ref FB_SUB_TMPL_MULTI_LIST the
+ *  data is the encoded list.
+ *
+ *  @param view      the record view to get the field from
+ *  @param position  the position of the field in the view's template
+ *  @param len       set to the length of the field's data
+ *  @return the field's data or NULL
+ *  @since libfixbuf 3.0.0
+ */
+const uint8_t *
+fbRecordViewGetFieldByPosition(
+    const fbRecordView_t  *view,
+    uint16_t               position,
+    size_t                *len);
+
 /**
  *  Releases all of the memory allocated during transcode of this record,
  *  freeing the list structures, recursively, allocated when fixbuf was
@@ -5524,6 +6139,24 @@ fbRecordFindValueForInfoElement(
     uint16_t               *position,
     uint16_t                skip);
 
+/**
+ *  Gets the Value of the Field that a field accessor finds in a Record.
+ *
+ *  This function is a convenience wrapper over fbFieldAccessorGetField() and
+ *  fbRecordGetValueForField().
+ *
+ *  @param record   The record to get the value from.
+ *  @param accessor The field accessor to use.
+ *  @param value    An output parameter to fill with the value.
+ *  @returns TRUE if the Template of `record` has the Field, FALSE otherwise
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbRecordGetValueForAccessor(
+    const fbRecord_t         *record,
+    const fbFieldAccessor_t  *accessor,
+    fbRecordValue_t          *value);
+
 /**
  *  Searches `record` for a basicList of `contentsElement` values.
  *
@@ -5704,6 +6337,16 @@ fbRecordFindAllSubRecords(
  *  between the lists as desired, including re-initializing the list if
  *  needed.
  *
+ *  The matching of fields is computed once for each pair of Templates and
+ *  cached on `tmpl`, so repeated copies between the same Templates do not
+ *  search either Template.  This modifies `tmpl` even though it is const:
+ *  when both Templates have been added to a session, the call may add a
+ *  cached plan to `tmpl` or reorder its cache.  The function must therefore
+ *  not be called with the same `tmpl` from several threads at once; this
+ *  includes the internal templates that the workers of an @ref
+ *  fbListenerPool_t share.  Templates that no session references are
+ *  never modified.
+ *
  *  @param srcRec  The Record to be copied.
  *  @param dstRec  The destination Record to copy `srcRec` into.
  *  @param tmpl    The Template for the destination Record.
@@ -5862,6 +6505,47 @@ fbSessionAddNewTemplateCallback(
     fbNewTemplateCallback_fn   callback,
     void                      *app_ctx);
 
+/**
+ *  Sets whether the external templates that a collector reads into
+ *  `session` are interned.  When enabled, a template that has the same
+ *  information model, scope count, and fields (PEN, ID, and length) as a
+ *  template already read by any interning session in the process is not
+ *  kept: the session references the existing, immutable template instead.
+ *  Collectors that receive byte-identical templates from many exporters then
+ *  hold one copy of each, and since transcoder plans and field offset caches
+ *  are keyed by template, a fBuf serving several sessions (such as a UDP
+ *  collector) shares those as well.  Interned templates are reference
+ *  counted and freed when the last session releases them.  They may be
+ *  shared by sessions used in different threads.
+ *
+ *  Templates are not interned while the session has a new template callback
+ *  (see fbSessionAddNewTemplateCallback()), since the callback may attach a
+ *  context to the template.  An application should not call
+ *  fbTemplateSetContext() on an interned template.
+ *
+ *  Disabled by default.  The setting is carried over to cloned sessions, so
+ *  call this before giving `session` to fbListenerAlloc().
+ *
+ *  @param session  The session to configure
+ *  @param intern   TRUE to intern external templates
+ *  @since libfixbuf 3.0.0
+ */
+void
+fbSessionSetInternTemplates(
+    fbSession_t  *session,
+    gboolean      intern);
+
+/**
+ *  Returns TRUE if the external templates read into `session` are interned.
+ *  See fbSessionSetInternTemplates().
+ *
+ *  @param session  The session to query
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbSessionGetInternTemplates(
+    const fbSession_t  *session);
+
 
 /**
  *  Arranges for templates read by `incomingSession` to be copied to
@@ -6271,6 +6955,148 @@ fbExporter_t *
 fbExporterAllocFile(
     const char  *path);
 
+/**
+ *  The signature of the sync policy of a file exporter; see
+ *  fbExporterSetFileSync().  The policy is called each time the exporter
+ *  hands data to the kernel, and returns TRUE to have fdatasync() called
+ *  on the file.
+ *
+ *  @param exporter         the exporting process endpoint.
+ *  @param unsynced_octets  octets written to the file since it was last
+ *                          synced or opened.
+ *  @param unsynced_ms      milliseconds since the file was last synced or
+ *                          opened.
+ *  @param ctx              the `ctx` given to fbExporterSetFileSync().
+ *  @return TRUE to sync the file now.
+ *  @since libfixbuf 3.0.0
+ */
+typedef gboolean (*fbExporterSyncPolicy_fn)(
+    fbExporter_t  *exporter,
+    uint64_t       unsynced_octets,
+    uint64_t       unsynced_ms,
+    void          *ctx);
+
+/**
+ *  The signature of a function called when a file exporter closes a
+ *  file, such as to move a finished file of a rotating exporter into an
+ *  archive; see fbExporterSetFileRotation().  All data has been written
+ *  (and synced, when the exporter has a sync policy) when it is called.
+ *
+ *  @param exporter  the exporting process endpoint.
+ *  @param path      the name of the file that was closed.
+ *  @param ctx       the `ctx` given to fbExporterSetFileRotation().
+ *  @since libfixbuf 3.0.0
+ */
+typedef void (*fbExporterFileClosed_fn)(
+    fbExporter_t  *exporter,
+    const char    *path,
+    void          *ctx);
+
+/**
+ *  Makes a file exporter collect messages in a write buffer of `bufsize`
+ *  octets and write the buffer to the file in one call each time it is
+ *  full, instead of writing each message through a stdio FILE.  The size
+ *  is rounded up to a multiple of 4096 octets and the buffer is aligned
+ *  to 4096, so every write but the last one of each file is a whole
+ *  number of aligned blocks.
+ *
+ *  When `direct` is TRUE, the file is opened with O_DIRECT (set
+ *  F_NOCACHE on platforms without it) so the written data does not fill
+ *  the page cache.  The file system must accept 4096-octet aligned
+ *  direct I/O.
+ *
+ *  Must be called before the first message is emitted or after the
+ *  exporter is closed.  Cannot be used together with fbExporterSetBatch()
+ *  or fbExporterStartAsync().
+ *
+ *  @param exporter  an exporter from fbExporterAllocFile() for a named
+ *                   file (not standard output).
+ *  @param bufsize   the write buffer size in octets, at most 1 GiB, or 0
+ *                   to write through stdio again.
+ *  @param direct    whether to bypass the page cache; requires a buffer.
+ *  @param err       an error description, set on failure.
+ *  @return TRUE on success.  FALSE if the exporter is not for a named
+ *          file, is open, is batched or asynchronous, or if direct I/O is
+ *          requested without a buffer or is not supported.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbExporterSetFileBuffer(
+    fbExporter_t  *exporter,
+    size_t         bufsize,
+    gboolean       direct,
+    GError       **err);
+
+/**
+ *  Sets the policy that decides when a file exporter calls fdatasync()
+ *  on its file.  Data in the write buffer of fbExporterSetFileBuffer()
+ *  has not reached the kernel and is not covered by a sync until the
+ *  buffer is written.  When a policy is set, each file is also synced
+ *  before it is closed.
+ *
+ *  Cannot be used together with fbExporterSetBatch() or
+ *  fbExporterStartAsync().
+ *
+ *  @param exporter  an exporter from fbExporterAllocFile() for a named
+ *                   file (not standard output).
+ *  @param policy    the sync policy, or NULL to never sync.
+ *  @param ctx       passed to `policy`.
+ *  @param err       an error description, set on failure.
+ *  @return TRUE on success.  FALSE if the exporter is not for a named
+ *          file, or is batched or asynchronous.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbExporterSetFileSync(
+    fbExporter_t             *exporter,
+    fbExporterSyncPolicy_fn   policy,
+    void                     *ctx,
+    GError                  **err);
+
+/**
+ *  Makes a file exporter start a new file when the current one holds at
+ *  least `max_octets` octets or was opened at least `max_seconds` ago.
+ *  The exporter's path is a strftime(3) pattern expanded with the UTC
+ *  time each new file is opened, such as "flows-%Y%m%d%H%M%S.ipfix".
+ *  When the expansion is the same as the previous file's, ".1", ".2", and
+ *  so on are appended.  Existing files are overwritten.
+ *
+ *  The limits are checked by fBufEmit() after each message is written,
+ *  so a file may exceed `max_octets` by up to one message and a file is
+ *  not closed while no messages are emitted.  After closing a file,
+ *  fBufEmit() exports the session's templates again with
+ *  fbSessionExportTemplates() and writes them to the new file in a
+ *  message of their own, so that each file can be read on its own.  The
+ *  file opened by the last fBufEmit() may therefore hold only templates.
+ *  `closed`, when not
+ *  NULL, is called after each file is closed, including when the
+ *  exporter is closed or freed.  As with any exporter that is reopened,
+ *  fbExporterGetOctetCount() restarts at 0 with each file.
+ *
+ *  Cannot be used together with fbExporterSetBatch() or
+ *  fbExporterStartAsync().
+ *
+ *  @param exporter     an exporter from fbExporterAllocFile() for a named
+ *                      file (not standard output).
+ *  @param max_octets   the size limit in octets, or 0 for no limit.
+ *  @param max_seconds  the age limit in seconds, or 0 for no limit.  When
+ *                      both limits are 0, the path is used as given.
+ *  @param closed       called after each file is closed, or NULL.
+ *  @param ctx          passed to `closed`.
+ *  @param err          an error description, set on failure.
+ *  @return TRUE on success.  FALSE if the exporter is not for a named
+ *          file, or is batched or asynchronous.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbExporterSetFileRotation(
+    fbExporter_t             *exporter,
+    uint64_t                  max_octets,
+    uint32_t                  max_seconds,
+    fbExporterFileClosed_fn   closed,
+    void                     *ctx,
+    GError                  **err);
+
 /**
  *  Allocates an exporting process to use the existing buffer `buf` having the
  *  specified size.  Each call to fBufEmit() copies data into `buf` starting
@@ -6338,6 +7164,7 @@ fbExporterAutoStream(
  *  Forces the file or socket underlying an exporting process endpoint to
  *  close.  No effect on open file endpoints. The file or socket may be
  *  reopened on a subsequent message emission from the associated buffer.
+ *  Messages queued by fbExporterSetBatch() are written first.
  *
  *  @param exporter  an exporting process endpoint.
  */
@@ -6345,6 +7172,227 @@ void
 fbExporterClose(
     fbExporter_t  *exporter);
 
+/**
+ *  Specifies what fBufEmit() does when the message ring of an exporter in
+ *  asynchronous mode is full.  See fbExporterStartAsync().
+ *
+ *  @since libfixbuf 3.0.0
+ */
+typedef enum fbExporterAsyncPolicy_en {
+    /** Waits for the export thread to free a slot.  This is the default. */
+    FB_EXPORTER_ASYNC_BLOCK = 0,
+    /** Discards the oldest message in the ring to make room. */
+    FB_EXPORTER_ASYNC_DROP_OLDEST,
+    /** Discards the message being emitted. */
+    FB_EXPORTER_ASYNC_DROP_NEWEST
+} fbExporterAsyncPolicy_t;
+
+/**
+ *  Counters of an exporter in asynchronous mode, filled by
+ *  fbExporterGetAsyncStats().  All counts are since
+ *  fbExporterStartAsync().
+ *
+ *  @since libfixbuf 3.0.0
+ */
+typedef struct fbExporterAsyncStats_st {
+    /** Messages added to the ring by fBufEmit() */
+    uint64_t   queued_msgs;
+    /** Octets added to the ring by fBufEmit() */
+    uint64_t   queued_octets;
+    /**
+     *  Messages discarded: by the full-ring policy, or by the export thread
+     *  after a write failure on a stream it cannot reopen or while stopping
+     */
+    uint64_t   dropped_msgs;
+    /** Octets in the messages counted by `dropped_msgs` */
+    uint64_t   dropped_octets;
+    /** Messages written by the export thread */
+    uint64_t   written_msgs;
+    /** Octets written by the export thread */
+    uint64_t   written_octets;
+    /** Times the export thread reopened the exporter after a failure */
+    uint64_t   reconnects;
+    /** Messages in the ring when the counters were read */
+    uint64_t   pending_msgs;
+} fbExporterAsyncStats_t;
+
+/**
+ *  Puts an exporting process endpoint in asynchronous mode.  A thread is
+ *  started that owns the exporter's file or socket: fBufEmit() copies each
+ *  finished message into a ring of `slots` messages and returns, and the
+ *  thread writes the messages in order.  When the ring is full, `policy`
+ *  decides whether fBufEmit() waits or a message is discarded.
+ *
+ *  When a write fails, the thread closes the exporter and reopens it,
+ *  waiting longer between each attempt, then writes the message again.
+ *  Templates are not resent on the new connection; an application using a
+ *  connection-oriented transport may watch the `reconnects` counter of
+ *  fbExporterGetAsyncStats() and call fbSessionExportTemplates().  Write
+ *  errors are not reported by fBufEmit(); the last one is returned by
+ *  fbExporterStopAsync().
+ *
+ *  While the thread runs, fbExporterGetOctetCount() counts the octets the
+ *  thread has written.  The ring takes `slots` buffers of the exporter's
+ *  MTU.  Not supported by exporters created with fbExporterAllocBuffer()
+ *  or together with fbExporterSetBatch().
+ *
+ *  @param exporter  an exporting process endpoint.
+ *  @param slots     number of messages the ring holds, 1 to 4096.
+ *  @param policy    what to do when the ring is full.
+ *  @param err       an error description, set on failure.
+ *  @return TRUE when the thread was started.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbExporterStartAsync(
+    fbExporter_t             *exporter,
+    unsigned int              slots,
+    fbExporterAsyncPolicy_t   policy,
+    GError                  **err);
+
+/**
+ *  Takes an exporting process endpoint out of asynchronous mode.  Waits
+ *  for the export thread to write the messages in the ring, giving up on
+ *  a message whose write fails, then stops the thread.  Called by
+ *  fbExporterClose() and when the exporter is freed.  Does nothing if the
+ *  exporter is not in asynchronous mode.
+ *
+ *  @param exporter  an exporting process endpoint.
+ *  @param err       an error description, set on failure.
+ *  @return TRUE on success, FALSE if the thread failed to write any
+ *          message; `err` then holds the last error it saw.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbExporterStopAsync(
+    fbExporter_t  *exporter,
+    GError       **err);
+
+/**
+ *  Fills `stats` with the counters of an exporter in asynchronous mode, or
+ *  with zeros if it is not in that mode.  May be called from any thread
+ *  while the exporter is in asynchronous mode.  Each counter is read
+ *  atomically without a lock, so the counters may not agree exactly with
+ *  one another.
+ *
+ *  @param exporter  an exporting process endpoint.
+ *  @param stats     the counters to fill.
+ *  @since libfixbuf 3.0.0
+ */
+void
+fbExporterGetAsyncStats(
+    const fbExporter_t      *exporter,
+    fbExporterAsyncStats_t  *stats);
+
+/**
+ *  Makes an exporting process endpoint queue messages and write several
+ *  at once.  With a `depth` larger than 1, each message emitted by
+ *  fBufEmit() is copied to a queue, and the queue is written when it
+ *  holds `depth` messages, using sendmmsg() for UDP where available and a
+ *  single write for TCP, TLS over TCP, and files.  When `max_latency_ms`
+ *  is not 0, the queue is also written by the first emit that finds its
+ *  oldest message has waited at least that long.  There is no timer: an application that
+ *  may go quiet should call fbExporterFlush() periodically.
+ *
+ *  Queued messages are written by fbExporterFlush(), by
+ *  fbExporterClose(), and when the exporter is freed.  They are not
+ *  included in fbExporterGetOctetCount() until they are written.
+ *
+ *  The queue holds `depth` messages of the exporter's MTU.  Calling this
+ *  function writes any queued messages before applying the new settings.
+ *
+ *  @param exporter        a UDP, TCP, TLS, or file exporting process
+ *                         endpoint.
+ *  @param depth           number of messages per write, 0 or 1 to write
+ *                         each message when it is emitted.  At most 1024.
+ *  @param max_latency_ms  longest time a message should wait in the queue,
+ *                         in milliseconds, or 0 for no limit.
+ *  @param err             an error description, set on failure.
+ *  @return TRUE on success.  FALSE if the exporter's transport does not
+ *          support batching, `depth` is out of range, or writing the
+ *          messages already queued fails.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbExporterSetBatch(
+    fbExporter_t  *exporter,
+    unsigned int   depth,
+    unsigned int   max_latency_ms,
+    GError       **err);
+
+/**
+ *  Writes the messages queued by an exporting process endpoint in batch
+ *  mode; see fbExporterSetBatch().  As with a failed fBufEmit(), the
+ *  exporter is closed if the write fails.  Does nothing when no messages
+ *  are queued.
+ *
+ *  @param exporter  an exporting process endpoint.
+ *  @param err       an error description, set on failure.
+ *  @return TRUE on success, FALSE if writing fails.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbExporterFlush(
+    fbExporter_t  *exporter,
+    GError       **err);
+
+/**
+ *  Stream compression methods for fbExporterSetCompression() and
+ *  fbCollectorGetCompression().
+ *
+ *  @since libfixbuf 3.0.0
+ */
+typedef enum fbCompressionMethod_en {
+    /** Messages are written as they are */
+    FB_COMPRESS_NONE = 0,
+    /** The LZ4 frame format, as written by `lz4(1)` */
+    FB_COMPRESS_LZ4,
+    /** The Zstandard frame format, as written by `zstd(1)` */
+    FB_COMPRESS_ZSTD
+} fbCompressionMethod_t;
+
+/**
+ *  Makes an exporting process endpoint compress the messages it writes.
+ *  The stream is a standard LZ4 or Zstandard frame, so an IPFIX file
+ *  written this way may also be decompressed with `lz4 -d` or `zstd -d`.
+ *  File and TCP collectors detect the compression when they start reading
+ *  and decompress it; see fbCollectorGetCompression().
+ *
+ *  A file exporter compresses messages into a 256 KiB buffer and writes
+ *  it when full.  A TCP exporter flushes the compressor after each
+ *  message, so the collector can decode every message as it arrives.
+ *  The frame is ended when the exporter is closed or rotates to a new
+ *  file (see fbExporterSetFileRotation()); a file that is not closed
+ *  cleanly is readable up to the last complete block.  When the exporter
+ *  reconnects, a new frame is started.
+ *
+ *  fbExporterGetOctetCount() counts the IPFIX octets before compression.
+ *  The limits of fbExporterSetFileRotation() apply to the compressed size
+ *  of each file, which grows in steps of up to 256 KiB.
+ *
+ *  Must be called before the first message is emitted or after the
+ *  exporter is closed.  Cannot be used together with fbExporterSetBatch();
+ *  with fbExporterStartAsync() the export thread does the compression.
+ *
+ *  @param exporter  a TCP or file exporting process endpoint.
+ *  @param method    the compression method, or FB_COMPRESS_NONE to stop
+ *                   compressing.  LZ4 requires libfixbuf to be built with
+ *                   `--with-lz4`, Zstandard with `--with-zstd`.
+ *  @param level     the compression level, or 0 for the method's default.
+ *                   For LZ4, levels 3 and above select LZ4-HC.
+ *  @param err       an error description, set on failure.
+ *  @return TRUE on success.  FALSE if the exporter's transport does not
+ *          support compression, it is open, batched, or asynchronous, or
+ *          `method` is not supported by this build.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbExporterSetCompression(
+    fbExporter_t           *exporter,
+    fbCompressionMethod_t   method,
+    int                     level,
+    GError                **err);
+
 /**
  *  Gets the (transcoded) message length that was copied to the exporting
  *  buffer upon fBufEmit() when using fbExporterAllocBuffer().
@@ -6397,6 +7445,23 @@ void
 fbExporterResetOctetCount(
     fbExporter_t  *exporter);
 
+/**
+ *  Fills `stats` with the counters of an exporting process endpoint: the
+ *  messages handed to it and the calls that wrote its file or socket.
+ *  Unlike fbExporterGetOctetCount(), the counters are not reset when a
+ *  file is rotated or the exporter is reopened.  In asynchronous mode the
+ *  write counters are updated by the export thread; each counter is read
+ *  atomically, but the counters may not agree exactly with one another.
+ *
+ *  @param exporter  an exporting process endpoint.
+ *  @param stats     the counters to fill.
+ *  @since libfixbuf 3.0.0
+ */
+void
+fbExporterGetStats(
+    const fbExporter_t  *exporter,
+    fbStats_t           *stats);
+
 /**
  *  Allocates a collecting process endpoint for a named file. The underlying
  *  file will be opened immediately.
@@ -6432,6 +7497,57 @@ fbCollectorAllocFP(
     void  *ctx,
     FILE  *fp);
 
+/**
+ *  Switches a collecting process endpoint created by fbCollectorAllocFile()
+ *  or fbCollectorAllocFP() to reading the rest of its file through a
+ *  private memory mapping, advised for sequential access.  A @ref fBuf_t
+ *  reading from a mapped collector decodes each message in place instead of
+ *  copying it into the buffer, so on-disk replay is limited mainly by memory
+ *  bandwidth.
+ *
+ *  Only regular files can be mapped.  For standard input, pipes, and other
+ *  streams this function fails and the collector keeps reading with stdio,
+ *  so callers may ignore the result when mapping is merely an optimization.
+ *  Setting a translator (fbCollectorSetNetflowV9Translator(),
+ *  fbCollectorSetSFlowTranslator()) returns the collector to stdio at the
+ *  current position.
+ *
+ *  The file must not be truncated while it is mapped.  When the collector
+ *  was created by fbCollectorAllocFP(), the position of `fp` is not
+ *  advanced by mapped reads.
+ *
+ *  @param collector a file collecting process endpoint.
+ *  @param err       An error description, set on failure.
+ *  @return TRUE if the collector's input is now mapped, FALSE if it could
+ *          not be mapped and the collector continues to use stdio.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbCollectorMapFile(
+    fbCollector_t  *collector,
+    GError        **err);
+
+/**
+ *  Returns the compression of the stream a collecting process endpoint
+ *  reads.  File and TCP collectors check the first octets of their stream
+ *  for an LZ4 or Zstandard frame, such as written by an exporter using
+ *  fbExporterSetCompression(), and decompress it as they read.  Several
+ *  frames in a row are read as one stream.  Compressed files cannot be
+ *  memory-mapped by fbCollectorMapFile().
+ *
+ *  When libfixbuf was built without support for the method, reading
+ *  fails with FB_ERROR_IMPL.  Translated streams (NetFlow V9, sFlow) are
+ *  not checked.
+ *
+ *  @param collector a collecting process endpoint.
+ *  @return the compression in use, or FB_COMPRESS_NONE if there is none
+ *          or nothing has been read yet.
+ *  @since libfixbuf 3.0.0
+ */
+fbCompressionMethod_t
+fbCollectorGetCompression(
+    const fbCollector_t  *collector);
+
 
 /**
  *  Retrieves the application context associated with a collector. This
@@ -6516,6 +7632,46 @@ fbListenerAlloc(
     fbListenerAppFree_fn   appfree,
     GError               **err);
 
+/**
+ *  Allocates `count` UDP listeners, or shards, all bound to the endpoint
+ *  in `spec` with SO_REUSEPORT, so the kernel spreads exporters across the
+ *  shards by address.  Each shard has its own collector, peer table and
+ *  @ref fBuf_t, as if created by fbListenerAlloc(), and may be waited on
+ *  by its own thread with fbListenerWait().  A given exporter's
+ *  datagrams normally reach the same shard as long as the set of shards
+ *  does not change.
+ *
+ *  Each shard uses the session at the same index of `sessions`.  These
+ *  must be distinct and must not share templates, since template
+ *  reference counts are not thread-safe.  In particular, the sessions
+ *  must not be clones of one another or of a common session made with
+ *  fbSessionClone(), which share their internal templates; allocate each
+ *  with fbSessionAlloc() and add its templates separately.  (External
+ *  templates interned with fbSessionSetInternTemplates() are the
+ *  exception.)  The sessions share the information model.
+ *
+ *  @param spec       a UDP or DTLS-over-UDP local endpoint to listen on
+ *  @param sessions   `count` sessions, one per shard
+ *  @param count      the number of shards; must be at least 1
+ *  @param appinit    application context initializer, as for
+ *                    fbListenerAlloc(), called by the shard's collector
+ *  @param appfree    application context free function
+ *  @param listeners  an array of `count` listeners, set on success
+ *  @param err        An error description, set on failure.  @ref
+ *                    FB_ERROR_IMPL if the platform lacks SO_REUSEPORT.
+ *  @return TRUE on success; FALSE after freeing any shards created.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbListenerAllocUDPShards(
+    const fbConnSpec_t    *spec,
+    fbSession_t          **sessions,
+    unsigned int           count,
+    fbListenerAppInit_fn   appinit,
+    fbListenerAppFree_fn   appfree,
+    fbListener_t         **listeners,
+    GError               **err);
+
 /**
  *  Frees a listener. Stops listening on the local endpoint, and frees any
  *  open buffers still managed by the listener.
@@ -6570,6 +7726,28 @@ fbListenerWaitNoCollectors(
     fbListener_t  *listener,
     GError       **err);
 
+/**
+ *  Sets whether connections the listener accepts from now on are watched
+ *  edge-triggered.  An edge-triggered connection is reported once each
+ *  time new data arrives, and fbListenerWait() keeps returning its buffer
+ *  until reading would block, rather than checking every connection on
+ *  each wait.  This requires the listener to wait with epoll (Linux) or
+ *  kqueue (BSD and macOS); otherwise enabling it fails with @ref
+ *  FB_ERROR_IMPL.  UDP sockets and passive sockets are always
+ *  level-triggered.
+ *
+ *  @param listener  a listener
+ *  @param edge      TRUE for edge-triggered, FALSE for level-triggered
+ *  @param err       An error description, set on failure.
+ *  @return TRUE on success, FALSE if edge-triggering is not available.
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbListenerSetEdgeTriggered(
+    fbListener_t  *listener,
+    gboolean       edge,
+    GError       **err);
+
 /**
  *  Causes the current or next call to fbListenerWait() to unblock and return.
  *  Use this from a thread or a signal handler to interrupt a blocked
@@ -6598,6 +7776,21 @@ fbListenerGetCollector(
     fbCollector_t      **collector,
     GError             **err);
 
+/**
+ *  Fills `stats` with the counters of a listener: the connections it
+ *  accepted and the time fbListenerWait() spent waiting for input.  The
+ *  counters of each connection are read from its collector with
+ *  fbCollectorGetStats().
+ *
+ *  @param listener  a listener.
+ *  @param stats     the counters to fill.
+ *  @since libfixbuf 3.0.0
+ */
+void
+fbListenerGetStats(
+    const fbListener_t  *listener,
+    fbStats_t           *stats);
+
 
 
 /**
@@ -6746,6 +7939,83 @@ fbCollectorSetUDPMultiSession(
     fbCollector_t  *collector,
     gboolean        multi_session);
 
+/**
+ *  Sets the number of datagrams a UDP @ref fbCollector_t reads from its
+ *  socket per system call.  The default, 1, reads one datagram per
+ *  recvfrom().  A larger `depth` makes the collector use
+ *  recvmmsg() to fill a ring of up to `depth` datagrams whenever the
+ *  socket becomes readable; fBufNextMessage() and fBufNext() are then
+ *  served from the ring until it is empty.  Each datagram keeps its own
+ *  peer address, so accept-only filtering and the UDP multi-session
+ *  mapping behave as they do without batching.
+ *
+ *  The ring holds `depth` buffers of the message buffer size, so memory
+ *  use grows linearly with `depth`.  The size may not be changed while
+ *  the ring holds unread datagrams.
+ *
+ *  Enabling batching also requests the socket's receive queue drop
+ *  counter (SO_RXQ_OVFL) where the platform supports it; see
+ *  fbCollectorGetUDPDrops().
+ *
+ *  @param collector a UDP collector, such as one returned by
+ *                   fbListenerGetCollector() for a UDP listener.
+ *  @param depth     number of datagrams per read, 0 or 1 to disable
+ *                   batching.  At most 1024.
+ *  @param err       an error description, set on failure.
+ *  @return TRUE on success.  FALSE if the collector is not a UDP
+ *          collector, `depth` is out of range, datagrams are pending,
+ *          or the platform lacks recvmmsg().
+ *  @since libfixbuf 3.0.0
+ */
+gboolean
+fbCollectorSetUDPBatchSize(
+    fbCollector_t  *collector,
+    unsigned int    depth,
+    GError        **err);
+
+/**
+ *  Returns the number of datagrams a UDP @ref fbCollector_t reads per
+ *  system call, as set by fbCollectorSetUDPBatchSize().
+ *
+ *  @param collector a UDP collector.
+ *  @return the batch depth, 1 when batching is disabled
+ *  @since libfixbuf 3.0.0
+ */
+unsigned int
+fbCollectorGetUDPBatchSize(
+    const fbCollector_t  *collector);
+
+/**
+ *  Returns the number of datagrams the kernel dropped because the
+ *  socket's receive queue of a UDP @ref fbCollector_t was full, as
+ *  reported by SO_RXQ_OVFL.  The value is a running total for the
+ *  socket and is updated only while batching is enabled with
+ *  fbCollectorSetUDPBatchSize(); it is always 0 on platforms without
+ *  SO_RXQ_OVFL.
+ *
+ *  @param collector a UDP collector.
+ *  @return the most recent socket drop count
+ *  @since libfixbuf 3.0.0
+ */
+uint32_t
+fbCollectorGetUDPDrops(
+    const fbCollector_t  *collector);
+
+/**
+ *  Fills `stats` with the counters of a @ref fbCollector_t: the messages
+ *  it returned, the calls that read its file or socket, and the time it
+ *  spent waiting for its socket to become readable.  A collector that
+ *  reads a mapped file makes no read calls.
+ *
+ *  @param collector a collector.
+ *  @param stats     the counters to fill.
+ *  @since libfixbuf 3.0.0
+ */
+void
+fbCollectorGetStats(
+    const fbCollector_t  *collector,
+    fbStats_t            *stats);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
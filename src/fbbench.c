@@ -0,0 +1,1608 @@
+/*
+ *  Copyright 2023 Carnegie Mellon University
+ *  See license information in LICENSE.txt.
+ */
+/**
+ *  @file fbbench.c
+ *  Throughput benchmarks for libfixbuf.
+ */
+/*
+ *  ------------------------------------------------------------------------
+ *  fbbench generates synthetic IPFIX records for a set of template mixes
+ *  and measures how quickly fixbuf encodes, decodes, writes, reads, sends,
+ *  and receives them, and how quickly the NetFlow v9 and sFlow translators
+ *  convert datagrams.  Each result is printed as a JSON object on its own
+ *  line so that runs may be compared across releases.  A UDP run that
+ *  loses records is marked with "valid":false and its rates are null.
+ *
+ *  The program is not built by default; use "make bench".
+ *  ------------------------------------------------------------------------
+ */
+
+#include <fixbuf/public.h>
+#include <pthread.h>
+#include <arpa/inet.h>
+
+/* Number of distinct records generated for each mix; the benchmarks cycle
+ * through these. */
+#define BM_POOL_SIZE            1024
+
+/* Number of records per call for the batch benchmarks. */
+#define BM_BATCH                64
+
+/* Template IDs of the synthetic templates. */
+#define BM_TID_FIXED            0x1000
+#define BM_TID_VARFIELD         0x1001
+#define BM_TID_DPI              0x1002
+#define BM_TID_DPI_TCP          0x1003
+#define BM_TID_DPI_HTTP         0x1004
+
+/* A UDP receiver is interrupted once no records have arrived for this
+ * long after the sender has finished, and a paced UDP sender stops
+ * waiting for a receiver that has made no progress for this long. */
+#define BM_UDP_IDLE_USEC        200000
+
+/* A UDP sender waits for the receiver while more than this many datagrams
+ * are in flight, so the loopback socket's default receive buffer does not
+ * overflow. */
+#define BM_UDP_WINDOW           32
+
+/* How often (in records) a UDP sender exporting a mix checks its window. */
+#define BM_UDP_PACE_RECORDS     16
+
+/* Records in each NetFlow v9 datagram, and how often (in datagrams) the
+ * template is repeated. */
+#define BM_V9_RECORDS           30
+#define BM_V9_TEMPLATE_EVERY    32
+
+/* Flow samples in each sFlow datagram. */
+#define BM_SFLOW_SAMPLES        10
+
+/* Size of the buffer used to build a datagram. */
+#define BM_DGRAM_MAX            2048
+
+/* String used in option descriptions when the text wraps multiple
+ * lines. */
+#define WRAP_STRING "\n                                  "
+
+
+/**
+ *  The record of the "fixed" mix: a flow record containing only
+ *  fixed-length elements.  It is also the first member of the records of
+ *  the other mixes.
+ */
+typedef struct bmFixedRec_st {
+    uint64_t   flowStartMilliseconds;
+    uint64_t   flowEndMilliseconds;
+    uint64_t   octetTotalCount;
+    uint64_t   packetTotalCount;
+    uint32_t   sourceIPv4Address;
+    uint32_t   destinationIPv4Address;
+    uint32_t   ingressInterface;
+    uint32_t   egressInterface;
+    uint16_t   sourceTransportPort;
+    uint16_t   destinationTransportPort;
+    uint16_t   vlanId;
+    uint16_t   tcpControlBits;
+    uint8_t    protocolIdentifier;
+    uint8_t    ipClassOfService;
+    uint8_t    flowEndReason;
+    uint8_t    flowDirection;
+    uint8_t    minimumTTL;
+    uint8_t    maximumTTL;
+    uint8_t    icmpTypeIPv4;
+    uint8_t    icmpCodeIPv4;
+} bmFixedRec_t;
+
+/**
+ *  The record of the "varfield" mix: the fixed record followed by several
+ *  variable-length strings and a payload.
+ */
+typedef struct bmVarfieldRec_st {
+    bmFixedRec_t   flow;
+    fbVarfield_t   applicationName;
+    fbVarfield_t   interfaceName;
+    fbVarfield_t   userName;
+    fbVarfield_t   httpRequestHost;
+    fbVarfield_t   httpRequestTarget;
+    fbVarfield_t   httpUserAgent;
+    fbVarfield_t   ipPayloadPacketSection;
+} bmVarfieldRec_t;
+
+/**
+ *  The record of the "dpi" mix, modeled on YAF: the fixed record followed
+ *  by a subTemplateMultiList holding a TCP entry and an HTTP entry whose
+ *  fields are basicLists of strings.
+ */
+typedef struct bmDpiRec_st {
+    bmFixedRec_t               flow;
+    fbSubTemplateMultiList_t   stml;
+} bmDpiRec_t;
+
+typedef struct bmDpiTcpRec_st {
+    uint32_t   tcpSequenceNumber;
+    uint32_t   reverseTcpSequenceNumber;
+    uint16_t   initialTcpControlBits;
+    uint16_t   reverseTcpControlBits;
+} bmDpiTcpRec_t;
+
+typedef struct bmDpiHttpRec_st {
+    fbBasicList_t   httpRequestMethod;
+    fbBasicList_t   httpRequestHost;
+    fbBasicList_t   httpRequestTarget;
+    fbBasicList_t   httpUserAgent;
+    fbBasicList_t   httpContentType;
+} bmDpiHttpRec_t;
+
+
+static fbInfoElementSpec_t bm_fixed_spec[] = {
+    {"flowStartMilliseconds",       8, 0 },
+    {"flowEndMilliseconds",         8, 0 },
+    {"octetTotalCount",             8, 0 },
+    {"packetTotalCount",            8, 0 },
+    {"sourceIPv4Address",           4, 0 },
+    {"destinationIPv4Address",      4, 0 },
+    {"ingressInterface",            4, 0 },
+    {"egressInterface",             4, 0 },
+    {"sourceTransportPort",         2, 0 },
+    {"destinationTransportPort",    2, 0 },
+    {"vlanId",                      2, 0 },
+    {"tcpControlBits",              2, 0 },
+    {"protocolIdentifier",          1, 0 },
+    {"ipClassOfService",            1, 0 },
+    {"flowEndReason",               1, 0 },
+    {"flowDirection",               1, 0 },
+    {"minimumTTL",                  1, 0 },
+    {"maximumTTL",                  1, 0 },
+    {"icmpTypeIPv4",                1, 0 },
+    {"icmpCodeIPv4",                1, 0 },
+    FB_IESPEC_NULL
+};
+
+static fbInfoElementSpec_t bm_varfield_spec[] = {
+    {"applicationName",             FB_IE_VARLEN, 0 },
+    {"interfaceName",               FB_IE_VARLEN, 0 },
+    {"userName",                    FB_IE_VARLEN, 0 },
+    {"httpRequestHost",             FB_IE_VARLEN, 0 },
+    {"httpRequestTarget",           FB_IE_VARLEN, 0 },
+    {"httpUserAgent",               FB_IE_VARLEN, 0 },
+    {"ipPayloadPacketSection",      FB_IE_VARLEN, 0 },
+    FB_IESPEC_NULL
+};
+
+static fbInfoElementSpec_t bm_dpi_spec[] = {
+    {"subTemplateMultiList",        FB_IE_VARLEN, 0 },
+    FB_IESPEC_NULL
+};
+
+static fbInfoElementSpec_t bm_dpi_tcp_spec[] = {
+    {"tcpSequenceNumber",           4, 0 },
+    {"reverseTcpSequenceNumber",    4, 0 },
+    {"tcpControlBits",              2, 0 },
+    {"reverseTcpControlBits",       2, 0 },
+    FB_IESPEC_NULL
+};
+
+static fbInfoElementSpec_t bm_dpi_http_spec[] = {
+    {"basicList",                   FB_IE_VARLEN, 0 },
+    {"basicList",                   FB_IE_VARLEN, 0 },
+    {"basicList",                   FB_IE_VARLEN, 0 },
+    {"basicList",                   FB_IE_VARLEN, 0 },
+    {"basicList",                   FB_IE_VARLEN, 0 },
+    FB_IESPEC_NULL
+};
+
+
+/* Values for the strings of the varfield and dpi mixes. */
+static const char *bm_app_names[] = {
+    "http", "https", "dns", "smtp", "imap", "ssh", "ntp", "quic"
+};
+static const char *bm_if_names[] = {
+    "eth0", "eth1", "bond0", "xe-0/0/1.0", "GigabitEthernet0/0/3"
+};
+static const char *bm_user_names[] = {
+    "", "alice", "bob", "svc-backup", "administrator@example.org"
+};
+static const char *bm_hosts[] = {
+    "www.example.com", "cdn.example.net", "api.example.org",
+    "updates.vendor.example", "images.static.example.com",
+    "a1b2c3d4e5.cloudfront.example"
+};
+static const char *bm_targets[] = {
+    "/", "/index.html", "/favicon.ico", "/api/v2/session?id=8f14e45fceea167a",
+    "/static/js/app.4f2a9c.min.js",
+    "/search?q=ipfix+collector+performance&source=hp&ei=Zk9vCgAAAA"
+};
+static const char *bm_agents[] = {
+    "curl/8.4.0",
+    "Mozilla/5.0 (X11; Linux x86_64; rv:118.0) Gecko/20100101 Firefox/118.0",
+    "Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 "
+    "(KHTML, like Gecko) Chrome/117.0.0.0 Safari/537.36",
+    "Microsoft-CryptoAPI/10.0"
+};
+static const char *bm_methods[] = {
+    "GET", "GET", "GET", "POST", "HEAD"
+};
+static const char *bm_ctypes[] = {
+    "text/html; charset=UTF-8", "application/json", "image/png",
+    "application/javascript"
+};
+
+
+/**
+ *  A template mix: the records of one of the synthetic templates.
+ */
+typedef struct bmMix_st {
+    const char  *name;
+    uint16_t     tid;
+    size_t       recsize;
+    /* BM_POOL_SIZE records of `recsize` octets */
+    uint8_t     *pool;
+    /* a file holding `records` records of this mix, written by the
+     * file-write benchmark */
+    gchar       *path;
+    uint64_t     path_octets;
+} bmMix_t;
+
+/**
+ *  The measurements of one benchmark.
+ */
+typedef struct bmResult_st {
+    uint64_t   records;
+    uint64_t   octets;
+    gint64     usec;
+    /* records sent but never received, for UDP */
+    uint64_t   lost;
+} bmResult_t;
+
+/**
+ *  The state shared by a receiving benchmark on the main thread and the
+ *  thread that sends to it.
+ */
+typedef struct bmPeer_st {
+    pthread_t       thread;
+    fbConnSpec_t    spec;
+    /* the mix being sent, or NULL when sending raw datagrams */
+    bmMix_t        *mix;
+    /* for raw datagrams, the function that builds datagram `seq` into
+     * `buf` and returns its length and the number of records in it */
+    size_t        (*build)(
+        uint8_t   *buf,
+        uint32_t   seq,
+        uint32_t  *records);
+    uint32_t        dgram_count;
+    /* records sent that the receiver never returns */
+    uint32_t        unreturned;
+    /* set by the sender */
+    uint64_t        sent;
+    uint64_t        octets;
+    /* the receiver, which the sender interrupts when a UDP transfer has
+     * stalled */
+    fbListener_t   *listener;
+    fBuf_t         *fbuf;
+    gint            received;
+    gint            done;
+} bmPeer_t;
+
+
+static fbInfoModel_t  *model = NULL;
+static fbSession_t    *pool_session = NULL;
+static FILE           *outfile = NULL;
+static uint64_t        rng_state = 0x2431e60f2431e60fULL;
+
+static int             opt_records = 1000000;
+static gchar          *opt_mixes = NULL;
+static gchar          *opt_benchmarks = NULL;
+static gchar          *opt_port = NULL;
+static gchar          *opt_output = NULL;
+
+static gchar         **mix_list = NULL;
+static gchar         **bench_list = NULL;
+static int             next_port = 0;
+
+static GOptionEntry    bm_options[] = {
+    {"records", 'n', 0, G_OPTION_ARG_INT, &opt_records,
+     "Process this many records per benchmark [1000000]", "count"},
+    {"mix", 'm', 0, G_OPTION_ARG_STRING, &opt_mixes,
+     ("Run only the template mixes in this comma-" WRAP_STRING
+      "separated list [fixed,varfield,dpi]"), "list"},
+    {"benchmarks", 'b', 0, G_OPTION_ARG_STRING, &opt_benchmarks,
+     ("Run only the benchmarks in this comma-" WRAP_STRING
+      "separated list [all]"), "list"},
+    {"port", 'p', 0, G_OPTION_ARG_STRING, &opt_port,
+     ("Use loopback ports starting at this one for" WRAP_STRING
+      "the network benchmarks [18600]"), "port"},
+    {"output", 'o', 0, G_OPTION_ARG_STRING, &opt_output,
+     "Write the results to this file [-]", "path"},
+    { NULL, 0, 0, G_OPTION_ARG_NONE, NULL, NULL, NULL }
+};
+
+/* Names of the benchmarks that are run for each mix, in order. */
+static const char *bm_mix_benchmarks[] = {
+    "encode", "encode-batch", "file-write", "decode", "decode-batch",
+    "file-read", "file-mmap", "tcp", "udp", NULL
+};
+
+/* Names of the translation benchmarks, which are run once. */
+static const char *bm_translate_benchmarks[] = {
+    "netflow-v9", "sflow", NULL
+};
+
+
+/**
+ *    Prints `err` and exits.
+ */
+static void
+bmFatal(
+    const char  *what,
+    GError      *err)
+{
+    fprintf(stderr, "%s: %s: %s\n", g_get_prgname(), what,
+            err ? err->message : strerror(errno));
+    exit(1);
+}
+
+
+/**
+ *    Returns the next value of a xorshift generator, so that every run
+ *    produces the same records.
+ */
+static uint64_t
+bmRandom(
+    void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+#define BM_PICK(array)  ((array)[bmRandom() % G_N_ELEMENTS(array)])
+
+
+/**
+ *    Sets `vf` to the string `str`.
+ */
+static void
+bmSetString(
+    fbVarfield_t  *vf,
+    const char    *str)
+{
+    vf->buf = (uint8_t *)str;
+    vf->len = strlen(str);
+}
+
+
+/**
+ *    Returns TRUE if `name` appears in `list` or `list` is NULL.
+ */
+static gboolean
+bmSelected(
+    gchar      **list,
+    const char  *name)
+{
+    unsigned int i;
+
+    if (NULL == list) {
+        return TRUE;
+    }
+    for (i = 0; list[i]; ++i) {
+        if (0 == strcmp(list[i], name)) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+
+/**
+ *    Returns the port to use for the next network benchmark.
+ */
+static const char *
+bmNextPort(
+    void)
+{
+    static char port[16];
+
+    snprintf(port, sizeof(port), "%d", next_port++);
+    return port;
+}
+
+
+/**
+ *    Writes the result of benchmark `name` for `mix` to the output.  A run
+ *    that lost records is not a valid measurement: it is marked invalid,
+ *    its rates are null, and a warning is printed.
+ */
+static void
+bmReport(
+    const char        *name,
+    const char        *mix,
+    const bmResult_t  *res)
+{
+    double sec = (double)res->usec / 1e6;
+    char   rates[128];
+
+    if (sec <= 0) {
+        sec = 1e-6;
+    }
+    if (res->lost) {
+        fprintf(stderr, "%s: Warning: %s benchmark of %s lost %" PRIu64
+                " of %" PRIu64 " records; its rates are not reported\n",
+                g_get_prgname(), name, mix, res->lost,
+                res->records + res->lost);
+        snprintf(rates, sizeof(rates),
+                 "\"records_per_sec\":null,\"octets_per_sec\":null");
+    } else {
+        snprintf(rates, sizeof(rates),
+                 "\"records_per_sec\":%.0f,\"octets_per_sec\":%.0f",
+                 (double)res->records / sec, (double)res->octets / sec);
+    }
+    fprintf(outfile,
+            "{\"benchmark\":\"%s\",\"mix\":\"%s\",\"libfixbuf\":\"%d.%d.%d\","
+            "\"records\":%" PRIu64 ",\"octets\":%" PRIu64
+            ",\"lost\":%" PRIu64 ",\"valid\":%s,\"seconds\":%.6f,%s}\n",
+            name, mix, FIXBUF_VERSION_MAJOR, FIXBUF_VERSION_MINOR,
+            FIXBUF_VERSION_RELEASE, res->records, res->octets, res->lost,
+            (res->lost ? "false" : "true"), sec, rates);
+    fflush(outfile);
+}
+
+
+/**
+ *    Creates the synthetic templates and adds them to `session`, as
+ *    internal and external templates when `for_export` is TRUE and as
+ *    internal templates otherwise.
+ */
+static void
+bmAddTemplates(
+    fbSession_t  *session,
+    gboolean      for_export)
+{
+    struct {
+        uint16_t              tid;
+        fbInfoElementSpec_t  *spec1;
+        fbInfoElementSpec_t  *spec2;
+    } tmpls[] = {
+        {BM_TID_FIXED,    bm_fixed_spec,    NULL},
+        {BM_TID_VARFIELD, bm_fixed_spec,    bm_varfield_spec},
+        {BM_TID_DPI,      bm_fixed_spec,    bm_dpi_spec},
+        {BM_TID_DPI_TCP,  bm_dpi_tcp_spec,  NULL},
+        {BM_TID_DPI_HTTP, bm_dpi_http_spec, NULL}
+    };
+    fbTemplate_t *tmpl;
+    GError       *err = NULL;
+    unsigned int  i;
+
+    for (i = 0; i < G_N_ELEMENTS(tmpls); ++i) {
+        tmpl = fbTemplateAlloc(model);
+        if (!fbTemplateAppendSpecArray(tmpl, tmpls[i].spec1, ~0, &err) ||
+            (tmpls[i].spec2 &&
+             !fbTemplateAppendSpecArray(tmpl, tmpls[i].spec2, ~0, &err)))
+        {
+            bmFatal("Cannot create template", err);
+        }
+        if (for_export) {
+            if (!fbSessionAddTemplatesForExport(session, tmpls[i].tid, tmpl,
+                                                NULL, &err))
+            {
+                bmFatal("Cannot add template", err);
+            }
+        } else if (!fbSessionAddTemplate(session, TRUE, tmpls[i].tid, tmpl,
+                                         NULL, &err))
+        {
+            bmFatal("Cannot add template", err);
+        }
+    }
+}
+
+
+/**
+ *    Fills `rec` with a random flow.
+ */
+static void
+bmFillFixed(
+    bmFixedRec_t  *rec)
+{
+    uint64_t r = bmRandom();
+
+    rec->flowStartMilliseconds = UINT64_C(1696000000000) + (r >> 40);
+    rec->flowEndMilliseconds = rec->flowStartMilliseconds + (r & 0xffff);
+    rec->packetTotalCount = 1 + (bmRandom() & 0x3ff);
+    rec->octetTotalCount = rec->packetTotalCount * (40 + (r & 0x5ff));
+    r = bmRandom();
+    rec->sourceIPv4Address = 0x0a000000 | (uint32_t)(r & 0xffffff);
+    rec->destinationIPv4Address = (uint32_t)(r >> 32);
+    rec->ingressInterface = (r >> 24) & 0xf;
+    rec->egressInterface = (r >> 28) & 0xf;
+    r = bmRandom();
+    rec->sourceTransportPort = (uint16_t)(1024 + (r & 0x7fff));
+    rec->destinationTransportPort = (r & 0x10000) ? 443 : 80;
+    rec->vlanId = (r >> 20) & 0xfff;
+    rec->tcpControlBits = (r >> 32) & 0x3f;
+    rec->protocolIdentifier = (r & 0x300000000000ULL) ? 6 : 17;
+    rec->ipClassOfService = (r >> 48) & 0xfc;
+    rec->flowEndReason = 1 + ((r >> 56) & 0x3);
+    rec->flowDirection = (r >> 58) & 0x1;
+    rec->minimumTTL = 32 + ((r >> 59) & 0x1f);
+    rec->maximumTTL = rec->minimumTTL + 1;
+}
+
+
+/**
+ *    Fills the basicList `bl` with between 1 and 3 strings of the element
+ *    `name` chosen from `values`.
+ */
+static void
+bmFillBasicList(
+    fbBasicList_t  *bl,
+    const char     *name,
+    const char    **values,
+    size_t          nvalues)
+{
+    fbVarfield_t *vf;
+    uint16_t      count = 1 + bmRandom() % 3;
+    uint16_t      i;
+
+    vf = (fbVarfield_t *)fbBasicListInit(
+        bl, FB_LIST_SEM_UNDEFINED, fbInfoModelGetElementByName(model, name),
+        count);
+    for (i = 0; i < count; ++i) {
+        bmSetString(&vf[i], values[bmRandom() % nvalues]);
+    }
+}
+
+
+/**
+ *    Generates the pool of records of `mix`.
+ */
+static void
+bmMixInit(
+    bmMix_t  *mix)
+{
+    unsigned int i;
+
+    mix->pool = g_malloc0(BM_POOL_SIZE * mix->recsize);
+    for (i = 0; i < BM_POOL_SIZE; ++i) {
+        uint8_t *rec = mix->pool + i * mix->recsize;
+        bmFillFixed((bmFixedRec_t *)rec);
+
+        if (BM_TID_VARFIELD == mix->tid) {
+            bmVarfieldRec_t *vr = (bmVarfieldRec_t *)rec;
+            static uint8_t   payload[512];
+            unsigned int     j;
+
+            if (0 == payload[0]) {
+                for (j = 0; j < sizeof(payload); ++j) {
+                    payload[j] = (uint8_t)(bmRandom() | 1);
+                }
+            }
+            bmSetString(&vr->applicationName, BM_PICK(bm_app_names));
+            bmSetString(&vr->interfaceName, BM_PICK(bm_if_names));
+            bmSetString(&vr->userName, BM_PICK(bm_user_names));
+            bmSetString(&vr->httpRequestHost, BM_PICK(bm_hosts));
+            bmSetString(&vr->httpRequestTarget, BM_PICK(bm_targets));
+            bmSetString(&vr->httpUserAgent, BM_PICK(bm_agents));
+            vr->ipPayloadPacketSection.buf = payload;
+            vr->ipPayloadPacketSection.len = bmRandom() % sizeof(payload);
+
+        } else if (BM_TID_DPI == mix->tid) {
+            bmDpiRec_t                    *dr = (bmDpiRec_t *)rec;
+            fbSubTemplateMultiListEntry_t *entry;
+            bmDpiTcpRec_t                 *tcp;
+            bmDpiHttpRec_t                *http;
+
+            entry = fbSubTemplateMultiListInit(&dr->stml,
+                                               FB_LIST_SEM_ALL_OF, 2);
+            tcp = (bmDpiTcpRec_t *)fbSubTemplateMultiListEntryInit(
+                entry, BM_TID_DPI_TCP,
+                fbSessionGetTemplate(pool_session, TRUE, BM_TID_DPI_TCP, NULL),
+                1);
+            tcp->tcpSequenceNumber = (uint32_t)bmRandom();
+            tcp->reverseTcpSequenceNumber = (uint32_t)bmRandom();
+            tcp->initialTcpControlBits = 0x02;
+            tcp->reverseTcpControlBits = 0x12;
+
+            entry = fbSubTemplateMultiListGetNextEntry(&dr->stml, entry);
+            http = (bmDpiHttpRec_t *)fbSubTemplateMultiListEntryInit(
+                entry, BM_TID_DPI_HTTP,
+                fbSessionGetTemplate(pool_session, TRUE, BM_TID_DPI_HTTP,
+                                     NULL),
+                1);
+            bmFillBasicList(&http->httpRequestMethod, "httpRequestMethod",
+                            bm_methods, G_N_ELEMENTS(bm_methods));
+            bmFillBasicList(&http->httpRequestHost, "httpRequestHost",
+                            bm_hosts, G_N_ELEMENTS(bm_hosts));
+            bmFillBasicList(&http->httpRequestTarget, "httpRequestTarget",
+                            bm_targets, G_N_ELEMENTS(bm_targets));
+            bmFillBasicList(&http->httpUserAgent, "httpUserAgent",
+                            bm_agents, G_N_ELEMENTS(bm_agents));
+            bmFillBasicList(&http->httpContentType, "httpContentType",
+                            bm_ctypes, G_N_ELEMENTS(bm_ctypes));
+        }
+    }
+}
+
+
+/**
+ *    Frees the pool and the file of `mix`.
+ */
+static void
+bmMixFree(
+    bmMix_t  *mix)
+{
+    const fbTemplate_t *tmpl;
+    unsigned int        i;
+
+    tmpl = fbSessionGetTemplate(pool_session, TRUE, mix->tid, NULL);
+    for (i = 0; i < BM_POOL_SIZE; ++i) {
+        fBufListFree(tmpl, mix->pool + i * mix->recsize);
+    }
+    g_free(mix->pool);
+    if (mix->path) {
+        g_unlink(mix->path);
+        g_free(mix->path);
+    }
+}
+
+
+/**
+ *    Waits until the receiver of `peer` has returned `target` records, or
+ *    until it has made no progress for BM_UDP_IDLE_USEC because a datagram
+ *    was lost.
+ */
+static void
+bmPeerWait(
+    bmPeer_t  *peer,
+    uint64_t   target)
+{
+    gint64 since = g_get_monotonic_time();
+    gint   prev = g_atomic_int_get(&peer->received);
+    gint   cur;
+
+    while ((uint64_t)(cur = g_atomic_int_get(&peer->received)) < target) {
+        if (cur != prev) {
+            prev = cur;
+            since = g_get_monotonic_time();
+        } else if (g_get_monotonic_time() - since > BM_UDP_IDLE_USEC) {
+            return;
+        }
+        g_thread_yield();
+    }
+}
+
+
+/**
+ *    Appends `opt_records` records of `mix` to `fbuf` and emits the last
+ *    message, one record per call or BM_BATCH per call.  When `peer` is
+ *    not NULL, `fbuf` exports over UDP and the sender keeps at most
+ *    BM_UDP_WINDOW messages in flight, estimating the records in each
+ *    message from those emitted so far.
+ */
+static void
+bmAppend(
+    fBuf_t    *fbuf,
+    bmMix_t   *mix,
+    gboolean   batch,
+    bmPeer_t  *peer)
+{
+    fbStats_t stats;
+    uint64_t window;
+    GError  *err = NULL;
+    uint64_t total = opt_records;
+    uint64_t i;
+    size_t   pos;
+    size_t   n;
+
+    if (!fBufSetTemplatesForExport(fbuf, mix->tid, &err)) {
+        bmFatal("Cannot set templates", err);
+    }
+    for (i = 0; i < total; i += n) {
+        pos = i % BM_POOL_SIZE;
+        if (batch) {
+            n = MIN(BM_BATCH, MIN(BM_POOL_SIZE - pos, total - i));
+            if (!fBufAppendBatch(fbuf, mix->pool + pos * mix->recsize,
+                                 mix->recsize, n, &err))
+            {
+                bmFatal("Cannot append records", err);
+            }
+        } else {
+            n = 1;
+            if (!fBufAppend(fbuf, mix->pool + pos * mix->recsize,
+                            mix->recsize, &err))
+            {
+                bmFatal("Cannot append record", err);
+            }
+        }
+        if (peer && 0 == (i + n) % BM_UDP_PACE_RECORDS) {
+            fbExporterGetStats(fBufGetExporter(fbuf), &stats);
+            if (stats.messages) {
+                window = (i + n) * BM_UDP_WINDOW / stats.messages;
+                if (i + n > window) {
+                    bmPeerWait(peer, i + n - window);
+                }
+            }
+        }
+    }
+    if (!fBufEmit(fbuf, &err)) {
+        bmFatal("Cannot emit message", err);
+    }
+}
+
+
+/**
+ *    Reads the records of `mix` from `fbuf` until the end of its input,
+ *    using fBufNext() or fBufNextBatch().  When `peer` is not NULL, the
+ *    input is a UDP socket: the count is published to the sender, the read
+ *    stops once `expected` records have arrived, and `last` is set to the
+ *    time of the final record.  Returns the number of records read.
+ */
+static uint64_t
+bmCollect(
+    fBuf_t    *fbuf,
+    bmMix_t   *mix,
+    gboolean   batch,
+    bmPeer_t  *peer,
+    uint64_t   expected,
+    gint64    *last)
+{
+    const fbTemplate_t *tmpl;
+    GError             *err = NULL;
+    uint64_t            count = 0;
+    uint8_t            *recs;
+    size_t              len;
+    size_t              n;
+    size_t              i;
+    gboolean            rc;
+
+    tmpl = fbSessionGetTemplate(fBufGetSession(fbuf), TRUE, mix->tid, NULL);
+    if (!fBufSetInternalTemplate(fbuf, mix->tid, &err)) {
+        bmFatal("Cannot set internal template", err);
+    }
+    recs = g_malloc0(BM_BATCH * mix->recsize);
+
+    for (;;) {
+        if (batch) {
+            rc = fBufNextBatch(fbuf, recs, mix->recsize, BM_BATCH, &n, &err);
+        } else {
+            len = mix->recsize;
+            n = 1;
+            rc = fBufNext(fbuf, recs, &len, &err);
+        }
+        if (!rc) {
+            if (g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_EOM) ||
+                (peer && !g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_IO)))
+            {
+                g_clear_error(&err);
+                continue;
+            }
+            if (!g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_EOF) &&
+                !g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_BUFSZ) &&
+                !peer)
+            {
+                bmFatal("Cannot read record", err);
+            }
+            g_clear_error(&err);
+            break;
+        }
+        if (BM_TID_DPI == mix->tid) {
+            for (i = 0; i < n; ++i) {
+                fBufListFree(tmpl, recs + i * mix->recsize);
+            }
+        }
+        count += n;
+        if (peer) {
+            *last = g_get_monotonic_time();
+            g_atomic_int_set(&peer->received, (gint)count);
+            if (count >= expected) {
+                break;
+            }
+        }
+    }
+
+    g_free(recs);
+    return count;
+}
+
+
+/**
+ *    Reads records of any template from `fbuf`, which is fed by a
+ *    translator, adding each new template as an internal template.  See
+ *    bmCollect() for `peer`, `expected`, and `last`.
+ */
+static uint64_t
+bmCollectAny(
+    fBuf_t    *fbuf,
+    bmPeer_t  *peer,
+    uint64_t   expected,
+    gint64    *last)
+{
+    fbRecord_t record = FB_RECORD_INIT;
+    GError    *err = NULL;
+    uint64_t   count = 0;
+    size_t     len;
+
+    record.reccapacity = 1024;
+    record.rec = g_malloc(record.reccapacity);
+
+    while (count < expected) {
+        record.tmpl = fBufNextCollectionTemplate(fbuf, &record.tid, &err);
+        if (record.tmpl) {
+            len = fbTemplateGetIELenOfMemBuffer(record.tmpl);
+            if (len > record.reccapacity) {
+                record.reccapacity = len;
+                record.rec = g_realloc(record.rec, len);
+            }
+            if (fBufNextRecord(fbuf, &record, &err)) {
+                fbRecordFreeLists(&record);
+                ++count;
+                *last = g_get_monotonic_time();
+                g_atomic_int_set(&peer->received, (gint)count);
+                continue;
+            }
+        }
+        if (g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_IO)) {
+            g_clear_error(&err);
+            break;
+        }
+        g_clear_error(&err);
+    }
+
+    g_free(record.rec);
+    return count;
+}
+
+
+/**
+ *    Callback that adds each template a translated stream defines as an
+ *    internal template, so bmCollectAny() can read its records.
+ */
+static void
+bmTemplateCallback(
+    fbSession_t           *session,
+    uint16_t               tid,
+    fbTemplate_t          *tmpl,
+    void                  *app_ctx,
+    void                 **tmpl_ctx,
+    fbTemplateCtxFree_fn  *tmpl_ctx_free_fn)
+{
+    (void)app_ctx;
+    (void)tmpl_ctx;
+    (void)tmpl_ctx_free_fn;
+
+    fbSessionAddTemplate(session, TRUE, tid, tmpl, NULL, NULL);
+}
+
+
+/**
+ *    Benchmarks encoding: appends the records of `mix` to an exporter that
+ *    writes to /dev/null.
+ */
+static void
+bmEncode(
+    bmMix_t     *mix,
+    gboolean     batch,
+    bmResult_t  *res)
+{
+    fbExporter_t *exporter;
+    fbSession_t  *session;
+    fBuf_t       *fbuf;
+    FILE         *fp;
+    gint64        start;
+
+    fp = fopen("/dev/null", "wb");
+    if (NULL == fp) {
+        bmFatal("Cannot open /dev/null", NULL);
+    }
+    exporter = fbExporterAllocFP(fp);
+    session = fbSessionAlloc(model);
+    fbuf = fBufAllocForExport(session, exporter);
+    bmAddTemplates(session, TRUE);
+
+    start = g_get_monotonic_time();
+    bmAppend(fbuf, mix, batch, NULL);
+    res->usec = g_get_monotonic_time() - start;
+    res->records = opt_records;
+    res->octets = fbExporterGetOctetCount(exporter);
+
+    fBufFree(fbuf);
+    fclose(fp);
+}
+
+
+/**
+ *    Benchmarks file export: writes the records of `mix` to a temporary
+ *    file, which the decode and file-read benchmarks then read.
+ */
+static void
+bmFileWrite(
+    bmMix_t     *mix,
+    bmResult_t  *res)
+{
+    fbExporter_t *exporter;
+    fbSession_t  *session;
+    fBuf_t       *fbuf;
+    GError       *err = NULL;
+    gint64        start;
+    int           fd;
+
+    fd = g_file_open_tmp("fbbench-XXXXXX.ipfix", &mix->path, &err);
+    if (fd < 0) {
+        bmFatal("Cannot create temporary file", err);
+    }
+    close(fd);
+
+    exporter = fbExporterAllocFile(mix->path);
+    session = fbSessionAlloc(model);
+    fbuf = fBufAllocForExport(session, exporter);
+    bmAddTemplates(session, TRUE);
+
+    start = g_get_monotonic_time();
+    bmAppend(fbuf, mix, FALSE, NULL);
+    fbExporterClose(exporter);
+    res->usec = g_get_monotonic_time() - start;
+    res->records = opt_records;
+    res->octets = mix->path_octets = fbExporterGetOctetCount(exporter);
+
+    fBufFree(fbuf);
+}
+
+
+/**
+ *    Benchmarks decoding: reads the records of `mix` from an in-memory copy
+ *    of its file.
+ */
+static void
+bmDecode(
+    bmMix_t     *mix,
+    gboolean     batch,
+    bmResult_t  *res)
+{
+    fbSession_t *session;
+    fBuf_t      *fbuf;
+    GError      *err = NULL;
+    gchar       *contents;
+    gsize        len;
+    gint64       start;
+
+    if (!g_file_get_contents(mix->path, &contents, &len, &err)) {
+        bmFatal("Cannot read file", err);
+    }
+    session = fbSessionAlloc(model);
+    bmAddTemplates(session, FALSE);
+    fbuf = fBufAllocForCollection(session, NULL);
+    fBufSetBuffer(fbuf, (uint8_t *)contents, len);
+
+    start = g_get_monotonic_time();
+    res->records = bmCollect(fbuf, mix, batch, NULL, 0, NULL);
+    res->usec = g_get_monotonic_time() - start;
+    res->octets = len;
+
+    fBufFree(fbuf);
+    g_free(contents);
+}
+
+
+/**
+ *    Benchmarks file collection: reads the records of `mix` from its file
+ *    using stdio, or mapped into memory when `mapped` is TRUE.
+ */
+static void
+bmFileRead(
+    bmMix_t     *mix,
+    gboolean     mapped,
+    bmResult_t  *res)
+{
+    fbCollector_t *collector;
+    fbSession_t   *session;
+    fBuf_t        *fbuf;
+    GError        *err = NULL;
+    gint64         start;
+
+    start = g_get_monotonic_time();
+    collector = fbCollectorAllocFile(NULL, mix->path, &err);
+    if (NULL == collector) {
+        bmFatal("Cannot open file", err);
+    }
+    if (mapped && !fbCollectorMapFile(collector, &err)) {
+        bmFatal("Cannot map file", err);
+    }
+    session = fbSessionAlloc(model);
+    bmAddTemplates(session, FALSE);
+    fbuf = fBufAllocForCollection(session, collector);
+
+    res->records = bmCollect(fbuf, mix, FALSE, NULL, 0, NULL);
+    res->usec = g_get_monotonic_time() - start;
+    res->octets = mix->path_octets;
+
+    fBufFree(fbuf);
+}
+
+
+/**
+ *    The thread that sends to a network benchmark: either exports the
+ *    records of a mix through an fBuf or sends raw datagrams built by
+ *    `build`.  For UDP, waits for the receiver to stall and interrupts it.
+ */
+static void *
+bmSenderMain(
+    void  *arg)
+{
+    bmPeer_t     *peer = (bmPeer_t *)arg;
+    fbExporter_t *exporter;
+    fbSession_t  *session;
+    fBuf_t       *fbuf;
+    gint          prev;
+    gint          cur;
+
+    if (peer->mix) {
+        exporter = fbExporterAllocNet(&peer->spec);
+        session = fbSessionAlloc(model);
+        fbuf = fBufAllocForExport(session, exporter);
+        bmAddTemplates(session, TRUE);
+        bmAppend(fbuf, peer->mix, FALSE,
+                 (FB_UDP == peer->spec.transport) ? peer : NULL);
+        peer->sent = opt_records;
+        peer->octets = fbExporterGetOctetCount(exporter);
+        fBufFree(fbuf);
+    } else {
+        struct sockaddr_in sin;
+        uint8_t            buf[BM_DGRAM_MAX];
+        uint32_t           records;
+        uint32_t           seq;
+        size_t             len;
+        int                sock;
+
+        memset(&sin, 0, sizeof(sin));
+        sin.sin_family = AF_INET;
+        sin.sin_port = htons(atoi(peer->spec.svc));
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        sock = socket(AF_INET, SOCK_DGRAM, 0);
+        if (sock < 0 || connect(sock, (struct sockaddr *)&sin, sizeof(sin))) {
+            bmFatal("Cannot open UDP socket", NULL);
+        }
+        for (seq = 0; seq < peer->dgram_count; ++seq) {
+            len = peer->build(buf, seq, &records);
+            if (send(sock, buf, len, 0) == (ssize_t)len) {
+                peer->sent += records;
+                peer->octets += len;
+            }
+            /* keep at most BM_UDP_WINDOW datagrams in flight */
+            if (peer->sent > peer->unreturned + records * BM_UDP_WINDOW) {
+                bmPeerWait(peer, (peer->sent - peer->unreturned -
+                                  records * BM_UDP_WINDOW));
+            }
+        }
+        close(sock);
+    }
+
+    if (FB_UDP != peer->spec.transport) {
+        return NULL;
+    }
+    prev = -1;
+    while (!g_atomic_int_get(&peer->done)) {
+        g_usleep(BM_UDP_IDLE_USEC);
+        cur = g_atomic_int_get(&peer->received);
+        if (cur == prev && !g_atomic_int_get(&peer->done)) {
+            fBuf_t *rfbuf = (fBuf_t *)g_atomic_pointer_get(&peer->fbuf);
+            fbListenerInterrupt(peer->listener);
+            if (rfbuf) {
+                fBufInterruptSocket(rfbuf);
+            }
+        }
+        prev = cur;
+    }
+    return NULL;
+}
+
+
+/**
+ *    Starts the sender thread for a network benchmark.
+ */
+static void
+bmPeerStart(
+    bmPeer_t  *peer)
+{
+    int rv;
+
+    rv = pthread_create(&peer->thread, NULL, bmSenderMain, peer);
+    if (rv != 0) {
+        fprintf(stderr, "%s: Unable to start thread: %s\n",
+                g_get_prgname(), strerror(rv));
+        exit(1);
+    }
+}
+
+
+/**
+ *    Allocates a listener on the next loopback port for `transport`,
+ *    storing the connection specifier in `peer`.
+ */
+static fbListener_t *
+bmListenerAlloc(
+    bmPeer_t       *peer,
+    fbTransport_t   transport,
+    fbSession_t    *session)
+{
+    fbListener_t *listener;
+    GError       *err = NULL;
+
+    peer->spec.transport = transport;
+    peer->spec.host = "127.0.0.1";
+    peer->spec.svc = g_strdup(bmNextPort());
+    listener = fbListenerAlloc(&peer->spec, session, NULL, NULL, &err);
+    if (NULL == listener) {
+        bmFatal("Cannot create listener", err);
+    }
+    peer->listener = listener;
+    return listener;
+}
+
+
+/**
+ *    Benchmarks the TCP or UDP exporter and collector: a thread exports the
+ *    records of `mix` over the loopback interface and this thread reads
+ *    them from a listener.
+ */
+static void
+bmNetwork(
+    bmMix_t        *mix,
+    fbTransport_t   transport,
+    bmResult_t     *res)
+{
+    bmPeer_t      peer;
+    fbListener_t *listener;
+    fbSession_t  *session;
+    fBuf_t       *fbuf;
+    GError       *err = NULL;
+    gint64        start;
+    gint64        last;
+
+    memset(&peer, 0, sizeof(peer));
+    peer.mix = mix;
+    session = fbSessionAlloc(model);
+    bmAddTemplates(session, FALSE);
+    listener = bmListenerAlloc(&peer, transport, session);
+
+    start = last = g_get_monotonic_time();
+    bmPeerStart(&peer);
+    fbuf = fbListenerWait(listener, &err);
+    if (NULL == fbuf) {
+        g_clear_error(&err);
+        res->records = 0;
+    } else if (FB_UDP == transport) {
+        g_atomic_pointer_set(&peer.fbuf, fbuf);
+        res->records = bmCollect(fbuf, mix, FALSE, &peer, opt_records,
+                                 &last);
+    } else {
+        res->records = bmCollect(fbuf, mix, FALSE, NULL, 0, NULL);
+        last = g_get_monotonic_time();
+    }
+    g_atomic_int_set(&peer.done, 1);
+    pthread_join(peer.thread, NULL);
+
+    res->usec = last - start;
+    res->octets = peer.octets;
+    res->lost = peer.sent - res->records;
+
+    if (fbuf && FB_UDP != transport) {
+        fBufFree(fbuf);
+    }
+    fbListenerFree(listener);
+    fbSessionFree(session);
+    g_free(peer.spec.svc);
+}
+
+
+/*
+ *  Helpers that write big-endian integers into a datagram.
+ */
+static uint8_t *
+bmPut16(
+    uint8_t   *p,
+    uint16_t   v)
+{
+    v = g_htons(v);
+    memcpy(p, &v, sizeof(v));
+    return p + sizeof(v);
+}
+
+static uint8_t *
+bmPut32(
+    uint8_t   *p,
+    uint32_t   v)
+{
+    v = g_htonl(v);
+    memcpy(p, &v, sizeof(v));
+    return p + sizeof(v);
+}
+
+
+/**
+ *    Builds NetFlow v9 datagram `seq`: BM_V9_RECORDS flow records, preceded
+ *    by the template every BM_V9_TEMPLATE_EVERY datagrams.
+ */
+static size_t
+bmBuildV9(
+    uint8_t   *buf,
+    uint32_t   seq,
+    uint32_t  *records)
+{
+    /* field type and length of each field of the template */
+    static const uint16_t fields[][2] = {
+        {1, 4}, {2, 4}, {22, 4}, {21, 4}, {8, 4}, {12, 4}, {10, 2},
+        {14, 2}, {7, 2}, {11, 2}, {4, 1}, {5, 1}, {6, 1}
+    };
+    bmFixedRec_t flow;
+    gboolean     tmpl = (0 == seq % BM_V9_TEMPLATE_EVERY);
+    uint8_t     *p = buf;
+    uint8_t     *set;
+    unsigned int i;
+
+    p = bmPut16(p, 9);
+    p = bmPut16(p, BM_V9_RECORDS + (tmpl ? 1 : 0));
+    p = bmPut32(p, 3600000 + seq);
+    p = bmPut32(p, 1696000000 + seq / 1000);
+    p = bmPut32(p, seq);
+    p = bmPut32(p, 1);
+
+    if (tmpl) {
+        p = bmPut16(p, 0);
+        p = bmPut16(p, 8 + 4 * G_N_ELEMENTS(fields));
+        p = bmPut16(p, 256);
+        p = bmPut16(p, G_N_ELEMENTS(fields));
+        for (i = 0; i < G_N_ELEMENTS(fields); ++i) {
+            p = bmPut16(p, fields[i][0]);
+            p = bmPut16(p, fields[i][1]);
+        }
+    }
+
+    set = p;
+    p += 4;
+    for (i = 0; i < BM_V9_RECORDS; ++i) {
+        bmFillFixed(&flow);
+        p = bmPut32(p, (uint32_t)flow.octetTotalCount);
+        p = bmPut32(p, (uint32_t)flow.packetTotalCount);
+        p = bmPut32(p, 3000000 + i);
+        p = bmPut32(p, 3500000 + i);
+        p = bmPut32(p, flow.sourceIPv4Address);
+        p = bmPut32(p, flow.destinationIPv4Address);
+        p = bmPut16(p, (uint16_t)flow.ingressInterface);
+        p = bmPut16(p, (uint16_t)flow.egressInterface);
+        p = bmPut16(p, flow.sourceTransportPort);
+        p = bmPut16(p, flow.destinationTransportPort);
+        *p++ = flow.protocolIdentifier;
+        *p++ = flow.ipClassOfService;
+        *p++ = (uint8_t)flow.tcpControlBits;
+    }
+    while ((p - set) % 4) {
+        *p++ = 0;
+    }
+    bmPut16(set, 256);
+    bmPut16(set + 2, (uint16_t)(p - set));
+
+    *records = BM_V9_RECORDS;
+    return p - buf;
+}
+
+
+/**
+ *    Builds sFlow v5 datagram `seq`: BM_SFLOW_SAMPLES flow samples, each
+ *    holding the Ethernet, IPv4, and TCP headers of a sampled packet.
+ */
+static size_t
+bmBuildSFlow(
+    uint8_t   *buf,
+    uint32_t   seq,
+    uint32_t  *records)
+{
+    bmFixedRec_t flow;
+    uint8_t     *p = buf;
+    uint8_t     *hdr;
+    unsigned int i;
+
+    p = bmPut32(p, 5);
+    p = bmPut32(p, 1);
+    p = bmPut32(p, 0x7f000001);
+    p = bmPut32(p, 1);
+    p = bmPut32(p, seq);
+    p = bmPut32(p, 3600000 + seq);
+    p = bmPut32(p, BM_SFLOW_SAMPLES);
+
+    for (i = 0; i < BM_SFLOW_SAMPLES; ++i) {
+        bmFillFixed(&flow);
+        /* flow sample header */
+        p = bmPut32(p, 1);
+        p = bmPut32(p, 112);
+        p = bmPut32(p, seq * BM_SFLOW_SAMPLES + i);
+        p = bmPut32(p, flow.ingressInterface);
+        p = bmPut32(p, 1000);
+        p = bmPut32(p, 1000 * (seq * BM_SFLOW_SAMPLES + i));
+        p = bmPut32(p, 0);
+        p = bmPut32(p, flow.ingressInterface);
+        p = bmPut32(p, flow.egressInterface);
+        p = bmPut32(p, 1);
+        /* raw packet header flow record */
+        p = bmPut32(p, 1);
+        p = bmPut32(p, 72);
+        p = bmPut32(p, 1);
+        p = bmPut32(p, 64 + (flow.octetTotalCount & 0x3ff));
+        p = bmPut32(p, 4);
+        p = bmPut32(p, 54);
+        /* Ethernet */
+        hdr = p;
+        memset(hdr, 0, 56);
+        hdr[0] = 0x02;
+        hdr[6] = 0x02;
+        hdr[11] = 0x01;
+        bmPut16(hdr + 12, 0x0800);
+        /* IPv4 */
+        hdr[14] = 0x45;
+        hdr[15] = flow.ipClassOfService;
+        bmPut16(hdr + 16, 40 + (flow.octetTotalCount & 0x3ff));
+        hdr[22] = flow.minimumTTL;
+        hdr[23] = 6;
+        bmPut32(hdr + 26, flow.sourceIPv4Address);
+        bmPut32(hdr + 30, flow.destinationIPv4Address);
+        /* TCP */
+        bmPut16(hdr + 34, flow.sourceTransportPort);
+        bmPut16(hdr + 36, flow.destinationTransportPort);
+        hdr[46] = 0x50;
+        hdr[47] = (uint8_t)flow.tcpControlBits;
+        p += 56;
+    }
+
+    *records = BM_SFLOW_SAMPLES;
+    return p - buf;
+}
+
+
+/**
+ *    Benchmarks the NetFlow v9 or sFlow translator: a thread sends
+ *    datagrams over the loopback interface to a UDP listener whose
+ *    collector translates them, and this thread reads the records.
+ */
+static void
+bmTranslate(
+    gboolean     sflow,
+    bmResult_t  *res)
+{
+    bmPeer_t       peer;
+    fbListener_t  *listener;
+    fbCollector_t *collector;
+    fbSession_t   *session;
+    fBuf_t        *fbuf;
+    GError        *err = NULL;
+    uint64_t       expected;
+    uint32_t       per_dgram;
+    gint64         start;
+    gint64         last;
+
+    memset(&peer, 0, sizeof(peer));
+    per_dgram = sflow ? BM_SFLOW_SAMPLES : BM_V9_RECORDS;
+    peer.build = sflow ? bmBuildSFlow : bmBuildV9;
+    peer.dgram_count = MAX(2, (opt_records + per_dgram - 1) / per_dgram);
+    /* the sFlow translator only returns templates for the first datagram
+     * of a session */
+    peer.unreturned = sflow ? per_dgram : 0;
+    expected = (uint64_t)per_dgram * peer.dgram_count - peer.unreturned;
+
+    session = fbSessionAlloc(model);
+    fbSessionAddNewTemplateCallback(session, bmTemplateCallback, NULL);
+    listener = bmListenerAlloc(&peer, FB_UDP, session);
+    if (!fbListenerGetCollector(listener, &collector, &err) ||
+        !(sflow
+          ? fbCollectorSetSFlowTranslator(collector, &err)
+          : fbCollectorSetNetflowV9Translator(collector, &err)))
+    {
+        bmFatal("Cannot set translator", err);
+    }
+
+    start = last = g_get_monotonic_time();
+    bmPeerStart(&peer);
+    fbuf = fbListenerWait(listener, &err);
+    if (NULL == fbuf) {
+        g_clear_error(&err);
+        res->records = 0;
+    } else {
+        g_atomic_pointer_set(&peer.fbuf, fbuf);
+        res->records = bmCollectAny(fbuf, &peer, expected, &last);
+    }
+    g_atomic_int_set(&peer.done, 1);
+    pthread_join(peer.thread, NULL);
+
+    res->usec = last - start;
+    res->octets = peer.octets;
+    res->lost = (expected > res->records) ? expected - res->records : 0;
+
+    fbListenerFree(listener);
+    fbSessionFree(session);
+    g_free(peer.spec.svc);
+}
+
+
+/**
+ *    Runs the selected benchmarks on `mix`.
+ */
+static void
+bmRunMix(
+    bmMix_t  *mix)
+{
+    bmResult_t   res;
+    const char  *name;
+    unsigned int i;
+
+    bmMixInit(mix);
+
+    for (i = 0; (name = bm_mix_benchmarks[i]); ++i) {
+        /* the file is needed by the benchmarks that follow */
+        if (!bmSelected(bench_list, name) &&
+            !(0 == strcmp(name, "file-write") && NULL == mix->path))
+        {
+            continue;
+        }
+        memset(&res, 0, sizeof(res));
+        if (0 == strcmp(name, "encode")) {
+            bmEncode(mix, FALSE, &res);
+        } else if (0 == strcmp(name, "encode-batch")) {
+            bmEncode(mix, TRUE, &res);
+        } else if (0 == strcmp(name, "file-write")) {
+            bmFileWrite(mix, &res);
+        } else if (0 == strcmp(name, "decode")) {
+            bmDecode(mix, FALSE, &res);
+        } else if (0 == strcmp(name, "decode-batch")) {
+            bmDecode(mix, TRUE, &res);
+        } else if (0 == strcmp(name, "file-read")) {
+            bmFileRead(mix, FALSE, &res);
+        } else if (0 == strcmp(name, "file-mmap")) {
+            bmFileRead(mix, TRUE, &res);
+        } else if (0 == strcmp(name, "tcp")) {
+            bmNetwork(mix, FB_TCP, &res);
+        } else if (0 == strcmp(name, "udp")) {
+            bmNetwork(mix, FB_UDP, &res);
+        }
+        if (bmSelected(bench_list, name)) {
+            bmReport(name, mix->name, &res);
+        }
+    }
+
+    bmMixFree(mix);
+}
+
+
+/**
+ *    Parses the command line options.
+ */
+static void
+bmParseOptions(
+    int    *argc,
+    char  **argv[])
+{
+    GOptionContext *ctx;
+    GError         *err = NULL;
+
+    ctx = g_option_context_new(" - libfixbuf throughput benchmarks");
+    g_option_context_add_main_entries(ctx, bm_options, NULL);
+    g_option_context_set_help_enabled(ctx, TRUE);
+    if (!g_option_context_parse(ctx, argc, argv, &err)) {
+        fprintf(stderr, "%s: Option parsing failed: %s\n",
+                g_get_prgname(), err->message);
+        exit(1);
+    }
+    g_option_context_free(ctx);
+
+    if (opt_records < 1) {
+        fprintf(stderr, "%s: Invalid records value %d\n",
+                g_get_prgname(), opt_records);
+        exit(1);
+    }
+    next_port = opt_port ? atoi(opt_port) : 18600;
+    if (next_port < 1 || next_port > 65535 - 16) {
+        fprintf(stderr, "%s: Invalid port %s\n", g_get_prgname(), opt_port);
+        exit(1);
+    }
+    if (opt_mixes) {
+        mix_list = g_strsplit(opt_mixes, ",", -1);
+    }
+    if (opt_benchmarks && strcmp(opt_benchmarks, "all")) {
+        bench_list = g_strsplit(opt_benchmarks, ",", -1);
+    }
+
+    if (NULL == opt_output || 0 == strcmp(opt_output, "-")) {
+        outfile = stdout;
+    } else {
+        outfile = fopen(opt_output, "w");
+        if (NULL == outfile) {
+            fprintf(stderr, "%s: Cannot open %s: %s\n",
+                    g_get_prgname(), opt_output, strerror(errno));
+            exit(1);
+        }
+    }
+}
+
+
+int
+main(
+    int    argc,
+    char  *argv[])
+{
+    bmMix_t mixes[] = {
+        {"fixed",    BM_TID_FIXED,    sizeof(bmFixedRec_t),    NULL, NULL, 0},
+        {"varfield", BM_TID_VARFIELD, sizeof(bmVarfieldRec_t), NULL, NULL, 0},
+        {"dpi",      BM_TID_DPI,      sizeof(bmDpiRec_t),      NULL, NULL, 0}
+    };
+    bmResult_t   res;
+    unsigned int i;
+
+    bmParseOptions(&argc, &argv);
+
+    /* a closed loopback socket must not end the program */
+    signal(SIGPIPE, SIG_IGN);
+
+    model = fbInfoModelAlloc();
+    pool_session = fbSessionAlloc(model);
+    bmAddTemplates(pool_session, FALSE);
+
+    for (i = 0; i < G_N_ELEMENTS(mixes); ++i) {
+        if (bmSelected(mix_list, mixes[i].name)) {
+            bmRunMix(&mixes[i]);
+        }
+    }
+
+    for (i = 0; bm_translate_benchmarks[i]; ++i) {
+        if (bmSelected(bench_list, bm_translate_benchmarks[i])) {
+            memset(&res, 0, sizeof(res));
+            bmTranslate((1 == i), &res);
+            bmReport(bm_translate_benchmarks[i],
+                     (1 == i) ? "sflow" : "netflowv9", &res);
+        }
+    }
+
+    fbSessionFree(pool_session);
+    fbInfoModelFree(model);
+    g_strfreev(mix_list);
+    g_strfreev(bench_list);
+    if (outfile != stdout) {
+        fclose(outfile);
+    }
+
+    return 0;
+}
+
+/*
+ *  @DISTRIBUTION_STATEMENT_BEGIN@
+ *  libfixbuf 3.0.0
+ *
+ *  Copyright 2022 Carnegie Mellon University.
+ *
+ *  NO WARRANTY. THIS CARNEGIE MELLON UNIVERSITY AND SOFTWARE ENGINEERING
+ *  INSTITUTE MATERIAL IS FURNISHED ON AN "AS-IS" BASIS. CARNEGIE MELLON
+ *  UNIVERSITY MAKES NO WARRANTIES OF ANY KIND, EITHER EXPRESSED OR IMPLIED,
+ *  AS TO ANY MATTER INCLUDING, BUT NOT LIMITED TO, WARRANTY OF FITNESS FOR
+ *  PURPOSE OR MERCHANTABILITY, EXCLUSIVITY, OR RESULTS OBTAINED FROM USE OF
+ *  THE MATERIAL. CARNEGIE MELLON UNIVERSITY DOES NOT MAKE ANY WARRANTY OF
+ *  ANY KIND WITH RESPECT TO FREEDOM FROM PATENT, TRADEMARK, OR COPYRIGHT
+ *  INFRINGEMENT.
+ *
+ *  Released under a GNU GPL 2.0-style license, please see LICENSE.txt or
+ *  contact permission@sei.cmu.edu for full terms.
+ *
+ *  [DISTRIBUTION STATEMENT A] This material has been approved for public
+ *  release and unlimited distribution.  Please see Copyright notice for
+ *  non-US Government use and distribution.
+ *
+ *  Carnegie Mellon(R) and CERT(R) are registered in the U.S. Patent and
+ *  Trademark Office by Carnegie Mellon University.
+ *
+ *  This Software includes and/or makes use of the following Third-Party
+ *  Software subject to its own license:
+ *
+ *  1. GLib-2.0 (https://gitlab.gnome.org/GNOME/glib/-/blob/main/COPYING)
+ *     Copyright 1995 GLib-2.0 Team.
+ *
+ *  2. Doxygen (http://www.gnu.org/licenses/old-licenses/gpl-2.0.html)
+ *     Copyright 2021 Dimitri van Heesch.
+ *
+ *  DM22-0006
+ *  @DISTRIBUTION_STATEMENT_END@
+ */
@@ -12,9 +12,48 @@
  *  ------------------------------------------------------------------------
  */
 
+/* for recvmmsg() */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
 #define _FIXBUF_SOURCE_
 #include <fixbuf/private.h>
 #include "fbcollector.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+#ifdef HAVE_LZ4
+#include <lz4frame.h>
+#endif
+
+#if defined(MSG_WAITFORONE)
+#define FB_ENABLE_RECVMMSG 1
+#endif
+
+/* size of the buffer holding compressed input of a collector; as large
+ * as the receive buffer, whose contents it takes over on detection */
+#define FB_COLLECTOR_COMP_INBUF_SIZE FB_COLLECTOR_RXBUF_SIZE
+
+/* counts a call that read the collector's file or socket and returned
+ * `_rc_`, which is negative or zero when nothing was read */
+#define FB_COLLECTOR_COUNT_READ(_collector_, _rc_)              \
+    do {                                                        \
+        ++(_collector_)->stats.reads;                           \
+        if ((ssize_t)(_rc_) > 0) {                              \
+            (_collector_)->stats.read_octets += (_rc_);         \
+        }                                                       \
+    } while (0)
+
+static gboolean
+fbCollectorReadFileCompressed(
+    fbCollector_t  *collector,
+    uint8_t        *msgbase,
+    size_t         *msglen,
+    GError        **err);
 
 
 /*#################################################
@@ -49,22 +88,26 @@ fbCollectorDecodeMsgVL(
     /* collector is unused in this function*/
     (void)collector;
 
-    h_version = g_ntohs(hdr->n_version);
+    /* a mapped file puts the header at any offset; copy the fields out */
+    memcpy(&h_version, (const uint8_t *)hdr, sizeof(h_version));
+    memcpy(&h_len, (const uint8_t *)hdr + sizeof(h_version), sizeof(h_len));
+
+    h_version = g_ntohs(h_version);
     if (h_version != 0x000A) {
         g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IPFIX,
                     "Illegal IPFIX Message version 0x%04x; "
                     "input is probably not an IPFIX Message stream.",
-                    g_ntohs(hdr->n_version));
+                    h_version);
         *m_len = 0;
         return FALSE;
     }
 
-    h_len = g_ntohs(hdr->n_len);
+    h_len = g_ntohs(h_len);
     if (h_len < 16) {
         g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IPFIX,
                     "Illegal IPFIX Message length 0x%04x; "
                     "input is probably not an IPFIX Message stream.",
-                    g_ntohs(hdr->n_len));
+                    h_len);
         *m_len = 0;
         return FALSE;
     }
@@ -295,6 +338,130 @@ fbCollectorSessionTimeoutNull(
  *
  *#################################################*/
 
+/**
+ *  The decompressor of a collector whose stream is compressed.  Compressed
+ *  octets are read into `inbuf`; octets from in_cur to in_end have not
+ *  been decompressed yet.  The decompressed stream goes to the
+ *  collector's rxbuf and is framed by fbCollectorReadBuffered().
+ *  `out_full` is set when the last call filled rxbuf, in which case the
+ *  decompressor may hold output that did not fit.
+ */
+struct fbCollectorComp_st {
+    fbCompressionMethod_t   method;
+    uint8_t                *inbuf;
+    size_t                  in_cur;
+    size_t                  in_end;
+    gboolean                out_full;
+#ifdef HAVE_ZSTD
+    ZSTD_DCtx              *zctx;
+#endif
+#ifdef HAVE_LZ4
+    LZ4F_dctx              *lctx;
+#endif
+};
+
+/**
+ * fbCollectorCompDetect
+ *
+ * Returns the compression method whose frame magic number is in the
+ * first four octets at `p`, or FB_COMPRESS_NONE.
+ *
+ */
+static fbCompressionMethod_t
+fbCollectorCompDetect(
+    const uint8_t  *p)
+{
+    /* the magic numbers are little endian */
+    if (p[0] == 0x28 && p[1] == 0xB5 && p[2] == 0x2F && p[3] == 0xFD) {
+        return FB_COMPRESS_ZSTD;
+    }
+    if (p[0] == 0x04 && p[1] == 0x22 && p[2] == 0x4D && p[3] == 0x18) {
+        return FB_COMPRESS_LZ4;
+    }
+    return FB_COMPRESS_NONE;
+}
+
+/**
+ * fbCollectorCompStart
+ *
+ * Sets up decompression of a collector's stream, whose first `len`
+ * octets have already been read into `data`.
+ *
+ */
+static gboolean
+fbCollectorCompStart(
+    fbCollector_t  *collector,
+    const uint8_t  *data,
+    size_t          len,
+    GError        **err)
+{
+    fbCollectorComp_t *comp;
+
+    comp = g_slice_new0(fbCollectorComp_t);
+    comp->method = fbCollectorCompDetect(data);
+    switch (comp->method) {
+#ifdef HAVE_ZSTD
+      case FB_COMPRESS_ZSTD:
+        comp->zctx = ZSTD_createDCtx();
+        if (!comp->zctx) {
+            g_error("Unable to allocate zstd decompression context");
+        }
+        break;
+#endif  /* HAVE_ZSTD */
+#ifdef HAVE_LZ4
+      case FB_COMPRESS_LZ4:
+        if (LZ4F_isError(LZ4F_createDecompressionContext(&comp->lctx,
+                                                         LZ4F_VERSION)))
+        {
+            g_error("Unable to allocate LZ4 decompression context");
+        }
+        break;
+#endif  /* HAVE_LZ4 */
+      default:
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Input is %s compressed but this build of libfixbuf"
+                    " does not support it",
+                    (comp->method == FB_COMPRESS_ZSTD) ? "zstd" : "LZ4");
+        g_slice_free(fbCollectorComp_t, comp);
+        return FALSE;
+    }
+
+    g_assert(len <= FB_COLLECTOR_COMP_INBUF_SIZE);
+    comp->inbuf = g_malloc(FB_COLLECTOR_COMP_INBUF_SIZE);
+    memcpy(comp->inbuf, data, len);
+    comp->in_end = len;
+    collector->comp = comp;
+
+    return TRUE;
+}
+
+/**
+ * fbCollectorCompFree
+ *
+ *
+ *
+ */
+static void
+fbCollectorCompFree(
+    fbCollectorComp_t  *comp)
+{
+    if (!comp) {
+        return;
+    }
+#ifdef HAVE_ZSTD
+    if (comp->zctx) {
+        ZSTD_freeDCtx(comp->zctx);
+    }
+#endif
+#ifdef HAVE_LZ4
+    if (comp->lctx) {
+        LZ4F_freeDecompressionContext(comp->lctx);
+    }
+#endif
+    g_free(comp->inbuf);
+    g_slice_free(fbCollectorComp_t, comp);
+}
+
 /**
  * fbCollectorReadFile
  *
@@ -315,9 +482,23 @@ fbCollectorReadFile(
     g_assert(*msglen > 4);
 
     rc = fread(msgbase, 1, 4, collector->stream.fp);
+    FB_COLLECTOR_COUNT_READ(collector, rc);
     if (rc < 4) {
         goto ERROR;
     }
+    if (collector->comp_detect) {
+        collector->comp_detect = FALSE;
+        if (!collector->translationActive &&
+            fbCollectorCompDetect(msgbase) != FB_COMPRESS_NONE)
+        {
+            if (!fbCollectorCompStart(collector, msgbase, 4, err)) {
+                return FALSE;
+            }
+            collector->coread = fbCollectorReadFileCompressed;
+            return fbCollectorReadFileCompressed(collector, msgbase, msglen,
+                                                 err);
+        }
+    }
     if (!collector->coreadLen(collector, (fbCollectorMsgVL_t *)msgbase,
                               *msglen, &h_len, err))
     {
@@ -327,6 +508,7 @@ fbCollectorReadFile(
 
     /* read rest of message */
     rc = fread(msgbase, 1, h_len - 4, collector->stream.fp);
+    FB_COLLECTOR_COUNT_READ(collector, rc);
     if (rc <= 0) {
         goto ERROR;
     }
@@ -362,12 +544,108 @@ static void
 fbCollectorCloseFile(
     fbCollector_t  *collector)
 {
+    if (collector->map) {
+        munmap(collector->map, collector->map_len);
+        collector->map = NULL;
+    }
     if (collector->stream.fp != stdin) {
         fclose(collector->stream.fp);
     }
     collector->active = FALSE;
 }
 
+/**
+ * fbCollectorNextMapped
+ *
+ * Frames the next message in the file mapping, setting `msg` to its
+ * start and `msglen` to its length, and advances the mapping offset.
+ * Mirrors the checks fbCollectorReadFile() makes on an fread().
+ *
+ */
+static gboolean
+fbCollectorNextMapped(
+    fbCollector_t  *collector,
+    uint8_t       **msg,
+    size_t         *msglen,
+    GError        **err)
+{
+    size_t   avail = collector->map_len - collector->map_off;
+    uint16_t h_len;
+
+    if (avail == 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_EOF,
+                    "End of file");
+        return FALSE;
+    }
+    if (avail < 4) {
+        collector->map_off = collector->map_len;
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_EOF,
+                    "Too few bytes available for IPFIX Message Header (%d/16)",
+                    (int)avail);
+        return FALSE;
+    }
+    *msg = collector->map + collector->map_off;
+    if (!collector->coreadLen(collector, (fbCollectorMsgVL_t *)*msg,
+                              *msglen, &h_len, err))
+    {
+        return FALSE;
+    }
+
+    /* a truncated final message is returned short, as fread() would */
+    *msglen = (h_len > avail) ? avail : h_len;
+    collector->map_off += *msglen;
+    return TRUE;
+}
+
+/**
+ * fbCollectorReadMapped
+ *
+ * Copies the next message out of the file mapping.  fBufNextMessage()
+ * uses fbCollectMessageInPlace() instead; this serves any other caller
+ * of fbCollectMessage().
+ *
+ * Implements collector->coread()
+ */
+static gboolean
+fbCollectorReadMapped(
+    fbCollector_t  *collector,
+    uint8_t        *msgbase,
+    size_t         *msglen,
+    GError        **err)
+{
+    uint8_t *msg;
+
+    g_assert(*msglen > 4);
+
+    if (!fbCollectorNextMapped(collector, &msg, msglen, err)) {
+        return FALSE;
+    }
+    memcpy(msgbase, msg, *msglen);
+    if (!collector->copostRead(collector, msgbase, msglen, err)) {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * fbCollectorUnmapFile
+ *
+ * Returns a mapped file collector to stdio, positioning the stream at
+ * the first byte not yet returned.
+ *
+ */
+static void
+fbCollectorUnmapFile(
+    fbCollector_t  *collector)
+{
+    if (collector->map) {
+        fseeko(collector->stream.fp, (off_t)collector->map_off, SEEK_SET);
+        munmap(collector->map, collector->map_len);
+        collector->map = NULL;
+        collector->coread = fbCollectorReadFile;
+    }
+}
+
 /**
  * fbCollectorAllocFP
  *
@@ -392,6 +670,7 @@ fbCollectorAllocFP(
     collector->bufferedStream = TRUE;
     collector->active = TRUE;
     collector->coread = fbCollectorReadFile;
+    collector->comp_detect = TRUE;
     collector->copostRead = fbCollectorPostProcNull;
     collector->coreadLen = fbCollectorDecodeMsgVL;
     collector->comsgHeader = fbCollectorMessageHeaderNull;
@@ -503,6 +782,7 @@ fbCollectorReadSCTP(
 
     rc = sctp_recvmsg(collector->stream.fd, msgbase, *msglen,
                       &peer, &peerlen, &sri, &sctp_flags);
+    FB_COLLECTOR_COUNT_READ(collector, rc);
 
     if (rc > 0) {
         if (!collector->comsgHeader(collector, msgbase, rc, &msgSize, err)) {
@@ -521,6 +801,10 @@ fbCollectorReadSCTP(
         g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
                     "SCTP read interrupt");
         return FALSE;
+    } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
+                    "No SCTP message ready");
+        return FALSE;
     } else {
         g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
                     "TCP I/O error: %s", strerror(errno));
@@ -529,55 +813,62 @@ fbCollectorReadSCTP(
 }
 #endif /* FB_ENABLE_SCTP */
 
+/**
+ * fbCollectorHandlePoll
+ *
+ * Waits until the collector's socket or interrupt pipe is readable.
+ *
+ * @return 0 when the socket is readable, -1 when the interrupt pipe was
+ * written or poll() failed
+ */
 static int
-fbCollectorHandleSelect(
+fbCollectorHandlePoll(
     fbCollector_t  *collector)
 {
-    fd_set  rdfds;
-    int     maxfd;
-    int     count;
-    int     retVal = 0;
-    uint8_t byte;
+    struct pollfd pfd[2];
+    int           count;
+    uint8_t       byte;
+    gint64        start;
 
     g_assert(collector);
 
-    if (collector->rip > collector->stream.fd) {
-        maxfd = collector->rip;
-    } else {
-        maxfd = collector->stream.fd;
+    /* a non-blocking read reports that no data is ready itself */
+    if (collector->nonblocking) {
+        return 0;
     }
 
-    maxfd++;
+    pfd[0].fd = collector->rip;
+    pfd[0].events = POLLIN;
+    pfd[0].revents = 0;
+    pfd[1].fd = collector->stream.fd;
+    pfd[1].events = POLLIN;
+    pfd[1].revents = 0;
 
-    FD_ZERO(&rdfds);
-    FD_SET(collector->rip, &rdfds);
-    FD_SET(collector->stream.fd, &rdfds);
+    start = g_get_monotonic_time();
+    count = poll(pfd, 2, -1);
+    ++collector->stats.polls;
+    collector->stats.poll_usec += g_get_monotonic_time() - start;
 
-    count = select(maxfd, &rdfds, NULL, NULL, NULL);
-
-    if (count) {
-        if (FD_ISSET(collector->stream.fd, &rdfds)) {
-            retVal = 0;
-        }
-
-        if (FD_ISSET(collector->rip, &rdfds)) {
-            read(collector->rip, &byte, sizeof(byte));
-            return -1;
-        }
-        return retVal;
-    } else {
+    if (count <= 0) {
+        return -1;
+    }
+    if (pfd[0].revents & POLLIN) {
+        read(collector->rip, &byte, sizeof(byte));
         return -1;
     }
+    return 0;
 }
 
 /**
- * fbCollectorReadTCP
+ * fbCollectorReadTCPUnbuffered
  *
+ * Reads one message straight from the socket.  Used when a translator
+ * is set, since translators read the rest of their headers from the
+ * socket themselves.
  *
- * Implements collector->coread()
  */
 static gboolean
-fbCollectorReadTCP(
+fbCollectorReadTCPUnbuffered(
     fbCollector_t  *collector,
     uint8_t        *msgbase,
     size_t         *msglen,
@@ -591,16 +882,17 @@ fbCollectorReadTCP(
     g_assert(*msglen > 4);
     rrem = 4;
     while (rrem) {
-        rc = fbCollectorHandleSelect(collector);
+        rc = fbCollectorHandlePoll(collector);
 
         if (rc < 0) {
             g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
                         "Interrupted by pipe");
-            /* interrupted by pipe read or other error with select*/
+            /* interrupted by pipe read or other error with poll */
             return FALSE;
         }
 
         rc = read(collector->stream.fd, msgbase, rrem);
+        FB_COLLECTOR_COUNT_READ(collector, rc);
         if (rc > 0) {
             rrem -= rc;
             msgbase += rc;
@@ -626,15 +918,16 @@ fbCollectorReadTCP(
     /* read rest of message */
     rrem = h_len - 4;
     while (rrem) {
-        rc = fbCollectorHandleSelect(collector);
+        rc = fbCollectorHandlePoll(collector);
 
         if (rc < 0) {
             g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
                         "Interrupted by pipe");
-            /* interrupted by pipe read or other error with select*/
+            /* interrupted by pipe read or other error with poll */
             return FALSE;
         }
         rc = read(collector->stream.fd, msgbase, rrem);
+        FB_COLLECTOR_COUNT_READ(collector, rc);
         if (rc > 0) {
             rrem -= rc;
             msgbase += rc;
@@ -661,6 +954,364 @@ fbCollectorReadTCP(
     return TRUE;
 }
 
+/**
+ * fbCollectorStreamFill_fn
+ *
+ * Reads up to `len` more bytes from the collector's stream into `buf`
+ * and sets `got` to the number read.  Sets FB_ERROR_EOF on orderly
+ * shutdown.
+ */
+typedef gboolean
+(*fbCollectorStreamFill_fn)(
+    fbCollector_t  *collector,
+    uint8_t        *buf,
+    size_t          len,
+    size_t         *got,
+    GError        **err);
+
+/**
+ * fbCollectorFillTCP
+ *
+ *
+ * Implements fbCollectorStreamFill_fn for TCP
+ */
+static gboolean
+fbCollectorFillTCP(
+    fbCollector_t  *collector,
+    uint8_t        *buf,
+    size_t          len,
+    size_t         *got,
+    GError        **err)
+{
+    ssize_t rc;
+
+    if (fbCollectorHandlePoll(collector) < 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "Interrupted by pipe");
+        /* interrupted by pipe read or other error with poll */
+        return FALSE;
+    }
+
+    rc = read(collector->stream.fd, buf, len);
+    FB_COLLECTOR_COUNT_READ(collector, rc);
+    if (rc > 0) {
+        *got = rc;
+        return TRUE;
+    } else if (rc == 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_EOF,
+                    "End of file");
+        return FALSE;
+    } else if (errno == EINTR) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
+                    "TCP read interrupt");
+        return FALSE;
+    } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
+                    "No TCP data ready");
+        return FALSE;
+    } else {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "TCP I/O error: %s", strerror(errno));
+        return FALSE;
+    }
+}
+
+/**
+ * fbCollectorFillFile
+ *
+ *
+ * Implements fbCollectorStreamFill_fn for files; only used to read
+ * compressed files
+ */
+static gboolean
+fbCollectorFillFile(
+    fbCollector_t  *collector,
+    uint8_t        *buf,
+    size_t          len,
+    size_t         *got,
+    GError        **err)
+{
+    size_t rc;
+
+    rc = fread(buf, 1, len, collector->stream.fp);
+    FB_COLLECTOR_COUNT_READ(collector, rc);
+    if (rc > 0) {
+        *got = rc;
+        return TRUE;
+    } else if (feof(collector->stream.fp)) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_EOF,
+                    "End of file");
+        return FALSE;
+    } else {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "I/O error: %s", strerror(errno));
+        return FALSE;
+    }
+}
+
+/**
+ * fbCollectorFillDecompress
+ *
+ * Decompresses more of a compressed stream into the free space at the
+ * end of the receive buffer and advances rx_end, calling `fill` to read
+ * more compressed bytes as needed.  Returns once at least one byte was
+ * produced.
+ */
+static gboolean
+fbCollectorFillDecompress(
+    fbCollector_t             *collector,
+    fbCollectorStreamFill_fn   fill,
+    GError                   **err)
+{
+    fbCollectorComp_t *comp = collector->comp;
+    size_t             start = collector->rx_end;
+    size_t             got;
+
+    g_assert(collector->rx_end < FB_COLLECTOR_RXBUF_SIZE);
+
+    while (collector->rx_end == start) {
+        if (comp->in_cur == comp->in_end) {
+            comp->in_cur = comp->in_end = 0;
+            if (!fill(collector, comp->inbuf, FB_COLLECTOR_COMP_INBUF_SIZE,
+                      &got, err))
+            {
+                return FALSE;
+            }
+            comp->in_end = got;
+        }
+
+        switch (comp->method) {
+#ifdef HAVE_ZSTD
+          case FB_COMPRESS_ZSTD:
+            {
+                ZSTD_inBuffer  in;
+                ZSTD_outBuffer out;
+                size_t         rc;
+
+                in.src = comp->inbuf;
+                in.size = comp->in_end;
+                in.pos = comp->in_cur;
+                out.dst = collector->rxbuf;
+                out.size = FB_COLLECTOR_RXBUF_SIZE;
+                out.pos = collector->rx_end;
+                rc = ZSTD_decompressStream(comp->zctx, &out, &in);
+                if (ZSTD_isError(rc)) {
+                    g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                                "zstd decompression failed: %s",
+                                ZSTD_getErrorName(rc));
+                    return FALSE;
+                }
+                comp->in_cur = in.pos;
+                collector->rx_end = out.pos;
+                break;
+            }
+#endif  /* HAVE_ZSTD */
+#ifdef HAVE_LZ4
+          case FB_COMPRESS_LZ4:
+            {
+                size_t dstlen = FB_COLLECTOR_RXBUF_SIZE - collector->rx_end;
+                size_t srclen = comp->in_end - comp->in_cur;
+                size_t rc;
+
+                rc = LZ4F_decompress(comp->lctx,
+                                     collector->rxbuf + collector->rx_end,
+                                     &dstlen, comp->inbuf + comp->in_cur,
+                                     &srclen, NULL);
+                if (LZ4F_isError(rc)) {
+                    g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                                "LZ4 decompression failed: %s",
+                                LZ4F_getErrorName(rc));
+                    return FALSE;
+                }
+                comp->in_cur += srclen;
+                collector->rx_end += dstlen;
+                break;
+            }
+#endif  /* HAVE_LZ4 */
+          default:
+            g_assert_not_reached();
+        }
+        comp->out_full = (collector->rx_end == FB_COLLECTOR_RXBUF_SIZE);
+    }
+
+    return TRUE;
+}
+
+/**
+ * fbCollectorReadBuffered
+ *
+ * Returns the next message from the collector's receive buffer,
+ * calling `fill` to read more from the stream when the buffer does not
+ * hold a complete message.  Each fill reads as much as the stream has
+ * ready, so one read() usually frames several messages.  A partial
+ * message stays in the buffer across calls, including calls that fail
+ * with FB_ERROR_NLREAD.
+ *
+ * When the collector checks for compression, the first octets of the
+ * stream are compared to the LZ4 and zstd magic numbers, and a
+ * compressed stream is decompressed into the buffer from then on.
+ *
+ */
+static gboolean
+fbCollectorReadBuffered(
+    fbCollector_t             *collector,
+    fbCollectorStreamFill_fn   fill,
+    uint8_t                   *msgbase,
+    size_t                    *msglen,
+    GError                   **err)
+{
+    fbCollectorMsgVL_t hdr;
+    uint16_t           h_len = 0;
+    size_t             avail;
+    size_t             got;
+
+    g_assert(*msglen > 4);
+
+    if (NULL == collector->rxbuf) {
+        collector->rxbuf = g_malloc(FB_COLLECTOR_RXBUF_SIZE);
+        collector->rx_cur = collector->rx_end = 0;
+    }
+
+    for (;;) {
+        avail = collector->rx_end - collector->rx_cur;
+        if (avail >= 4 && !collector->comp_detect) {
+            /* copy the header out; it may be at any offset in rxbuf */
+            memcpy(&hdr, collector->rxbuf + collector->rx_cur, sizeof(hdr));
+            if (!collector->coreadLen(collector, &hdr, *msglen, &h_len, err)) {
+                return FALSE;
+            }
+            if (avail >= h_len) {
+                break;
+            }
+        }
+
+        /* need more bytes; move the partial message to the front */
+        if (collector->rx_cur) {
+            memmove(collector->rxbuf, collector->rxbuf + collector->rx_cur,
+                    avail);
+            collector->rx_cur = 0;
+            collector->rx_end = avail;
+        }
+        if (collector->comp) {
+            if (!fbCollectorFillDecompress(collector, fill, err)) {
+                return FALSE;
+            }
+            continue;
+        }
+        if (!fill(collector, collector->rxbuf + collector->rx_end,
+                  FB_COLLECTOR_RXBUF_SIZE - collector->rx_end, &got, err))
+        {
+            return FALSE;
+        }
+        collector->rx_end += got;
+
+        if (collector->comp_detect && collector->rx_end >= 4) {
+            /* nothing has been returned, so the stream starts at 0 */
+            collector->comp_detect = FALSE;
+            if (fbCollectorCompDetect(collector->rxbuf) != FB_COMPRESS_NONE) {
+                if (!fbCollectorCompStart(collector, collector->rxbuf,
+                                          collector->rx_end, err))
+                {
+                    return FALSE;
+                }
+                collector->rx_cur = collector->rx_end = 0;
+            }
+        }
+    }
+
+    memcpy(msgbase, collector->rxbuf + collector->rx_cur, h_len);
+    collector->rx_cur += h_len;
+    if (collector->rx_cur == collector->rx_end) {
+        collector->rx_cur = collector->rx_end = 0;
+    }
+
+    /* Post process, if needed and return message length from header. */
+    *msglen = h_len;
+    if (!collector->copostRead(collector, msgbase, msglen, err)) {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * fbCollectorReadFileCompressed
+ *
+ * Reads a compressed file; set by fbCollectorReadFile() when it finds
+ * the file is compressed.
+ *
+ * Implements collector->coread()
+ */
+static gboolean
+fbCollectorReadFileCompressed(
+    fbCollector_t  *collector,
+    uint8_t        *msgbase,
+    size_t         *msglen,
+    GError        **err)
+{
+    return fbCollectorReadBuffered(collector, fbCollectorFillFile,
+                                   msgbase, msglen, err);
+}
+
+/**
+ * fbCollectorReadTCP
+ *
+ *
+ * Implements collector->coread()
+ */
+static gboolean
+fbCollectorReadTCP(
+    fbCollector_t  *collector,
+    uint8_t        *msgbase,
+    size_t         *msglen,
+    GError        **err)
+{
+    if (collector->coreadLen != fbCollectorDecodeMsgVL) {
+        return fbCollectorReadTCPUnbuffered(collector, msgbase, msglen, err);
+    }
+    return fbCollectorReadBuffered(collector, fbCollectorFillTCP,
+                                   msgbase, msglen, err);
+}
+
+/**
+ * fbCollectorUDPSpecHash
+ *
+ * Hashes the peer address and observation domain of a UDP connection
+ * spec; used with fbCollectorUDPSpecEqual() for collector->udp_peers.
+ *
+ */
+static guint
+fbCollectorUDPSpecHash(
+    gconstpointer   v)
+{
+    const fbUDPConnSpec_t *spec = (const fbUDPConnSpec_t *)v;
+    const uint8_t         *cp = (const uint8_t *)&(spec->peer);
+    guint32                h = 2166136261u ^ spec->obdomain;
+    size_t                 i;
+
+    for (i = 0; i < spec->peerlen; i++) {
+        h = (h ^ cp[i]) * 16777619u;
+    }
+    return h;
+}
+
+/**
+ * fbCollectorUDPSpecEqual
+ *
+ *
+ *
+ */
+static gboolean
+fbCollectorUDPSpecEqual(
+    gconstpointer   a,
+    gconstpointer   b)
+{
+    const fbUDPConnSpec_t *sa = (const fbUDPConnSpec_t *)a;
+    const fbUDPConnSpec_t *sb = (const fbUDPConnSpec_t *)b;
+
+    return (sa->obdomain == sb->obdomain && sa->peerlen == sb->peerlen &&
+            0 == memcmp(&(sa->peer), &(sb->peer), sa->peerlen));
+}
+
 static void
 fbCollectorSetUDPSpec(
     fbCollector_t    *collector,
@@ -714,8 +1365,10 @@ fbCollectorFreeUDPSpec(
             spec->prev->next = NULL;
         } else {
             collector->udp_tail = NULL;
+            collector->udp_head = NULL;
         }
     }
+    g_hash_table_remove(collector->udp_peers, spec);
 
     if (collector->multi_session) {
         fbListenerAppFree(collector->listener, spec->ctx);
@@ -737,8 +1390,8 @@ fbCollectorVerifyUDPPeer(
     socklen_t         fromlen,
     GError          **err)
 {
-    fbUDPConnSpec_t *udp = collector->udp_head;
-    gboolean         found = FALSE;
+    fbUDPConnSpec_t *udp = NULL;
+    fbUDPConnSpec_t  key;
 
     /* stash the address if we've not seen it before */
     /* compare the address if we have */
@@ -772,25 +1425,23 @@ fbCollectorVerifyUDPPeer(
                sizeof(collector->peer) : fromlen);
     }
 
-    while (udp) {
-        /* loop through and find current one */
-        if (udp->obdomain == collector->obdomain) {
-            if (!memcmp(&(udp->peer.so), from, udp->peerlen)) {
-                /* we have a match - set session */
-                fbCollectorSetUDPSpec(collector, udp);
-                found = TRUE;
-                break;
-            }
-        }
-        udp = udp->next;
+    if (!collector->udp_peers) {
+        collector->udp_peers = g_hash_table_new(fbCollectorUDPSpecHash,
+                                                fbCollectorUDPSpecEqual);
     }
 
-    if (!found) {
+    /* find current one */
+    key.peerlen = (fromlen > sizeof(key.peer)) ? sizeof(key.peer) : fromlen;
+    memcpy(&(key.peer.so), from, key.peerlen);
+    key.obdomain = collector->obdomain;
+    udp = g_hash_table_lookup(collector->udp_peers, &key);
+
+    if (!udp) {
         udp = g_slice_new0(fbUDPConnSpec_t);
-        udp->peerlen =
-            (fromlen > sizeof(udp->peer)) ? sizeof(udp->peer) : fromlen;
+        udp->peerlen = key.peerlen;
         memcpy(&(udp->peer.so), from, udp->peerlen);
         udp->obdomain = collector->obdomain;
+        g_hash_table_insert(collector->udp_peers, udp, udp);
         /* create a new session */
         udp->session = fbListenerSetPeerSession(collector->listener, NULL);
         fbCollectorSetUDPSpec(collector, udp);
@@ -808,6 +1459,8 @@ fbCollectorVerifyUDPPeer(
             udp->ctx = collector->ctx;
         }
     } else {
+        /* we have a match - set session */
+        fbCollectorSetUDPSpec(collector, udp);
         if (udp->reject) {
             g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
                         "Rejecting previously rejected connection");
@@ -830,46 +1483,29 @@ fbCollectorVerifyUDPPeer(
 }
 
 /**
- * fbCollectorReadUDP
+ * fbCollectorProcessUDP
  *
+ * Processes a datagram of length `recvlen` that was received from
+ * `peer` and has been stored in `msgbase`: builds the message header,
+ * maps the peer to a session, and runs the post-read translation.
+ * Shared by the recvfrom() and recvmmsg() readers.
  *
- * Implements collector->coread()
  */
 static gboolean
-fbCollectorReadUDP(
-    fbCollector_t  *collector,
-    uint8_t        *msgbase,
-    size_t         *msglen,
-    GError        **err)
+fbCollectorProcessUDP(
+    fbCollector_t       *collector,
+    uint8_t             *msgbase,
+    ssize_t              recvlen,
+    size_t              *msglen,
+    union coll_peer_un  *peer,
+    socklen_t            peerlen,
+    GError             **err)
 {
     uint16_t msgSize = 0;
-    ssize_t  recvlen = 0;
-    int      rc;
-    union {
-        struct sockaddr       so;
-        struct sockaddr_in    ip4;
-        struct sockaddr_in6   ip6;
-    }                           peer;
-    socklen_t peerlen;
-
-    memset(&peer, 0, sizeof(peer));
-
-    rc = fbCollectorHandleSelect(collector);
-
-    if (rc < 0) {
-        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
-                    "Interrupted by pipe");
-        /* interrupted by pipe read or other error with select*/
-        return FALSE;
-    }
-
-    peerlen = sizeof(peer);
-    recvlen = recvfrom(collector->stream.fd, msgbase, *msglen, 0,
-                       (struct sockaddr *)&peer, &peerlen);
 
-    if (peer.so.sa_family == AF_INET6) {
-        peer.ip6.sin6_flowinfo = 0;
-        peer.ip6.sin6_scope_id = 0;
+    if (peer->so.sa_family == AF_INET6) {
+        peer->ip6.sin6_flowinfo = 0;
+        peer->ip6.sin6_scope_id = 0;
     }
 
     if (!collector->comsgHeader(collector, msgbase, recvlen, &msgSize, err)) {
@@ -885,7 +1521,7 @@ fbCollectorReadUDP(
          * app using fixbuf should ignore error codes = NL_READ.**/
 
         /* this will only veto if we set accept from explicitly*/
-        if (!fbCollectorVerifyUDPPeer(collector, &(peer.so), peerlen, err)) {
+        if (!fbCollectorVerifyUDPPeer(collector, &(peer->so), peerlen, err)) {
             return FALSE;
         }
         if (!collector->copostRead(collector, msgbase, msglen, err)) {
@@ -903,6 +1539,242 @@ fbCollectorReadUDP(
     }
 }
 
+/**
+ * fbCollectorReadUDP
+ *
+ *
+ * Implements collector->coread()
+ */
+static gboolean
+fbCollectorReadUDP(
+    fbCollector_t  *collector,
+    uint8_t        *msgbase,
+    size_t         *msglen,
+    GError        **err)
+{
+    ssize_t            recvlen = 0;
+    int                rc;
+    union coll_peer_un peer;
+    socklen_t          peerlen;
+
+    memset(&peer, 0, sizeof(peer));
+
+    rc = fbCollectorHandlePoll(collector);
+
+    if (rc < 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "Interrupted by pipe");
+        /* interrupted by pipe read or other error with poll */
+        return FALSE;
+    }
+
+    peerlen = sizeof(peer);
+    recvlen = recvfrom(collector->stream.fd, msgbase, *msglen, 0,
+                       (struct sockaddr *)&peer, &peerlen);
+    FB_COLLECTOR_COUNT_READ(collector, recvlen);
+
+    return fbCollectorProcessUDP(collector, msgbase, recvlen, msglen,
+                                 &peer, peerlen, err);
+}
+
+#ifdef FB_ENABLE_RECVMMSG
+/*
+ *  The recvmmsg() ring.  One slot per datagram; each slot has its own
+ *  payload buffer, peer address, and control buffer (for SO_RXQ_OVFL).
+ *  `count` is the number of slots filled by the last recvmmsg() and
+ *  `next` is the index of the next slot fbCollectorReadUDPBatch()
+ *  returns.
+ */
+struct fbCollectorUDPRing_st {
+    struct mmsghdr      *msgs;
+    struct iovec        *iov;
+    union coll_peer_un  *peers;
+    uint8_t             *ctrl;
+    uint8_t             *buf;
+    size_t               slotlen;
+    size_t               ctrllen;
+    unsigned int         depth;
+    unsigned int         count;
+    unsigned int         next;
+};
+
+/**
+ * fbCollectorUDPRingFree
+ *
+ *
+ *
+ */
+static void
+fbCollectorUDPRingFree(
+    fbCollectorUDPRing_t  *ring)
+{
+    if (ring) {
+        g_free(ring->buf);
+        g_free(ring->ctrl);
+        g_free(ring->peers);
+        g_free(ring->iov);
+        g_free(ring->msgs);
+        g_slice_free(fbCollectorUDPRing_t, ring);
+    }
+}
+
+/**
+ * fbCollectorUDPRingAlloc
+ *
+ * Allocates a ring of `depth` slots.  Payload buffers are allocated on
+ * the first read, when the message buffer size is known.
+ *
+ */
+static fbCollectorUDPRing_t *
+fbCollectorUDPRingAlloc(
+    unsigned int   depth)
+{
+    fbCollectorUDPRing_t *ring = g_slice_new0(fbCollectorUDPRing_t);
+
+    ring->depth = depth;
+#ifdef SO_RXQ_OVFL
+    ring->ctrllen = CMSG_SPACE(sizeof(uint32_t));
+#endif
+    ring->msgs = g_new0(struct mmsghdr, depth);
+    ring->iov = g_new0(struct iovec, depth);
+    ring->peers = g_new0(union coll_peer_un, depth);
+    if (ring->ctrllen) {
+        ring->ctrl = g_malloc0(ring->ctrllen * depth);
+    }
+
+    return ring;
+}
+
+/**
+ * fbCollectorUDPRingFill
+ *
+ * Waits for the socket (or the interrupt pipe) and reads as many
+ * datagrams as are queued, up to the ring depth, in one recvmmsg().
+ *
+ */
+static gboolean
+fbCollectorUDPRingFill(
+    fbCollector_t         *collector,
+    fbCollectorUDPRing_t  *ring,
+    size_t                 slotlen,
+    GError               **err)
+{
+    struct mmsghdr *m;
+    unsigned int    i;
+    int             rc;
+
+    if (ring->slotlen != slotlen) {
+        g_free(ring->buf);
+        ring->buf = g_malloc(slotlen * ring->depth);
+        ring->slotlen = slotlen;
+        for (i = 0; i < ring->depth; ++i) {
+            ring->iov[i].iov_base = ring->buf + (slotlen * i);
+            ring->iov[i].iov_len = slotlen;
+        }
+    }
+
+    /* recvmmsg() overwrites the name and control lengths */
+    for (i = 0; i < ring->depth; ++i) {
+        m = &ring->msgs[i];
+        memset(&ring->peers[i], 0, sizeof(ring->peers[i]));
+        m->msg_hdr.msg_name = &ring->peers[i];
+        m->msg_hdr.msg_namelen = sizeof(ring->peers[i]);
+        m->msg_hdr.msg_iov = &ring->iov[i];
+        m->msg_hdr.msg_iovlen = 1;
+        m->msg_hdr.msg_control = (ring->ctrllen
+                                  ? ring->ctrl + (ring->ctrllen * i) : NULL);
+        m->msg_hdr.msg_controllen = ring->ctrllen;
+        m->msg_hdr.msg_flags = 0;
+        m->msg_len = 0;
+    }
+
+    ring->count = 0;
+    ring->next = 0;
+
+    rc = fbCollectorHandlePoll(collector);
+    if (rc < 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "Interrupted by pipe");
+        /* interrupted by pipe read or other error with poll */
+        return FALSE;
+    }
+
+    /* poll() said the socket is readable; take whatever is queued */
+    rc = recvmmsg(collector->stream.fd, ring->msgs, ring->depth,
+                  MSG_DONTWAIT, NULL);
+    ++collector->stats.reads;
+    for (i = 0; (int)i < rc; ++i) {
+        collector->stats.read_octets += ring->msgs[i].msg_len;
+    }
+    if (rc <= 0) {
+        if (rc == 0 || errno == EINTR || errno == EWOULDBLOCK) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
+                        "UDP read interrupt or timeout");
+        } else {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "UDP I/O error: %s", strerror(errno));
+        }
+        return FALSE;
+    }
+    ring->count = rc;
+
+#ifdef SO_RXQ_OVFL
+    /* the kernel reports a running total; keep the latest one */
+    for (i = 0; i < ring->count; ++i) {
+        struct msghdr  *mh = &ring->msgs[i].msg_hdr;
+        struct cmsghdr *cm;
+        uint32_t        drops;
+
+        for (cm = CMSG_FIRSTHDR(mh); cm != NULL; cm = CMSG_NXTHDR(mh, cm)) {
+            if (cm->cmsg_level == SOL_SOCKET && cm->cmsg_type == SO_RXQ_OVFL)
+            {
+                memcpy(&drops, CMSG_DATA(cm), sizeof(drops));
+                collector->udp_drops = drops;
+            }
+        }
+    }
+#endif  /* SO_RXQ_OVFL */
+
+    return TRUE;
+}
+
+/**
+ * fbCollectorReadUDPBatch
+ *
+ * Returns the next datagram from the collector's recvmmsg() ring,
+ * refilling the ring when it is empty.
+ *
+ * Implements collector->coread()
+ */
+static gboolean
+fbCollectorReadUDPBatch(
+    fbCollector_t  *collector,
+    uint8_t        *msgbase,
+    size_t         *msglen,
+    GError        **err)
+{
+    fbCollectorUDPRing_t *ring = collector->udp_ring;
+    struct mmsghdr       *m;
+    unsigned int          slot;
+    size_t                len;
+
+    if (ring->next >= ring->count) {
+        if (!fbCollectorUDPRingFill(collector, ring, *msglen, err)) {
+            return FALSE;
+        }
+    }
+
+    slot = ring->next++;
+    m = &ring->msgs[slot];
+    len = (m->msg_len > *msglen) ? *msglen : m->msg_len;
+    memcpy(msgbase, ring->iov[slot].iov_base, len);
+
+    return fbCollectorProcessUDP(collector, msgbase, len, msglen,
+                                 &ring->peers[slot], m->msg_hdr.msg_namelen,
+                                 err);
+}
+#endif  /* FB_ENABLE_RECVMMSG */
+
 /**
  * fbCollectorCloseSocket
  *
@@ -993,6 +1865,7 @@ fbCollectorAllocSocket(
 #endif
       case FB_TCP:
         collector->coread = fbCollectorReadTCP;
+        collector->comp_detect = TRUE;
         break;
       case FB_UDP:
         collector->coread = fbCollectorReadUDP;
@@ -1009,13 +1882,16 @@ fbCollectorAllocSocket(
 #ifdef HAVE_OPENSSL
 
 /**
- * fbCollectorReadTLS
+ * fbCollectorReadDTLS
  *
+ * Reads one message straight from the SSL object.  Used for DTLS, where
+ * each SSL_read() returns a single datagram, and for TLS when a
+ * translator is set.
  *
  * Implements collector->coread()
  */
 static gboolean
-fbCollectorReadTLS(
+fbCollectorReadDTLS(
     fbCollector_t  *collector,
     uint8_t        *msgbase,
     size_t         *msglen,
@@ -1031,6 +1907,7 @@ fbCollectorReadTLS(
     rrem = 4;
     while (rrem) {
         rc = SSL_read(collector->ssl, msgbase, rrem);
+        FB_COLLECTOR_COUNT_READ(collector, rc);
         if (rc > 0) {
             rrem -= rc;
             msgbase += rc;
@@ -1057,6 +1934,7 @@ fbCollectorReadTLS(
     rrem = h_len - 4;
     while (rrem) {
         rc = SSL_read(collector->ssl, msgbase, rrem);
+        FB_COLLECTOR_COUNT_READ(collector, rc);
         if (rc > 0) {
             rrem -= rc;
             msgbase += rc;
@@ -1074,6 +1952,109 @@ fbCollectorReadTLS(
     return TRUE;
 }
 
+/**
+ * fbCollectorFillTLS
+ *
+ * When kernel TLS is receiving, reads the decrypted stream straight from
+ * the socket as fbCollectorFillTCP() does.  The kernel fails such a read
+ * with EIO when the next record is not application data (an alert or a
+ * post-handshake message); that record, and anything OpenSSL already
+ * holds, is left to SSL_read().
+ *
+ * Implements fbCollectorStreamFill_fn for TLS
+ */
+static gboolean
+fbCollectorFillTLS(
+    fbCollector_t  *collector,
+    uint8_t        *buf,
+    size_t          len,
+    size_t         *got,
+    GError        **err)
+{
+    ssize_t rc;
+    int     sslerr;
+    char    errbuf[FB_SSL_ERR_BUFSIZ];
+
+#ifdef FB_ENABLE_KTLS
+    if (collector->ktls_recv && !SSL_has_pending(collector->ssl)) {
+        if (fbCollectorHandlePoll(collector) < 0) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "Interrupted by pipe");
+            return FALSE;
+        }
+        rc = read(collector->stream.fd, buf, len);
+        FB_COLLECTOR_COUNT_READ(collector, rc);
+        if (rc > 0) {
+            *got = rc;
+            return TRUE;
+        } else if (rc == 0) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_EOF,
+                        "TLS connection shutdown");
+            return FALSE;
+        } else if (errno == EINTR) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
+                        "TLS read interrupt");
+            return FALSE;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
+                        "No TLS data ready");
+            return FALSE;
+        } else if (errno != EIO) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "TLS I/O error: %s", strerror(errno));
+            return FALSE;
+        }
+    }
+#endif  /* FB_ENABLE_KTLS */
+
+    rc = SSL_read(collector->ssl, buf, len);
+    FB_COLLECTOR_COUNT_READ(collector, rc);
+    if (rc > 0) {
+        *got = rc;
+        return TRUE;
+    } else if (rc == 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_EOF,
+                    "TLS connection shutdown");
+        return FALSE;
+    } else {
+        if (collector->nonblocking) {
+            sslerr = SSL_get_error(collector->ssl, (int)rc);
+            if (sslerr == SSL_ERROR_WANT_READ ||
+                sslerr == SSL_ERROR_WANT_WRITE)
+            {
+                g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
+                            "No TLS data ready");
+                return FALSE;
+            }
+        }
+        ERR_error_string_n(ERR_get_error(), errbuf, sizeof(errbuf));
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "TLS I/O error: %s", errbuf);
+        ERR_clear_error();
+        return FALSE;
+    }
+}
+
+/**
+ * fbCollectorReadTLS
+ *
+ *
+ * Implements collector->coread()
+ */
+static gboolean
+fbCollectorReadTLS(
+    fbCollector_t  *collector,
+    uint8_t        *msgbase,
+    size_t         *msglen,
+    GError        **err)
+{
+    if (collector->coreadLen != fbCollectorDecodeMsgVL) {
+        return fbCollectorReadDTLS(collector, msgbase, msglen, err);
+    }
+    return fbCollectorReadBuffered(collector, fbCollectorFillTLS,
+                                   msgbase, msglen, err);
+}
+
 /**
  * fbCollectorCloseTLS
  *
@@ -1157,6 +2138,10 @@ fbCollectorOpenTLS(
 
     /* FIXME do post-connection verification */
 
+#ifdef FB_ENABLE_KTLS
+    collector->ktls_recv = BIO_get_ktls_recv(SSL_get_rbio(collector->ssl));
+#endif
+
   end:
     if (!ok) {
         collector->active = FALSE;
@@ -1300,6 +2285,7 @@ fbCollectorAllocTLS(
 #ifdef HAVE_OPENSSL_DTLS_SCTP
       case FB_DTLS_SCTP:
 #endif
+        collector->coread = fbCollectorReadDTLS;
         ok = fbCollectorOpenDTLS(collector, err);
         break;
 #endif /* if HAVE_OPENSSL_DTLS */
@@ -1340,12 +2326,161 @@ fbCollectMessage(
     }
 
     /* Attempt to read message */
-    if (collector->coread(collector, msgbase, msglen, err)) {return TRUE;}
+    if (collector->coread(collector, msgbase, msglen, err)) {
+        ++collector->stats.messages;
+        collector->stats.message_octets += *msglen;
+        return TRUE;
+    }
 
     /* Read failure; signal error */
     return FALSE;
 }
 
+/**
+ * fbCollectMessageInPlace
+ *
+ *
+ *
+ */
+gboolean
+fbCollectMessageInPlace(
+    fbCollector_t  *collector,
+    uint8_t       **msgbase,
+    size_t         *msglen,
+    GError        **err)
+{
+    g_assert(collector->map);
+
+    /* Ensure stream is open */
+    if (!collector->active) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_CONN,
+                    "Collector not active");
+        return FALSE;
+    }
+
+    if (!fbCollectorNextMapped(collector, msgbase, msglen, err)) {
+        return FALSE;
+    }
+    ++collector->stats.messages;
+    collector->stats.message_octets += *msglen;
+    return TRUE;
+}
+
+/**
+ * fbCollectorIsMapped
+ *
+ *
+ *
+ */
+gboolean
+fbCollectorIsMapped(
+    const fbCollector_t  *collector)
+{
+    return (NULL != collector->map);
+}
+
+/**
+ * fbCollectorMapFile
+ *
+ *
+ *
+ */
+gboolean
+fbCollectorMapFile(
+    fbCollector_t  *collector,
+    GError        **err)
+{
+    struct stat st;
+    off_t       pos;
+    void       *map;
+    int         fd;
+
+    if (collector->comp) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Cannot memory-map compressed input");
+        return FALSE;
+    }
+    if (collector->coread != fbCollectorReadFile &&
+        collector->coread != fbCollectorReadMapped)
+    {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Only file collectors may be memory-mapped");
+        return FALSE;
+    }
+    if (collector->map) {
+        return TRUE;
+    }
+    if (collector->translationActive) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Cannot memory-map a collector with a translator");
+        return FALSE;
+    }
+
+    fd = fileno(collector->stream.fp);
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "Cannot stat collector input: %s", strerror(errno));
+        return FALSE;
+    }
+    if (!S_ISREG(st.st_mode) || st.st_size == 0 ||
+        (uint64_t)st.st_size > (uint64_t)SIZE_MAX)
+    {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Collector input is not a mappable regular file");
+        return FALSE;
+    }
+    /* the mapping starts where stdio has got to, read-ahead included */
+    pos = ftello(collector->stream.fp);
+    if (pos < 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "Cannot find collector input position: %s",
+                    strerror(errno));
+        return FALSE;
+    }
+
+    /* private and writable so in-place decoding may never fault the file */
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE, fd, 0);
+    if (MAP_FAILED == map) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "Cannot memory-map collector input: %s", strerror(errno));
+        return FALSE;
+    }
+    /* leave compressed input to stdio, which will detect it */
+    if ((uint64_t)pos + 4 <= (uint64_t)st.st_size &&
+        fbCollectorCompDetect((uint8_t *)map + pos) != FB_COMPRESS_NONE)
+    {
+        munmap(map, (size_t)st.st_size);
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Cannot memory-map compressed input");
+        return FALSE;
+    }
+#ifdef MADV_SEQUENTIAL
+    madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+
+    collector->map = (uint8_t *)map;
+    collector->map_len = (size_t)st.st_size;
+    collector->map_off = ((uint64_t)pos > (uint64_t)st.st_size)
+                         ? (size_t)st.st_size : (size_t)pos;
+    collector->coread = fbCollectorReadMapped;
+    collector->comp_detect = FALSE;
+    return TRUE;
+}
+
+/**
+ * fbCollectorGetCompression
+ *
+ *
+ *
+ */
+fbCompressionMethod_t
+fbCollectorGetCompression(
+    const fbCollector_t  *collector)
+{
+    return collector->comp ? collector->comp->method : FB_COMPRESS_NONE;
+}
+
 /**
  * fbCollectorGetContext
  *
@@ -1409,6 +2544,37 @@ fbCollectorSetFD(
 }
 
 
+/**
+ * fbCollectorSetNonBlocking
+ *
+ *
+ *
+ */
+gboolean
+fbCollectorSetNonBlocking(
+    fbCollector_t  *collector,
+    GError        **err)
+{
+    int flags;
+
+    if (collector->coreadLen != fbCollectorDecodeMsgVL) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Cannot read a translated stream without blocking");
+        return FALSE;
+    }
+    flags = fcntl(collector->stream.fd, F_GETFL);
+    if (flags < 0 ||
+        fcntl(collector->stream.fd, F_SETFL, flags | O_NONBLOCK) < 0)
+    {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "Cannot make collector socket non-blocking: %s",
+                    strerror(errno));
+        return FALSE;
+    }
+    collector->nonblocking = TRUE;
+    return TRUE;
+}
+
 /**
  * fbCollectorClose
  *
@@ -1446,6 +2612,17 @@ fbCollectorFree(
     while (collector->udp_tail) {
         fbCollectorFreeUDPSpec(collector, collector->udp_tail);
     }
+    if (collector->udp_peers) {
+        g_hash_table_destroy(collector->udp_peers);
+    }
+#ifdef FB_ENABLE_RECVMMSG
+    fbCollectorUDPRingFree(collector->udp_ring);
+#endif
+    g_free(collector->rxbuf);
+    fbCollectorCompFree(collector->comp);
+    if (collector->map) {
+        munmap(collector->map, collector->map_len);
+    }
 
     g_slice_free(fbCollector_t, collector);
 }
@@ -1517,6 +2694,9 @@ fbCollectorSetTranslator(
         return FALSE;
     }
 
+    /* translators read their headers from the stream themselves */
+    fbCollectorUnmapFile(collector);
+
     collector->copostRead = postProcFunc;
     collector->coreadLen = vlMessageFunc;
     collector->comsgHeader = headerFunc;
@@ -1589,6 +2769,162 @@ fbCollectorSetUDPMultiSession(
     collector->multi_session = multi_session;
 }
 
+gboolean
+fbCollectorSetUDPBatchSize(
+    fbCollector_t  *collector,
+    unsigned int    depth,
+    GError        **err)
+{
+#ifdef FB_ENABLE_RECVMMSG
+#ifdef SO_RXQ_OVFL
+    int on = 1;
+#endif
+
+    if (collector->coread != fbCollectorReadUDP &&
+        collector->coread != fbCollectorReadUDPBatch)
+    {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_CONN,
+                    "Batched reads are only supported on UDP collectors");
+        return FALSE;
+    }
+    if (depth > FB_UDP_BATCH_MAX) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "UDP batch size %u exceeds maximum %u",
+                    depth, FB_UDP_BATCH_MAX);
+        return FALSE;
+    }
+    if (collector->udp_ring &&
+        collector->udp_ring->next < collector->udp_ring->count)
+    {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Cannot change UDP batch size while datagrams"
+                    " are pending");
+        return FALSE;
+    }
+
+    fbCollectorUDPRingFree(collector->udp_ring);
+    collector->udp_ring = NULL;
+
+    if (depth <= 1) {
+        collector->coread = fbCollectorReadUDP;
+        return TRUE;
+    }
+
+#ifdef SO_RXQ_OVFL
+    /* failure only costs us the drop counter */
+    setsockopt(collector->stream.fd, SOL_SOCKET, SO_RXQ_OVFL,
+               &on, sizeof(on));
+#endif
+    collector->udp_ring = fbCollectorUDPRingAlloc(depth);
+    collector->coread = fbCollectorReadUDPBatch;
+    return TRUE;
+#else  /* FB_ENABLE_RECVMMSG */
+    if (depth <= 1) {
+        return TRUE;
+    }
+    g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                "Batched UDP reads (recvmmsg) are not supported"
+                " on this platform");
+    return FALSE;
+#endif  /* FB_ENABLE_RECVMMSG */
+}
+
+unsigned int
+fbCollectorGetUDPBatchSize(
+    const fbCollector_t  *collector)
+{
+#ifdef FB_ENABLE_RECVMMSG
+    if (collector->udp_ring) {
+        return collector->udp_ring->depth;
+    }
+#endif
+    return 1;
+}
+
+uint32_t
+fbCollectorGetUDPDrops(
+    const fbCollector_t  *collector)
+{
+    if (!collector) {
+        return 0;
+    }
+
+    return collector->udp_drops;
+}
+
+void
+fbCollectorGetStats(
+    const fbCollector_t  *collector,
+    fbStats_t            *stats)
+{
+    *stats = collector->stats;
+}
+
+gboolean
+fbCollectorHasPendingMessages(
+    const fbCollector_t  *collector)
+{
+    uint16_t n_len;
+    size_t   avail;
+
+    if (!collector) {
+        return FALSE;
+    }
+#ifdef FB_ENABLE_RECVMMSG
+    if (collector->udp_ring) {
+        return (collector->udp_ring->next < collector->udp_ring->count);
+    }
+#endif
+    /* a complete message, or an invalid header the next read reports */
+    avail = collector->rx_end - collector->rx_cur;
+    if (avail >= 4) {
+        /* the header may be at any offset in rxbuf */
+        memcpy(&n_len, collector->rxbuf + collector->rx_cur + 2,
+               sizeof(n_len));
+        n_len = g_ntohs(n_len);
+        if (avail >= n_len || n_len < 16) {
+            return TRUE;
+        }
+    }
+    /* compressed input read from the socket but not yet decompressed, or
+     * decompressed output that did not fit in rxbuf */
+    if (collector->comp &&
+        (collector->comp->in_cur < collector->comp->in_end ||
+         collector->comp->out_full))
+    {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+gboolean
+fbCollectorIsReadable(
+    const fbCollector_t  *collector)
+{
+    struct pollfd pfd;
+
+    if (!collector || !collector->active) {
+        return FALSE;
+    }
+    if (fbCollectorHasPendingMessages(collector)) {
+        return TRUE;
+    }
+#ifdef HAVE_OPENSSL
+    /* decrypted bytes held by OpenSSL do not show on the socket */
+    if (collector->ssl && SSL_pending(collector->ssl) > 0) {
+        return TRUE;
+    }
+#endif
+    if (collector->stream.fd < 0) {
+        return FALSE;
+    }
+    pfd.fd = collector->stream.fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    /* readable, at end of stream, or failed: the next read will not block */
+    return (poll(&pfd, 1, 0) > 0 && pfd.revents != 0);
+}
+
 /*
  *  @DISTRIBUTION_STATEMENT_BEGIN@
  *  libfixbuf 3.0.0
@@ -22,6 +22,18 @@
 /* 30 mins in seconds */
 #define FB_UDP_TIMEOUT 1800
 
+/* size of the receive buffer used by TCP and TLS collectors */
+#define FB_COLLECTOR_RXBUF_SIZE (256 * 1024)
+
+/* largest number of datagrams fbCollectorSetUDPBatchSize() accepts */
+#define FB_UDP_BATCH_MAX 1024
+
+/** receive ring used by the recvmmsg() UDP reader; see fbcollector.c */
+typedef struct fbCollectorUDPRing_st fbCollectorUDPRing_t;
+
+/** decompressor of a compressed stream; see fbcollector.c */
+typedef struct fbCollectorComp_st fbCollectorComp_t;
+
 
 /** structure definition of the start of IPFIX & NetFlow messages */
 typedef struct fbCollectorMsgVL_st {
@@ -270,6 +282,8 @@ struct fbCollector_st {
 #ifdef HAVE_OPENSSL
     /** OpenSSL socket, for TLS or DTLS over the socket in fd. */
     SSL                           *ssl;
+    /** TRUE when the kernel decrypts the TLS stream, so fd is read directly */
+    gboolean                       ktls_recv;
 #endif
     fbCollectorRead_fn             coread;
     fbCollectorVLMessageSize_fn    coreadLen;
@@ -279,8 +293,48 @@ struct fbCollector_st {
     fbCollectorTransClose_fn       cotransClose;
     fbCollectorSessionTimeout_fn   cotimeOut;
     void                          *translatorState;
+    /** UDP peers, most recently seen first, for timing them out */
     fbUDPConnSpec_t               *udp_head;
     fbUDPConnSpec_t               *udp_tail;
+    /** UDP peers keyed by address and observation domain */
+    GHashTable                    *udp_peers;
+    /**
+     * Datagrams received by the last recvmmsg() and not yet returned.
+     * NULL unless fbCollectorSetUDPBatchSize() enabled batching.
+     */
+    fbCollectorUDPRing_t          *udp_ring;
+    /** Most recent socket receive queue drop count (SO_RXQ_OVFL). */
+    uint32_t                       udp_drops;
+    /** Counters returned by fbCollectorGetStats(). */
+    fbStats_t                      stats;
+    /**
+     * Receive buffer for TCP and TLS, FB_COLLECTOR_RXBUF_SIZE bytes,
+     * allocated on first read.  Bytes from rx_cur to rx_end have been
+     * read from the stream but not yet returned as messages.
+     */
+    uint8_t                       *rxbuf;
+    size_t                         rx_cur;
+    size_t                         rx_end;
+    /**
+     * Whether the socket is non-blocking; see fbCollectorSetNonBlocking().
+     * Reads then fail with FB_ERROR_NLREAD instead of waiting for data.
+     */
+    gboolean                       nonblocking;
+    /**
+     * Decompressor when the stream is compressed, NULL otherwise.  When
+     * set, rxbuf holds decompressed bytes.
+     */
+    fbCollectorComp_t             *comp;
+    /** Whether the start of the stream has yet to be checked for
+     *  compression; set for file and TCP collectors. */
+    gboolean                       comp_detect;
+    /**
+     * Mapping of a file collector's input, set by fbCollectorMapFile().
+     * map_off is the offset of the next message within the file.
+     */
+    uint8_t                       *map;
+    size_t                         map_len;
+    size_t                         map_off;
 
     /** Cached peer address. Filled in at allocation time */
     union coll_peer_un {
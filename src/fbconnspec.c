@@ -365,6 +365,14 @@ fbConnSpecInitTLS(
         goto end;
     }
 
+#ifdef FB_ENABLE_KTLS
+    /* Let the kernel encrypt and decrypt TLS streams where it can; when it
+     * cannot, OpenSSL quietly keeps doing it in user space */
+    if (spec->transport == FB_TLS_TCP) {
+        SSL_CTX_set_options(ssl_ctx, SSL_OP_ENABLE_KTLS);
+    }
+#endif
+
     /* Require verification */
     SSL_CTX_set_verify(ssl_ctx,
                        SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT,
@@ -12,9 +12,59 @@
  *  ------------------------------------------------------------------------
  */
 
+/* for sendmmsg() */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
 #define _FIXBUF_SOURCE_
 #include <fixbuf/private.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/time.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+#ifdef HAVE_LZ4
+#include <lz4frame.h>
+#endif
+
+#if defined(MSG_WAITFORONE)
+#define FB_ENABLE_SENDMMSG 1
+#endif
+
+/**
+ * The largest depth accepted by fbExporterSetBatch().
+ */
+#define FB_EXPORTER_BATCH_MAX       1024
+
+/**
+ * The largest number of slots accepted by fbExporterStartAsync().
+ */
+#define FB_EXPORTER_ASYNC_MAX       4096
+
+/**
+ * The shortest and longest delay, in milliseconds, between attempts of
+ * the export thread to reopen a closed exporter.
+ */
+#define FB_EXPORTER_ASYNC_RETRY_MIN 10
+#define FB_EXPORTER_ASYNC_RETRY_MAX 1000
+
+/**
+ * File exporter write buffers set by fbExporterSetFileBuffer() are a
+ * multiple of this size and are aligned to it, as O_DIRECT requires.
+ */
+#define FB_EXPORTER_FILE_BLOCK      4096
+
+/**
+ * The largest write buffer accepted by fbExporterSetFileBuffer().
+ */
+#define FB_EXPORTER_FILE_BUFFER_MAX (1 << 30)
 
+/**
+ * Size of the buffer that holds compressed output before it is written;
+ * see fbExporterSetCompression().
+ */
+#define FB_EXPORTER_COMP_BUFSIZE    (256 * 1024)
 
 /**
  * If set in exporter SCTP mode, use simple automatic stream selection as
@@ -29,6 +79,35 @@
  */
 #define FB_F_SCTP_PR_TTL            0x40000000
 
+/**
+ * Adds `_v_` to, or reads, a counter that one thread updates while another
+ * may read it: the export thread's counters and the exporter's octet count
+ * in asynchronous mode.  Relaxed atomic operations take no lock and order
+ * nothing else; a reader sees each counter's latest value, but not a
+ * consistent snapshot of several.
+ */
+#define FB_COUNTER_ADD(_p_, _v_) \
+    __atomic_fetch_add((_p_), (_v_), __ATOMIC_RELAXED)
+#define FB_COUNTER_GET(_p_) \
+    __atomic_load_n((_p_), __ATOMIC_RELAXED)
+#define FB_COUNTER_SET(_p_, _v_) \
+    __atomic_store_n((_p_), (_v_), __ATOMIC_RELAXED)
+
+/**
+ * Counts a call that wrote the exporter's file or socket and returned
+ * `_rc_`, which is negative or zero when nothing was written.  In
+ * asynchronous mode the export thread makes the call while another thread
+ * may call fbExporterGetStats(), so the counters are atomic.
+ */
+#define FB_EXPORTER_COUNT_WRITE(_exporter_, _rc_)                       \
+    do {                                                                \
+        FB_COUNTER_ADD(&(_exporter_)->stats.writes, 1);                 \
+        if ((ssize_t)(_rc_) > 0) {                                      \
+            FB_COUNTER_ADD(&(_exporter_)->stats.write_octets,           \
+                           (uint64_t)(_rc_));                           \
+        }                                                               \
+    } while (0)
+
 /**
  *  Signature of function for exporter->exopen()
  */
@@ -54,6 +133,156 @@ typedef void
 (*fbExporterClose_fn)(
     fbExporter_t  *exporter);
 
+/**
+ *  Messages queued by an exporter in batch mode; see fbExporterSetBatch().
+ *  The messages are stored back to back in `buf`.
+ */
+typedef struct fbExporterBatch_st {
+    /** Queued messages */
+    uint8_t         *buf;
+    /** Size of `buf`: `depth` times the exporter's MTU */
+    size_t           bufsize;
+    /** Octets used in `buf` */
+    size_t           used;
+    /** Length of each queued message */
+    size_t          *lens;
+#ifdef FB_ENABLE_SENDMMSG
+    /** Message vector for sendmmsg(), one per queued message */
+    struct mmsghdr  *msgs;
+    /** I/O vector for sendmmsg(), one per queued message */
+    struct iovec    *iov;
+#endif
+    /** Monotonic time (usec) when the oldest queued message was queued */
+    gint64           first;
+    /** Queue messages no longer than this (usec); 0 for no limit */
+    gint64           latency;
+    /** Number of messages to queue before writing them */
+    unsigned int     depth;
+    /** Number of queued messages */
+    unsigned int     count;
+} fbExporterBatch_t;
+
+/**
+ *  State of an exporter in asynchronous mode; see fbExporterStartAsync().
+ *
+ *  The slots form a single-producer, single-consumer ring.  The thread
+ *  calling fBufEmit() is the producer and is the only one to advance
+ *  `head`.  The export thread is the consumer: it copies the message at
+ *  `tail` to `wbuf`, then claims it by advancing `tail` with a
+ *  compare-and-swap.  Under FB_EXPORTER_ASYNC_DROP_OLDEST the producer
+ *  may also advance `tail` to discard a message, in which case the
+ *  consumer's swap fails and it discards its copy; the producer can only
+ *  reuse a slot once `tail` has passed it, so a copy is never torn.
+ *
+ *  `lock` is used only to sleep and wake: the consumer when the ring is
+ *  empty, the producer when it is full under FB_EXPORTER_ASYNC_BLOCK.  It
+ *  also guards the counters and state the export thread updates.
+ */
+typedef struct fbExporterAsync_st {
+    /** Message buffers, `slots` of the exporter's MTU */
+    uint8_t                  **bufs;
+    /** Length of the message in each slot */
+    size_t                    *lens;
+    /** The export thread's copy of the message it is writing */
+    uint8_t                   *wbuf;
+    pthread_t                  thread;
+    pthread_mutex_t            lock;
+    /** Signaled when a message is added or the thread should stop */
+    pthread_cond_t             ready;
+    /** Signaled when a slot is freed */
+    pthread_cond_t             space;
+    /** What the producer does when the ring is full */
+    fbExporterAsyncPolicy_t    policy;
+    unsigned int               slots;
+    /** Count of messages added; the next slot is head % slots */
+    volatile gint              head;
+    /** Count of messages removed; the oldest slot is tail % slots */
+    volatile gint              tail;
+    /** Set while the export thread waits on `ready` */
+    volatile gint              cons_waiting;
+    /** Set while the producer waits on `space` */
+    volatile gint              prod_waiting;
+    /** Set to make the export thread exit once the ring is empty */
+    volatile gint              stop;
+    /** Counters updated by the producer: queued_* and dropped_*; read
+     * with FB_COUNTER_GET() */
+    fbExporterAsyncStats_t     stats;
+    /** Counters updated by the export thread with FB_COUNTER_ADD() */
+    uint64_t                   written_msgs;
+    uint64_t                   written_octets;
+    uint64_t                   failed_msgs;
+    uint64_t                   failed_octets;
+    uint64_t                   reconnects;
+    /** The last write or open error of the export thread, under `lock` */
+    GError                    *error;
+} fbExporterAsync_t;
+
+/**
+ *  State of a file exporter that uses fbExporterSetFileBuffer(),
+ *  fbExporterSetFileSync(), or fbExporterSetFileRotation().
+ */
+typedef struct fbExporterFile_st {
+    /** Write buffer, or NULL to write through the stdio FILE */
+    uint8_t                   *buf;
+    /** Size of `buf`, a multiple of FB_EXPORTER_FILE_BLOCK */
+    size_t                     bufsize;
+    /** Octets used in `buf` */
+    size_t                     used;
+    /** Whether the file is opened with O_DIRECT (or F_NOCACHE) */
+    gboolean                   direct;
+    /** Decides when to call fdatasync(); NULL to never sync */
+    fbExporterSyncPolicy_fn    sync_fn;
+    void                      *sync_ctx;
+    /** Octets handed to the kernel since the last sync */
+    uint64_t                   unsynced;
+    /** Monotonic time (usec) of the last sync or of the open */
+    gint64                     synced_at;
+    /** Start a new file after this many octets; 0 for no limit */
+    uint64_t                   rotate_octets;
+    /** Start a new file after this long (usec); 0 for no limit */
+    gint64                     rotate_usec;
+    /** Called when a file is closed */
+    fbExporterFileClosed_fn    closed_fn;
+    void                      *closed_ctx;
+    /** Name of the open (or last) file */
+    char                      *path;
+    /** Expansion of the path pattern that produced `path` */
+    char                      *stem;
+    /** Suffix of `path` when `stem` repeats; 0 for none */
+    unsigned int               serial;
+    /** Octets written to the open file */
+    uint64_t                   file_octets;
+    /** Monotonic time (usec) when the open file was opened */
+    gint64                     opened_at;
+} fbExporterFile_t;
+
+/**
+ *  Compression state of an exporter; see fbExporterSetCompression().
+ *  Compressed output collects in `buf` and is handed to exwrite() when
+ *  `buf` cannot hold the output of another message, or after each
+ *  message when `flush` is set.
+ */
+typedef struct fbExporterComp_st {
+    fbCompressionMethod_t      method;
+    /** Compressed output not yet written */
+    uint8_t                   *buf;
+    /** Size of `buf`, FB_EXPORTER_COMP_BUFSIZE */
+    size_t                     bufsize;
+    /** Octets used in `buf` */
+    size_t                     used;
+    /** Whether a frame has been started on the open stream */
+    gboolean                   framed;
+    /** Whether to write each message's output when it is compressed */
+    gboolean                   flush;
+#ifdef HAVE_ZSTD
+    ZSTD_CCtx                 *zctx;
+#endif
+#ifdef HAVE_LZ4
+    LZ4F_cctx                 *lctx;
+    LZ4F_preferences_t         prefs;
+#endif
+} fbExporterComp_t;
+
 struct fbExporter_st {
     /** Specifier used for stream open */
     union {
@@ -75,6 +304,8 @@ struct fbExporter_st {
 #ifdef HAVE_OPENSSL
     /** OpenSSL socket, for TLS or DTLS over the socket in fd. */
     SSL                 *ssl;
+    /** TRUE when the kernel encrypts the TLS stream, so fd is written */
+    gboolean             ktls_send;
 #endif
     /**
      * Callback function to open an exporter.  This is only called by
@@ -94,7 +325,8 @@ struct fbExporter_st {
     /** Stores the `msglen` param of last call to fbExporterWriteBuffer() */
     size_t               msg_len;
     /** Stores number of octets written to the file, stream, or buffer.  This
-     * sum does not include partial (short) writes to a socket. */
+     * sum does not include partial (short) writes to a socket.  In
+     * asynchronous mode the export thread updates it with FB_COUNTER_ADD() */
     size_t               export_len;
     /** SCTP mode. Union of FB_SCTP_F_* flags. */
     uint32_t             sctp_mode;
@@ -102,10 +334,236 @@ struct fbExporter_st {
     int                  sctp_stream;
     /** Partial reliability parameter (see mode) */
     int                  sctp_pr_param;
+    /** Queued messages when batching, NULL otherwise */
+    fbExporterBatch_t   *batch;
+    /** Export thread state in asynchronous mode, NULL otherwise */
+    fbExporterAsync_t   *async;
+    /** Buffering, sync, and rotation state of a file exporter, or NULL */
+    fbExporterFile_t    *file;
+    /** Compression state, or NULL to write messages as they are */
+    fbExporterComp_t    *comp;
+    /** Counters returned by fbExporterGetStats(), updated with
+     * FB_COUNTER_ADD() since the export thread may count writes */
+    fbStats_t            stats;
     uint16_t             mtu;
     gboolean             active;
 };
 
+/**
+ * fbExporterFileNextPath
+ *
+ * Returns the name for the next file of a rotating file exporter: the
+ * exporter's path expanded by strftime() for the current UTC time.  When
+ * the expansion matches the previous file's, a serial number is appended.
+ *
+ * @param exporter
+ *
+ * @return a newly allocated path
+ */
+static char *
+fbExporterFileNextPath(
+    fbExporter_t  *exporter)
+{
+    fbExporterFile_t *file = exporter->file;
+    char              name[FILENAME_MAX];
+    struct tm         tm;
+    time_t            now;
+
+    now = time(NULL);
+    gmtime_r(&now, &tm);
+    if (0 == strftime(name, sizeof(name), exporter->spec.path, &tm)) {
+        g_strlcpy(name, exporter->spec.path, sizeof(name));
+    }
+
+    if (file->stem && 0 == strcmp(file->stem, name)) {
+        ++file->serial;
+        return g_strdup_printf("%s.%u", name, file->serial);
+    }
+    g_free(file->stem);
+    file->stem = g_strdup(name);
+    file->serial = 0;
+    return g_strdup(name);
+}
+
+/**
+ * fbExporterFileSync
+ *
+ * Writes data buffered by stdio and calls fdatasync() (fsync() where it
+ * is not available) on the file of a file exporter.
+ *
+ * @param exporter
+ * @param err
+ *
+ * @return
+ */
+static gboolean
+fbExporterFileSync(
+    fbExporter_t  *exporter,
+    GError       **err)
+{
+    fbExporterFile_t *file = exporter->file;
+    int               fd;
+    int               rc;
+
+    if (file->buf) {
+        fd = exporter->stream.fd;
+    } else {
+        if (fflush(exporter->stream.fp)) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "Couldn't flush %s: %s", file->path, strerror(errno));
+            return FALSE;
+        }
+        fd = fileno(exporter->stream.fp);
+    }
+#if defined(_POSIX_SYNCHRONIZED_IO) && _POSIX_SYNCHRONIZED_IO > 0
+    rc = fdatasync(fd);
+#else
+    rc = fsync(fd);
+#endif
+    if (rc == -1) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "Couldn't sync %s: %s", file->path, strerror(errno));
+        return FALSE;
+    }
+    file->unsynced = 0;
+    file->synced_at = g_get_monotonic_time();
+
+    return TRUE;
+}
+
+/**
+ * fbExporterFileWritten
+ *
+ * Accounts for `len` octets handed to the kernel by a file exporter and
+ * asks the sync policy whether to sync.
+ *
+ * @param exporter
+ * @param len
+ * @param err
+ *
+ * @return
+ */
+static gboolean
+fbExporterFileWritten(
+    fbExporter_t  *exporter,
+    size_t         len,
+    GError       **err)
+{
+    fbExporterFile_t *file = exporter->file;
+    uint64_t          msec;
+
+    file->unsynced += len;
+    if (!file->sync_fn) {
+        return TRUE;
+    }
+    msec = (g_get_monotonic_time() - file->synced_at) / 1000;
+    if (!file->sync_fn(exporter, file->unsynced, msec, file->sync_ctx)) {
+        return TRUE;
+    }
+    return fbExporterFileSync(exporter, err);
+}
+
+/**
+ * fbExporterFileClearDirect
+ *
+ * Turns off O_DIRECT on the file descriptor of a file exporter, for
+ * writes whose offset or length is not a whole block.  The file is
+ * opened with O_DIRECT again when it is rotated or reopened.
+ *
+ * @param exporter
+ */
+static void
+fbExporterFileClearDirect(
+    fbExporter_t  *exporter)
+{
+#ifdef O_DIRECT
+    if (exporter->file->direct) {
+        int flags = fcntl(exporter->stream.fd, F_GETFL);
+        if (flags != -1 && (flags & O_DIRECT)) {
+            fcntl(exporter->stream.fd, F_SETFL, flags & ~O_DIRECT);
+        }
+    }
+#endif  /* O_DIRECT */
+}
+
+/**
+ * fbExporterFileWriteBlock
+ *
+ * Writes `len` octets of the write buffer of a file exporter to its file
+ * descriptor, and empties the buffer.  The rest of a short write is
+ * generally not block aligned, so O_DIRECT is turned off to write it.
+ *
+ * @param exporter
+ * @param len
+ * @param err
+ *
+ * @return
+ */
+static gboolean
+fbExporterFileWriteBlock(
+    fbExporter_t  *exporter,
+    size_t         len,
+    GError       **err)
+{
+    fbExporterFile_t *file = exporter->file;
+    size_t            done = 0;
+    ssize_t           rc;
+
+    file->used = 0;
+    while (done < len) {
+        rc = write(exporter->stream.fd, file->buf + done, len - done);
+        FB_EXPORTER_COUNT_WRITE(exporter, rc);
+        if (rc > 0) {
+            done += rc;
+            if (done < len) {
+                fbExporterFileClearDirect(exporter);
+            }
+        } else if (rc == -1 && errno == EINTR) {
+            continue;
+        } else {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "Couldn't write %u bytes to %s: %s",
+                        (uint32_t)(len - done), file->path,
+                        strerror(errno));
+            return FALSE;
+        }
+    }
+
+    return fbExporterFileWritten(exporter, len, err);
+}
+
+/**
+ * fbExporterFileFinish
+ *
+ * Writes anything left in the write buffer of a file exporter and syncs
+ * the file if it has a sync policy.  The tail of the buffer is not a
+ * whole block, so O_DIRECT is turned off to write it.
+ *
+ * @param exporter
+ * @param err
+ *
+ * @return
+ */
+static gboolean
+fbExporterFileFinish(
+    fbExporter_t  *exporter,
+    GError       **err)
+{
+    fbExporterFile_t *file = exporter->file;
+
+    if (file->buf && file->used) {
+        fbExporterFileClearDirect(exporter);
+        if (!fbExporterFileWriteBlock(exporter, file->used, err)) {
+            return FALSE;
+        }
+    }
+    if (file->sync_fn && file->unsynced) {
+        return fbExporterFileSync(exporter, err);
+    }
+
+    return TRUE;
+}
+
 /**
  * fbExporterOpenFile
  *
@@ -122,10 +580,56 @@ fbExporterOpenFile(
     fbExporter_t  *exporter,
     GError       **err)
 {
-    /* check to see if we're opening stdout */
-    if ((strlen(exporter->spec.path) == 1) &&
-        (exporter->spec.path[0] == '-'))
+    fbExporterFile_t *file = exporter->file;
+    const char       *path = exporter->spec.path;
+    int               flags;
+    int               fd;
+
+    if (file) {
+        /* see fbExporterSetFileBuffer() and fbExporterSetFileRotation() */
+        g_free(file->path);
+        if (file->rotate_octets || file->rotate_usec) {
+            file->path = fbExporterFileNextPath(exporter);
+        } else {
+            file->path = g_strdup(exporter->spec.path);
+        }
+        path = file->path;
+
+        if (file->buf) {
+            flags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef O_DIRECT
+            if (file->direct) {
+                flags |= O_DIRECT;
+            }
+#endif
+            fd = open(path, flags, 0666);
+            if (fd == -1) {
+                g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                            "Couldn't open %s for export: %s",
+                            path, strerror(errno));
+                return FALSE;
+            }
+#if !defined(O_DIRECT) && defined(F_NOCACHE)
+            if (file->direct) {
+                fcntl(fd, F_NOCACHE, 1);
+            }
+#endif
+            exporter->stream.fd = fd;
+        } else {
+            exporter->stream.fp = fopen(path, "w");
+        }
+        file->used = 0;
+        file->unsynced = 0;
+        file->file_octets = 0;
+        file->opened_at = file->synced_at = g_get_monotonic_time();
+        if (file->buf) {
+            exporter->active = TRUE;
+            return TRUE;
+        }
+    } else if ((strlen(exporter->spec.path) == 1) &&
+               (exporter->spec.path[0] == '-'))
     {
+        /* check to see if we're opening stdout */
         /* don't open a terminal */
         if (isatty(fileno(stdout))) {
             g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
@@ -144,7 +648,7 @@ fbExporterOpenFile(
     if (!exporter->stream.fp) {
         g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
                     "Couldn't open %s for export: %s",
-                    exporter->spec.path, strerror(errno));
+                    path, strerror(errno));
         return FALSE;
     }
 
@@ -173,11 +677,47 @@ fbExporterWriteFile(
     size_t         msglen,
     GError       **err)
 {
-    if (msglen != fwrite(msgbase, 1, msglen, exporter->stream.fp)) {
-        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
-                    "Couldn't write %u bytes to %s: %s",
-                    (uint32_t)msglen, exporter->spec.path, strerror(errno));
-        return FALSE;
+    fbExporterFile_t *file = exporter->file;
+    size_t            len;
+
+    if (!file) {
+        len = fwrite(msgbase, 1, msglen, exporter->stream.fp);
+        FB_EXPORTER_COUNT_WRITE(exporter, len);
+        if (msglen != len) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "Couldn't write %u bytes to %s: %s",
+                        (uint32_t)msglen, exporter->spec.path,
+                        strerror(errno));
+            return FALSE;
+        }
+        return TRUE;
+    }
+
+    file->file_octets += msglen;
+    if (!file->buf) {
+        len = fwrite(msgbase, 1, msglen, exporter->stream.fp);
+        FB_EXPORTER_COUNT_WRITE(exporter, len);
+        if (msglen != len) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "Couldn't write %u bytes to %s: %s",
+                        (uint32_t)msglen, file->path, strerror(errno));
+            return FALSE;
+        }
+        return fbExporterFileWritten(exporter, msglen, err);
+    }
+
+    /* fill the buffer, writing it each time it is full */
+    while (msglen) {
+        len = MIN(msglen, file->bufsize - file->used);
+        memcpy(file->buf + file->used, msgbase, len);
+        file->used += len;
+        msgbase += len;
+        msglen -= len;
+        if (file->used == file->bufsize &&
+            !fbExporterFileWriteBlock(exporter, file->bufsize, err))
+        {
+            return FALSE;
+        }
     }
 
     return TRUE;
@@ -196,6 +736,24 @@ static void
 fbExporterCloseFile(
     fbExporter_t  *exporter)
 {
+    fbExporterFile_t *file = exporter->file;
+
+    if (file) {
+        /* nobody to report a failure to */
+        fbExporterFileFinish(exporter, NULL);
+        if (file->buf) {
+            close(exporter->stream.fd);
+            exporter->stream.fd = -1;
+        } else {
+            fclose(exporter->stream.fp);
+            exporter->stream.fp = NULL;
+        }
+        exporter->active = FALSE;
+        if (file->closed_fn) {
+            file->closed_fn(exporter, file->path, file->closed_ctx);
+        }
+        return;
+    }
     if (exporter->stream.fp == stdout) {
         fflush(exporter->stream.fp);
     } else {
@@ -236,96 +794,544 @@ fbExporterAllocFile(
 }
 
 /**
- * fbExporterOpenBuffer
- *
- * Implements exporter->exopen()
+ * fbExporterCompDrain
  *
+ * Writes the compressed output held by a compressing exporter.
  *
  * @param exporter
  * @param err
+ *
+ * @return
  */
 static gboolean
-fbExporterOpenBuffer(
+fbExporterCompDrain(
     fbExporter_t  *exporter,
     GError       **err)
 {
-    (void)err;
-    /* set active flag */
-    exporter->active = TRUE;
+    fbExporterComp_t *comp = exporter->comp;
+    size_t            used = comp->used;
 
-    return TRUE;
+    if (!used) {
+        return TRUE;
+    }
+    comp->used = 0;
+    return exporter->exwrite(exporter, comp->buf, used, err);
 }
 
 /**
- * fbExporterCloseBuffer
- *
- * Implements exporter->exclose()
+ * fbExporterCompRestart
  *
+ * Forgets the frame of a compressing exporter after its stream is
+ * (re)opened, so the next message starts a new one.
  *
  * @param exporter
  *
  */
 static void
-fbExporterCloseBuffer(
+fbExporterCompRestart(
     fbExporter_t  *exporter)
 {
-    exporter->active = FALSE;
+    if (exporter->comp) {
+        exporter->comp->framed = FALSE;
+        exporter->comp->used = 0;
+    }
 }
 
 /**
- * fbExporterWriteBuffer
- *
- * Implements exporter->exwrite()
+ * fbExporterCompWrite
  *
+ * Compresses a message and writes the compressed output as `buf` fills.
+ * Used in place of exporter->exwrite() by a compressing exporter.
  *
  * @param exporter
  * @param msgbase
  * @param msglen
  * @param err
+ *
+ * @return
  */
 static gboolean
-fbExporterWriteBuffer(
+fbExporterCompWrite(
     fbExporter_t  *exporter,
     uint8_t       *msgbase,
     size_t         msglen,
     GError       **err)
 {
-    (void)err;
-    memcpy(exporter->stream.buffer, msgbase, msglen);
-    exporter->msg_len = msglen;
+    fbExporterComp_t *comp = exporter->comp;
 
-    return TRUE;
+    switch (comp->method) {
+#ifdef HAVE_ZSTD
+      case FB_COMPRESS_ZSTD:
+        {
+            ZSTD_inBuffer     in = { msgbase, msglen, 0 };
+            ZSTD_outBuffer    out;
+            ZSTD_EndDirective mode;
+            size_t            rc;
+
+            if (!comp->framed) {
+                ZSTD_CCtx_reset(comp->zctx, ZSTD_reset_session_only);
+                comp->framed = TRUE;
+            }
+            mode = comp->flush ? ZSTD_e_flush : ZSTD_e_continue;
+            do {
+                out.dst = comp->buf;
+                out.size = comp->bufsize;
+                out.pos = comp->used;
+                rc = ZSTD_compressStream2(comp->zctx, &out, &in, mode);
+                if (ZSTD_isError(rc)) {
+                    g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                                "zstd compression failed: %s",
+                                ZSTD_getErrorName(rc));
+                    return FALSE;
+                }
+                comp->used = out.pos;
+                if (comp->used == comp->bufsize &&
+                    !fbExporterCompDrain(exporter, err))
+                {
+                    return FALSE;
+                }
+            } while (in.pos < in.size || (mode == ZSTD_e_flush && rc));
+            break;
+        }
+#endif  /* HAVE_ZSTD */
+#ifdef HAVE_LZ4
+      case FB_COMPRESS_LZ4:
+        {
+            size_t rc;
+
+            if (comp->bufsize - comp->used <
+                LZ4F_HEADER_SIZE_MAX + LZ4F_compressBound(msglen, &comp->prefs)
+                && !fbExporterCompDrain(exporter, err))
+            {
+                return FALSE;
+            }
+            if (!comp->framed) {
+                rc = LZ4F_compressBegin(comp->lctx, comp->buf + comp->used,
+                                        comp->bufsize - comp->used,
+                                        &comp->prefs);
+                if (LZ4F_isError(rc)) {
+                    goto LZ4ERR;
+                }
+                comp->used += rc;
+                comp->framed = TRUE;
+            }
+            rc = LZ4F_compressUpdate(comp->lctx, comp->buf + comp->used,
+                                     comp->bufsize - comp->used,
+                                     msgbase, msglen, NULL);
+            if (LZ4F_isError(rc)) {
+                goto LZ4ERR;
+            }
+            comp->used += rc;
+            if (comp->flush) {
+                rc = LZ4F_flush(comp->lctx, comp->buf + comp->used,
+                                comp->bufsize - comp->used, NULL);
+                if (LZ4F_isError(rc)) {
+                    goto LZ4ERR;
+                }
+                comp->used += rc;
+            }
+            break;
+          LZ4ERR:
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "LZ4 compression failed: %s", LZ4F_getErrorName(rc));
+            return FALSE;
+        }
+#endif  /* HAVE_LZ4 */
+      default:
+        g_assert_not_reached();
+    }
+
+    return comp->flush ? fbExporterCompDrain(exporter, err) : TRUE;
 }
 
 /**
- * fbExporterAllocBuffer
+ * fbExporterCompEnd
  *
+ * Ends the frame of a compressing exporter and writes all of its
+ * output.  Called before the exporter's stream is closed.
  *
+ * @param exporter
+ * @param err
  *
+ * @return
  */
-fbExporter_t *
-fbExporterAllocBuffer(
-    uint8_t   *buf,
-    uint16_t   bufsize)
+static gboolean
+fbExporterCompEnd(
+    fbExporter_t  *exporter,
+    GError       **err)
 {
-    fbExporter_t *exporter = NULL;
-
-    exporter = g_slice_new0(fbExporter_t);
-    exporter->exwrite = fbExporterWriteBuffer;
-    exporter->exopen = fbExporterOpenBuffer;
-    exporter->exclose = fbExporterCloseBuffer;
-    exporter->mtu = bufsize;
-    exporter->stream.buffer = buf;
+    fbExporterComp_t *comp = exporter->comp;
 
-    return exporter;
-}
+    if (!comp || !comp->framed) {
+        return TRUE;
+    }
+    comp->framed = FALSE;
 
-/**
- * fbExporterAllocFP
- *
- * @param fp
- *
- * @return
+    switch (comp->method) {
+#ifdef HAVE_ZSTD
+      case FB_COMPRESS_ZSTD:
+        {
+            ZSTD_inBuffer  in = { NULL, 0, 0 };
+            ZSTD_outBuffer out;
+            size_t         rc;
+
+            do {
+                out.dst = comp->buf;
+                out.size = comp->bufsize;
+                out.pos = comp->used;
+                rc = ZSTD_compressStream2(comp->zctx, &out, &in, ZSTD_e_end);
+                if (ZSTD_isError(rc)) {
+                    g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                                "zstd compression failed: %s",
+                                ZSTD_getErrorName(rc));
+                    return FALSE;
+                }
+                comp->used = out.pos;
+                if (rc && !fbExporterCompDrain(exporter, err)) {
+                    return FALSE;
+                }
+            } while (rc);
+            break;
+        }
+#endif  /* HAVE_ZSTD */
+#ifdef HAVE_LZ4
+      case FB_COMPRESS_LZ4:
+        {
+            size_t rc;
+
+            if (comp->bufsize - comp->used < LZ4F_compressBound(0, &comp->prefs)
+                && !fbExporterCompDrain(exporter, err))
+            {
+                return FALSE;
+            }
+            rc = LZ4F_compressEnd(comp->lctx, comp->buf + comp->used,
+                                  comp->bufsize - comp->used, NULL);
+            if (LZ4F_isError(rc)) {
+                g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                            "LZ4 compression failed: %s",
+                            LZ4F_getErrorName(rc));
+                return FALSE;
+            }
+            comp->used += rc;
+            break;
+        }
+#endif  /* HAVE_LZ4 */
+      default:
+        g_assert_not_reached();
+    }
+
+    return fbExporterCompDrain(exporter, err);
+}
+
+/**
+ * fbExporterCompFree
+ *
+ *
+ *
+ */
+static void
+fbExporterCompFree(
+    fbExporterComp_t  *comp)
+{
+    if (!comp) {
+        return;
+    }
+#ifdef HAVE_ZSTD
+    if (comp->zctx) {
+        ZSTD_freeCCtx(comp->zctx);
+    }
+#endif
+#ifdef HAVE_LZ4
+    if (comp->lctx) {
+        LZ4F_freeCompressionContext(comp->lctx);
+    }
+#endif
+    g_free(comp->buf);
+    g_slice_free(fbExporterComp_t, comp);
+}
+
+/**
+ * fbExporterFileSetup
+ *
+ * Returns the file state of a file exporter, allocating it if needed, or
+ * sets `err` and returns NULL when the exporter cannot use it.
+ *
+ * @param exporter
+ * @param err
+ *
+ * @return
+ */
+static fbExporterFile_t *
+fbExporterFileSetup(
+    fbExporter_t  *exporter,
+    GError       **err)
+{
+    if (exporter->exopen != fbExporterOpenFile ||
+        0 == strcmp(exporter->spec.path, "-"))
+    {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "File buffering, sync, and rotation are only supported"
+                    " for exporters to named files");
+        return NULL;
+    }
+    if (exporter->batch || exporter->async) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Cannot change file options of a batched or"
+                    " asynchronous exporter");
+        return NULL;
+    }
+    if (!exporter->file) {
+        exporter->file = g_slice_new0(fbExporterFile_t);
+    }
+    return exporter->file;
+}
+
+/**
+ * fbExporterSetFileBuffer
+ *
+ *
+ *
+ */
+gboolean
+fbExporterSetFileBuffer(
+    fbExporter_t  *exporter,
+    size_t         bufsize,
+    gboolean       direct,
+    GError       **err)
+{
+    fbExporterFile_t *file;
+    void             *buf = NULL;
+
+    if (exporter->active) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Cannot change the file buffer of an open exporter");
+        return FALSE;
+    }
+    if (bufsize > FB_EXPORTER_FILE_BUFFER_MAX) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "File buffer size %zu is larger than the maximum %u",
+                    bufsize, FB_EXPORTER_FILE_BUFFER_MAX);
+        return FALSE;
+    }
+    if (direct && !bufsize) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Direct I/O requires a file buffer");
+        return FALSE;
+    }
+#if !defined(O_DIRECT) && !defined(F_NOCACHE)
+    if (direct) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Direct I/O is not supported on this platform");
+        return FALSE;
+    }
+#endif
+    if (!(file = fbExporterFileSetup(exporter, err))) {
+        return FALSE;
+    }
+
+    bufsize = ((bufsize + FB_EXPORTER_FILE_BLOCK - 1)
+               / FB_EXPORTER_FILE_BLOCK * FB_EXPORTER_FILE_BLOCK);
+    if (bufsize && posix_memalign(&buf, FB_EXPORTER_FILE_BLOCK, bufsize)) {
+        g_error("Unable to allocate %zu byte file buffer", bufsize);
+    }
+    free(file->buf);
+    file->buf = (uint8_t *)buf;
+    file->bufsize = bufsize;
+    file->used = 0;
+    file->direct = direct;
+
+    return TRUE;
+}
+
+/**
+ * fbExporterSetFileSync
+ *
+ *
+ *
+ */
+gboolean
+fbExporterSetFileSync(
+    fbExporter_t             *exporter,
+    fbExporterSyncPolicy_fn   policy,
+    void                     *ctx,
+    GError                  **err)
+{
+    fbExporterFile_t *file;
+
+    if (!(file = fbExporterFileSetup(exporter, err))) {
+        return FALSE;
+    }
+    file->sync_fn = policy;
+    file->sync_ctx = ctx;
+    file->synced_at = g_get_monotonic_time();
+
+    return TRUE;
+}
+
+/**
+ * fbExporterSetFileRotation
+ *
+ *
+ *
+ */
+gboolean
+fbExporterSetFileRotation(
+    fbExporter_t             *exporter,
+    uint64_t                  max_octets,
+    uint32_t                  max_seconds,
+    fbExporterFileClosed_fn   closed,
+    void                     *ctx,
+    GError                  **err)
+{
+    fbExporterFile_t *file;
+
+    if (!(file = fbExporterFileSetup(exporter, err))) {
+        return FALSE;
+    }
+    file->rotate_octets = max_octets;
+    file->rotate_usec = (gint64)max_seconds * G_USEC_PER_SEC;
+    file->closed_fn = closed;
+    file->closed_ctx = ctx;
+
+    return TRUE;
+}
+
+/**
+ * fbExporterRotateDue
+ *
+ *
+ * NOTE: fixbuf/private.h function
+ *
+ */
+gboolean
+fbExporterRotateDue(
+    const fbExporter_t  *exporter)
+{
+    const fbExporterFile_t *file = exporter->file;
+
+    if (!file || !exporter->active) {
+        return FALSE;
+    }
+    return ((file->rotate_octets && file->file_octets >= file->rotate_octets)
+            || (file->rotate_usec &&
+                g_get_monotonic_time() - file->opened_at >= file->rotate_usec));
+}
+
+/**
+ * fbExporterRotate
+ *
+ *
+ * NOTE: fixbuf/private.h function
+ *
+ */
+gboolean
+fbExporterRotate(
+    fbExporter_t  *exporter,
+    GError       **err)
+{
+    gboolean ok;
+
+    if (!exporter->active) {
+        return TRUE;
+    }
+    ok = (fbExporterCompEnd(exporter, err) &&
+          fbExporterFileFinish(exporter, err));
+    exporter->exclose(exporter);
+
+    return ok;
+}
+
+/**
+ * fbExporterOpenBuffer
+ *
+ * Implements exporter->exopen()
+ *
+ *
+ * @param exporter
+ * @param err
+ */
+static gboolean
+fbExporterOpenBuffer(
+    fbExporter_t  *exporter,
+    GError       **err)
+{
+    (void)err;
+    /* set active flag */
+    exporter->active = TRUE;
+
+    return TRUE;
+}
+
+/**
+ * fbExporterCloseBuffer
+ *
+ * Implements exporter->exclose()
+ *
+ *
+ * @param exporter
+ *
+ */
+static void
+fbExporterCloseBuffer(
+    fbExporter_t  *exporter)
+{
+    exporter->active = FALSE;
+}
+
+/**
+ * fbExporterWriteBuffer
+ *
+ * Implements exporter->exwrite()
+ *
+ *
+ * @param exporter
+ * @param msgbase
+ * @param msglen
+ * @param err
+ */
+static gboolean
+fbExporterWriteBuffer(
+    fbExporter_t  *exporter,
+    uint8_t       *msgbase,
+    size_t         msglen,
+    GError       **err)
+{
+    (void)err;
+    memcpy(exporter->stream.buffer, msgbase, msglen);
+    exporter->msg_len = msglen;
+
+    return TRUE;
+}
+
+/**
+ * fbExporterAllocBuffer
+ *
+ *
+ *
+ */
+fbExporter_t *
+fbExporterAllocBuffer(
+    uint8_t   *buf,
+    uint16_t   bufsize)
+{
+    fbExporter_t *exporter = NULL;
+
+    exporter = g_slice_new0(fbExporter_t);
+    exporter->exwrite = fbExporterWriteBuffer;
+    exporter->exopen = fbExporterOpenBuffer;
+    exporter->exclose = fbExporterCloseBuffer;
+    exporter->mtu = bufsize;
+    exporter->stream.buffer = buf;
+
+    return exporter;
+}
+
+/**
+ * fbExporterAllocFP
+ *
+ * @param fp
+ *
+ * @return
  */
 fbExporter_t *
 fbExporterAllocFP(
@@ -550,6 +1556,7 @@ fbExporterWriteSCTP(
                       exporter->sctp_stream,  /* stream */
                       sctp_ttl,     /* message lifetime (ms) */
                       0);           /* context */
+    FB_EXPORTER_COUNT_WRITE(exporter, rc);
 
     if (rc == (ssize_t)msglen) {
         return TRUE;
@@ -596,6 +1603,7 @@ fbExporterWriteTCP(
     ssize_t rc;
 
     rc = write(exporter->stream.fd, msgbase, msglen);
+    FB_EXPORTER_COUNT_WRITE(exporter, rc);
     if (rc == (ssize_t)msglen) {
         return TRUE;
     } else if (rc == -1) {
@@ -640,6 +1648,7 @@ fbExporterWriteUDP(
 
     /* Send the buffer as a single message */
     rc = send(exporter->stream.fd, msgbase, msglen, 0);
+    FB_EXPORTER_COUNT_WRITE(exporter, rc);
 
     /* Deal with the results */
     if (rc == (ssize_t)msglen) {
@@ -701,6 +1710,8 @@ fbExporterOpenTLS(
     char     errbuf[FB_SSL_ERR_BUFSIZ];
     gboolean ok = TRUE;
 
+    exporter->ktls_send = FALSE;
+
     /* Initialize SSL context if necessary */
     if (!exporter->spec.conn->vssl_ctx) {
         if (!fbConnSpecInitTLS(exporter->spec.conn, FALSE, err)) {
@@ -748,6 +1759,10 @@ fbExporterOpenTLS(
 
     /* FIXME do post-connection verification */
 
+#ifdef FB_ENABLE_KTLS
+    exporter->ktls_send = BIO_get_ktls_send(SSL_get_wbio(exporter->ssl));
+#endif
+
   end:
     if (!ok) {
         exporter->active = FALSE;
@@ -856,6 +1871,9 @@ fbExporterOpenDTLS(
 /**
  * fbExporterWriteTLS
  *
+ * When kernel TLS is sending, writes to the socket as
+ * fbExporterWriteTCP() does and lets the kernel encrypt.
+ *
  * Implements exporter->exwrite()
  *
  *
@@ -876,8 +1894,15 @@ fbExporterWriteTLS(
     char errbuf[FB_SSL_ERR_BUFSIZ];
     int  rc;
 
+#ifdef FB_ENABLE_KTLS
+    if (exporter->ktls_send) {
+        return fbExporterWriteTCP(exporter, msgbase, msglen, err);
+    }
+#endif
+
     while (msglen) {
         rc = SSL_write(exporter->ssl, msgbase, msglen);
+        FB_EXPORTER_COUNT_WRITE(exporter, rc);
         if (rc <= 0) {
             ERR_error_string_n(ERR_get_error(), errbuf, sizeof(errbuf));
             g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
@@ -1077,37 +2102,901 @@ fbExporterSetPRTTL(
 #endif  /* 0 */
 
 /**
- * fbExportMessage
+ * fbExporterBatchFree
  *
  *
- * NOTE: fixbuf/private.h function
  *
- * @param exporter
- * @param msgbase
- * @param msglen
- * @param err
+ */
+static void
+fbExporterBatchFree(
+    fbExporterBatch_t  *batch)
+{
+    if (batch) {
+        g_free(batch->buf);
+        g_free(batch->lens);
+#ifdef FB_ENABLE_SENDMMSG
+        g_free(batch->msgs);
+        g_free(batch->iov);
+#endif
+        g_slice_free(fbExporterBatch_t, batch);
+    }
+}
+
+/**
+ * fbExporterBatchWriteUDP
  *
- * @return
+ * Sends the queued messages of a UDP exporter, as many per call to
+ * sendmmsg() as the kernel accepts.  Falls back to
+ * fbExporterWriteUDP() for the rest of the messages on a send error so
+ * that such errors are reported the same way.
+ *
+ * Returns the number of messages written, in `written`.
  *
  */
-gboolean
-fbExportMessage(
+static gboolean
+fbExporterBatchWriteUDP(
     fbExporter_t  *exporter,
-    uint8_t       *msgbase,
-    size_t         msglen,
+    unsigned int  *written,
     GError       **err)
 {
-    /* Ensure stream is open */
-    if (!exporter->active) {
-        g_assert(exporter->exopen);
-        if (!exporter->exopen(exporter, err)) {return FALSE;}
-        exporter->export_len = 0;
+    fbExporterBatch_t *batch = exporter->batch;
+    unsigned int       i = 0;
+    size_t             off = 0;
+#ifdef FB_ENABLE_SENDMMSG
+    int                rc;
+    int                j;
+
+    for (i = 0; i < batch->count; ++i) {
+        batch->iov[i].iov_base = batch->buf + off;
+        batch->iov[i].iov_len = batch->lens[i];
+        memset(&batch->msgs[i], 0, sizeof(batch->msgs[i]));
+        batch->msgs[i].msg_hdr.msg_iov = &batch->iov[i];
+        batch->msgs[i].msg_hdr.msg_iovlen = 1;
+        off += batch->lens[i];
     }
 
-    /* Attempt to write message */
-    if (exporter->exwrite(exporter, msgbase, msglen, err)) {
-        exporter->export_len += msglen;
-        return TRUE;
+    i = 0;
+    off = 0;
+    while (i < batch->count) {
+        rc = sendmmsg(exporter->stream.fd, batch->msgs + i,
+                      batch->count - i, 0);
+        ++exporter->stats.writes;
+        if (rc <= 0) {
+            break;
+        }
+        for (j = 0; j < rc; ++j, ++i) {
+            exporter->stats.write_octets += batch->msgs[i].msg_len;
+            if (batch->msgs[i].msg_len != batch->lens[i]) {
+                g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                            "Short write on UDP send: wrote %u while "
+                            "writing %u", batch->msgs[i].msg_len,
+                            (uint32_t)batch->lens[i]);
+                *written = i;
+                return FALSE;
+            }
+            off += batch->lens[i];
+        }
+    }
+#endif  /* FB_ENABLE_SENDMMSG */
+
+    for ( ; i < batch->count; ++i) {
+        if (!fbExporterWriteUDP(exporter, batch->buf + off, batch->lens[i],
+                                err))
+        {
+            *written = i;
+            return FALSE;
+        }
+        off += batch->lens[i];
+    }
+
+    *written = i;
+    return TRUE;
+}
+
+/**
+ * fbExporterBatchWriteStream
+ *
+ * Writes the queued messages of a TCP or file exporter with one call
+ * to write() or fwrite(), which is continued after a partial write to
+ * a socket or a write interrupted by a signal.  A TLS exporter writes them with one fbExporterWriteTLS(),
+ * which is a write() when kernel TLS is sending.  Returns the number of
+ * complete messages written, in `written`.
+ *
+ */
+static gboolean
+fbExporterBatchWriteStream(
+    fbExporter_t  *exporter,
+    unsigned int  *written,
+    GError       **err)
+{
+    fbExporterBatch_t *batch = exporter->batch;
+    size_t             done = 0;
+    size_t             off = 0;
+    ssize_t            rc;
+    unsigned int       i;
+    gboolean           ok = TRUE;
+
+    if (exporter->exwrite == fbExporterWriteFile) {
+        done = fwrite(batch->buf, 1, batch->used, exporter->stream.fp);
+        FB_EXPORTER_COUNT_WRITE(exporter, done);
+        if (done != batch->used) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "Couldn't write %u bytes to %s: %s",
+                        (uint32_t)batch->used, exporter->spec.path,
+                        strerror(errno));
+            ok = FALSE;
+        }
+#ifdef HAVE_OPENSSL
+    } else if (exporter->exwrite == fbExporterWriteTLS) {
+        ok = fbExporterWriteTLS(exporter, batch->buf, batch->used, err);
+        done = ok ? batch->used : 0;
+#endif
+    } else {
+        while (done < batch->used) {
+            rc = write(exporter->stream.fd, batch->buf + done,
+                       batch->used - done);
+            FB_EXPORTER_COUNT_WRITE(exporter, rc);
+            if (rc > 0) {
+                done += rc;
+                continue;
+            }
+            if (rc == -1 && errno == EINTR) {
+                continue;
+            }
+            if (rc == -1 && errno == EPIPE) {
+                g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLWRITE,
+                            "Connection reset (EPIPE) on TCP write");
+            } else {
+                g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                            "I/O error: %s", strerror(errno));
+            }
+            ok = FALSE;
+            break;
+        }
+    }
+
+    /* only messages written in full count as written */
+    for (i = 0; i < batch->count && off + batch->lens[i] <= done; ++i) {
+        off += batch->lens[i];
+    }
+    *written = i;
+    return ok;
+}
+
+/**
+ * fbExporterBatchWrite
+ *
+ * Writes the messages queued on `exporter` and empties the queue.  On
+ * failure closes the exporter, as fbExportMessage() does.  The octet
+ * count includes each message that was written in full.
+ *
+ */
+static gboolean
+fbExporterBatchWrite(
+    fbExporter_t  *exporter,
+    GError       **err)
+{
+    fbExporterBatch_t *batch = exporter->batch;
+    unsigned int       written = 0;
+    unsigned int       i;
+    gboolean           ok;
+
+    if (0 == batch->count) {
+        return TRUE;
+    }
+
+    if (exporter->exwrite == fbExporterWriteUDP) {
+        ok = fbExporterBatchWriteUDP(exporter, &written, err);
+    } else {
+        ok = fbExporterBatchWriteStream(exporter, &written, err);
+    }
+
+    for (i = 0; i < written; ++i) {
+        exporter->export_len += batch->lens[i];
+    }
+    batch->count = 0;
+    batch->used = 0;
+
+    if (!ok && exporter->exclose) {
+        exporter->exclose(exporter);
+    }
+    return ok;
+}
+
+/**
+ * fbExporterBatchAdd
+ *
+ * Queues a message on an exporter in batch mode, writing the queue
+ * when it is full or its oldest message has waited the maximum
+ * latency.
+ *
+ */
+static gboolean
+fbExporterBatchAdd(
+    fbExporter_t  *exporter,
+    uint8_t       *msgbase,
+    size_t         msglen,
+    GError       **err)
+{
+    fbExporterBatch_t *batch = exporter->batch;
+
+    if (batch->used + msglen > batch->bufsize) {
+        if (!fbExporterBatchWrite(exporter, err)) {
+            return FALSE;
+        }
+    }
+    if (msglen > batch->bufsize) {
+        /* cannot queue; write it alone */
+        if (exporter->exwrite(exporter, msgbase, msglen, err)) {
+            exporter->export_len += msglen;
+            return TRUE;
+        }
+        if (exporter->exclose) {exporter->exclose(exporter);}
+        return FALSE;
+    }
+
+    if (0 == batch->count) {
+        batch->first = g_get_monotonic_time();
+    }
+    memcpy(batch->buf + batch->used, msgbase, msglen);
+    batch->lens[batch->count++] = msglen;
+    batch->used += msglen;
+
+    if (batch->count == batch->depth ||
+        (batch->latency &&
+         g_get_monotonic_time() - batch->first >= batch->latency))
+    {
+        return fbExporterBatchWrite(exporter, err);
+    }
+    return TRUE;
+}
+
+/**
+ * fbExporterSetBatch
+ *
+ *
+ *
+ */
+gboolean
+fbExporterSetBatch(
+    fbExporter_t  *exporter,
+    unsigned int   depth,
+    unsigned int   max_latency_ms,
+    GError       **err)
+{
+    fbExporterBatch_t *batch;
+
+    if (exporter->async) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Cannot batch an exporter in asynchronous mode");
+        return FALSE;
+    }
+    if (exporter->file) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Cannot batch a file exporter that has file options");
+        return FALSE;
+    }
+    if (exporter->comp) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Cannot batch a compressing exporter");
+        return FALSE;
+    }
+    if (exporter->exwrite != fbExporterWriteUDP &&
+        exporter->exwrite != fbExporterWriteTCP &&
+        exporter->exwrite != fbExporterWriteFile
+#ifdef HAVE_OPENSSL
+        && !(exporter->exwrite == fbExporterWriteTLS &&
+             exporter->spec.conn->transport == FB_TLS_TCP)
+#endif
+        )
+    {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Batched export is only supported for UDP, TCP, TLS,"
+                    " and file exporters");
+        return FALSE;
+    }
+    if (depth > FB_EXPORTER_BATCH_MAX) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Export batch depth %u is larger than the maximum %u",
+                    depth, FB_EXPORTER_BATCH_MAX);
+        return FALSE;
+    }
+
+    /* write anything queued under the old settings */
+    if (!fbExporterFlush(exporter, err)) {
+        return FALSE;
+    }
+    fbExporterBatchFree(exporter->batch);
+    exporter->batch = NULL;
+
+    if (depth <= 1) {
+        return TRUE;
+    }
+
+    batch = g_slice_new0(fbExporterBatch_t);
+    batch->depth = depth;
+    batch->latency = (gint64)max_latency_ms * 1000;
+    batch->bufsize = (size_t)depth * exporter->mtu;
+    batch->buf = g_malloc(batch->bufsize);
+    batch->lens = g_new0(size_t, depth);
+#ifdef FB_ENABLE_SENDMMSG
+    if (exporter->exwrite == fbExporterWriteUDP) {
+        batch->msgs = g_new0(struct mmsghdr, depth);
+        batch->iov = g_new0(struct iovec, depth);
+    }
+#endif
+    exporter->batch = batch;
+
+    return TRUE;
+}
+
+/**
+ * fbExporterSetCompression
+ *
+ *
+ *
+ */
+gboolean
+fbExporterSetCompression(
+    fbExporter_t           *exporter,
+    fbCompressionMethod_t   method,
+    int                     level,
+    GError                **err)
+{
+    fbExporterComp_t *comp;
+
+    if (exporter->exwrite != fbExporterWriteFile &&
+        exporter->exwrite != fbExporterWriteTCP)
+    {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Compression is only supported for TCP and file"
+                    " exporters");
+        return FALSE;
+    }
+    if (exporter->batch || exporter->async) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Cannot change compression of a batched or"
+                    " asynchronous exporter");
+        return FALSE;
+    }
+    if (exporter->active && exporter->exopen) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Cannot change compression of an open exporter");
+        return FALSE;
+    }
+    if (exporter->comp && exporter->comp->framed) {
+        /* an FP exporter; finish what was written so far */
+        if (!fbExporterCompEnd(exporter, err)) {
+            return FALSE;
+        }
+    }
+    fbExporterCompFree(exporter->comp);
+    exporter->comp = NULL;
+
+    if (FB_COMPRESS_NONE == method) {
+        return TRUE;
+    }
+
+    comp = g_slice_new0(fbExporterComp_t);
+    comp->method = method;
+    comp->flush = (exporter->exwrite == fbExporterWriteTCP);
+    switch (method) {
+#ifdef HAVE_ZSTD
+      case FB_COMPRESS_ZSTD:
+        comp->bufsize = FB_EXPORTER_COMP_BUFSIZE;
+        comp->zctx = ZSTD_createCCtx();
+        if (!comp->zctx) {
+            g_error("Unable to allocate zstd compression context");
+        }
+        ZSTD_CCtx_setParameter(comp->zctx, ZSTD_c_compressionLevel,
+                               level ? level : ZSTD_CLEVEL_DEFAULT);
+        break;
+#endif  /* HAVE_ZSTD */
+#ifdef HAVE_LZ4
+      case FB_COMPRESS_LZ4:
+        comp->bufsize = FB_EXPORTER_COMP_BUFSIZE;
+        if (LZ4F_isError(LZ4F_createCompressionContext(&comp->lctx,
+                                                       LZ4F_VERSION)))
+        {
+            g_error("Unable to allocate LZ4 compression context");
+        }
+        comp->prefs.frameInfo.blockSizeID = LZ4F_max64KB;
+        comp->prefs.frameInfo.blockMode = LZ4F_blockLinked;
+        comp->prefs.compressionLevel = level;
+        break;
+#endif  /* HAVE_LZ4 */
+      default:
+        g_slice_free(fbExporterComp_t, comp);
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Compression method %d is not supported by this build"
+                    " of libfixbuf", (int)method);
+        return FALSE;
+    }
+    comp->buf = g_malloc(comp->bufsize);
+    exporter->comp = comp;
+
+    return TRUE;
+}
+
+/**
+ * fbExporterFlush
+ *
+ *
+ *
+ */
+gboolean
+fbExporterFlush(
+    fbExporter_t  *exporter,
+    GError       **err)
+{
+    if (!exporter->batch || 0 == exporter->batch->count) {
+        return TRUE;
+    }
+    return fbExporterBatchWrite(exporter, err);
+}
+
+/**
+ * fbExporterAsyncSleep
+ *
+ * Waits up to `msec` milliseconds on the `ready` condition of `async`,
+ * which must be locked by the caller.
+ *
+ */
+static void
+fbExporterAsyncSleep(
+    fbExporterAsync_t  *async,
+    unsigned int        msec)
+{
+    struct timeval  now;
+    struct timespec until;
+
+    gettimeofday(&now, NULL);
+    until.tv_sec = now.tv_sec + msec / 1000;
+    until.tv_nsec = (now.tv_usec + (msec % 1000) * 1000) * 1000;
+    if (until.tv_nsec >= 1000000000L) {
+        until.tv_sec++;
+        until.tv_nsec -= 1000000000L;
+    }
+    pthread_cond_timedwait(&async->ready, &async->lock, &until);
+}
+
+/**
+ * fbExporterAsyncSetError
+ *
+ * Replaces the last error of the export thread with `err`, which it
+ * takes.
+ *
+ */
+static void
+fbExporterAsyncSetError(
+    fbExporterAsync_t  *async,
+    GError             *err)
+{
+    pthread_mutex_lock(&async->lock);
+    g_clear_error(&async->error);
+    async->error = err;
+    pthread_mutex_unlock(&async->lock);
+}
+
+/**
+ * fbExporterAsyncWrite
+ *
+ * Writes `msglen` octets of the export thread's buffer, reopening the
+ * exporter as needed.  Retries with a growing delay while the exporter
+ * cannot be opened or written, until the thread is asked to stop.
+ * Returns FALSE if the message was given up on.
+ *
+ */
+static gboolean
+fbExporterAsyncWrite(
+    fbExporter_t  *exporter,
+    size_t         msglen)
+{
+    fbExporterAsync_t *async = exporter->async;
+    unsigned int       delay = FB_EXPORTER_ASYNC_RETRY_MIN;
+    gboolean           reopened = FALSE;
+    GError            *err = NULL;
+
+    for (;;) {
+        if (!exporter->active) {
+            if (exporter->exopen && exporter->exopen(exporter, &err)) {
+                FB_COUNTER_SET(&exporter->export_len, 0);
+                fbExporterCompRestart(exporter);
+                reopened = TRUE;
+            } else if (!exporter->exopen) {
+                /* nothing to reopen; e.g., fbExporterAllocFP() */
+                return FALSE;
+            } else {
+                fbExporterAsyncSetError(async, err);
+                err = NULL;
+            }
+        }
+        if (exporter->active) {
+            if (exporter->comp
+                ? fbExporterCompWrite(exporter, async->wbuf, msglen, &err)
+                : exporter->exwrite(exporter, async->wbuf, msglen, &err))
+            {
+                /* the first open is not a reconnect */
+                if (reopened && (async->written_msgs || async->failed_msgs)) {
+                    FB_COUNTER_ADD(&async->reconnects, 1);
+                }
+                FB_COUNTER_ADD(&async->written_msgs, 1);
+                FB_COUNTER_ADD(&async->written_octets, msglen);
+                FB_COUNTER_ADD(&exporter->export_len, msglen);
+                return TRUE;
+            }
+            fbExporterAsyncSetError(async, err);
+            err = NULL;
+            if (!exporter->exclose) {
+                return FALSE;
+            }
+            exporter->exclose(exporter);
+        }
+
+        /* wait before trying again, unless we are stopping */
+        pthread_mutex_lock(&async->lock);
+        if (!g_atomic_int_get(&async->stop)) {
+            fbExporterAsyncSleep(async, delay);
+        }
+        pthread_mutex_unlock(&async->lock);
+        if (g_atomic_int_get(&async->stop)) {
+            return FALSE;
+        }
+        delay = MIN(delay * 2, FB_EXPORTER_ASYNC_RETRY_MAX);
+    }
+}
+
+/**
+ * fbExporterAsyncMain
+ *
+ * The export thread.  Takes messages from the ring and writes them
+ * until told to stop and the ring is empty.
+ *
+ */
+static void *
+fbExporterAsyncMain(
+    void  *arg)
+{
+    fbExporter_t      *exporter = (fbExporter_t *)arg;
+    fbExporterAsync_t *async = exporter->async;
+    guint              head, tail;
+    size_t             msglen;
+
+    for (;;) {
+        tail = (guint)g_atomic_int_get(&async->tail);
+        head = (guint)g_atomic_int_get(&async->head);
+        if (head == tail) {
+            if (g_atomic_int_get(&async->stop)) {
+                break;
+            }
+            pthread_mutex_lock(&async->lock);
+            g_atomic_int_set(&async->cons_waiting, 1);
+            while ((guint)g_atomic_int_get(&async->head) ==
+                   (guint)g_atomic_int_get(&async->tail) &&
+                   !g_atomic_int_get(&async->stop))
+            {
+                pthread_cond_wait(&async->ready, &async->lock);
+            }
+            g_atomic_int_set(&async->cons_waiting, 0);
+            pthread_mutex_unlock(&async->lock);
+            continue;
+        }
+
+        /* copy, then claim; a failed claim means the producer dropped
+         * this message while we copied it */
+        msglen = async->lens[tail % async->slots];
+        memcpy(async->wbuf, async->bufs[tail % async->slots], msglen);
+        if (!g_atomic_int_compare_and_exchange(&async->tail, (gint)tail,
+                                               (gint)(tail + 1)))
+        {
+            continue;
+        }
+        if (g_atomic_int_get(&async->prod_waiting)) {
+            pthread_mutex_lock(&async->lock);
+            pthread_cond_signal(&async->space);
+            pthread_mutex_unlock(&async->lock);
+        }
+
+        if (!fbExporterAsyncWrite(exporter, msglen)) {
+            FB_COUNTER_ADD(&async->failed_msgs, 1);
+            FB_COUNTER_ADD(&async->failed_octets, msglen);
+        }
+    }
+
+    /* wake a producer that raced with the stop */
+    pthread_mutex_lock(&async->lock);
+    pthread_cond_broadcast(&async->space);
+    pthread_mutex_unlock(&async->lock);
+
+    return NULL;
+}
+
+/**
+ * fbExporterAsyncAdd
+ *
+ * Copies a message into the ring of an exporter in asynchronous mode,
+ * applying the exporter's policy when the ring is full.
+ *
+ */
+static gboolean
+fbExporterAsyncAdd(
+    fbExporter_t  *exporter,
+    uint8_t       *msgbase,
+    size_t         msglen,
+    GError       **err)
+{
+    fbExporterAsync_t *async = exporter->async;
+    guint              head, tail;
+
+    if (msglen > exporter->mtu) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "Message of %u octets is larger than the exporter's"
+                    " MTU", (uint32_t)msglen);
+        return FALSE;
+    }
+
+    head = (guint)g_atomic_int_get(&async->head);
+    for (;;) {
+        tail = (guint)g_atomic_int_get(&async->tail);
+        if (head - tail < async->slots) {
+            break;
+        }
+        switch (async->policy) {
+          case FB_EXPORTER_ASYNC_DROP_NEWEST:
+            FB_COUNTER_ADD(&async->stats.dropped_msgs, 1);
+            FB_COUNTER_ADD(&async->stats.dropped_octets, msglen);
+            return TRUE;
+          case FB_EXPORTER_ASYNC_DROP_OLDEST:
+            if (g_atomic_int_compare_and_exchange(&async->tail, (gint)tail,
+                                                  (gint)(tail + 1)))
+            {
+                FB_COUNTER_ADD(&async->stats.dropped_msgs, 1);
+                FB_COUNTER_ADD(&async->stats.dropped_octets,
+                               async->lens[tail % async->slots]);
+            }
+            break;
+          case FB_EXPORTER_ASYNC_BLOCK:
+          default:
+            pthread_mutex_lock(&async->lock);
+            g_atomic_int_set(&async->prod_waiting, 1);
+            while (head - (guint)g_atomic_int_get(&async->tail) >=
+                   async->slots)
+            {
+                pthread_cond_wait(&async->space, &async->lock);
+            }
+            g_atomic_int_set(&async->prod_waiting, 0);
+            pthread_mutex_unlock(&async->lock);
+            break;
+        }
+    }
+
+    memcpy(async->bufs[head % async->slots], msgbase, msglen);
+    async->lens[head % async->slots] = msglen;
+    g_atomic_int_set(&async->head, (gint)(head + 1));
+    FB_COUNTER_ADD(&async->stats.queued_msgs, 1);
+    FB_COUNTER_ADD(&async->stats.queued_octets, msglen);
+
+    if (g_atomic_int_get(&async->cons_waiting)) {
+        pthread_mutex_lock(&async->lock);
+        pthread_cond_signal(&async->ready);
+        pthread_mutex_unlock(&async->lock);
+    }
+    return TRUE;
+}
+
+/**
+ * fbExporterStartAsync
+ *
+ *
+ *
+ */
+gboolean
+fbExporterStartAsync(
+    fbExporter_t             *exporter,
+    unsigned int              slots,
+    fbExporterAsyncPolicy_t   policy,
+    GError                  **err)
+{
+    fbExporterAsync_t *async;
+    unsigned int       i;
+    int                rc;
+
+    if (exporter->async) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Exporter is already in asynchronous mode");
+        return FALSE;
+    }
+    if (exporter->batch) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Cannot use asynchronous mode on a batched exporter");
+        return FALSE;
+    }
+    if (exporter->file) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Cannot use asynchronous mode on a file exporter that"
+                    " has file options");
+        return FALSE;
+    }
+    if (exporter->exwrite == fbExporterWriteBuffer) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Asynchronous mode is not supported for buffer"
+                    " exporters");
+        return FALSE;
+    }
+    if (slots < 1 || slots > FB_EXPORTER_ASYNC_MAX) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Asynchronous export ring size %u is not between 1"
+                    " and %u", slots, FB_EXPORTER_ASYNC_MAX);
+        return FALSE;
+    }
+
+    async = g_slice_new0(fbExporterAsync_t);
+    async->slots = slots;
+    async->policy = policy;
+    async->bufs = g_new0(uint8_t *, slots);
+    for (i = 0; i < slots; ++i) {
+        async->bufs[i] = g_malloc(exporter->mtu);
+    }
+    async->lens = g_new0(size_t, slots);
+    async->wbuf = g_malloc(exporter->mtu);
+    pthread_mutex_init(&async->lock, NULL);
+    pthread_cond_init(&async->ready, NULL);
+    pthread_cond_init(&async->space, NULL);
+    exporter->async = async;
+
+    rc = pthread_create(&async->thread, NULL, fbExporterAsyncMain, exporter);
+    if (rc != 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "Unable to start export thread: %s", strerror(rc));
+        exporter->async = NULL;
+        pthread_cond_destroy(&async->space);
+        pthread_cond_destroy(&async->ready);
+        pthread_mutex_destroy(&async->lock);
+        for (i = 0; i < slots; ++i) {
+            g_free(async->bufs[i]);
+        }
+        g_free(async->bufs);
+        g_free(async->lens);
+        g_free(async->wbuf);
+        g_slice_free(fbExporterAsync_t, async);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * fbExporterStopAsync
+ *
+ *
+ *
+ */
+gboolean
+fbExporterStopAsync(
+    fbExporter_t  *exporter,
+    GError       **err)
+{
+    fbExporterAsync_t *async = exporter->async;
+    gboolean           ok = TRUE;
+    unsigned int       i;
+
+    if (!async) {
+        return TRUE;
+    }
+
+    pthread_mutex_lock(&async->lock);
+    g_atomic_int_set(&async->stop, 1);
+    pthread_cond_signal(&async->ready);
+    pthread_mutex_unlock(&async->lock);
+    pthread_join(async->thread, NULL);
+
+    if (async->failed_msgs) {
+        ok = FALSE;
+        if (async->error) {
+            g_propagate_error(err, async->error);
+            async->error = NULL;
+        } else {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "Export thread failed to write %" G_GUINT64_FORMAT
+                        " messages", async->failed_msgs);
+        }
+    }
+    g_clear_error(&async->error);
+
+    exporter->async = NULL;
+    pthread_cond_destroy(&async->space);
+    pthread_cond_destroy(&async->ready);
+    pthread_mutex_destroy(&async->lock);
+    for (i = 0; i < async->slots; ++i) {
+        g_free(async->bufs[i]);
+    }
+    g_free(async->bufs);
+    g_free(async->lens);
+    g_free(async->wbuf);
+    g_slice_free(fbExporterAsync_t, async);
+
+    return ok;
+}
+
+/**
+ * fbExporterGetAsyncStats
+ *
+ *
+ *
+ */
+void
+fbExporterGetAsyncStats(
+    const fbExporter_t      *exporter,
+    fbExporterAsyncStats_t  *stats)
+{
+    fbExporterAsync_t *async = exporter->async;
+
+    memset(stats, 0, sizeof(*stats));
+    if (!async) {
+        return;
+    }
+
+    stats->queued_msgs = FB_COUNTER_GET(&async->stats.queued_msgs);
+    stats->queued_octets = FB_COUNTER_GET(&async->stats.queued_octets);
+    stats->dropped_msgs = (FB_COUNTER_GET(&async->stats.dropped_msgs) +
+                           FB_COUNTER_GET(&async->failed_msgs));
+    stats->dropped_octets = (FB_COUNTER_GET(&async->stats.dropped_octets) +
+                             FB_COUNTER_GET(&async->failed_octets));
+    stats->written_msgs = FB_COUNTER_GET(&async->written_msgs);
+    stats->written_octets = FB_COUNTER_GET(&async->written_octets);
+    stats->reconnects = FB_COUNTER_GET(&async->reconnects);
+    stats->pending_msgs = ((guint)g_atomic_int_get(&async->head) -
+                           (guint)g_atomic_int_get(&async->tail));
+}
+
+/**
+ * fbExportMessage
+ *
+ *
+ * NOTE: fixbuf/private.h function
+ *
+ * @param exporter
+ * @param msgbase
+ * @param msglen
+ * @param err
+ *
+ * @return
+ *
+ */
+gboolean
+fbExportMessage(
+    fbExporter_t  *exporter,
+    uint8_t       *msgbase,
+    size_t         msglen,
+    GError       **err)
+{
+    FB_COUNTER_ADD(&exporter->stats.messages, 1);
+    FB_COUNTER_ADD(&exporter->stats.message_octets, msglen);
+
+    /* The export thread opens and writes the stream */
+    if (exporter->async) {
+        return fbExporterAsyncAdd(exporter, msgbase, msglen, err);
+    }
+
+    /* Ensure stream is open */
+    if (!exporter->active) {
+        g_assert(exporter->exopen);
+        if (!exporter->exopen(exporter, err)) {return FALSE;}
+        exporter->export_len = 0;
+        fbExporterCompRestart(exporter);
+    }
+
+    if (exporter->batch) {
+        return fbExporterBatchAdd(exporter, msgbase, msglen, err);
+    }
+
+    /* Attempt to write message */
+    if (exporter->comp
+        ? fbExporterCompWrite(exporter, msgbase, msglen, err)
+        : exporter->exwrite(exporter, msgbase, msglen, err))
+    {
+        exporter->export_len += msglen;
+        return TRUE;
     }
 
     /* Close exporter on write failure */
@@ -1129,6 +3018,14 @@ fbExporterFree(
     fbExporter_t  *exporter)
 {
     fbExporterClose(exporter);
+    fbExporterBatchFree(exporter->batch);
+    fbExporterCompFree(exporter->comp);
+    if (exporter->file) {
+        free(exporter->file->buf);
+        g_free(exporter->file->path);
+        g_free(exporter->file->stem);
+        g_slice_free(fbExporterFile_t, exporter->file);
+    }
     if (exporter->exwrite == fbExporterWriteFile) {
         g_free(exporter->spec.path);
     } else {
@@ -1149,6 +3046,18 @@ void
 fbExporterClose(
     fbExporter_t  *exporter)
 {
+    if (exporter->async) {
+        /* drain the ring; nobody to report a failure to */
+        fbExporterStopAsync(exporter, NULL);
+    }
+    if (exporter->active && exporter->batch) {
+        /* nobody to report a failure to; the messages are lost */
+        fbExporterFlush(exporter, NULL);
+    }
+    if (exporter->active && exporter->comp) {
+        /* end the frame; also done for FP exporters, which stay open */
+        fbExporterCompEnd(exporter, NULL);
+    }
     if (exporter->active && exporter->exclose) {exporter->exclose(exporter);}
 }
 
@@ -1175,7 +3084,7 @@ size_t
 fbExporterGetOctetCount(
     const fbExporter_t  *exporter)
 {
-    return exporter->export_len;
+    return FB_COUNTER_GET(&exporter->export_len);
 }
 
 /**
@@ -1188,9 +3097,7 @@ size_t
 fbExporterGetOctetCountAndReset(
     fbExporter_t  *exporter)
 {
-    size_t len = exporter->export_len;
-    exporter->export_len = 0;
-    return len;
+    return __atomic_exchange_n(&exporter->export_len, 0, __ATOMIC_RELAXED);
 }
 
 /**
@@ -1203,7 +3110,26 @@ void
 fbExporterResetOctetCount(
     fbExporter_t  *exporter)
 {
-    exporter->export_len = 0;
+    FB_COUNTER_SET(&exporter->export_len, 0);
+}
+
+/**
+ * fbExporterGetStats
+ *
+ *
+ * @param exporter
+ * @param stats
+ */
+void
+fbExporterGetStats(
+    const fbExporter_t  *exporter,
+    fbStats_t           *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->messages = FB_COUNTER_GET(&exporter->stats.messages);
+    stats->message_octets = FB_COUNTER_GET(&exporter->stats.message_octets);
+    stats->writes = FB_COUNTER_GET(&exporter->stats.writes);
+    stats->write_octets = FB_COUNTER_GET(&exporter->stats.write_octets);
 }
 
 /*
@@ -38,11 +38,22 @@
 /* maximum length allowed for an element description */
 #define FB_IE_DESCRIPTION_BUFSIZ    4096
 
+/*
+ *  The elements compiled into libfixbuf live in a read-only table generated
+ *  by make-infomodel that every model shares (see infomodel.h).  The two
+ *  hash tables of a model hold only the overlay: elements added at run time
+ *  (from XML, from RFC 5610 type records, or as aliens).  An overlay element
+ *  shadows the prebuilt element with the same ID.  A name in ie_byname that
+ *  maps to NULL marks a prebuilt name that no longer refers to an element,
+ *  because its element was redefined under another name.
+ */
 struct fbInfoModel_st {
     GHashTable    *ie_table;
     GHashTable    *ie_byname;
     GStringChunk  *ie_names;
     GStringChunk  *ie_desc;
+    /* number of prebuilt elements whose ID is also in ie_table */
+    guint          prebuilt_shadowed;
 };
 
 
@@ -121,8 +132,7 @@ fbInfoModelAlloc(
     model->ie_names = g_string_chunk_new(512);
     model->ie_desc = g_string_chunk_new(1024);
 
-    /* Add elements to the information model */
-    infomodelAddGlobalElements(model);
+    /* The global elements come from the shared prebuilt table */
 
     /* Return the new information model */
     return model;
@@ -164,6 +174,62 @@ fbInfoModelReversifyName(
 }
 
 
+/**
+ *  Removes 'name' from the ie_byname table of 'model'.  If 'name' is also
+ *  the name of a prebuilt element, leaves a NULL entry so the name does not
+ *  fall back to the prebuilt table.
+ */
+static void
+fbInfoModelRemoveName(
+    fbInfoModel_t  *model,
+    const char     *name)
+{
+    if (infomodelPrebuiltGetElementByName(name)) {
+        g_hash_table_insert(model->ie_byname, (char *)name, NULL);
+    } else {
+        g_hash_table_remove(model->ie_byname, name);
+    }
+}
+
+
+/**
+ *  Returns TRUE if 'ie' is identical to the prebuilt element 'prebuilt'.
+ */
+static gboolean
+fbInfoElementMatchesPrebuilt(
+    const fbInfoElement_t  *ie,
+    const fbInfoElement_t  *prebuilt)
+{
+    return (ie->len == prebuilt->len && ie->flags == prebuilt->flags &&
+            ie->type == prebuilt->type && ie->min == prebuilt->min &&
+            ie->max == prebuilt->max && 0 == strcmp(ie->name, prebuilt->name)
+            && (ie->description
+                ? (prebuilt->description &&
+                   0 == strcmp(ie->description, prebuilt->description))
+                : !prebuilt->description));
+}
+
+
+/**
+ *  Returns TRUE if adding 'ie' to 'model' would not change the model; that
+ *  is, when neither its ID nor its name is in the overlay and the prebuilt
+ *  element with its ID is identical to it.  A helper function for
+ *  fbInfoModelAddElement().
+ */
+static gboolean
+fbInfoModelIsPrebuiltElement(
+    const fbInfoModel_t    *model,
+    const fbInfoElement_t  *ie)
+{
+    const fbInfoElement_t *prebuilt;
+
+    prebuilt = infomodelPrebuiltGetElementByID(ie->ent, ie->num);
+    return (prebuilt && fbInfoElementMatchesPrebuilt(ie, prebuilt) &&
+            !g_hash_table_contains(model->ie_table, ie) &&
+            !g_hash_table_contains(model->ie_byname, ie->name));
+}
+
+
 /**
  *  Updates the two hash tables of 'model' with the data in 'model_ie'.  A
  *  helper function for fbInfoModelAddElement().
@@ -173,12 +239,26 @@ fbInfoModelInsertElement(
     fbInfoModel_t    *model,
     fbInfoElement_t  *model_ie)
 {
-    fbInfoElement_t *found;
+    fbInfoElement_t       *found;
+    const fbInfoElement_t *prebuilt;
 
     /* Check for an existing element with same ID.  If it is not known, add it
      * to both tables. */
     found = g_hash_table_lookup(model->ie_table, model_ie);
     if (found == NULL) {
+        /* If it redefines a prebuilt element under a different name, that
+         * name is released unless it already refers to something else. */
+        prebuilt = infomodelPrebuiltGetElementByID(model_ie->ent,
+                                                   model_ie->num);
+        if (prebuilt) {
+            ++model->prebuilt_shadowed;
+            if (0 != strcmp(prebuilt->name, model_ie->name) &&
+                !g_hash_table_contains(model->ie_byname, prebuilt->name))
+            {
+                g_hash_table_insert(model->ie_byname,
+                                    (char *)prebuilt->name, NULL);
+            }
+        }
         g_hash_table_insert(model->ie_table, model_ie, model_ie);
         g_hash_table_insert(model->ie_byname, (char *)model_ie->name, model_ie);
         return;
@@ -189,7 +269,7 @@ fbInfoModelInsertElement(
      * since we use g_string_chunk_insert_const(). */
     if (found->name != model_ie->name) {
         if (g_hash_table_lookup(model->ie_byname, found->name) == found) {
-            g_hash_table_remove(model->ie_byname, found->name);
+            fbInfoModelRemoveName(model, found->name);
         }
     }
 
@@ -209,29 +289,35 @@ fbInfoModelAddElement(
     const fbInfoElement_t  *ie)
 {
     fbInfoElement_t *model_ie = NULL;
+    fbInfoElement_t  rev_ie;
     char             revname[FB_IE_NAME_BUFSIZ];
 
     g_assert(ie);
 
-    /* Allocate a new information element */
-    model_ie = g_slice_new0(fbInfoElement_t);
+    /* Reading a registry that repeats the built-in elements is common (the
+     * tools load cert_ipfix.xml); such elements need no overlay entry. */
+    if (!fbInfoModelIsPrebuiltElement(model, ie)) {
+        /* Allocate a new information element */
+        model_ie = g_slice_new0(fbInfoElement_t);
+
+        /* Copy external IE to model IE */
+        model_ie->name = g_string_chunk_insert_const(model->ie_names,
+                                                     ie->name);
+        model_ie->ent = ie->ent;
+        model_ie->num = ie->num;
+        model_ie->len = ie->len;
+        model_ie->flags = ie->flags;
+        model_ie->min = ie->min;
+        model_ie->max = ie->max;
+        model_ie->type = ie->type;
+        if (ie->description) {
+            model_ie->description = (g_string_chunk_insert_const(
+                                         model->ie_desc, ie->description));
+        }
 
-    /* Copy external IE to model IE */
-    model_ie->name = g_string_chunk_insert_const(model->ie_names, ie->name);
-    model_ie->ent = ie->ent;
-    model_ie->num = ie->num;
-    model_ie->len = ie->len;
-    model_ie->flags = ie->flags;
-    model_ie->min = ie->min;
-    model_ie->max = ie->max;
-    model_ie->type = ie->type;
-    if (ie->description) {
-        model_ie->description = (g_string_chunk_insert_const(
-                                     model->ie_desc, ie->description));
+        fbInfoModelInsertElement(model, model_ie);
     }
 
-    fbInfoModelInsertElement(model, model_ie);
-
     /* Short circuit if not reversible */
     if (!(ie->flags & FB_IE_F_REVERSIBLE)) {
         return;
@@ -242,18 +328,24 @@ fbInfoModelAddElement(
         return;
     }
 
-    /* Allocate a new reverse information element */
-    model_ie = g_slice_new0(fbInfoElement_t);
+    /* Fill a reverse information element */
+    memset(&rev_ie, 0, sizeof(rev_ie));
+    rev_ie.name = revname;
+    rev_ie.ent = ie->ent ? ie->ent : FB_IE_PEN_REVERSE;
+    rev_ie.num = ie->ent ? ie->num | FB_IE_VENDOR_BIT_REVERSE : ie->num;
+    rev_ie.len = ie->len;
+    rev_ie.flags = ie->flags;
+    rev_ie.min = ie->min;
+    rev_ie.max = ie->max;
+    rev_ie.type = ie->type;
+
+    if (fbInfoModelIsPrebuiltElement(model, &rev_ie)) {
+        return;
+    }
 
-    /* Copy external IE to reverse model IE */
+    /* Allocate a new reverse information element */
+    model_ie = g_slice_dup(fbInfoElement_t, &rev_ie);
     model_ie->name = g_string_chunk_insert_const(model->ie_names, revname);
-    model_ie->ent = ie->ent ? ie->ent : FB_IE_PEN_REVERSE;
-    model_ie->num = ie->ent ? ie->num | FB_IE_VENDOR_BIT_REVERSE : ie->num;
-    model_ie->len = ie->len;
-    model_ie->flags = ie->flags;
-    model_ie->min = ie->min;
-    model_ie->max = ie->max;
-    model_ie->type = ie->type;
 
     fbInfoModelInsertElement(model, model_ie);
 }
@@ -272,7 +364,13 @@ fbInfoModelGetElement(
     const fbInfoModel_t    *model,
     const fbInfoElement_t  *ex_ie)
 {
-    return g_hash_table_lookup(model->ie_table, ex_ie);
+    const fbInfoElement_t *ie;
+
+    ie = g_hash_table_lookup(model->ie_table, ex_ie);
+    if (ie) {
+        return ie;
+    }
+    return infomodelPrebuiltGetElementByID(ex_ie->ent, ex_ie->num);
 }
 
 gboolean
@@ -280,8 +378,8 @@ fbInfoModelContainsElement(
     const fbInfoModel_t    *model,
     const fbInfoElement_t  *ex_ie)
 {
-    return (g_hash_table_contains(model->ie_table, ex_ie) ||
-            g_hash_table_contains(model->ie_byname, ex_ie->name));
+    return (fbInfoModelGetElement(model, ex_ie) ||
+            (ex_ie->name && fbInfoModelGetElementByName(model, ex_ie->name)));
 }
 
 /*
@@ -498,8 +596,21 @@ fbInfoModelGetElementByName(
     const fbInfoModel_t  *model,
     const char           *name)
 {
+    const fbInfoElement_t *ie;
+    gpointer               value;
+
     g_assert(name);
-    return g_hash_table_lookup(model->ie_byname, name);
+    if (g_hash_table_lookup_extended(model->ie_byname, name, NULL, &value)) {
+        return (const fbInfoElement_t *)value;
+    }
+    /* A prebuilt element whose ID was redefined in the overlay keeps its
+     * name only when the redefinition uses the same name, and that case
+     * was found above. */
+    ie = infomodelPrebuiltGetElementByName(name);
+    if (ie && g_hash_table_contains(model->ie_table, ie)) {
+        return NULL;
+    }
+    return ie;
 }
 
 const fbInfoElement_t *
@@ -706,7 +817,11 @@ guint
 fbInfoModelCountElements(
     const fbInfoModel_t  *model)
 {
-    return g_hash_table_size(model->ie_table);
+    size_t count;
+
+    infomodelPrebuiltGetElements(&count);
+    return count - model->prebuilt_shadowed + g_hash_table_size(
+        model->ie_table);
 }
 
 void
@@ -715,16 +830,31 @@ fbInfoModelIterInit(
     const fbInfoModel_t  *model)
 {
     g_assert(iter);
-    g_hash_table_iter_init(iter, model->ie_table);
+    iter->model = model;
+    iter->prebuilt_pos = 0;
+    g_hash_table_iter_init(&iter->overlay, model->ie_table);
 }
 
 const fbInfoElement_t *
 fbInfoModelIterNext(
     fbInfoModelIter_t  *iter)
 {
+    const fbInfoElement_t *prebuilt;
     const fbInfoElement_t *ie;
+    size_t                 count;
+
     g_assert(iter);
-    if (g_hash_table_iter_next(iter, NULL, (gpointer *)&ie)) {
+
+    /* Visit the prebuilt elements not shadowed by the overlay, then the
+     * overlay */
+    prebuilt = infomodelPrebuiltGetElements(&count);
+    while (iter->prebuilt_pos < count) {
+        ie = &prebuilt[iter->prebuilt_pos++];
+        if (!g_hash_table_contains(iter->model->ie_table, ie)) {
+            return ie;
+        }
+    }
+    if (g_hash_table_iter_next(&iter->overlay, NULL, (gpointer *)&ie)) {
         return ie;
     }
     return NULL;
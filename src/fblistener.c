@@ -14,7 +14,24 @@
 
 #define _FIXBUF_SOURCE_
 #include <fixbuf/private.h>
+#include <fcntl.h>
 #include <poll.h>
+#include <pthread.h>
+
+/*
+ *  Listeners wait on an epoll (Linux) or kqueue (BSD, macOS) descriptor
+ *  when the platform has one, and fall back to poll() over pfd_array when
+ *  it does not or when creating the descriptor fails.
+ */
+#if defined(__linux__)
+#include <sys/epoll.h>
+#define FB_LISTENER_EPOLL 1
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || \
+    defined(__OpenBSD__) || defined(__DragonFly__)
+#include <sys/event.h>
+#include <sys/time.h>
+#define FB_LISTENER_KQUEUE 1
+#endif
 
 
 
@@ -58,8 +75,24 @@
 
 #define MAX_BUFFER_FREE 100
 
-/* Maximum number of connections allowed by fixbuf */
-#define MAX_CONNECTIONS 25
+/* Socket option that spreads datagrams across sockets bound to the same
+ * address: FreeBSD needs SO_REUSEPORT_LB; elsewhere SO_REUSEPORT does */
+#if defined(SO_REUSEPORT_LB)
+#define FB_SO_REUSEPORT SO_REUSEPORT_LB
+#elif defined(SO_REUSEPORT)
+#define FB_SO_REUSEPORT SO_REUSEPORT
+#endif
+
+/* Maximum number of ready descriptors fetched by one event wait */
+#define FB_LISTENER_MAX_EVENTS 64
+
+/* messages a listener pool worker reads from one connection before
+ * giving its other ready connections a turn */
+#define FB_LISTENER_POOL_BURST 64
+
+/* microseconds a listener pool waits before accepting again when out of
+ * descriptors or memory */
+#define FB_LISTENER_POOL_ACCEPT_DELAY 100000
 
 struct fbListener_st {
     /** Connection specifier for passive socket. */
@@ -72,14 +105,40 @@ struct fbListener_st {
     fbSession_t           *udp_session;
     /** Last buffer returned by fbListenerWait(). */
     fBuf_t                *lastbuf;
-    /** The set of file descriptors to be monitored */
+    /**
+     * Interrupt pipe (entries 0 and 1) and passive sockets (entries 2 up
+     * to pfd_passive) of the listener.  When polling without an event
+     * descriptor, accepted connections are appended too.
+     */
     struct pollfd         *pfd_array;
-    /** size of array */
+    /** number of entries in use */
     nfds_t                 pfd_len;
+    /** number of entries allocated */
+    nfds_t                 pfd_cap;
+    /** end of the passive sockets in pfd_array */
+    nfds_t                 pfd_passive;
+    /** epoll or kqueue descriptor watching all sockets; -1 to use poll() */
+    int                    evfd;
+    /** watch accepted connections edge-triggered; needs evfd */
+    gboolean               edge;
+    /** Descriptors reported by the last wait and not yet dispatched. */
+    int                    ready[FB_LISTENER_MAX_EVENTS];
+    unsigned int           ready_cur;
+    unsigned int           ready_cnt;
+    /**
+     * Buffers returned since the listener last blocked.  Only these can
+     * have messages left in their collectors, so only these are checked
+     * before blocking again.
+     */
+    fBuf_t               **recent;
+    unsigned int           recent_len;
+    unsigned int           recent_cap;
     /** Holds last file descriptor used */
     int                    lsock;
     /** mode (-1 for udp) */
     int                    mode;
+    /** bind with SO_REUSEPORT, one shard of fbListenerAllocUDPShards() */
+    gboolean               reuseport;
     /**
      * used to hold the handle to the collector for
      * this listener
@@ -98,6 +157,10 @@ struct fbListener_st {
     fbListenerAppInit_fn   appinit;
     /** Application free function. Frees storage allocated by appinit. */
     fbListenerAppFree_fn   appfree;
+    /** Counters returned by fbListenerGetStats(). */
+    fbStats_t              stats;
+    /** Pool reading the accepted connections, or NULL */
+    fbListenerPool_t      *pool;
 };
 
 typedef struct fbListenerWaitFDSet_st {
@@ -114,13 +177,182 @@ struct fbListenerGroup_st {
     fbListenerEntry_t  *head;
     /** pointer to the last fbListener */
     fbListenerEntry_t  *lastlist;
-    /** pointer to a generic structure for future use */
+    /** descriptors polled when the group cannot use evfd */
     struct pollfd      *group_pfd;
+    /** listener owning each entry of group_pfd */
+    fbListener_t      **group_owner;
     /** length of usable fds */
     nfds_t              pfd_len;
+    /** number of entries allocated in group_pfd and group_owner */
+    nfds_t              pfd_cap;
+    /** epoll or kqueue descriptor watching each member's evfd, or -1 */
+    int                 evfd;
+    /** number of members whose evfd is not watched by the group's */
+    unsigned int        unwatched;
 };
 
 
+/**
+ * fbListenerEventsOpen
+ *
+ * Returns a new epoll or kqueue descriptor, or -1 if the platform has
+ * neither or the descriptor cannot be created.
+ *
+ */
+static int
+fbListenerEventsOpen(
+    void)
+{
+    int evfd = -1;
+
+#if defined(FB_LISTENER_EPOLL)
+    evfd = epoll_create(FB_LISTENER_MAX_EVENTS);
+#elif defined(FB_LISTENER_KQUEUE)
+    evfd = kqueue();
+#endif
+    return evfd;
+}
+
+/**
+ * fbListenerEventsAdd
+ *
+ * Starts watching `fd` for input on the event descriptor `evfd`,
+ * edge-triggered if `edge` is TRUE.
+ *
+ */
+static gboolean
+fbListenerEventsAdd(
+    int       evfd,
+    int       fd,
+    gboolean  edge)
+{
+#if defined(FB_LISTENER_EPOLL)
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN | (edge ? EPOLLET : 0);
+    ev.data.fd = fd;
+    return (0 == epoll_ctl(evfd, EPOLL_CTL_ADD, fd, &ev));
+#elif defined(FB_LISTENER_KQUEUE)
+    struct kevent ev;
+
+    EV_SET(&ev, fd, EVFILT_READ, EV_ADD | (edge ? EV_CLEAR : 0), 0, 0, NULL);
+    return (0 == kevent(evfd, &ev, 1, NULL, 0, NULL));
+#else
+    (void)evfd;
+    (void)fd;
+    (void)edge;
+    return FALSE;
+#endif /* if defined(FB_LISTENER_EPOLL) */
+}
+
+/**
+ * fbListenerEventsDel
+ *
+ * Stops watching `fd` on the event descriptor `evfd`.  A descriptor that
+ * is already closed is no longer watched, so errors are ignored.
+ *
+ */
+static void
+fbListenerEventsDel(
+    int   evfd,
+    int   fd)
+{
+#if defined(FB_LISTENER_EPOLL)
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+    epoll_ctl(evfd, EPOLL_CTL_DEL, fd, &ev);
+#elif defined(FB_LISTENER_KQUEUE)
+    struct kevent ev;
+
+    EV_SET(&ev, fd, EVFILT_READ, EV_DELETE, 0, 0, NULL);
+    kevent(evfd, &ev, 1, NULL, 0, NULL);
+#else
+    (void)evfd;
+    (void)fd;
+#endif /* if defined(FB_LISTENER_EPOLL) */
+}
+
+/**
+ * fbListenerEventsWait
+ *
+ * Waits up to `timeout` milliseconds (-1 for no limit) for input on the
+ * descriptors watched by `evfd` and stores up to FB_LISTENER_MAX_EVENTS
+ * ready descriptors in `fds`.  Returns their count, or -1 and sets errno.
+ *
+ */
+static int
+fbListenerEventsWait(
+    int   evfd,
+    int  *fds,
+    int   timeout)
+{
+    int i;
+    int rc = -1;
+#if defined(FB_LISTENER_EPOLL)
+    struct epoll_event evs[FB_LISTENER_MAX_EVENTS];
+
+    rc = epoll_wait(evfd, evs, FB_LISTENER_MAX_EVENTS, timeout);
+    for (i = 0; i < rc; ++i) {
+        fds[i] = evs[i].data.fd;
+    }
+#elif defined(FB_LISTENER_KQUEUE)
+    struct kevent   evs[FB_LISTENER_MAX_EVENTS];
+    struct timespec ts;
+
+    ts.tv_sec = timeout / 1000;
+    ts.tv_nsec = (timeout % 1000) * 1000000;
+    rc = kevent(evfd, NULL, 0, evs, FB_LISTENER_MAX_EVENTS,
+                (timeout < 0) ? NULL : &ts);
+    for (i = 0; i < rc; ++i) {
+        fds[i] = (int)evs[i].ident;
+    }
+#else
+    (void)evfd;
+    (void)fds;
+    (void)timeout;
+    (void)i;
+    errno = ENOSYS;
+#endif /* if defined(FB_LISTENER_EPOLL) */
+    return rc;
+}
+
+/**
+ * fbListenerSetWaitError
+ *
+ * Sets `err` after a failed wait for input.
+ *
+ */
+static void
+fbListenerSetWaitError(
+    GError  **err)
+{
+    if (errno == EINTR) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
+                    "Interrupted listener wait");
+    } else {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "listener wait error: %s",
+                    strerror(errno));
+    }
+}
+
+/**
+ * fbListenerSetPoolError
+ *
+ * Sets the error returned when waiting on a listener that has a pool,
+ * whose workers use the listener's connection state concurrently.
+ */
+static void
+fbListenerSetPoolError(
+    GError  **err)
+{
+    g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                "Cannot wait on a listener that has a pool");
+}
+
+
 /**
  * fbListenerTeardownSocket
  *
@@ -141,10 +373,16 @@ fbListenerTeardownSocket(
                 listener->pfd_array[i].fd = -1;
             }
         }
-        g_slice_free1((MAX_CONNECTIONS * sizeof(struct pollfd)),
-                      listener->pfd_array);
+        g_free(listener->pfd_array);
+        listener->pfd_array = NULL;
         listener->pfd_len = 0;
+        listener->pfd_cap = 0;
+    }
+    if (listener->evfd >= 0) {
+        close(listener->evfd);
+        listener->evfd = -1;
     }
+    listener->ready_cur = listener->ready_cnt = 0;
 }
 
 /**
@@ -190,10 +428,10 @@ fbListenerInitSocket(
         current = current->ai_next;
     }
 
-    listener->pfd_array = ((struct pollfd *)
-                           g_slice_alloc0(MAX_CONNECTIONS *
-                                          sizeof(struct pollfd)));
+    listener->pfd_array = g_new0(struct pollfd, i + 2);
     listener->pfd_len = i + 2;
+    listener->pfd_cap = i + 2;
+    listener->pfd_passive = i + 2;
 
     /* read interrupt pipe */
     listener->pfd_array[0].fd = pfd[0];
@@ -221,6 +459,16 @@ fbListenerInitSocket(
         if (cpfd->fd < 0) {
             i++; continue;
         }
+#ifdef FB_SO_REUSEPORT
+        if (listener->reuseport) {
+            int on = 1;
+            if (setsockopt(cpfd->fd, SOL_SOCKET, FB_SO_REUSEPORT,
+                           &on, sizeof(on)))
+            {
+                close(cpfd->fd); cpfd->fd = -1; i++; continue;
+            }
+        }
+#endif /* ifdef FB_SO_REUSEPORT */
         if (bind(cpfd->fd, ai->ai_addr, ai->ai_addrlen) == -1) {
             close(cpfd->fd); cpfd->fd = -1; i++; continue;
         }
@@ -233,7 +481,7 @@ fbListenerInitSocket(
 #endif
             )
         {
-            if (listen(cpfd->fd, 1) < 0) {
+            if (listen(cpfd->fd, SOMAXCONN) < 0) {
                 close(cpfd->fd); cpfd->fd = -1; i++; continue;
             }
         }
@@ -252,6 +500,19 @@ fbListenerInitSocket(
         return FALSE;
     }
 
+    /* Watch the interrupt pipe and passive sockets with an event
+     * descriptor if possible; use poll() if any of them cannot be added */
+    listener->evfd = fbListenerEventsOpen();
+    for (i = 0; listener->evfd >= 0 && i < (int)listener->pfd_passive; i++) {
+        if (i != 1 && listener->pfd_array[i].fd >= 0 &&
+            !fbListenerEventsAdd(listener->evfd, listener->pfd_array[i].fd,
+                                 FALSE))
+        {
+            close(listener->evfd);
+            listener->evfd = -1;
+        }
+    }
+
     /* All done. */
     return TRUE;
 }
@@ -330,18 +591,18 @@ fbListenerInitUDPSocket(
 }
 
 /**
- * fbListenerAlloc
- *
- *
+ * fbListenerAllocInternal
  *
+ * Implements fbListenerAlloc(); binds with SO_REUSEPORT if `reuseport`.
  *
  */
-fbListener_t *
-fbListenerAlloc(
+static fbListener_t *
+fbListenerAllocInternal(
     const fbConnSpec_t    *spec,
     fbSession_t           *session,
     fbListenerAppInit_fn   appinit,
     fbListenerAppFree_fn   appfree,
+    gboolean               reuseport,
     GError               **err)
 {
     fbListener_t *listener = NULL;
@@ -359,6 +620,8 @@ fbListenerAlloc(
 
     /* -1 for file descriptors means no fd */
     listener->lsock = -1;
+    listener->evfd = -1;
+    listener->reuseport = reuseport;
 
     if (ownSocket) { /* user handling own socket creation and connections */
         listener->spec = NULL;
@@ -437,6 +700,78 @@ fbListenerAlloc(
     return NULL;
 }
 
+/**
+ * fbListenerAlloc
+ *
+ *
+ *
+ *
+ */
+fbListener_t *
+fbListenerAlloc(
+    const fbConnSpec_t    *spec,
+    fbSession_t           *session,
+    fbListenerAppInit_fn   appinit,
+    fbListenerAppFree_fn   appfree,
+    GError               **err)
+{
+    return fbListenerAllocInternal(spec, session, appinit, appfree,
+                                   FALSE, err);
+}
+
+/**
+ * fbListenerAllocUDPShards
+ *
+ *
+ *
+ *
+ */
+gboolean
+fbListenerAllocUDPShards(
+    const fbConnSpec_t    *spec,
+    fbSession_t          **sessions,
+    unsigned int           count,
+    fbListenerAppInit_fn   appinit,
+    fbListenerAppFree_fn   appfree,
+    fbListener_t         **listeners,
+    GError               **err)
+{
+    unsigned int i, j;
+
+    g_assert(spec);
+    g_assert(sessions);
+    g_assert(listeners);
+
+    if (spec->transport != FB_UDP && spec->transport != FB_DTLS_UDP) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_CONN,
+                    "Listener shards need a UDP transport");
+        return FALSE;
+    }
+    if (0 == count) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Listener shards need at least one shard");
+        return FALSE;
+    }
+#ifndef FB_SO_REUSEPORT
+    g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                "SO_REUSEPORT is not available on this platform");
+    return FALSE;
+#else
+    for (i = 0; i < count; i++) {
+        listeners[i] = fbListenerAllocInternal(spec, sessions[i],
+                                               appinit, appfree, TRUE, err);
+        if (!listeners[i]) {
+            for (j = 0; j < i; j++) {
+                fbListenerFree(listeners[j]);
+                listeners[j] = NULL;
+            }
+            return FALSE;
+        }
+    }
+    return TRUE;
+#endif /* ifndef FB_SO_REUSEPORT */
+}
+
 
 /**
  * fbListenerFreeBuffer
@@ -534,6 +869,7 @@ fbListenerFree(
     }
     /* free the listener table */
     g_hash_table_destroy(listener->fdtab);
+    g_free(listener->recent);
 
     /* free the connection specifier */
     fbConnSpecFree(listener->spec);
@@ -596,71 +932,174 @@ fbListenerFree(
  */
 static void
 fbListenerAddPollFD(
-    struct pollfd  *fd_array,
-    nfds_t         *array_len,
-    int             fd)
+    fbListener_t  *listener,
+    int            fd)
 {
-    nfds_t   i;
-    nfds_t   num_fds = *array_len;
-    gboolean added = FALSE;
+    nfds_t i;
 
     /* use an old entry for this new entry */
-    for (i = 0; i < num_fds; i++) {
-        if (fd_array[i].fd < 0) {
-            fd_array[i].fd = fd;
-            fd_array[i].events = POLLIN;
-            added = TRUE;
-            break;
+    for (i = listener->pfd_passive; i < listener->pfd_len; i++) {
+        if (listener->pfd_array[i].fd < 0) {
+            listener->pfd_array[i].fd = fd;
+            listener->pfd_array[i].events = POLLIN;
+            return;
         }
     }
 
     /* no free entries in the array, add a new one */
-    if (!added) {
-        fd_array[num_fds].fd = fd;
-        fd_array[num_fds].events = POLLIN;
-        num_fds++;
-        *array_len = num_fds;
+    if (listener->pfd_len == listener->pfd_cap) {
+        listener->pfd_cap *= 2;
+        listener->pfd_array = g_renew(struct pollfd, listener->pfd_array,
+                                      listener->pfd_cap);
     }
+    listener->pfd_array[listener->pfd_len].fd = fd;
+    listener->pfd_array[listener->pfd_len].events = POLLIN;
+    listener->pfd_array[listener->pfd_len].revents = 0;
+    listener->pfd_len++;
 }
 
 /**
- * fbListenerWaitAccept
+ * fbListenerAddRecent
  *
+ * Remembers that `fbuf` was returned so the next wait checks its
+ * collector for input it has already read.
  *
+ */
+static void
+fbListenerAddRecent(
+    fbListener_t  *listener,
+    fBuf_t        *fbuf)
+{
+    unsigned int i;
+
+    listener->lastbuf = fbuf;
+    for (i = 0; i < listener->recent_len; i++) {
+        if (listener->recent[i] == fbuf) {
+            return;
+        }
+    }
+    if (listener->recent_len == listener->recent_cap) {
+        listener->recent_cap = listener->recent_cap ?
+            (2 * listener->recent_cap) : 4;
+        listener->recent = g_renew(fBuf_t *, listener->recent,
+                                   listener->recent_cap);
+    }
+    listener->recent[listener->recent_len++] = fbuf;
+}
+
+/**
+ * fbListenerNextRecent
  *
+ * Returns a recently returned buffer that can be read without waiting:
+ * its collector holds a message, or it is an edge-triggered connection
+ * with input the event descriptor will not report again.  Buffers with
+ * neither are forgotten.  Returns NULL if there are none.
  *
  */
 static fBuf_t *
-fbListenerWaitAccept(
+fbListenerNextRecent(
+    fbListener_t  *listener)
+{
+    fbCollector_t *collector;
+    fBuf_t        *fbuf;
+    unsigned int   i = 0;
+
+    while (i < listener->recent_len) {
+        fbuf = listener->recent[i];
+        collector = fBufGetCollector(fbuf);
+        if (fbCollectorHasPendingMessages(collector) ||
+            (listener->edge && listener->mode >= 0 &&
+             fbCollectorIsReadable(collector)))
+        {
+            listener->lastbuf = fbuf;
+            listener->lsock = fbCollectorGetFD(collector);
+            return fbuf;
+        }
+        listener->recent[i] = listener->recent[--listener->recent_len];
+    }
+    return NULL;
+}
+
+/**
+ * fbListenerFillReady
+ *
+ * Waits up to `timeout` milliseconds (-1 for no limit) for input on the
+ * listener's descriptors and queues the ready ones for dispatch, the
+ * interrupt pipe first.
+ *
+ */
+static gboolean
+fbListenerFillReady(
     fbListener_t  *listener,
+    int            timeout,
     GError       **err)
 {
-    int asock;
-    union {
-        struct sockaddr       so;
-        struct sockaddr_in    ip4;
-        struct sockaddr_in6   ip6;
-    }                           peer;
-    socklen_t      peerlen;
+    nfds_t i;
+    int    rc;
+    int    tmp;
+    gint64 start;
+
+    listener->ready_cur = listener->ready_cnt = 0;
+    start = g_get_monotonic_time();
+    if (listener->evfd >= 0) {
+        rc = fbListenerEventsWait(listener->evfd, listener->ready, timeout);
+    } else {
+        rc = poll(listener->pfd_array, listener->pfd_len, timeout);
+        if (rc > 0) {
+            rc = 0;
+            for (i = 0; (i < listener->pfd_len &&
+                         rc < FB_LISTENER_MAX_EVENTS); i++)
+            {
+                if (listener->pfd_array[i].revents) {
+                    listener->ready[rc++] = listener->pfd_array[i].fd;
+                }
+            }
+        }
+    }
+    ++listener->stats.polls;
+    listener->stats.poll_usec += g_get_monotonic_time() - start;
+
+    if (rc < 0) {
+        fbListenerSetWaitError(err);
+        return FALSE;
+    }
+
+    for (tmp = 1; tmp < rc; tmp++) {
+        if (listener->ready[tmp] == listener->pfd_array[0].fd) {
+            listener->ready[tmp] = listener->ready[0];
+            listener->ready[0] = listener->pfd_array[0].fd;
+            break;
+        }
+    }
+    listener->ready_cnt = rc;
+    return TRUE;
+}
+
+/**
+ * fbListenerSetupConnection
+ *
+ * Asks the application for context and creates the collector and
+ * automatic-mode buffer for the accepted socket `asock`.  Closes `asock`
+ * if the application rejects it.  When not NULL, `lock` is held while
+ * cloning the listener's session.
+ *
+ */
+static fBuf_t *
+fbListenerSetupConnection(
+    fbListener_t     *listener,
+    int               asock,
+    struct sockaddr  *peer,
+    socklen_t         peerlen,
+    pthread_mutex_t  *lock,
+    GError          **err)
+{
     void          *ctx = NULL;
     fbCollector_t *collector = NULL;
     fBuf_t        *fbuf = NULL;
 
-    /* Accept the connection */
-    peerlen = sizeof(peer);
-    asock = accept(listener->lsock, &(peer.so), &peerlen);
-    if (asock < 0) {
-        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
-                    "listener accept error: %s",
-                    strerror(errno));
-        return NULL;
-    }
-
     /* Okay, we have a socket. Ask the application for context. */
     if (listener->appinit) {
-        if (!listener->appinit(listener, &ctx, asock,
-                               &(peer.so), peerlen, err))
-        {
+        if (!listener->appinit(listener, &ctx, asock, peer, peerlen, err)) {
             close(asock);
             return NULL;
         }
@@ -673,7 +1112,7 @@ fbListenerWaitAccept(
 #endif
       case FB_TCP:
         collector = fbCollectorAllocSocket(listener, ctx, asock,
-                                           &(peer.so), peerlen, err);
+                                           peer, peerlen, err);
         break;
 #ifdef HAVE_OPENSSL
 #ifdef HAVE_OPENSSL_DTLS_SCTP
@@ -681,7 +1120,7 @@ fbListenerWaitAccept(
 #endif
       case FB_TLS_TCP:
         collector = fbCollectorAllocTLS(listener, ctx, asock,
-                                        &(peer.so), peerlen, err);
+                                        peer, peerlen, err);
         break;
 #endif /* if HAVE_OPENSSL */
       default:
@@ -692,154 +1131,234 @@ fbListenerWaitAccept(
     if (!collector) {return NULL;}
 
     /* Create a buffer with a cloned session around the collector */
+    if (lock) {
+        pthread_mutex_lock(lock);
+    }
     fbuf = fBufAllocForCollection(fbSessionClone(listener->session), collector);
+    if (lock) {
+        pthread_mutex_unlock(lock);
+    }
 
     /* Make the buffer automatic */
     fBufSetAutomaticMode(fbuf, TRUE);
 
+    return fbuf;
+}
+
+/**
+ * fbListenerWaitAccept
+ *
+ *
+ *
+ *
+ */
+static fBuf_t *
+fbListenerWaitAccept(
+    fbListener_t  *listener,
+    GError       **err)
+{
+    int asock;
+    union {
+        struct sockaddr       so;
+        struct sockaddr_in    ip4;
+        struct sockaddr_in6   ip6;
+    }                           peer;
+    socklen_t      peerlen;
+    fBuf_t        *fbuf = NULL;
+
+    /* Accept the connection */
+    peerlen = sizeof(peer);
+    asock = accept(listener->lsock, &(peer.so), &peerlen);
+    if (asock < 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                    "listener accept error: %s",
+                    strerror(errno));
+        return NULL;
+    }
+    ++listener->stats.connections;
+
+    fbuf = fbListenerSetupConnection(listener, asock, &(peer.so), peerlen,
+                                     NULL, err);
+    if (!fbuf) {return NULL;}
+
     /* Add buffer to the file descriptor table */
     g_hash_table_insert(listener->fdtab, GINT_TO_POINTER(asock), fbuf);
 
-    /* don't add to array if fbListenerWaitNoCollectors was called */
+    /* don't watch it if fbListenerWaitNoCollectors was called */
     if (listener->mode < 1) {
-        /* add to poll array */
-        if (listener->pfd_len < MAX_CONNECTIONS) {
-            fbListenerAddPollFD(listener->pfd_array, &listener->pfd_len, asock);
-        } else {
-            g_warning("Max connections %d reached.", MAX_CONNECTIONS);
+        if (listener->evfd < 0) {
+            fbListenerAddPollFD(listener, asock);
+        } else if (!fbListenerEventsAdd(listener->evfd, asock,
+                                        listener->edge))
+        {
+            g_warning("Cannot watch connection: %s", strerror(errno));
         }
     }
 
     listener->lsock = asock;
 
     /* store the collector handle */
-    listener->collectorHandle = collector;
+    listener->collectorHandle = fBufGetCollector(fbuf);
 
     /* All done. */
     return fbuf;
 }
 
 /**
- * fbListenerRemove
- *
- *
+ * fbListenerDispatchFD
  *
+ * Finds the buffer to return for a descriptor reported ready: that of an
+ * existing connection or UDP socket, or the buffer of a new connection
+ * accepted on a passive socket.  Sets `fbuf` to NULL for a descriptor the
+ * listener no longer watches.  Returns FALSE and sets `err` on interrupt
+ * or accept failure.
  *
  */
-void
-fbListenerRemove(
+static gboolean
+fbListenerDispatchFD(
     fbListener_t  *listener,
-    int            fd)
+    int            fd,
+    fBuf_t       **fbuf,
+    GError       **err)
 {
-    unsigned int i;
+    uint8_t byte;
+    nfds_t  i;
 
-    /* remove from hash table */
-    g_hash_table_remove(listener->fdtab, GINT_TO_POINTER(fd));
+    *fbuf = NULL;
+    if (fd < 0) {
+        return TRUE;
+    }
 
-    /* remove from poll array */
-    for (i = 0; i < listener->pfd_len; i++) {
-        if (listener->pfd_array[i].fd == fd) {
-            if (listener->lsock == fd) {
-                /* unset lsock */
-                listener->lsock = 0;
-            }
-            close(listener->pfd_array[i].fd);
-            listener->pfd_array[i].fd = -1;
-            break;
+    if (fd == listener->pfd_array[0].fd) {
+        /* read or write interrupt */
+        /* consume and ignore return */
+        read(fd, &byte, sizeof(byte));
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
+                    "External interrupt on pipe");
+        return FALSE;
+    }
+
+    /* check to see if it's been seen before */
+    if ((*fbuf = g_hash_table_lookup(listener->fdtab, GINT_TO_POINTER(fd)))) {
+        listener->lsock = fd;
+        if (listener->mode < 0) {
+            /* if UDP set FD on collector for reading */
+            fbCollectorSetFD(fBufGetCollector(*fbuf), fd);
+        }
+        fbListenerAddRecent(listener, *fbuf);
+        return TRUE;
+    }
+
+    if (listener->mode < 0) {
+        return TRUE;
+    }
+    for (i = 2; i < listener->pfd_passive; i++) {
+        if (listener->pfd_array[i].fd == fd) {
+            /* new connection */
+            listener->lsock = fd;
+            if (!(*fbuf = fbListenerWaitAccept(listener, err))) {
+                return FALSE;
+            }
+            if (listener->mode < 1) {
+                fbListenerAddRecent(listener, *fbuf);
+            } else {
+                listener->lastbuf = *fbuf;
+            }
+            return TRUE;
         }
     }
+
+    /* closed since the wait reported it */
+    return TRUE;
 }
 
 /**
- * fbListenerWait
+ * fbListenerRemove
  *
  *
  *
  *
  */
-fBuf_t *
-fbListenerWait(
+void
+fbListenerRemove(
     fbListener_t  *listener,
-    GError       **err)
+    int            fd)
 {
-    fBuf_t      *fbuf = NULL;
-    uint8_t      byte;
-    int          got_sock = -1;
-    int          rc;
     unsigned int i;
 
-    /* wait for data available on one of our file descriptors */
-    rc = poll(listener->pfd_array, listener->pfd_len, -1);
+    /* remove from hash table */
+    g_hash_table_remove(listener->fdtab, GINT_TO_POINTER(fd));
 
-    if (rc < 0) {
-        if (errno == EINTR) {
-            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
-                        "Interrupted listener wait");
-            return NULL;
-        } else {
-            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
-                        "listener wait error: %s",
-                        strerror(errno));
-            return NULL;
+    /* don't dispatch it from the current ready list */
+    for (i = listener->ready_cur; i < listener->ready_cnt; i++) {
+        if (listener->ready[i] == fd) {
+            listener->ready[i] = -1;
         }
     }
 
-    /* Loop through file descriptors */
-    for (i = 0; i < listener->pfd_len; i++) {
-        struct pollfd *pfd = &listener->pfd_array[i];
+    if (listener->lsock == fd) {
+        /* unset lsock */
+        listener->lsock = 0;
+    }
 
-        if (pfd->revents & (POLLERR | POLLHUP | POLLNVAL)) {
-            /* hang up or error */
-            got_sock = pfd->fd;
-            break;
-        }
+    /* accepted connections are not in the poll array when an event
+     * descriptor is in use, and the collector closes them */
+    if (listener->evfd >= 0) {
+        fbListenerEventsDel(listener->evfd, fd);
+    }
 
-        if (!(pfd->revents & POLLIN)) {
-            continue;
+    /* remove from poll array */
+    for (i = 0; i < listener->pfd_len; i++) {
+        if (listener->pfd_array[i].fd == fd) {
+            close(listener->pfd_array[i].fd);
+            listener->pfd_array[i].fd = -1;
+            break;
         }
+    }
+}
 
-        if (i == 0) {
-            /* read or write interrupt */
-            /* consume and ignore return */
-            read(pfd->fd, &byte, sizeof(byte));
-            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
-                        "External interrupt on pipe");
-            return NULL;
-        }
+/**
+ * fbListenerWait
+ *
+ *
+ *
+ *
+ */
+fBuf_t *
+fbListenerWait(
+    fbListener_t  *listener,
+    GError       **err)
+{
+    fBuf_t *fbuf = NULL;
 
-        got_sock = pfd->fd;
-        break;
+    if (listener->pool) {
+        fbListenerSetPoolError(err);
+        return NULL;
     }
 
-    /* quick solution - check if the fd is the same as last time */
-    if ((listener->lsock == got_sock) && listener->lastbuf) {
-        return listener->lastbuf;
+    /* collectors may hold messages they have read but not returned:
+     * queued datagrams on UDP, buffered stream data on TCP and TLS */
+    if ((fbuf = fbListenerNextRecent(listener))) {
+        return fbuf;
     }
 
-    listener->lsock = got_sock;
-
-    /* different than last time -> check to see if it's been seen before */
-    if ((fbuf = g_hash_table_lookup(listener->fdtab,
-                                    GINT_TO_POINTER(got_sock))))
-    {
-        listener->lastbuf = fbuf;
-        if (listener->mode < 0) {
-            /* if UDP set FD on collector for reading */
-            fbCollectorSetFD(fBufGetCollector(fbuf), got_sock);
+    for (;;) {
+        /* wait for data available on one of our file descriptors */
+        if (listener->ready_cur >= listener->ready_cnt) {
+            if (!fbListenerFillReady(listener, -1, err)) {
+                return NULL;
+            }
         }
-        return fbuf;
-    } else {
-        if (listener->mode >= 0) {
-            /* new connection */
-            fbuf = fbListenerWaitAccept(listener, err);
-            if (!fbuf) {return NULL;}
-            listener->lastbuf = fbuf;
-            return fbuf;
-        } else {
-            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
-                        "listener wait error: invalid FD");
-            /* this is strange bc UDP fbufs are set in fblisteneralloc */
-            return NULL;
+        while (listener->ready_cur < listener->ready_cnt) {
+            if (!fbListenerDispatchFD(
+                    listener, listener->ready[listener->ready_cur++],
+                    &fbuf, err))
+            {
+                return NULL;
+            }
+            if (fbuf) {
+                return fbuf;
+            }
         }
     }
 }
@@ -849,70 +1368,58 @@ fbListenerWaitNoCollectors(
     fbListener_t  *listener,
     GError       **err)
 {
-    fBuf_t      *fbuf = NULL;
-    uint8_t      byte;
-    int          rc;
-    unsigned int i;
-
-    /* set the mode to 1 so fbListenerWaitAccept doesn't add fd */
-    listener->mode = 1;
-    /* wait for data available on one of our file descriptors */
-    rc = poll(listener->pfd_array, listener->pfd_len, -1);
+    fBuf_t *fbuf = NULL;
+    int     fd;
 
-    if (rc < 0) {
-        if (errno == EINTR) {
-            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
-                        "Interrupted listener wait");
-            return NULL;
-        } else {
-            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
-                        "listener wait error: %s",
-                        strerror(errno));
-            return NULL;
-        }
+    if (listener->pool) {
+        fbListenerSetPoolError(err);
+        return NULL;
     }
 
-    /* Loop file descriptors */
-    for (i = 0; i < listener->pfd_len; i++) {
-        struct pollfd *pfd = &listener->pfd_array[i];
-
-        if (pfd->revents & (POLLERR | POLLHUP | POLLNVAL)) {
-            listener->lsock = pfd->fd;
-            break;
-        }
+    /* set the mode to 1 so fbListenerWaitAccept doesn't add fd */
+    listener->mode = 1;
 
-        if (!(pfd->revents & POLLIN)) {
-            continue;
+    /* handle any pending accept, return the accepted buffer immediately. */
+    for (;;) {
+        if (listener->ready_cur >= listener->ready_cnt) {
+            if (!fbListenerFillReady(listener, -1, err)) {
+                return NULL;
+            }
         }
-
-        if (i == 0) {
-            /* read or write interrupt */
-            /* consume and ignore return */
-            read(pfd->fd, &byte, sizeof(byte));
-            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
-                        "External interrupt on pipe");
-            return NULL;
+        while (listener->ready_cur < listener->ready_cnt) {
+            fd = listener->ready[listener->ready_cur++];
+            if (!fbListenerDispatchFD(listener, fd, &fbuf, err)) {
+                return NULL;
+            }
+            if (fbuf) {
+                return fbuf;
+            }
         }
-
-        listener->lsock = pfd->fd;
-        break;
     }
+}
 
-    /* handle any pending accept, return the accepted buffer immediately. */
-    if (listener->mode >= 0) {
-        return fbListenerWaitAccept(listener, err);
-    } else {
-        /* For UDP this doesn't really work, just return the data */
-        if ((fbuf = g_hash_table_lookup(listener->fdtab,
-                                        GINT_TO_POINTER(listener->lsock))))
-        {
-            fbCollectorSetFD(fBufGetCollector(fbuf), listener->lsock);
-            return fbuf;
-        }
-    }
+/**
+ * fbListenerSetEdgeTriggered
+ *
+ *
+ *
+ *
+ */
+gboolean
+fbListenerSetEdgeTriggered(
+    fbListener_t  *listener,
+    gboolean       edge,
+    GError       **err)
+{
+    g_assert(listener);
 
-    /* this should never happen */
-    return NULL;
+    if (edge && listener->evfd < 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                    "Edge-triggered connections need epoll or kqueue");
+        return FALSE;
+    }
+    listener->edge = edge;
+    return TRUE;
 }
 
 
@@ -989,6 +1496,22 @@ fbListenerGetCollector(
 }
 
 
+/**
+ * fbListenerGetStats
+ *
+ *
+ *
+ *
+ */
+void
+fbListenerGetStats(
+    const fbListener_t  *listener,
+    fbStats_t           *stats)
+{
+    *stats = listener->stats;
+}
+
+
 fbListenerGroup_t *
 fbListenerGroupAlloc(
     void)
@@ -996,8 +1519,7 @@ fbListenerGroupAlloc(
     fbListenerGroup_t *group = NULL;
 
     group = g_slice_new0(fbListenerGroup_t);
-    group->group_pfd = ((struct pollfd *)g_slice_alloc0(
-                            MAX_CONNECTIONS * 5 * sizeof(struct pollfd)));
+    group->evfd = fbListenerEventsOpen();
     group->head = NULL;
 
     return group;
@@ -1014,10 +1536,14 @@ void
 fbListenerGroupFree(
     fbListenerGroup_t  *group)
 {
-    if (group && group->group_pfd) {
-        g_slice_free1((MAX_CONNECTIONS * 5 * sizeof(struct pollfd)),
-                      group->group_pfd);
+    if (NULL == group) {
+        return;
     }
+    if (group->evfd >= 0) {
+        close(group->evfd);
+    }
+    g_free(group->group_pfd);
+    g_free(group->group_owner);
 
     g_slice_free(fbListenerGroup_t, group);
 }
@@ -1034,7 +1560,6 @@ fbListenerGroupAddListener(
     const fbListener_t  *listener)
 {
     fbListenerEntry_t *entry = NULL;
-    unsigned int       i;
 
     if (!group || !listener) {
         return 2;
@@ -1057,11 +1582,12 @@ fbListenerGroupAddListener(
 
     group->head = entry;
 
-    /* add FDs */
-    for (i = 0; i < entry->listener->pfd_len; i++) {
-        group->group_pfd[group->pfd_len].fd = entry->listener->pfd_array[i].fd;
-        group->group_pfd[group->pfd_len].events = POLLIN;
-        group->pfd_len++;
+    /* watch the listener's event descriptor; a listener without one makes
+     * the group poll all members' descriptors */
+    if (group->evfd < 0 || listener->evfd < 0 ||
+        !fbListenerEventsAdd(group->evfd, listener->evfd, FALSE))
+    {
+        group->unwatched++;
     }
 
     group->lastlist = entry;
@@ -1080,7 +1606,6 @@ fbListenerGroupDeleteListener(
     const fbListener_t  *listener)
 {
     fbListenerEntry_t *entry = NULL;
-    unsigned int       i, k;
 
     if (!group || !listener) {
         return 2;
@@ -1090,22 +1615,19 @@ fbListenerGroupDeleteListener(
         if (entry->listener == listener) {
             if (entry->prev) {
                 entry->prev->next = entry->next;
+            } else {
+                group->head = entry->next;
             }
 
             if (entry->next) {
                 entry->next->prev = entry->prev;
             }
 
-            /* remove FDs (close will happen later) */
-            for (i = 0; i < entry->listener->pfd_len; i++) {
-                for (k = 0; k < group->pfd_len; k++) {
-                    if (entry->listener->pfd_array[i].fd ==
-                        group->group_pfd[k].fd)
-                    {
-                        group->group_pfd[k].fd = -1;
-                        break;
-                    }
-                }
+            /* stop watching it (close will happen later) */
+            if (group->evfd >= 0 && listener->evfd >= 0) {
+                fbListenerEventsDel(group->evfd, listener->evfd);
+            } else if (group->unwatched) {
+                group->unwatched--;
             }
 
             if (entry == group->lastlist) {
@@ -1156,148 +1678,803 @@ fbListenerFreeGroupResult(
 }
 
 
+/**
+ * fbListenerGroupAddPollFD
+ *
+ * Appends `fd` of `listener` to the descriptors the group polls.
+ *
+ */
+static void
+fbListenerGroupAddPollFD(
+    fbListenerGroup_t  *group,
+    fbListener_t       *listener,
+    int                 fd)
+{
+    if (group->pfd_len == group->pfd_cap) {
+        group->pfd_cap = group->pfd_cap ? (2 * group->pfd_cap) : 32;
+        group->group_pfd = g_renew(struct pollfd, group->group_pfd,
+                                   group->pfd_cap);
+        group->group_owner = g_renew(fbListener_t *, group->group_owner,
+                                     group->pfd_cap);
+    }
+    group->group_pfd[group->pfd_len].fd = fd;
+    group->group_pfd[group->pfd_len].events = POLLIN;
+    group->group_pfd[group->pfd_len].revents = 0;
+    group->group_owner[group->pfd_len] = listener;
+    group->pfd_len++;
+}
+
+/**
+ * fbListenerGroupCollect
+ *
+ * Adds a result for each buffer of `listener` that is ready: after
+ * checking its event descriptor without blocking if `poll_evfd` is TRUE,
+ * and then for each descriptor on its ready list.
+ *
+ */
+static gboolean
+fbListenerGroupCollect(
+    fbListenerGroup_t        *group,
+    fbListenerEntry_t        *entry,
+    gboolean                  poll_evfd,
+    fbListenerGroupResult_t **resultHead,
+    GError                  **err)
+{
+    fbListener_t *listener = entry->listener;
+    fBuf_t       *fbuf;
+
+    if (poll_evfd && listener->ready_cur >= listener->ready_cnt &&
+        !fbListenerFillReady(listener, 0, err))
+    {
+        return FALSE;
+    }
+    while (listener->ready_cur < listener->ready_cnt) {
+        if (!fbListenerDispatchFD(listener,
+                                  listener->ready[listener->ready_cur++],
+                                  &fbuf, err))
+        {
+            return FALSE;
+        }
+        if (fbuf) {
+            fbListenerNewResult(resultHead, listener);
+            group->lastlist = entry;
+        }
+    }
+    return TRUE;
+}
+
 
 fbListenerGroupResult_t *
 fbListenerGroupWait(
     fbListenerGroup_t  *group,
     GError            **err)
 {
-    gboolean     found;
-    uint8_t      byte;
-    unsigned int i, k;
-    int          rc;
-    int          new_fd = -1;
-    fBuf_t      *fbuf = NULL;
     fbListenerEntry_t       *entry       = NULL;
     fbListenerGroupResult_t *resultHead  = NULL;
+    fbListener_t            *listener;
+    int                      ready[FB_LISTENER_MAX_EVENTS];
+    int                      rc, k;
+    nfds_t                   i;
 
     g_assert(group);
 
+    for (entry = group->head; entry; entry = entry->next) {
+        if (entry->listener->pool) {
+            fbListenerSetPoolError(err);
+            return NULL;
+        }
+    }
+
+    /* buffers with messages already read need no wait */
+    for (entry = group->head; entry; entry = entry->next) {
+        if (fbListenerNextRecent(entry->listener)) {
+            fbListenerNewResult(&resultHead, entry->listener);
+            group->lastlist = entry;
+        }
+    }
+
     /* wait for data available on one of our file descriptors */
 
     while (!resultHead) {
-        rc = poll(group->group_pfd, group->pfd_len, -1);
-
-        if (rc < 0) {
-            if (errno == EINTR) {
-                g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
-                            "Interrupted listener wait");
-                return NULL;
-            } else {
-                g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
-                            "listener wait error: %s",
-                            strerror(errno));
+        if (group->evfd >= 0 && 0 == group->unwatched) {
+            rc = fbListenerEventsWait(group->evfd, ready, -1);
+            if (rc < 0) {
+                fbListenerSetWaitError(err);
                 return NULL;
             }
+            /* find out which listener each belongs to */
+            for (k = 0; k < rc; k++) {
+                for (entry = group->head; entry; entry = entry->next) {
+                    if (entry->listener->evfd == ready[k]) {
+                        if (!fbListenerGroupCollect(group, entry, TRUE,
+                                                    &resultHead, err))
+                        {
+                            goto err;
+                        }
+                        break;
+                    }
+                }
+            }
+            continue;
+        }
+
+        /* poll each listener's event descriptor or, without one, its
+         * interrupt pipe, passive sockets, and connections */
+        group->pfd_len = 0;
+        for (entry = group->head; entry; entry = entry->next) {
+            listener = entry->listener;
+            if (listener->evfd >= 0) {
+                fbListenerGroupAddPollFD(group, listener, listener->evfd);
+                continue;
+            }
+            for (i = 0; i < listener->pfd_len; i++) {
+                if (i != 1 && listener->pfd_array[i].fd >= 0) {
+                    fbListenerGroupAddPollFD(group, listener,
+                                             listener->pfd_array[i].fd);
+                }
+            }
+        }
+
+        rc = poll(group->group_pfd, group->pfd_len, -1);
+        if (rc < 0) {
+            fbListenerSetWaitError(err);
+            return NULL;
         }
 
         /* Loop file descriptors */
         for (i = 0; i < group->pfd_len; i++) {
-            struct pollfd *pfd = &group->group_pfd[i];
+            if (!group->group_pfd[i].revents) {
+                continue;
+            }
+            listener = group->group_owner[i];
+            for (entry = group->head; entry->listener != listener;
+                 entry = entry->next)
+            {}
+            if (listener->evfd >= 0) {
+                if (!fbListenerGroupCollect(group, entry, TRUE,
+                                            &resultHead, err))
+                {
+                    goto err;
+                }
+            } else {
+                listener->ready_cur = 0;
+                listener->ready_cnt = 1;
+                listener->ready[0] = group->group_pfd[i].fd;
+                if (!fbListenerGroupCollect(group, entry, FALSE,
+                                            &resultHead, err))
+                {
+                    goto err;
+                }
+            }
+        }
+    } /* !resultHead */
+    return resultHead;
 
-            found = FALSE;
+  err:
+    fbListenerFreeGroupResult(resultHead);
+    return NULL;
+}
 
-            if (pfd->revents & (POLLERR | POLLHUP | POLLNVAL)) {
-                /* hang up or error */
-                new_fd = pfd->fd;
-            } else if (!(pfd->revents & POLLIN)) {
-                continue;
+/**
+ * fbListenerPoolConn_t
+ *
+ * A connection accepted by the pool's accepting thread and handed to a
+ * worker through the worker's pipe.  A socket of -1 stops the worker.
+ */
+typedef struct fbListenerPoolConn_st {
+    int        sock;
+    socklen_t  peerlen;
+    union {
+        struct sockaddr       so;
+        struct sockaddr_in    ip4;
+        struct sockaddr_in6   ip6;
+    }          peer;
+} fbListenerPoolConn_t;
+
+/**
+ * fbListenerPoolWorker_t
+ *
+ * A worker thread and the connections it owns.
+ */
+typedef struct fbListenerPoolWorker_st {
+    /** the pool */
+    fbListenerPool_t  *pool;
+    /** index among the pool's workers */
+    unsigned int       index;
+    /** the thread */
+    pthread_t          thread;
+    /** receives fbListenerPoolConn_t; [0] is read by the worker */
+    int                pipe[2];
+    /** epoll or kqueue descriptor watching pipe[0] and the connections,
+     * or -1 to poll() them */
+    int                evfd;
+    /** Maps socket descriptors to the buffers of the worker's connections */
+    GHashTable        *conns;
+    /** descriptors polled when evfd is -1, rebuilt when conns changes */
+    struct pollfd     *pfd;
+    nfds_t             pfd_len;
+    nfds_t             pfd_cap;
+    gboolean           pfd_stale;
+    /**
+     * Connections that stopped after FB_LISTENER_POOL_BURST messages and
+     * may have more; they are read again before the worker blocks.
+     */
+    int               *again;
+    unsigned int       again_len;
+    unsigned int       again_cap;
+} fbListenerPoolWorker_t;
+
+struct fbListenerPool_st {
+    /** listener whose connections the pool reads */
+    fbListener_t              *listener;
+    /** called for each message */
+    fbListenerPoolMessage_fn   onmsg;
+    /** application data for onmsg */
+    void                      *udata;
+    /**
+     * Held while creating and freeing buffers, and while fBufFree() takes
+     * a connection off the listener.  Cloned sessions share the listener
+     * session's internal templates, whose reference counts are not
+     * atomic; the caches those templates keep are updated atomically.
+     */
+    pthread_mutex_t            lock;
+    /** the workers */
+    fbListenerPoolWorker_t    *workers;
+    unsigned int               worker_count;
+    /** worker that receives the next connection */
+    unsigned int               next_worker;
+    /** mode of the listener before the pool was attached */
+    int                        listener_mode;
+};
+
+/**
+ * fbListenerPoolCloseConn
+ *
+ * Frees the buffer of one of a worker's connections, which closes the
+ * connection and calls the application's free function.
+ *
+ */
+static void
+fbListenerPoolCloseConn(
+    fbListenerPoolWorker_t  *worker,
+    int                      fd,
+    fBuf_t                  *fbuf)
+{
+    if (worker->evfd >= 0) {
+        fbListenerEventsDel(worker->evfd, fd);
+    }
+    g_hash_table_remove(worker->conns, GINT_TO_POINTER(fd));
+    worker->pfd_stale = TRUE;
+
+    pthread_mutex_lock(&worker->pool->lock);
+    fBufFree(fbuf);
+    pthread_mutex_unlock(&worker->pool->lock);
+}
+
+/**
+ * fbListenerPoolAddConn
+ *
+ * Creates the collector and buffer for a connection handed to the worker,
+ * makes its socket non-blocking, and starts watching it.  Returns FALSE
+ * if told to stop.
+ *
+ */
+static gboolean
+fbListenerPoolAddConn(
+    fbListenerPoolWorker_t  *worker)
+{
+    fbListenerPoolConn_t conn;
+    fBuf_t              *fbuf;
+    GError              *err = NULL;
+
+    if (read(worker->pipe[0], &conn, sizeof(conn)) != sizeof(conn) ||
+        conn.sock < 0)
+    {
+        return FALSE;
+    }
+
+    fbuf = fbListenerSetupConnection(worker->pool->listener, conn.sock,
+                                     &(conn.peer.so), conn.peerlen,
+                                     &worker->pool->lock, &err);
+    if (!fbuf) {
+        /* rejected by the application or collector setup failed */
+        g_clear_error(&err);
+        return TRUE;
+    }
+    fBufSetAutomaticMode(fbuf, FALSE);
+
+    /* a peer that sends part of a message must not stall the worker */
+    if (!fbCollectorSetNonBlocking(fBufGetCollector(fbuf), &err)) {
+        g_warning("Cannot read connection: %s", err->message);
+        g_clear_error(&err);
+        pthread_mutex_lock(&worker->pool->lock);
+        fBufFree(fbuf);
+        pthread_mutex_unlock(&worker->pool->lock);
+        return TRUE;
+    }
+
+    g_hash_table_insert(worker->conns, GINT_TO_POINTER(conn.sock), fbuf);
+    worker->pfd_stale = TRUE;
+    if (worker->evfd >= 0 &&
+        !fbListenerEventsAdd(worker->evfd, conn.sock, FALSE))
+    {
+        g_warning("Cannot watch connection: %s", strerror(errno));
+    }
+    return TRUE;
+}
+
+/**
+ * fbListenerPoolReadAgain
+ *
+ * Queues one of a worker's connections to be read again before the
+ * worker next blocks.
+ *
+ */
+static void
+fbListenerPoolReadAgain(
+    fbListenerPoolWorker_t  *worker,
+    int                      fd)
+{
+    unsigned int i;
+
+    for (i = 0; i < worker->again_len; i++) {
+        if (worker->again[i] == fd) {
+            return;
+        }
+    }
+    if (worker->again_len == worker->again_cap) {
+        worker->again_cap = worker->again_cap ? 2 * worker->again_cap : 8;
+        worker->again = g_renew(int, worker->again, worker->again_cap);
+    }
+    worker->again[worker->again_len++] = fd;
+}
+
+/**
+ * fbListenerPoolReadConn
+ *
+ * Passes the complete messages available on one of a worker's
+ * connections to the application.  The socket is non-blocking, so a
+ * partial message stays in the collector's receive buffer until the rest
+ * arrives, and a read interrupted by a signal is retried when the socket
+ * is next reported readable.  After FB_LISTENER_POOL_BURST messages the
+ * connection is queued to be read again so that the worker's other
+ * connections get a turn.  Closes the connection on end of stream,
+ * error, or when the application returns FALSE.
+ *
+ */
+static void
+fbListenerPoolReadConn(
+    fbListenerPoolWorker_t  *worker,
+    int                      fd)
+{
+    fbListenerPool_t *pool = worker->pool;
+    fBuf_t           *fbuf;
+    GError           *err = NULL;
+    unsigned int      count;
+
+    fbuf = g_hash_table_lookup(worker->conns, GINT_TO_POINTER(fd));
+    if (!fbuf) {
+        return;
+    }
+
+    for (count = 0; count < FB_LISTENER_POOL_BURST; count++) {
+        if (!fBufNextMessage(fbuf, &err)) {
+            if (g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD)) {
+                /* no complete message yet */
+                g_clear_error(&err);
+                return;
             }
+            g_clear_error(&err);
+            fbListenerPoolCloseConn(worker, fd, fbuf);
+            return;
+        }
+        if (!pool->onmsg(fbuf, worker->index, pool->udata)) {
+            fbListenerPoolCloseConn(worker, fd, fbuf);
+            return;
+        }
+    }
+    fbListenerPoolReadAgain(worker, fd);
+}
+
+/**
+ * fbListenerPoolWorkerWait
+ *
+ * Waits up to `timeout` milliseconds (-1 for no limit) for input on the
+ * worker's pipe and connections and stores the ready descriptors in
+ * `ready`.  Returns their count.
+ *
+ */
+static int
+fbListenerPoolWorkerWait(
+    fbListenerPoolWorker_t  *worker,
+    int                     *ready,
+    int                      timeout)
+{
+    GHashTableIter iter;
+    gpointer       key;
+    nfds_t         i;
+    int            rc;
 
-            new_fd = pfd->fd;
+    if (worker->evfd >= 0) {
+        return fbListenerEventsWait(worker->evfd, ready, timeout);
+    }
 
-            /* check to see if this belongs to the last listener */
-            if (new_fd == group->lastlist->listener->lsock) {
-                fbListenerNewResult(&resultHead, group->lastlist->listener);
-                continue;
+    if (worker->pfd_stale) {
+        worker->pfd_len = 0;
+        if (worker->pfd_cap < (nfds_t)g_hash_table_size(worker->conns) + 1) {
+            worker->pfd_cap = g_hash_table_size(worker->conns) + 1;
+            worker->pfd = g_renew(struct pollfd, worker->pfd,
+                                  worker->pfd_cap);
+        }
+        worker->pfd[worker->pfd_len++].fd = worker->pipe[0];
+        g_hash_table_iter_init(&iter, worker->conns);
+        while (g_hash_table_iter_next(&iter, &key, NULL)) {
+            worker->pfd[worker->pfd_len++].fd = GPOINTER_TO_INT(key);
+        }
+        for (i = 0; i < worker->pfd_len; i++) {
+            worker->pfd[i].events = POLLIN;
+        }
+        worker->pfd_stale = FALSE;
+    }
+
+    rc = poll(worker->pfd, worker->pfd_len, timeout);
+    if (rc > 0) {
+        rc = 0;
+        for (i = 0; i < worker->pfd_len && rc < FB_LISTENER_MAX_EVENTS; i++) {
+            if (worker->pfd[i].revents) {
+                ready[rc++] = worker->pfd[i].fd;
             }
+        }
+    }
+    return rc;
+}
 
-            /* find out which listener this belongs to */
-            for (entry = group->head; entry; entry = entry->next) {
-                /* handle interrupt pipe read end */
-
-                for (k = 0; k < entry->listener->pfd_len; k++) {
-                    struct pollfd *cpfd = &entry->listener->pfd_array[k];
-
-                    if (new_fd == cpfd->fd) {
-                        if (k == 0) {
-                            /* read or write interrupt */
-                            /* consume and ignore return */
-                            read(cpfd->fd, &byte, sizeof(byte));
-                            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NLREAD,
-                                        "External interrupt on pipe");
-                            return NULL;
-                        }
+/**
+ * fbListenerPoolWorkerMain
+ *
+ * Thread function of a worker: reads its connections until stopped, then
+ * frees them.
+ *
+ */
+static void *
+fbListenerPoolWorkerMain(
+    void  *vworker)
+{
+    fbListenerPoolWorker_t *worker = (fbListenerPoolWorker_t *)vworker;
+    int                     ready[FB_LISTENER_MAX_EVENTS];
+    GHashTableIter          iter;
+    gpointer                key, value;
+    gboolean                running = TRUE;
+    unsigned int            again, j;
+    int                     rc, i;
+
+    while (running) {
+        /* do not block while a connection has messages left to read */
+        rc = fbListenerPoolWorkerWait(worker, ready,
+                                      worker->again_len ? 0 : -1);
+        if (rc < 0 && errno != EINTR) {
+            g_warning("listener pool wait error: %s", strerror(errno));
+            break;
+        }
+        for (i = 0; i < rc; i++) {
+            if (ready[i] == worker->pipe[0]) {
+                running = fbListenerPoolAddConn(worker);
+            } else {
+                fbListenerPoolReadConn(worker, ready[i]);
+            }
+        }
 
-                        if ((entry->listener->lsock == new_fd) &&
-                            entry->listener->lastbuf)
-                        {
-                            fbListenerNewResult(&resultHead, entry->listener);
-                            found = TRUE;
-                            group->lastlist = entry;
-                            break;
-                        }
+        /* read the connections queued by the previous pass; reading may
+         * queue them again after these */
+        again = worker->again_len;
+        for (j = 0; j < again && running; j++) {
+            fbListenerPoolReadConn(worker, worker->again[j]);
+        }
+        again = MIN(again, worker->again_len);
+        memmove(worker->again, worker->again + again,
+                (worker->again_len - again) * sizeof(int));
+        worker->again_len -= again;
+    }
 
-                        entry->listener->lsock = new_fd;
-                        /* Look it up */
-                        if ((fbuf = g_hash_table_lookup(
-                                 entry->listener->fdtab,
-                                 GINT_TO_POINTER(new_fd))))
-                        {
-                            if (entry->listener->mode < 0) {
-                                fbCollectorSetFD(fBufGetCollector(fbuf),
-                                                 new_fd);
-                            }
-                            entry->listener->lastbuf = fbuf;
-                            fbListenerNewResult(&resultHead, entry->listener);
-                            group->lastlist = entry;
-                            found = TRUE;
-                            break;
-                        } else {
-                            if (entry->listener->mode >= 0) {
-                                /* TCP - call accept */
-                                fbuf = fbListenerWaitAccept(entry->listener,
-                                                            err);
-                                entry->listener->lastbuf = fbuf;
-                                fbListenerNewResult(&resultHead,
-                                                    entry->listener);
-                                if (group->pfd_len < (MAX_CONNECTIONS * 5)) {
-                                    fbListenerAddPollFD(
-                                        group->group_pfd,
-                                        &group->pfd_len,
-                                        entry->listener->lsock);
-                                } else {
-                                    g_warning("Maximum connections reached "
-                                              "for Listener Group (%d)",
-                                              (int)group->pfd_len);
-                                }
-                                found = TRUE;
-                                group->lastlist = entry;
-                                break;
-                            } else {
-                                /* shouldn't happen */
-                                g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
-                                            "listener wait error: invalid FD");
-                                return NULL;
-                            }
-                        }
-                    } /* new_fd == cpfd->fd */
-                } /* listener->pfd_array for loop */
+    /* free open connections on this thread */
+    g_hash_table_iter_init(&iter, worker->conns);
+    while (g_hash_table_iter_next(&iter, &key, &value)) {
+        g_hash_table_iter_remove(&iter);
+        pthread_mutex_lock(&worker->pool->lock);
+        fBufFree((fBuf_t *)value);
+        pthread_mutex_unlock(&worker->pool->lock);
+    }
 
-                if (found) {
-                    break;
-                }
-            } /* listenergroup for loop */
+    return NULL;
+}
+
+/**
+ * fbListenerPoolAlloc
+ *
+ *
+ *
+ *
+ */
+fbListenerPool_t *
+fbListenerPoolAlloc(
+    fbListener_t              *listener,
+    unsigned int               workers,
+    fbListenerPoolMessage_fn   onmsg,
+    void                      *udata,
+    GError                   **err)
+{
+    fbListenerPool_t       *pool;
+    fbListenerPoolWorker_t *worker;
+    unsigned int            i;
+
+    g_assert(listener);
+    g_assert(onmsg);
+
+    if (!listener->spec || listener->mode < 0) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_CONN,
+                    "Listener pools need a listener that accepts"
+                    " connections");
+        return NULL;
+    }
+    if (listener->pool) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Listener already has a pool");
+        return NULL;
+    }
+    if (0 == workers) {
+        g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SETUP,
+                    "Listener pool needs at least one worker");
+        return NULL;
+    }
 
-            if (!found) {
-                /* close the old one, it doesn't belong to any listeners
-                 * it most likely was closed on the listener */
-                close(pfd->fd);
-                pfd->fd = -1;
+    pool = g_slice_new0(fbListenerPool_t);
+    pool->listener = listener;
+    pool->onmsg = onmsg;
+    pool->udata = udata;
+    pthread_mutex_init(&pool->lock, NULL);
+    pool->workers = g_new0(fbListenerPoolWorker_t, workers);
+
+    for (i = 0; i < workers; i++) {
+        worker = &pool->workers[i];
+        worker->pool = pool;
+        worker->index = i;
+        worker->conns = g_hash_table_new(g_direct_hash, g_direct_equal);
+        worker->pfd_stale = TRUE;
+        if (pipe(worker->pipe)) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "listener pool error creating pipe: %s",
+                        strerror(errno));
+            g_hash_table_destroy(worker->conns);
+            break;
+        }
+        worker->evfd = fbListenerEventsOpen();
+        if (worker->evfd >= 0 &&
+            !fbListenerEventsAdd(worker->evfd, worker->pipe[0], FALSE))
+        {
+            close(worker->evfd);
+            worker->evfd = -1;
+        }
+        if (pthread_create(&worker->thread, NULL,
+                           fbListenerPoolWorkerMain, worker))
+        {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "listener pool error creating thread: %s",
+                        strerror(errno));
+            close(worker->pipe[0]);
+            close(worker->pipe[1]);
+            if (worker->evfd >= 0) {
+                close(worker->evfd);
             }
-        } /* loop through fd's */
-    } /* !resultHead */
-    return resultHead;
+            g_hash_table_destroy(worker->conns);
+            break;
+        }
+        pool->worker_count++;
+    }
+
+    if (pool->worker_count < workers) {
+        fbListenerPoolFree(pool);
+        return NULL;
+    }
+
+    /* accepted connections belong to the pool, not the listener, and the
+     * listener may no longer be waited on */
+    pool->listener_mode = listener->mode;
+    listener->mode = 1;
+    listener->pool = pool;
+
+    return pool;
+}
+
+/**
+ * fbListenerPoolAccept
+ *
+ * Accepts a connection on the passive socket `fd` and hands it to the
+ * next worker.  A connection that failed before it could be accepted is
+ * skipped, and when out of descriptors or memory the pool waits for the
+ * workers to close some; both return TRUE.  Returns FALSE and sets `err`
+ * on any other error.
+ *
+ */
+static gboolean
+fbListenerPoolAccept(
+    fbListenerPool_t  *pool,
+    int                fd,
+    gboolean          *starved,
+    GError           **err)
+{
+    fbListenerPoolWorker_t *worker;
+    fbListenerPoolConn_t    conn;
+
+    memset(&conn, 0, sizeof(conn));
+    conn.peerlen = sizeof(conn.peer);
+    conn.sock = accept(fd, &(conn.peer.so), &conn.peerlen);
+    if (conn.sock < 0) {
+        switch (errno) {
+          case EINTR:
+          case EAGAIN:
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+          case EWOULDBLOCK:
+#endif
+          case ECONNABORTED:
+          case EPROTO:
+          case EPERM:
+          case ENETDOWN:
+          case ENETUNREACH:
+          case EHOSTDOWN:
+          case EHOSTUNREACH:
+          case ENOPROTOOPT:
+          case EOPNOTSUPP:
+#ifdef ENONET
+          case ENONET:
+#endif
+            /* the connection went away or was refused; keep accepting */
+            return TRUE;
+          case EMFILE:
+          case ENFILE:
+          case ENOBUFS:
+          case ENOMEM:
+            if (!*starved) {
+                g_warning("listener pool cannot accept: %s",
+                          strerror(errno));
+                *starved = TRUE;
+            }
+            g_usleep(FB_LISTENER_POOL_ACCEPT_DELAY);
+            return TRUE;
+          default:
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IO,
+                        "listener accept error: %s", strerror(errno));
+            return FALSE;
+        }
+    }
+    *starved = FALSE;
+
+    /* the connection is set up on the thread that will own it */
+    worker = &pool->workers[pool->next_worker];
+    pool->next_worker = (pool->next_worker + 1) % pool->worker_count;
+    if (write(worker->pipe[1], &conn, sizeof(conn)) != sizeof(conn)) {
+        close(conn.sock);
+    }
+    return TRUE;
+}
+
+/**
+ * fbListenerPoolRun
+ *
+ *
+ *
+ *
+ */
+gboolean
+fbListenerPoolRun(
+    fbListenerPool_t  *pool,
+    GError           **err)
+{
+    fbListener_t  *listener = pool->listener;
+    struct pollfd *pfd;
+    int           *flags;
+    nfds_t         pfd_len = 0;
+    nfds_t         i;
+    uint8_t        byte;
+    gboolean       starved = FALSE;
+    gboolean       ok = FALSE;
+
+    /* wait on the interrupt pipe and passive sockets only; the worker
+     * threads may call fbListenerRemove() on the listener meanwhile, so
+     * its ready list and descriptor table are left alone */
+    pfd = g_new0(struct pollfd, listener->pfd_passive);
+    flags = g_new0(int, listener->pfd_passive);
+    for (i = 0; i < listener->pfd_passive; i++) {
+        if (i != 1 && listener->pfd_array[i].fd >= 0) {
+            pfd[pfd_len].fd = listener->pfd_array[i].fd;
+            pfd[pfd_len].events = POLLIN;
+            pfd_len++;
+        }
+    }
+
+    /* a connection reset between poll() and accept() must not block the
+     * pool, so accept without blocking; restored on return */
+    for (i = 1; i < pfd_len; i++) {
+        flags[i] = fcntl(pfd[i].fd, F_GETFL);
+        if (flags[i] >= 0) {
+            fcntl(pfd[i].fd, F_SETFL, flags[i] | O_NONBLOCK);
+        }
+    }
+
+    for (;;) {
+        if (poll(pfd, pfd_len, -1) < 0) {
+            fbListenerSetWaitError(err);
+            goto end;
+        }
+        if (pfd[0].revents) {
+            /* consume and ignore return */
+            read(pfd[0].fd, &byte, sizeof(byte));
+            ok = TRUE;
+            goto end;
+        }
+        for (i = 1; i < pfd_len; i++) {
+            if (pfd[i].revents &&
+                !fbListenerPoolAccept(pool, pfd[i].fd, &starved, err))
+            {
+                goto end;
+            }
+        }
+    }
+
+  end:
+    for (i = 1; i < pfd_len; i++) {
+        if (flags[i] >= 0) {
+            fcntl(pfd[i].fd, F_SETFL, flags[i]);
+        }
+    }
+    g_free(flags);
+    g_free(pfd);
+    return ok;
+}
+
+/**
+ * fbListenerPoolFree
+ *
+ *
+ *
+ *
+ */
+void
+fbListenerPoolFree(
+    fbListenerPool_t  *pool)
+{
+    fbListenerPoolWorker_t *worker;
+    fbListenerPoolConn_t    conn;
+    unsigned int            i;
+
+    if (NULL == pool) {
+        return;
+    }
+
+    memset(&conn, 0, sizeof(conn));
+    conn.sock = -1;
+    for (i = 0; i < pool->worker_count; i++) {
+        /* ignore return; the thread exits if the pipe is closed */
+        write(pool->workers[i].pipe[1], &conn, sizeof(conn));
+    }
+    for (i = 0; i < pool->worker_count; i++) {
+        worker = &pool->workers[i];
+        pthread_join(worker->thread, NULL);
+        close(worker->pipe[0]);
+        close(worker->pipe[1]);
+        if (worker->evfd >= 0) {
+            close(worker->evfd);
+        }
+        g_hash_table_destroy(worker->conns);
+        g_free(worker->pfd);
+        g_free(worker->again);
+    }
+    if (pool->listener->pool == pool) {
+        pool->listener->pool = NULL;
+        pool->listener->mode = pool->listener_mode;
+    }
+    g_free(pool->workers);
+    pthread_mutex_destroy(&pool->lock);
+    g_slice_free(fbListenerPool_t, pool);
 }
 
 /*  Given a socket descriptor with an existing connection, return an fbuf
@@ -1399,9 +2576,17 @@ fbListenerRemoveLastBuf(
     fBuf_t        *fbuf,
     fbListener_t  *listener)
 {
+    unsigned int i;
+
     if (listener->lastbuf == fbuf) {
         listener->lastbuf = NULL;
     }
+    for (i = 0; i < listener->recent_len; i++) {
+        if (listener->recent[i] == fbuf) {
+            listener->recent[i] = listener->recent[--listener->recent_len];
+            break;
+        }
+    }
 }
 
 gboolean
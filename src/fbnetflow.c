@@ -239,24 +239,47 @@ typedef struct fbCollectorNetflowV9TemplateHash_st {
     gboolean   optionsTemplate;
     /** boolean flag set if we added sysuptime field to template */
     gboolean   addSysUpTime;
+    /** length of a record once converted to IPFIX: templateLength plus
+     *  the sysuptime field when addSysUpTime is set.  Computed when the
+     *  template is parsed so fbCollectorPostProcV9() can convert a whole
+     *  set at once */
+    uint16_t   ipfixLength;
 } fbCollectorNetflowV9TemplateHash_t;
 
 typedef struct fbCollectorNetflowV9Session_st {
     /** template hash */
     GHashTable  *templateHash;
-    /** potential missed packets */
+    /** potential missed packets; see netflowAddMissed() */
     uint32_t     netflowMissed;
     /** current netflow seq num */
     uint32_t     netflowSeqNum;
     /** current ipfix seq num */
     uint32_t     ipfixSeqNum;
+    /** observation domain of the exporter, for fbCollectorGetNetflowMissed */
+    uint32_t     obdomain;
+    /** address of the exporter */
+    union {
+        struct sockaddr       so;
+        struct sockaddr_in    ip4;
+        struct sockaddr_in6   ip6;
+    }            peer;
+    /** size of peer */
+    size_t       peerlen;
 } fbCollectorNetflowV9Session_t;
 
-/** defines the extra state needed to convert from NetflowV9 to IPFIX */
+/**
+ * defines the extra state needed to convert from NetflowV9 to IPFIX
+ *
+ * Only the thread reading the collector changes this state.  It takes
+ * ts_lock only to add sessions to or remove them from domainHash, so
+ * that fbCollectorGetNetflowMissed() may search domainHash from another
+ * thread while holding ts_lock.
+ */
 struct fbCollectorNetflowV9State_st {
     uint64_t                        sysUpTime;
     uint32_t                        observation_id;
     fbSession_t                    *sessionptr;
+    /** session of sessionptr; set atomically */
     fbCollectorNetflowV9Session_t  *session;
     /* need to keep templates per domain */
     GHashTable                     *domainHash;
@@ -291,6 +314,22 @@ domainHashDestroyHelper(
     g_slice_free(fbCollectorNetflowV9Session_t, datum);
 }
 
+/**
+ * netflowAddMissed
+ *
+ * Adds `count`, which may be negative, to the missed packet count of
+ * `nfsession`.  The count is updated atomically since
+ * fbCollectorGetNetflowMissed() may read it from another thread.
+ *
+ */
+static void
+netflowAddMissed(
+    fbCollectorNetflowV9Session_t  *nfsession,
+    int                             count)
+{
+    g_atomic_int_add((gint *)&nfsession->netflowMissed, count);
+}
+
 
 
 /*#################################################
@@ -766,8 +805,10 @@ netflowDataTemplateParse(
         newTemplate->optionsTemplate = FALSE;
         if (addSysUpTime) {
             newTemplate->addSysUpTime = TRUE;
+            newTemplate->ipfixLength = targetRecSize + sizeof(uint64_t);
         } else {
             newTemplate->addSysUpTime = FALSE;
+            newTemplate->ipfixLength = targetRecSize;
         }
         addSysUpTime = FALSE;
 
@@ -949,6 +990,7 @@ netflowOptionsTemplateParse(
         newTemplate->templateLength = templateLength;
         newTemplate->optionsTemplate = TRUE;
         newTemplate->addSysUpTime = FALSE;
+        newTemplate->ipfixLength = templateLength;
         /* if there is no TemplateHash this is the first template we
          * are receiving in the current domain. Create a Hash for the domain.*/
         if (currentSession->templateHash == NULL) {
@@ -1073,21 +1115,25 @@ fbCollectorPostProcV9(
     /* read the observation domain */
     READU32INC(msgOsetPtr, obsDomain);
 
-    pthread_mutex_lock(&transState->ts_lock);
-
     transState->observation_id = obsDomain;
 
     if (transState->sessionptr != collector->udp_head->session) {
         /* lookup template Hash Table per Domain */
-        transState->session =
-            g_hash_table_lookup(transState->domainHash,
-                                collector->udp_head->session);
-        if (transState->session == NULL) {
-            transState->session = g_slice_new0(fbCollectorNetflowV9Session_t);
+        currentSession = g_hash_table_lookup(transState->domainHash,
+                                             collector->udp_head->session);
+        if (currentSession == NULL) {
+            currentSession = g_slice_new0(fbCollectorNetflowV9Session_t);
+            currentSession->obdomain = collector->udp_head->obdomain;
+            currentSession->peerlen = collector->udp_head->peerlen;
+            memcpy(&(currentSession->peer), &(collector->udp_head->peer),
+                   currentSession->peerlen);
+            pthread_mutex_lock(&transState->ts_lock);
             g_hash_table_insert(transState->domainHash,
                                 (gpointer)collector->udp_head->session,
-                                transState->session);
+                                currentSession);
+            pthread_mutex_unlock(&transState->ts_lock);
         }
+        g_atomic_pointer_set(&transState->session, currentSession);
         transState->sessionptr = collector->udp_head->session;
     }
 
@@ -1108,10 +1154,10 @@ fbCollectorPostProcV9(
                     /* check for reboot */
                     if (transState->sysUpTime > NF_REBOOT_SECS) {
                         /* probably not a reboot so account for missed */
-                        currentSession->netflowMissed += seq_diff;
+                        netflowAddMissed(currentSession, seq_diff);
                     } /* else - reboot? don't add to missed count */
                 } else {
-                    currentSession->netflowMissed += seq_diff;
+                    netflowAddMissed(currentSession, seq_diff);
                 }
                 currentSession->netflowSeqNum = netflowSeqNum;
             } else {
@@ -1127,7 +1173,7 @@ fbCollectorPostProcV9(
                     /* But subtract one so when we add one below, it evens out
                      */
                     if (currentSession->netflowMissed) {
-                        currentSession->netflowMissed -= 1;
+                        netflowAddMissed(currentSession, -1);
                     }
                     currentSession->netflowSeqNum -= 1;
                 }
@@ -1158,7 +1204,6 @@ fbCollectorPostProcV9(
             g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NETFLOWV9,
                         "Invalid Netflow %s Record Length (%u < 4)",
                         ((1 == setId) ? "Options" : "Data"), recordLength);
-            pthread_mutex_unlock(&transState->ts_lock);
             return FALSE;
         }
         /* Check to make sure we won't overrun buffer - Add 4 for set header */
@@ -1168,7 +1213,6 @@ fbCollectorPostProcV9(
                         "larger than remaining buffer length (%ld)",
                         (1 == setId) ? "Options" : "Record",
                         recordLength, ((dataBuf + *bufLen + 4) - msgOsetPtr));
-            pthread_mutex_unlock(&transState->ts_lock);
             return FALSE;
         }
 
@@ -1181,7 +1225,6 @@ fbCollectorPostProcV9(
                                                     recLengthPtr,
                                                     dataBuf, bufLen, err);
             if (!tmpls_parsed) {
-                pthread_mutex_unlock(&transState->ts_lock);
                 return FALSE;
             }
 
@@ -1202,7 +1245,6 @@ fbCollectorPostProcV9(
                                                        recLengthPtr, err);
             if (!tmpls_parsed) {
                 /* Needs to contain at least 1 */
-                pthread_mutex_unlock(&transState->ts_lock);
                 return FALSE;
             }
 
@@ -1216,7 +1258,6 @@ fbCollectorPostProcV9(
             /* data records must be 256 or higher */
             g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NETFLOWV9,
                         "NetFlow record type (%u) is not supported", setId);
-            pthread_mutex_unlock(&transState->ts_lock);
             return FALSE;
         } else {
             /* DATA */
@@ -1231,7 +1272,6 @@ fbCollectorPostProcV9(
                                 "No Templates Present for this session."
                                 " %u Flows Lost.", recordCount - recordCounter);
                     currentSession->netflowSeqNum++;
-                    pthread_mutex_unlock(&transState->ts_lock);
                     return FALSE;
                 }
                 /* else, remove these bytes from the packet */
@@ -1258,7 +1298,6 @@ fbCollectorPostProcV9(
                                 " %u Flows Lost.", setId,
                                 (recordCount - recordCounter));
                     currentSession->netflowSeqNum++;
-                    pthread_mutex_unlock(&transState->ts_lock);
                     return FALSE;
                 }
                 /* else, remove these bytes from the packet */
@@ -1287,7 +1326,6 @@ fbCollectorPostProcV9(
                 if (numberRecordsInSet == 0) {
                     g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_NETFLOWV9,
                                 "NetFlow Data Record with 0 Records");
-                    pthread_mutex_unlock(&transState->ts_lock);
                     return FALSE;
                 }
 
@@ -1296,30 +1334,39 @@ fbCollectorPostProcV9(
 
                 /* now check if need to add sysuptime to the record */
                 if (derTemplate->addSysUpTime) {
-                    for (i = 0; i < numberRecordsInSet; i++) {
-                        msgOsetPtr += derTemplate->templateLength;
-                        if (FB_MSGLEN_MAX <= (*bufLen + sizeof(uint64_t))) {
-                            g_set_error(err, FB_ERROR_DOMAIN,
-                                        FB_ERROR_NETFLOWV9,
-                                        "NetFlow V9 unable to convert "
-                                        "information model "
-                                        "time elements, no space");
-                            pthread_mutex_unlock(&transState->ts_lock);
-                            return FALSE;
-                        }
-
-                        memmove((msgOsetPtr + sizeof(uint64_t)), msgOsetPtr,
-                                (*bufLen - (msgOsetPtr - dataBuf)));
+                    uint16_t inLen = derTemplate->templateLength;
+                    uint16_t outLen = derTemplate->ipfixLength;
+                    size_t   growth = ((size_t)numberRecordsInSet *
+                                       (outLen - inLen));
+                    uint8_t *setEnd = msgOsetPtr + (numberRecordsInSet *
+                                                    (size_t)inLen);
+
+                    if (FB_MSGLEN_MAX <= (*bufLen + growth)) {
+                        g_set_error(err, FB_ERROR_DOMAIN,
+                                    FB_ERROR_NETFLOWV9,
+                                    "NetFlow V9 unable to convert "
+                                    "information model "
+                                    "time elements, no space");
+                        return FALSE;
+                    }
+
+                    /* open up room for every record's sysUpTime with a
+                     * single move of the bytes after the records, then
+                     * spread the records out from last to first so no
+                     * record is overwritten before it is moved */
+                    memmove(setEnd + growth, setEnd,
+                            (*bufLen - (setEnd - dataBuf)));
+                    for (i = numberRecordsInSet - 1; i >= 0; i--) {
+                        memmove(msgOsetPtr + (i * (size_t)outLen),
+                                msgOsetPtr + (i * (size_t)inLen), inLen);
                         /* add sysUpTime to flow record */
-                        memcpy(msgOsetPtr, &(transState->sysUpTime),
-                               sizeof(uint64_t));
-                        msgOsetPtr += sizeof(uint64_t);
-                        *bufLen += sizeof(uint64_t);
+                        memcpy(msgOsetPtr + (i * (size_t)outLen) + inLen,
+                               &(transState->sysUpTime), sizeof(uint64_t));
                     }
-                    msgOsetPtr += padding;
-                    *recLengthPtr = g_htons(recordLength +
-                                            (numberRecordsInSet *
-                                             sizeof(uint64_t)));
+                    msgOsetPtr += (numberRecordsInSet * (size_t)outLen) +
+                        padding;
+                    *bufLen += growth;
+                    *recLengthPtr = g_htons(recordLength + growth);
                 } else {
                     /* subtract 4 since we already incremented msgOsetPtr 4
                      * for id & length */
@@ -1338,7 +1385,6 @@ fbCollectorPostProcV9(
                     "%u, processed %u)", (unsigned int)(*bufLen),
                     ntohs(*lengthCountPtr));
         currentSession->netflowSeqNum++;
-        pthread_mutex_unlock(&transState->ts_lock);
         return FALSE;
     }
 
@@ -1378,8 +1424,6 @@ fbCollectorPostProcV9(
     }
 #endif /* if FB_NETFLOW_DEBUG == 1 */
 
-    pthread_mutex_unlock(&transState->ts_lock);
-
     return TRUE;
 }
 
@@ -1448,7 +1492,7 @@ fbCollectorTimeOutSessionV9(
 
     if (session == transState->sessionptr) {
         transState->sessionptr = NULL;
-        transState->session = NULL;
+        g_atomic_pointer_set(&transState->session, NULL);
     }
 
     pthread_mutex_unlock(&transState->ts_lock);
@@ -1544,39 +1588,16 @@ fbCollectorGetNetflowMissed(
     uint32_t                obdomain)
 {
     struct fbCollectorNetflowV9State_st *ts = NULL;
-    fbUDPConnSpec_t *udp = NULL;
-    fbSession_t *session = NULL;
     fbCollectorNetflowV9Session_t       *ts_session = NULL;
-    uint32_t missed = 0;
+    fbCollectorNetflowV9Session_t       *nfsession;
+    GHashTableIter iter;
+    gpointer       value;
+    uint32_t       missed = 0;
 
     if (!collector) {
         return 0;
     }
 
-    if (peer) {
-        udp = collector->udp_head;
-        while (udp) {
-            /* loop through and find the match */
-            if (udp->obdomain == obdomain) {
-                if (!memcmp(&(udp->peer), peer, (peerlen > udp->peerlen) ?
-                            udp->peerlen : peerlen))
-                {
-                    /* we have a match - set session */
-                    session = udp->session;
-                    break;
-                }
-            }
-            udp = udp->next;
-        }
-    } else {
-        /* set to most recent */
-        session = collector->udp_head->session;
-    }
-
-    if (!session) {
-        return 0;
-    }
-
     ts = (struct fbCollectorNetflowV9State_st *)collector->translatorState;
 
     if (ts == NULL) {
@@ -1584,17 +1605,31 @@ fbCollectorGetNetflowMissed(
         return 0;
     }
 
+    /* the collecting thread keeps reading; it only waits for this lock
+     * when a session starts or times out */
     pthread_mutex_lock(&ts->ts_lock);
 
-    if (ts->sessionptr != session) {
-        /* lookup template Hash Table per Domain */
-        ts_session = g_hash_table_lookup(ts->domainHash, session);
+    if (peer) {
+        g_hash_table_iter_init(&iter, ts->domainHash);
+        while (g_hash_table_iter_next(&iter, NULL, &value)) {
+            /* loop through and find the match */
+            nfsession = (fbCollectorNetflowV9Session_t *)value;
+            if (nfsession->obdomain == obdomain &&
+                !memcmp(&(nfsession->peer), peer,
+                        (peerlen > nfsession->peerlen) ?
+                        nfsession->peerlen : peerlen))
+            {
+                ts_session = nfsession;
+                break;
+            }
+        }
     } else {
-        ts_session = ts->session;
+        /* set to most recent */
+        ts_session = g_atomic_pointer_get(&ts->session);
     }
 
     if (ts_session) {
-        missed = ts_session->netflowMissed;
+        missed = g_atomic_int_get((gint *)&ts_session->netflowMissed);
     }
 
     pthread_mutex_unlock(&ts->ts_lock);
@@ -31,6 +31,32 @@
  * storing values for invalid TIDs 0-255. */
 #define TMPL_PAIR_ARRAY_SIZE    (sizeof(uint16_t) * (1 << 16))
 
+/**
+ *  Number of bits of a template ID used to index a page of a template index.
+ *  The remaining high bits select the page.
+ */
+#define TMPL_INDEX_PAGE_BITS    8
+
+/** Number of template pointers held by one page of a template index. */
+#define TMPL_INDEX_PAGE_SIZE    (1 << TMPL_INDEX_PAGE_BITS)
+
+/** Number of pages in a template index. */
+#define TMPL_INDEX_PAGE_COUNT   (1 << (16 - TMPL_INDEX_PAGE_BITS))
+
+/**
+ *  A template index is a two-level, direct-indexed table that maps a template
+ *  ID to a template.  The high bits of the ID select a page and the low bits
+ *  select the template in that page.  Pages are allocated when a template is
+ *  first added to them, so a sparse set of IDs costs little memory while a
+ *  look-up is never more than two loads.
+ *
+ *  The index mirrors the contents of a template table (a GHashTable), which
+ *  remains the authority for iterating over the templates.
+ */
+typedef struct fbTemplateIndex_st {
+    fbTemplate_t  **page[TMPL_INDEX_PAGE_COUNT];
+} fbTemplateIndex_t;
+
 /* FIXME: Consider changing fbSession so the ext_FOO/int_FOO pairs of
  * members become a FOO[2] array and the `internal` gboolean used by
  * several function is used as the index into those arrays. */
@@ -54,6 +80,15 @@ struct fbSession_st {
      * the `dom_mdInfoTab` table.
      */
     GHashTable                *mdInfoTab;
+    /**
+     * Direct-indexed lookup table for `int_ttab`.
+     */
+    fbTemplateIndex_t         *int_tindex;
+    /**
+     * Direct-indexed lookup table for `ext_ttab`.  References a value from
+     * the `dom_tindex` table.
+     */
+    fbTemplateIndex_t         *ext_tindex;
 
     /**
      * Array of size 2^16 where index is external TID and value is
@@ -81,6 +116,12 @@ struct fbSession_st {
      * Maps domain to external template table.
      */
     GHashTable                *dom_ttab;
+    /**
+     * Domain external template index.
+     * Maps domain to the direct-indexed lookup table for the domain's
+     * external template table.
+     */
+    GHashTable                *dom_tindex;
     /**
      * Domain metadata info table.
      * Maps domain to external template metadata info.
@@ -180,10 +221,97 @@ struct fbSession_st {
      * to return the template ID it was given.
      */
     gboolean                   tmpl_pair_disabled;
+    /**
+     * If TRUE, external templates read by a collector are replaced by the
+     * identical template from the process-wide intern table.  See
+     * fbSessionSetInternTemplates().
+     */
+    gboolean                   intern_templates;
 };
 
 
 
+/**
+ *  Allocates and returns an empty template index.
+ */
+static fbTemplateIndex_t *
+fbTemplateIndexAlloc(
+    void)
+{
+    return g_slice_new0(fbTemplateIndex_t);
+}
+
+/**
+ *  Removes all templates from the template index 'tindex' and frees its
+ *  pages.  Does not free the index itself.
+ */
+static void
+fbTemplateIndexClear(
+    fbTemplateIndex_t  *tindex)
+{
+    unsigned int i;
+
+    for (i = 0; i < TMPL_INDEX_PAGE_COUNT; ++i) {
+        if (tindex->page[i]) {
+            g_slice_free1(TMPL_INDEX_PAGE_SIZE * sizeof(fbTemplate_t *),
+                          tindex->page[i]);
+            tindex->page[i] = NULL;
+        }
+    }
+}
+
+/**
+ *  Frees the template index 'tindex'.
+ */
+static void
+fbTemplateIndexFree(
+    fbTemplateIndex_t  *tindex)
+{
+    if (tindex) {
+        fbTemplateIndexClear(tindex);
+        g_slice_free(fbTemplateIndex_t, tindex);
+    }
+}
+
+/**
+ *  Sets the template for 'tid' in the template index 'tindex' to 'tmpl',
+ *  allocating a page if necessary.  When 'tmpl' is NULL, removes the template
+ *  for 'tid'.
+ */
+static void
+fbTemplateIndexSet(
+    fbTemplateIndex_t  *tindex,
+    uint16_t            tid,
+    fbTemplate_t       *tmpl)
+{
+    fbTemplate_t **page = tindex->page[tid >> TMPL_INDEX_PAGE_BITS];
+
+    if (NULL == page) {
+        if (NULL == tmpl) {
+            return;
+        }
+        page = ((fbTemplate_t **)g_slice_alloc0(
+                    TMPL_INDEX_PAGE_SIZE * sizeof(fbTemplate_t *)));
+        tindex->page[tid >> TMPL_INDEX_PAGE_BITS] = page;
+    }
+    page[tid & (TMPL_INDEX_PAGE_SIZE - 1)] = tmpl;
+}
+
+/**
+ *  Returns the template for 'tid' in the template index 'tindex' or NULL if
+ *  there is no such template.
+ */
+static inline fbTemplate_t *
+fbTemplateIndexGet(
+    const fbTemplateIndex_t  *tindex,
+    uint16_t                  tid)
+{
+    fbTemplate_t **page = tindex->page[tid >> TMPL_INDEX_PAGE_BITS];
+
+    return (page ? page[tid & (TMPL_INDEX_PAGE_SIZE - 1)] : NULL);
+}
+
+
 fbSession_t *
 fbSessionAlloc(
     fbInfoModel_t  *model)
@@ -198,6 +326,7 @@ fbSessionAlloc(
 
     /* Allocate internal template table */
     session->int_ttab = g_hash_table_new(g_direct_hash, g_direct_equal);
+    session->int_tindex = fbTemplateIndexAlloc();
 
     /* Reset session externals (will allocate domain template tables, etc.) */
     fbSessionResetExternal(session);
@@ -646,6 +775,21 @@ fbSessionAddNewTemplateCallback(
     session->tmpl_app_ctx = app_ctx;
 }
 
+void
+fbSessionSetInternTemplates(
+    fbSession_t  *session,
+    gboolean      intern)
+{
+    session->intern_templates = intern;
+}
+
+gboolean
+fbSessionGetInternTemplates(
+    const fbSession_t  *session)
+{
+    return session->intern_templates;
+}
+
 void *
 fbSessionGetNewTemplateCallbackAppCtx(
     const fbSession_t  *session)
@@ -841,12 +985,14 @@ fbSessionSetTemplatePairsDisabled(
 
 /**
  *  Releases all templates used by the template table 'ttab' and removes them
- *  from the table.  Does not free the table itself.
+ *  from the table and from its index 'tindex' (which may be NULL).  Does not
+ *  free the table or the index.
  */
 static void
 fbSessionClearTemplateTable(
-    fbSession_t  *session,
-    GHashTable   *ttab)
+    fbSession_t        *session,
+    GHashTable         *ttab,
+    fbTemplateIndex_t  *tindex)
 {
     GHashTableIter iter;
     fbTemplate_t  *tmpl;
@@ -865,6 +1011,9 @@ fbSessionClearTemplateTable(
         }
     }
     g_hash_table_remove_all(ttab);
+    if (tindex) {
+        fbTemplateIndexClear(tindex);
+    }
 }
 
 
@@ -876,6 +1025,7 @@ fbSessionResetExternal(
     GHashTable    *ttab;
 
     session->ext_ttab = NULL;
+    session->ext_tindex = NULL;
     session->mdInfoTab = NULL;
 
     /* Clear out the domain template table; create if needed */
@@ -887,13 +1037,21 @@ fbSessionResetExternal(
         /* Release all the external templates (will free unless shared) */
         g_hash_table_iter_init(&iter, session->dom_ttab);
         while (g_hash_table_iter_next(&iter, NULL, (gpointer *)&ttab)) {
-            fbSessionClearTemplateTable(session, ttab);
+            fbSessionClearTemplateTable(session, ttab, NULL);
         }
         /* Empty out the domain template table, which frees the hash tables it
          * contains */
         g_hash_table_remove_all(session->dom_ttab);
     }
 
+    /* Clear out the domain template index table; create if needed */
+    if (NULL == session->dom_tindex) {
+        session->dom_tindex = g_hash_table_new_full(
+            NULL, NULL, NULL, (GDestroyNotify)fbTemplateIndexFree);
+    } else {
+        g_hash_table_remove_all(session->dom_tindex);
+    }
+
     /* Clear out the domain template metadata table; create if needed */
     if (NULL == session->dom_mdInfoTab) {
         session->dom_mdInfoTab = g_hash_table_new_full(
@@ -925,9 +1083,12 @@ fbSessionFree(
         return;
     }
     fbSessionResetExternal(session);
-    fbSessionClearTemplateTable(session, session->int_ttab);
+    fbSessionClearTemplateTable(session, session->int_ttab,
+                                session->int_tindex);
     g_hash_table_destroy(session->int_ttab);
+    fbTemplateIndexFree(session->int_tindex);
     g_hash_table_destroy(session->dom_ttab);
+    g_hash_table_destroy(session->dom_tindex);
     g_hash_table_destroy(session->dom_mdInfoTab);
     if (session->dom_seqtab) {
         g_hash_table_destroy(session->dom_seqtab);
@@ -954,6 +1115,15 @@ fbSessionSetDomain(
                             session->ext_ttab);
     }
 
+    /* Update external template index; create if necessary. */
+    session->ext_tindex = g_hash_table_lookup(session->dom_tindex,
+                                              GUINT_TO_POINTER(domain));
+    if (!session->ext_tindex) {
+        session->ext_tindex = fbTemplateIndexAlloc();
+        g_hash_table_insert(session->dom_tindex, GUINT_TO_POINTER(domain),
+                            session->ext_tindex);
+    }
+
     /* Update template metadata table; create if necessary. */
     session->mdInfoTab = g_hash_table_lookup(session->dom_mdInfoTab,
                                              GUINT_TO_POINTER(domain));
@@ -993,15 +1163,17 @@ fbSessionFindUnusedTemplateId(
     gboolean      internal)
 {
     /* Select a template table to add the template to */
-    GHashTable *ttab = internal ? session->int_ttab : session->ext_ttab;
-    uint16_t    tid = 0;
+    GHashTable        *ttab = internal ? session->int_ttab : session->ext_ttab;
+    fbTemplateIndex_t *tindex = (internal
+                                 ? session->int_tindex : session->ext_tindex);
+    uint16_t           tid = 0;
 
     if (internal) {
         if (g_hash_table_size(ttab) == (UINT16_MAX - FB_TID_MIN_DATA)) {
             return 0;
         }
         tid = session->int_next_tid;
-        while (g_hash_table_lookup(ttab, GUINT_TO_POINTER((unsigned int)tid))) {
+        while (fbTemplateIndexGet(tindex, tid)) {
             tid = ((tid > FB_TID_MIN_DATA) ? (tid - 1) : UINT16_MAX);
         }
         session->int_next_tid =
@@ -1011,7 +1183,7 @@ fbSessionFindUnusedTemplateId(
             return 0;
         }
         tid = session->ext_next_tid;
-        while (g_hash_table_lookup(ttab, GUINT_TO_POINTER((unsigned int)tid))) {
+        while (fbTemplateIndexGet(tindex, tid)) {
             tid = ((tid < UINT16_MAX) ? (tid + 1) : FB_TID_MIN_DATA);
         }
         session->ext_next_tid =
@@ -1156,6 +1328,8 @@ fbSessionAddTemplate(
 
     /* Insert template into table */
     g_hash_table_insert(ttab, GUINT_TO_POINTER((unsigned int)tid), tmpl);
+    fbTemplateIndexSet((internal ? session->int_tindex : session->ext_tindex),
+                       tid, tmpl);
 
     if (internal &&
         tmpl->ie_internal_len > session->largestInternalTemplateLength &&
@@ -1202,6 +1376,8 @@ fbSessionRemoveTemplate(
 
     /* Remove template */
     g_hash_table_remove(ttab, GUINT_TO_POINTER((unsigned int)tid));
+    fbTemplateIndexSet((internal ? session->int_tindex : session->ext_tindex),
+                       tid, NULL);
 
     /* FIXME: Remove the metadata also? */
 #if 0
@@ -1246,13 +1422,11 @@ fbSessionGetTemplate(
     uint16_t            tid,
     GError            **err)
 {
-    GHashTable   *ttab;
     fbTemplate_t *tmpl;
 
-    /* Select a template table to get the template from */
-    ttab = internal ? session->int_ttab : session->ext_ttab;
-
-    tmpl = g_hash_table_lookup(ttab, GUINT_TO_POINTER((unsigned int)tid));
+    /* Select a template index to get the template from */
+    tmpl = fbTemplateIndexGet(
+        (internal ? session->int_tindex : session->ext_tindex), tid);
     /* Check for missing template */
     if (!tmpl) {
         if (internal) {
@@ -1545,6 +1719,8 @@ fbSessionClone(
     session->new_template_callback = base->new_template_callback;
     session->tmpl_app_ctx = base->tmpl_app_ctx;
 
+    session->intern_templates = base->intern_templates;
+
     /* copy collector reference */
     session->collector = base->collector;
 
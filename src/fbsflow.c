@@ -34,6 +34,15 @@
 #define SF_OUT_OF_ORDER 10
 #define SF_REBOOT_SECS  60 * 1000 /* 1 min in milliseconds */
 
+/* size of the IPFIX message buffer the sFlow datagram is converted into */
+#define SFLOW_MSG_MAX       65496
+/* length of an IPFIX message header and a set header */
+#define SFLOW_MSG_HDR_LEN   16
+#define SFLOW_SET_HDR_LEN   4
+/* encoded length of an sflow_spec and an sflow_ctr_spec record */
+#define SFLOW_REC_LEN       185
+#define SFLOW_CTR_REC_LEN   96
+
 #define FB_SFLOW_ETHER  1
 #define FB_SFLOW_IPv4   0x0800
 #define FB_SFLOW_IPv6   0x86DD
@@ -234,6 +243,37 @@
         ptr += sizeof(*ru32_t32ptr) / sizeof(*ptr); \
     }
 
+/*
+ *  Write `value` to `ptr` in network byte order and move `ptr` past it.
+ *  These encode records straight into the IPFIX message; see
+ *  sflowEncodeRec().
+ */
+#define WRITEU8INC(ptr, value) {                \
+        *(ptr) = (uint8_t)(value);              \
+        ++(ptr);                                \
+    }
+
+#define WRITEU16INC(ptr, value) {               \
+        WRITEU16(ptr, value);                   \
+        (ptr) += sizeof(uint16_t);              \
+    }
+
+#define WRITEU32INC(ptr, value) {               \
+        WRITEU32(ptr, value);                   \
+        (ptr) += sizeof(uint32_t);              \
+    }
+
+#define WRITEU64INC(ptr, value) {               \
+        uint64_t wu64_t64val = htonll(value);   \
+        memcpy(ptr, &wu64_t64val, 8);           \
+        (ptr) += sizeof(uint64_t);              \
+    }
+
+#define WRITEBYTESINC(ptr, src, len) {          \
+        memcpy(ptr, src, len);                  \
+        (ptr) += (len);                         \
+    }
+
 
 static fbInfoElementSpec_t sflow_spec[] = {
     { "sourceIPv6Address",              16, 0 },
@@ -429,7 +469,7 @@ typedef struct fbHdrIPv6_st {
 
 
 typedef struct fbCollectorSFlowSession_st {
-    /** potential sflow samples missed */
+    /** potential sflow samples missed; see sflowAddMissed() */
     uint32_t   sflowMissed;
     /** current sFlow seq num */
     uint32_t   sflowSeqNum;
@@ -437,19 +477,45 @@ typedef struct fbCollectorSFlowSession_st {
     uint32_t   sflowFlowSeqNum;
     /** Counter Sample seq number */
     uint32_t   sflowCounterSeqNum;
+    /** observation domain of the exporter, for fbCollectorGetSFlowMissed */
+    uint32_t   obdomain;
+    /** address of the exporter */
+    union {
+        struct sockaddr       so;
+        struct sockaddr_in    ip4;
+        struct sockaddr_in6   ip6;
+    }          peer;
+    /** size of peer */
+    size_t     peerlen;
 } fbCollectorSFlowSession_t;
 
-/** defines the extra state needed to convert from sFlow to IPFIX */
+/**
+ * defines the extra state needed to convert from sFlow to IPFIX
+ *
+ * Only the thread reading the collector changes this state.  It takes
+ * ts_lock only to add sessions to or remove them from domainHash, so
+ * that fbCollectorGetSFlowMissed() may search domainHash from another
+ * thread while holding ts_lock.
+ */
 struct fbCollectorSFlowState_st {
     uint64_t                    ptime;
     uint32_t                    observation_id;
     uint32_t                    samples;
+    /** session of cosession; set atomically */
     fbCollectorSFlowSession_t  *session;
     fbSession_t                *exsession;
     fbSession_t                *cosession;
     fbInfoModel_t              *model;
     fBuf_t                     *fbuf;
     uint8_t                    *ipfixBuffer;
+    /** where the next record goes in ipfixBuffer */
+    uint8_t                    *msgcp;
+    /** start of the set being filled in ipfixBuffer, NULL if none */
+    uint8_t                    *setbase;
+    /** number of records in the message being built */
+    uint32_t                    msgrc;
+    /** template ID of the set at setbase */
+    uint16_t                    settid;
     GHashTable                 *domainHash;
     pthread_mutex_t             ts_lock;
 };
@@ -462,6 +528,218 @@ sessionDestroyHelper(
     g_slice_free(fbCollectorSFlowSession_t, datum);
 }
 
+/**
+ * sflowAddMissed
+ *
+ * Adds `count`, which may be negative, to the missed sample count of
+ * `sfsession`.  The count is updated atomically since
+ * fbCollectorGetSFlowMissed() may read it from another thread.
+ *
+ */
+static void
+sflowAddMissed(
+    fbCollectorSFlowSession_t  *sfsession,
+    int                         count)
+{
+    g_atomic_int_add((gint *)&sfsession->sflowMissed, count);
+}
+
+
+/**
+ * sflowMessageBegin
+ *
+ * Starts a new IPFIX message in the ipfixBuffer of `transState`.  The
+ * message header is written by sflowMessageFinish().
+ *
+ */
+static void
+sflowMessageBegin(
+    struct fbCollectorSFlowState_st  *transState)
+{
+    transState->msgcp = transState->ipfixBuffer + SFLOW_MSG_HDR_LEN;
+    transState->setbase = NULL;
+    transState->settid = 0;
+    transState->msgrc = 0;
+}
+
+/**
+ * sflowMessageCloseSet
+ *
+ * Writes the length of the current set, if any.
+ *
+ */
+static void
+sflowMessageCloseSet(
+    struct fbCollectorSFlowState_st  *transState)
+{
+    if (transState->setbase) {
+        WRITEU16(transState->setbase + 2,
+                 transState->msgcp - transState->setbase);
+        transState->setbase = NULL;
+    }
+}
+
+/**
+ * sflowMessageAppend
+ *
+ * Reserves `reclen` octets for a record described by template `tid` in
+ * the message being built, starting a new set when the previous record
+ * used a different template.  Returns where the caller should encode
+ * the record, or NULL when the message is full.
+ *
+ */
+static uint8_t *
+sflowMessageAppend(
+    struct fbCollectorSFlowState_st  *transState,
+    uint16_t                          tid,
+    uint16_t                          reclen,
+    GError                          **err)
+{
+    uint8_t *rec;
+
+    if (transState->setbase == NULL || transState->settid != tid) {
+        sflowMessageCloseSet(transState);
+        if ((transState->msgcp - transState->ipfixBuffer) +
+            SFLOW_SET_HDR_LEN + reclen > SFLOW_MSG_MAX)
+        {
+            goto full;
+        }
+        transState->setbase = transState->msgcp;
+        transState->settid = tid;
+        WRITEU16INC(transState->msgcp, tid);
+        WRITEU16INC(transState->msgcp, 0);
+    } else if ((transState->msgcp - transState->ipfixBuffer) + reclen >
+               SFLOW_MSG_MAX)
+    {
+        goto full;
+    }
+
+    rec = transState->msgcp;
+    transState->msgcp += reclen;
+    transState->msgrc++;
+    return rec;
+
+  full:
+    g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SFLOW,
+                "sFlow datagram does not fit in an IPFIX message");
+    return NULL;
+}
+
+/**
+ * sflowMessageFinish
+ *
+ * Closes the message being built and writes its header, using and
+ * advancing the sequence number of the export session the same way
+ * fBufEmit() would.  Returns the length of the message, which is 0
+ * when no records were added.
+ *
+ */
+static size_t
+sflowMessageFinish(
+    struct fbCollectorSFlowState_st  *transState)
+{
+    uint8_t *hdr = transState->ipfixBuffer;
+    size_t   msglen;
+
+    if (0 == transState->msgrc) {
+        return 0;
+    }
+
+    sflowMessageCloseSet(transState);
+    msglen = transState->msgcp - transState->ipfixBuffer;
+
+    WRITEU16INC(hdr, 0x000A);
+    WRITEU16INC(hdr, msglen);
+    WRITEU32INC(hdr, time(NULL));
+    WRITEU32INC(hdr, fbSessionGetSequence(transState->exsession));
+    WRITEU32INC(hdr, fbSessionGetDomain(transState->exsession));
+
+    fbSessionSetSequence(transState->exsession,
+                         fbSessionGetSequence(transState->exsession) +
+                         transState->msgrc);
+
+    return msglen;
+}
+
+/**
+ * sflowEncodeRec
+ *
+ * Writes `sflowrec` to `out` as a record of sflow_spec.  Every element
+ * of sflow_spec has a fixed length, so the encoding is the members in
+ * order in network byte order.
+ *
+ */
+static void
+sflowEncodeRec(
+    uint8_t                *out,
+    const fbSFlowRecord_t  *sflowrec)
+{
+    WRITEBYTESINC(out, sflowrec->sourceIPv6Address, 16);
+    WRITEBYTESINC(out, sflowrec->destinationIPv6Address, 16);
+    WRITEBYTESINC(out, sflowrec->nextHopIPv6Address, 16);
+    WRITEBYTESINC(out, sflowrec->bgpNextHopIPv6Address, 16);
+    WRITEBYTESINC(out, sflowrec->collectorIPv6Address, 16);
+    WRITEU64INC(out, sflowrec->collectionTimeMilliseconds);
+    WRITEU64INC(out, sflowrec->systemUpTime);
+    WRITEU32INC(out, sflowrec->collectorIPv4Address);
+    WRITEU8INC(out, sflowrec->protocolIdentifier);
+    WRITEU8INC(out, sflowrec->ipClassOfService);
+    WRITEU8INC(out, sflowrec->sourceIPv4PrefixLength);
+    WRITEU8INC(out, sflowrec->destinationIPv4PrefixLength);
+    WRITEU32INC(out, sflowrec->sourceIPv4Address);
+    WRITEU32INC(out, sflowrec->destinationIPv4Address);
+    WRITEU32INC(out, sflowrec->octetTotalCount);
+    WRITEU32INC(out, sflowrec->packetTotalCount);
+    WRITEU32INC(out, sflowrec->ingressInterface);
+    WRITEU32INC(out, sflowrec->egressInterface);
+    WRITEBYTESINC(out, sflowrec->sourceMacAddress, 6);
+    WRITEBYTESINC(out, sflowrec->destinationMacAddress, 6);
+    WRITEU32INC(out, sflowrec->nextHopIPv4Address);
+    WRITEU32INC(out, sflowrec->bgpSourceAsNumber);
+    WRITEU32INC(out, sflowrec->bgpDestinationAsNumber);
+    WRITEU32INC(out, sflowrec->bgpNextHopIPv4Address);
+    WRITEU32INC(out, sflowrec->samplingPacketInterval);
+    WRITEU32INC(out, sflowrec->samplingPopulation);
+    WRITEU32INC(out, sflowrec->droppedPacketTotalCount);
+    WRITEU32INC(out, sflowrec->selectorId);
+    WRITEU16INC(out, sflowrec->vlanId);
+    WRITEU16INC(out, sflowrec->sourceTransportPort);
+    WRITEU16INC(out, sflowrec->destinationTransportPort);
+    WRITEU16INC(out, sflowrec->tcpControlBits);
+    WRITEU16INC(out, sflowrec->dot1qVlanId);
+    WRITEU16INC(out, sflowrec->postDot1qVlanId);
+    WRITEU8INC(out, sflowrec->dot1qPriority);
+}
+
+/**
+ * sflowEncodeOptRec
+ *
+ * Writes `sflowrec` to `out` as a record of sflow_ctr_spec.
+ *
+ */
+static void
+sflowEncodeOptRec(
+    uint8_t                       *out,
+    const fbSFlowCounterRecord_t  *sflowrec)
+{
+    WRITEBYTESINC(out, sflowrec->ipv6, 16);
+    WRITEU64INC(out, sflowrec->ctime);
+    WRITEU64INC(out, sflowrec->sysuptime);
+    WRITEU32INC(out, sflowrec->ipv4);
+    WRITEU32INC(out, sflowrec->ingress);
+    WRITEU64INC(out, sflowrec->inoct);
+    WRITEU32INC(out, sflowrec->ingressType);
+    WRITEU32INC(out, sflowrec->inpkt);
+    WRITEU32INC(out, sflowrec->inmulti);
+    WRITEU32INC(out, sflowrec->inbroad);
+    WRITEU32INC(out, sflowrec->indiscard);
+    WRITEU32INC(out, sflowrec->inerr);
+    WRITEU64INC(out, sflowrec->outoct);
+    WRITEU32INC(out, sflowrec->inunknown);
+    WRITEU32INC(out, sflowrec->outpkt);
+    WRITEU32INC(out, sflowrec->outbroad);
+    WRITEU32INC(out, sflowrec->agentid);
+}
 
 static gboolean
 sflowAppendRec(
@@ -471,19 +749,14 @@ sflowAppendRec(
 {
     struct fbCollectorSFlowState_st *transState =
         (struct fbCollectorSFlowState_st *)collector->translatorState;
+    uint8_t *out;
 
     /* appending new record */
-
-    if (!fBufSetExportTemplate(transState->fbuf, SFLOW_TID, err)) {
-        return FALSE;
-    }
-
-    if (!fBufAppend(transState->fbuf, (uint8_t *)sflowrec,
-                    sizeof(fbSFlowRecord_t), err))
-    {
-        /* error appending */
+    out = sflowMessageAppend(transState, SFLOW_TID, SFLOW_REC_LEN, err);
+    if (!out) {
         return FALSE;
     }
+    sflowEncodeRec(out, sflowrec);
 
     return TRUE;
 }
@@ -496,27 +769,15 @@ sflowAppendOptRec(
 {
     struct fbCollectorSFlowState_st *transState =
         (struct fbCollectorSFlowState_st *)collector->translatorState;
+    uint8_t *out;
 
     /* appending new record */
-
-    if (!fBufSetInternalTemplate(transState->fbuf, SFLOW_OPT_TID, err)) {
-        return FALSE;
-    }
-
-    if (!fBufSetExportTemplate(transState->fbuf, SFLOW_OPT_TID, err)) {
-        return FALSE;
-    }
-
-    if (!fBufAppend(transState->fbuf, (uint8_t *)sflowrec,
-                    sizeof(fbSFlowCounterRecord_t), err))
-    {
-        /* error appending */
-        return FALSE;
-    }
-
-    if (!fBufSetInternalTemplate(transState->fbuf, SFLOW_TID, err)) {
+    out = sflowMessageAppend(transState, SFLOW_OPT_TID, SFLOW_CTR_REC_LEN,
+                             err);
+    if (!out) {
         return FALSE;
     }
+    sflowEncodeOptRec(out, sflowrec);
 
     return TRUE;
 }
@@ -531,7 +792,7 @@ sflowAllocExporter(
 {
     fbExporter_t *exp = NULL;
 
-    exp = fbExporterAllocBuffer(dataBuf, 65496);
+    exp = fbExporterAllocBuffer(dataBuf, SFLOW_MSG_MAX);
 
     if (fbuf) {
         fBufSetExporter(fbuf, exp);
@@ -1311,22 +1572,10 @@ fbCollectorPostProcSFlow(
     memset(&sflowrec, 0, sizeof(sflowrec));
     memset(&sflowctr, 0, sizeof(sflowctr));
 
-    pthread_mutex_lock(&transState->ts_lock);
-
-    memset(transState->ipfixBuffer, 0, 65535);
-
     if (!transState->fbuf) {
-        transState->fbuf = fBufAllocForExport(transState->exsession, NULL);
-
         newbuffer = TRUE;
     }
 
-    sfexp = sflowAllocExporter(transState->ipfixBuffer, transState->fbuf, err);
-    if (!sfexp) {
-        pthread_mutex_unlock(&transState->ts_lock);
-        return FALSE;
-    }
-
     /* we already know this is version 5, so skip */
     msgOsetPtr += 4;
     /* get ip version */
@@ -1351,16 +1600,22 @@ fbCollectorPostProcSFlow(
 
     if (transState->cosession != collector->udp_head->session) {
         /* lookup template Hash Table per Domain */
-        transState->session =
-            g_hash_table_lookup(transState->domainHash,
-                                collector->udp_head->session);
-        if (transState->session == NULL) {
-            transState->session = g_slice_new0(fbCollectorSFlowSession_t);
+        currentSession = g_hash_table_lookup(transState->domainHash,
+                                             collector->udp_head->session);
+        if (currentSession == NULL) {
+            currentSession = g_slice_new0(fbCollectorSFlowSession_t);
+            currentSession->obdomain = collector->udp_head->obdomain;
+            currentSession->peerlen = collector->udp_head->peerlen;
+            memcpy(&(currentSession->peer), &(collector->udp_head->peer),
+                   currentSession->peerlen);
+            pthread_mutex_lock(&transState->ts_lock);
             g_hash_table_insert(transState->domainHash,
                                 (gpointer)collector->udp_head->session,
-                                transState->session);
+                                currentSession);
+            pthread_mutex_unlock(&transState->ts_lock);
             newbuffer = TRUE;
         }
+        g_atomic_pointer_set(&transState->session, currentSession);
         transState->cosession = collector->udp_head->session;
     }
 
@@ -1368,8 +1623,21 @@ fbCollectorPostProcSFlow(
     transState->observation_id = obsDomain;
 
     if (newbuffer) {
+        /* templates go through the fBuf; the records of later datagrams
+         * are written directly by sflowMessageAppend() */
+        memset(transState->ipfixBuffer, 0, 65535);
+        sfexp = sflowAllocExporter(transState->ipfixBuffer, transState->fbuf,
+                                   err);
+        if (!sfexp) {
+            return FALSE;
+        }
+        if (!transState->fbuf) {
+            /* fBufAllocForExport() requires the exporter */
+            transState->fbuf = fBufAllocForExport(transState->exsession,
+                                                  sfexp);
+        }
+
         if (!fbSessionExportTemplates(transState->exsession, err)) {
-            pthread_mutex_unlock(&transState->ts_lock);
             return FALSE;
         }
 
@@ -1383,7 +1651,6 @@ fbCollectorPostProcSFlow(
 #endif
         memcpy(dataBuf, transState->ipfixBuffer, msglen);
         *bufLen = msglen;
-        pthread_mutex_unlock(&transState->ts_lock);
         return TRUE;
     }
 
@@ -1405,10 +1672,10 @@ fbCollectorPostProcSFlow(
                     /* check for reboot */
                     if (timeStamp > SF_REBOOT_SECS) {
                         /* probably not a reboot so account for missed */
-                        currentSession->sflowMissed += seq_diff;
+                        sflowAddMissed(currentSession, seq_diff);
                     } /* else - reboot? don't add to missed count */
                 } else {
-                    currentSession->sflowMissed += seq_diff;
+                    sflowAddMissed(currentSession, seq_diff);
                 }
                 currentSession->sflowSeqNum = sflowSeqNum;
             } else {
@@ -1424,7 +1691,7 @@ fbCollectorPostProcSFlow(
                     /* But subtract one so when we add one below, it evens out
                      */
                     if (currentSession->sflowMissed) {
-                        currentSession->sflowMissed -= 1;
+                        sflowAddMissed(currentSession, -1);
                     }
                     currentSession->sflowSeqNum -= 1;
                 }
@@ -1439,12 +1706,13 @@ fbCollectorPostProcSFlow(
     READU32INC(msgOsetPtr, numSamples);
     msgParsed -= 16;
 
+    sflowMessageBegin(transState);
+
     while (sampleCount < numSamples) {
         if (msgParsed < 8) {
             g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SFLOW,
                         "Buffer too small for Sample Header");
             currentSession->sflowSeqNum++;
-            pthread_mutex_unlock(&transState->ts_lock);
             return FALSE;
         }
 
@@ -1466,7 +1734,6 @@ fbCollectorPostProcSFlow(
                         "Invalid sFlow enterprise number (%u)",
                         enterprise);
             currentSession->sflowSeqNum++;
-            pthread_mutex_unlock(&transState->ts_lock);
             return FALSE;
         }
 
@@ -1475,7 +1742,6 @@ fbCollectorPostProcSFlow(
                         "Buffer too small for sample length (%u)",
                         sampleLength);
             currentSession->sflowSeqNum++;
-            pthread_mutex_unlock(&transState->ts_lock);
             return FALSE;
         }
 
@@ -1556,14 +1822,12 @@ fbCollectorPostProcSFlow(
             g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_SFLOW,
                         "Invalid sFlow Format (%d)", format);
             currentSession->sflowSeqNum++;
-            pthread_mutex_unlock(&transState->ts_lock);
             return FALSE;
         }
 
         if (!flows && !counters) {
             /* error ocurred */
             currentSession->sflowSeqNum++;
-            pthread_mutex_unlock(&transState->ts_lock);
             return FALSE;
         }
 
@@ -1584,18 +1848,11 @@ fbCollectorPostProcSFlow(
     /* increment the sequence number for the netflow side */
     currentSession->sflowSeqNum++;
 
-    fBufEmit(transState->fbuf, err);
-    g_clear_error(err);
-
-    msglen = fbExporterGetMsgLen(sfexp);
+    msglen = sflowMessageFinish(transState);
 
     memcpy(dataBuf, transState->ipfixBuffer, msglen);
     *bufLen = msglen;
 
-    fbExporterClose(sfexp);
-
-    pthread_mutex_unlock(&transState->ts_lock);
-
     return TRUE;
 }
 
@@ -1683,7 +1940,7 @@ fbCollectorTimeOutSessionSFlow(
 
     if (session == transState->cosession) {
         transState->cosession = NULL;
-        transState->session = NULL;
+        g_atomic_pointer_set(&transState->session, NULL);
     }
 
     pthread_mutex_unlock(&transState->ts_lock);
@@ -1741,6 +1998,8 @@ fbCollectorSetSFlowTranslator(
     if (!fbTemplateAppendSpecArray(sftmpl, sflow_spec, 0xffffffff, err)) {
         return FALSE;
     }
+    /* sflowEncodeRec() writes records of exactly this length */
+    g_assert(sftmpl->ie_len == SFLOW_REC_LEN);
 
     sfsess = fbSessionAlloc(model);
 
@@ -1757,6 +2016,7 @@ fbCollectorSetSFlowTranslator(
     if (!fbTemplateAppendSpecArray(sftmpl, sflow_ctr_spec, 0xffffffff, err)) {
         return FALSE;
     }
+    g_assert(sftmpl->ie_len == SFLOW_CTR_REC_LEN);
 
     fbTemplateSetOptionsScope(sftmpl, 1);
 
@@ -1816,39 +2076,16 @@ fbCollectorGetSFlowMissed(
     uint32_t                obdomain)
 {
     struct fbCollectorSFlowState_st *ts = NULL;
-    fbUDPConnSpec_t *udp = NULL;
-    fbSession_t *session = NULL;
     fbCollectorSFlowSession_t       *sfsession = NULL;
-    uint32_t missed = 0;
+    fbCollectorSFlowSession_t       *cur;
+    GHashTableIter iter;
+    gpointer       value;
+    uint32_t       missed = 0;
 
     if (!collector) {
         return 0;
     }
 
-    if (peer) {
-        udp = collector->udp_head;
-        while (udp) {
-            /* loop through and find the match */
-            if (udp->obdomain == obdomain) {
-                if (!memcmp(&(udp->peer), peer, (peerlen > udp->peerlen) ?
-                            udp->peerlen : peerlen))
-                {
-                    /* we have a match - set session */
-                    session = udp->session;
-                    break;
-                }
-            }
-            udp = udp->next;
-        }
-    } else {
-        /* set to most recent */
-        session = collector->udp_head->session;
-    }
-
-    if (!session) {
-        return 0;
-    }
-
     ts = (struct fbCollectorSFlowState_st *)collector->translatorState;
 
     if (ts == NULL) {
@@ -1856,17 +2093,30 @@ fbCollectorGetSFlowMissed(
         return 0;
     }
 
+    /* the collecting thread keeps reading; it only waits for this lock
+     * when a session starts or times out */
     pthread_mutex_lock(&ts->ts_lock);
 
-    if (ts->cosession != session) {
-        /* lookup template Hash Table per Domain */
-        sfsession = g_hash_table_lookup(ts->domainHash, session);
+    if (peer) {
+        g_hash_table_iter_init(&iter, ts->domainHash);
+        while (g_hash_table_iter_next(&iter, NULL, &value)) {
+            /* loop through and find the match */
+            cur = (fbCollectorSFlowSession_t *)value;
+            if (cur->obdomain == obdomain &&
+                !memcmp(&(cur->peer), peer, (peerlen > cur->peerlen) ?
+                        cur->peerlen : peerlen))
+            {
+                sfsession = cur;
+                break;
+            }
+        }
     } else {
-        sfsession = ts->session;
+        /* set to most recent */
+        sfsession = g_atomic_pointer_get(&ts->session);
     }
 
     if (sfsession) {
-        missed = sfsession->sflowMissed;
+        missed = g_atomic_int_get((gint *)&sfsession->sflowMissed);
     }
 
     pthread_mutex_unlock(&ts->ts_lock);
@@ -15,6 +15,8 @@
 #define _FIXBUF_SOURCE_
 #include <fixbuf/private.h>
 
+#include <pthread.h>
+
 
 #if !GLIB_CHECK_VERSION(2, 32, 0)
 #define g_hash_table_contains(_table, _key) \
@@ -35,6 +37,39 @@
  */
 #define FB_TMPL_MAX_ELEMENTS   ((65535 - 16 - 4 - 4) >> 2)
 
+/**
+ *  A field accessor.  Its `id` is the index of its slot in the
+ *  `accessor_slots` of every Template.
+ */
+struct fbFieldAccessor_st {
+    const fbInfoElement_t  *ie;
+    uint16_t                skip;
+    uint32_t                id;
+};
+
+/** Protects the allocation of field accessor IDs. */
+static pthread_mutex_t fbFieldAccessorLock = PTHREAD_MUTEX_INITIALIZER;
+/** The IDs of freed field accessors, which are reused before new IDs. */
+static uint32_t *fbFieldAccessorFreeIDs = NULL;
+/** The number of IDs in fbFieldAccessorFreeIDs. */
+static uint32_t fbFieldAccessorFreeCount = 0;
+/** The next unused field accessor ID. */
+static uint32_t fbFieldAccessorNextID = 0;
+
+/** The serial number of the most recently allocated template. */
+static gint     fbTemplateSerial = 0;
+
+/**
+ *  Protects the intern table and the reference counts of the templates in
+ *  it.
+ */
+static pthread_mutex_t fbTemplateInternLock = PTHREAD_MUTEX_INITIALIZER;
+/**
+ *  The process-wide intern table: a set of interned templates, hashed by
+ *  their `fingerprint` and compared by fbTemplateInternEqual().
+ */
+static GHashTable     *fbTemplateInternTable = NULL;
+
 /**
  *  Add '_addend_' to '_current_' checking whether the result overflows a
  *  uint16_t.  If it would overflow, return FALSE.  If okay, do the addition
@@ -191,6 +226,7 @@ fbTemplateAlloc(
     tmpl->model = model;
     tmpl->tmpl_len = 4;
     tmpl->active = FALSE;
+    tmpl->serial = (uint32_t)g_atomic_int_add(&fbTemplateSerial, 1) + 1;
 
     /* allocate indices table */
     tmpl->indices = g_hash_table_new((GHashFunc)fbTemplateFieldHash,
@@ -203,14 +239,51 @@ void
 fbTemplateRetain(
     fbTemplate_t  *tmpl)
 {
+    /* A referenced template may no longer be modified (see
+     * fbTemplateAppend()), so its lookups may be cached from now on */
+    tmpl->active = TRUE;
+
     /* Increment reference count */
+    if (tmpl->interned) {
+        pthread_mutex_lock(&fbTemplateInternLock);
+        ++(tmpl->ref_count);
+        pthread_mutex_unlock(&fbTemplateInternLock);
+        return;
+    }
     ++(tmpl->ref_count);
 }
 
+/*
+ *  Frees the interned template 'tmpl' if it is no longer referenced,
+ *  removing it from the intern table.  Decrements its reference count
+ *  first when 'release' is TRUE.
+ */
+static void
+fbTemplateInternRelease(
+    fbTemplate_t  *tmpl,
+    gboolean       release)
+{
+    pthread_mutex_lock(&fbTemplateInternLock);
+    if (release) {
+        --(tmpl->ref_count);
+    }
+    if (tmpl->ref_count > 0) {
+        pthread_mutex_unlock(&fbTemplateInternLock);
+        return;
+    }
+    g_hash_table_remove(fbTemplateInternTable, tmpl);
+    pthread_mutex_unlock(&fbTemplateInternLock);
+    fbTemplateFree(tmpl);
+}
+
 void
 fbTemplateRelease(
     fbTemplate_t  *tmpl)
 {
+    if (tmpl->interned) {
+        fbTemplateInternRelease(tmpl, TRUE);
+        return;
+    }
     /* Decrement reference count */
     --(tmpl->ref_count);
     /* Free if not referenced */
@@ -221,15 +294,102 @@ void
 fbTemplateFreeUnused(
     fbTemplate_t  *tmpl)
 {
-    if (tmpl->ref_count <= 0) {
+    if (tmpl->interned) {
+        fbTemplateInternRelease(tmpl, FALSE);
+    } else if (tmpl->ref_count <= 0) {
         fbTemplateFree(tmpl);
     }
 }
 
+/*
+ *  Computes the fingerprint of 'tmpl': an FNV-1a hash of its model, scope
+ *  count, and the PEN, ID, and length of each field, which is what its
+ *  template record holds apart from the template ID.
+ */
+static uint32_t
+fbTemplateFingerprint(
+    const fbTemplate_t  *tmpl)
+{
+    const fbTemplateField_t *field;
+    uintptr_t model = (uintptr_t)tmpl->model;
+    uint32_t  h = 0x811c9dc5u;
+    uint16_t  i;
+
+#define FB_FINGERPRINT_MIX(_v_) \
+    { h = (h ^ (uint32_t)(_v_)) * 0x01000193u; }
+
+    FB_FINGERPRINT_MIX(model);
+    FB_FINGERPRINT_MIX((uint64_t)model >> 32);
+    FB_FINGERPRINT_MIX(tmpl->scope_count);
+    for (i = 0; i < tmpl->ie_count; ++i) {
+        field = tmpl->ie_ary[i];
+        FB_FINGERPRINT_MIX(field->canon->ent);
+        FB_FINGERPRINT_MIX(((uint32_t)field->canon->num << 16) | field->len);
+    }
+#undef FB_FINGERPRINT_MIX
+
+    return h;
+}
+
+static guint
+fbTemplateInternHash(
+    gconstpointer  tmpl)
+{
+    return ((const fbTemplate_t *)tmpl)->fingerprint;
+}
+
+static gboolean
+fbTemplateInternEqual(
+    gconstpointer  a,
+    gconstpointer  b)
+{
+    const fbTemplate_t *tmpl1 = (const fbTemplate_t *)a;
+    const fbTemplate_t *tmpl2 = (const fbTemplate_t *)b;
+
+    return (tmpl1->fingerprint == tmpl2->fingerprint &&
+            tmpl1->model == tmpl2->model &&
+            fbTemplatesAreEqual(tmpl1, tmpl2));
+}
+
+/*  Declared in private.h */
+fbTemplate_t *
+fbTemplateIntern(
+    fbTemplate_t  *tmpl)
+{
+    fbTemplate_t *found;
+
+    g_assert(tmpl->ref_count == 0 && !tmpl->interned);
+
+    tmpl->fingerprint = fbTemplateFingerprint(tmpl);
+
+    pthread_mutex_lock(&fbTemplateInternLock);
+    if (NULL == fbTemplateInternTable) {
+        fbTemplateInternTable = g_hash_table_new(fbTemplateInternHash,
+                                                 fbTemplateInternEqual);
+    }
+    found = (fbTemplate_t *)g_hash_table_lookup(fbTemplateInternTable, tmpl);
+    if (found) {
+        ++(found->ref_count);
+        pthread_mutex_unlock(&fbTemplateInternLock);
+        fbTemplateFree(tmpl);
+        return found;
+    }
+    tmpl->interned = TRUE;
+    tmpl->active = TRUE;
+    tmpl->ref_count = 1;
+    g_hash_table_insert(fbTemplateInternTable, tmpl, tmpl);
+    pthread_mutex_unlock(&fbTemplateInternLock);
+
+    return tmpl;
+}
+
 static void
 fbTemplateFree(
     fbTemplate_t  *tmpl)
 {
+    fbTemplateAccessorSlots_t *slots;
+    fbTemplateAccessorSlot_t  *slot;
+    fbRecordCopyPlan_t *plan;
     int i;
 
     if (tmpl->ctx_free) {
@@ -254,6 +414,24 @@ fbTemplateFree(
 
     /* destroy offset cache if present */
     g_free(tmpl->off_cache);
+
+    /* destroy the caches of field accessors and copy plans */
+    while (tmpl->accessor_slots) {
+        slots = tmpl->accessor_slots;
+        tmpl->accessor_slots = slots->prev;
+        g_free(slots);
+    }
+    while (tmpl->accessor_slot_list) {
+        slot = tmpl->accessor_slot_list;
+        tmpl->accessor_slot_list = slot->next;
+        g_slice_free(fbTemplateAccessorSlot_t, slot);
+    }
+    while (tmpl->copy_plans) {
+        plan = tmpl->copy_plans;
+        tmpl->copy_plans = plan->next;
+        g_free(plan->ops);
+        g_slice_free(fbRecordCopyPlan_t, plan);
+    }
     /* destroy template */
     g_slice_free(fbTemplate_t, tmpl);
 }
@@ -381,6 +559,11 @@ fbTemplateExtendIndices(
         return FALSE;
     }
 
+    /* extend the fixed-length prefix; see fbTranscodeFillOffsets() */
+    if (!tmpl->is_varlen) {
+        tmpl->fixed_prefix_count = tmpl->ie_count;
+    }
+
     tmpl_ie->tmpl = tmpl;
     /* Add index of this information element to the indices table */
     g_hash_table_insert(tmpl->indices, tmpl_ie,
@@ -922,6 +1105,132 @@ fbTemplateFindFieldByDataType(
 }
 
 
+fbFieldAccessor_t *
+fbFieldAccessorAlloc(
+    const fbInfoElement_t  *ie,
+    uint16_t                skip)
+{
+    fbFieldAccessor_t *accessor;
+
+    accessor = g_slice_new0(fbFieldAccessor_t);
+    accessor->ie = ie;
+    accessor->skip = skip;
+
+    pthread_mutex_lock(&fbFieldAccessorLock);
+    if (fbFieldAccessorFreeCount) {
+        accessor->id = fbFieldAccessorFreeIDs[--fbFieldAccessorFreeCount];
+    } else {
+        accessor->id = fbFieldAccessorNextID++;
+    }
+    pthread_mutex_unlock(&fbFieldAccessorLock);
+
+    return accessor;
+}
+
+
+void
+fbFieldAccessorFree(
+    fbFieldAccessor_t  *accessor)
+{
+    if (NULL == accessor) {
+        return;
+    }
+    /* the slots that templates hold for this ID are checked against the
+     * element and skip of the accessor that next uses the ID, so they need
+     * not be cleared */
+    pthread_mutex_lock(&fbFieldAccessorLock);
+    /* every freed ID was once the next ID, so this many always suffices */
+    fbFieldAccessorFreeIDs = g_renew(uint32_t, fbFieldAccessorFreeIDs,
+                                     fbFieldAccessorNextID);
+    fbFieldAccessorFreeIDs[fbFieldAccessorFreeCount++] = accessor->id;
+    pthread_mutex_unlock(&fbFieldAccessorLock);
+
+    g_slice_free(fbFieldAccessor_t, accessor);
+}
+
+
+/*
+ *  Templates may be shared by threads (see fbTemplateIntern() and
+ *  fbSessionClone()), so the slot array and each slot are published with a
+ *  compare-and-swap and are not modified afterward; a lookup that races
+ *  with another sees either the old or the new one and takes no lock.  A
+ *  slot filled in an array that is being replaced may be lost, which
+ *  costs only another search.
+ */
+const fbTemplateField_t *
+fbFieldAccessorGetField(
+    const fbFieldAccessor_t  *accessor,
+    const fbTemplate_t       *tmpl)
+{
+    fbTemplate_t              *t = (fbTemplate_t *)tmpl;
+    fbTemplateAccessorSlots_t *slots;
+    fbTemplateAccessorSlots_t *grown;
+    fbTemplateAccessorSlot_t  *slot;
+    fbTemplateAccessorSlot_t  *filled;
+    const fbTemplateField_t   *field;
+    uint32_t                   count;
+    uint32_t                   i;
+
+    slots = g_atomic_pointer_get(&t->accessor_slots);
+    slot = NULL;
+    if (slots && accessor->id < slots->count) {
+        slot = g_atomic_pointer_get(&slots->slot[accessor->id]);
+        if (slot && slot->ie == accessor->ie && slot->skip == accessor->skip) {
+            return slot->field;
+        }
+    }
+    if (!tmpl->active) {
+        /* fields may yet be appended; do not cache */
+        return fbTemplateFindFieldByElement(tmpl, accessor->ie, NULL,
+                                            accessor->skip);
+    }
+
+    /* grow the slots to cover the accessor, at least doubling; when
+     * another thread replaces the array first, use its array */
+    while (NULL == slots || accessor->id >= slots->count) {
+        count = MAX(accessor->id + 1, (slots ? 2 * slots->count : 0));
+        grown = g_malloc0(G_STRUCT_OFFSET(fbTemplateAccessorSlots_t, slot)
+                          + count * sizeof(fbTemplateAccessorSlot_t *));
+        grown->prev = slots;
+        grown->count = count;
+        for (i = 0; slots && i < slots->count; ++i) {
+            grown->slot[i] = g_atomic_pointer_get(&slots->slot[i]);
+        }
+        if (g_atomic_pointer_compare_and_exchange(&t->accessor_slots,
+                                                  slots, grown))
+        {
+            slots = grown;
+        } else {
+            g_free(grown);
+            slots = g_atomic_pointer_get(&t->accessor_slots);
+        }
+        slot = ((accessor->id < slots->count)
+                ? g_atomic_pointer_get(&slots->slot[accessor->id]) : NULL);
+    }
+
+    filled = g_slice_new(fbTemplateAccessorSlot_t);
+    filled->ie = accessor->ie;
+    filled->skip = accessor->skip;
+    filled->field = fbTemplateFindFieldByElement(tmpl, accessor->ie, NULL,
+                                                 accessor->skip);
+    field = filled->field;
+    if (!g_atomic_pointer_compare_and_exchange(&slots->slot[accessor->id],
+                                               slot, filled))
+    {
+        /* another thread filled the slot first */
+        g_slice_free(fbTemplateAccessorSlot_t, filled);
+        return field;
+    }
+    /* readers may still hold the slot this one replaced, so every slot is
+     * kept until the template is freed */
+    do {
+        filled->next = g_atomic_pointer_get(&t->accessor_slot_list);
+    } while (!g_atomic_pointer_compare_and_exchange(&t->accessor_slot_list,
+                                                    filled->next, filled));
+    return field;
+}
+
+
 const fbTemplateField_t *
 fbTemplateFindFieldByIdent(
     const fbTemplate_t  *tmpl,
@@ -42,6 +42,127 @@
 #endif  /* G_BYTE_ORDER */
 #endif  /* HAVE_NTOHLL */
 
+/* Whether runs of fixed-width fields may be transcoded by a vector byte
+ * shuffle; see fbTranscodePlanShuffle().  On x86 the kernel is chosen at
+ * run time from the features of the CPU. */
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN && defined(__GNUC__) \
+    && (defined(__x86_64__) || defined(__i386__))
+#define FB_TC_SHUFFLE       1
+#define FB_TC_SHUFFLE_X86   1
+#include <immintrin.h>
+#elif G_BYTE_ORDER == G_LITTLE_ENDIAN && defined(__aarch64__) \
+    && defined(__ARM_NEON)
+#define FB_TC_SHUFFLE       1
+#define FB_TC_SHUFFLE_NEON  1
+#include <arm_neon.h>
+#endif  /* G_BYTE_ORDER == G_LITTLE_ENDIAN && ... */
+
+/* The number of octets a shuffle kernel handles in one step. */
+#define FB_TC_SHUFFLE_CHUNK  16
+
+/* The average number of destination octets a chunk of a shuffle must fill
+ * for the shuffle to be used. */
+#define FB_TC_SHUFFLE_MIN_FILL  4
+
+
+/*
+ *  The kinds of operation in a compiled transcode plan.  See
+ *  fbTranscodeOp_t.
+ */
+typedef enum fbTranscodeOpType_en {
+    /* copy `d_len` octets; one or more fields that need no byte-swapping */
+    FB_TCOP_COPY,
+    /* copy and byte-swap `count` values, each of length `s_len` */
+    FB_TCOP_SWAP,
+    /* zero `d_len` octets; one or more fields missing from the source */
+    FB_TCOP_ZERO,
+    /* skip `d_len` octets that were zeroed when the record was started */
+    FB_TCOP_SKIP,
+    /* fixed-length integer or octets whose source and dest lengths differ */
+    FB_TCOP_FIXED,
+    /* float64 whose source and dest lengths differ */
+    FB_TCOP_DOUBLE,
+    /* variable-length string or octetArray */
+    FB_TCOP_VARFIELD,
+    /* basicList */
+    FB_TCOP_BASICLIST,
+    /* subTemplateList */
+    FB_TCOP_SUBTMPLLIST,
+    /* subTemplateMultiList */
+    FB_TCOP_SUBTMPLMULTILIST,
+    /* source and dest disagree on whether a string or octetArray is varlen */
+    FB_TCOP_MIXED_LENGTH,
+    /* a run of fixed-width operations done by a vector byte shuffle; the
+     * run reads `s_len` octets and writes `d_len` octets, and `count` is
+     * the index of its fbTranscodeShuffle_t */
+    FB_TCOP_SHUFFLE
+} fbTranscodeOpType_t;
+
+/*
+ *  One operation in a compiled transcode plan.  An operation covers one or
+ *  more consecutive fields of the destination template.
+ */
+typedef struct fbTranscodeOp_st {
+    /* index in the source template of the (first) source field */
+    uint16_t   s_idx;
+    /* offset of the (first) source field; valid when the plan's `s_static`
+     * is TRUE, otherwise the offset is found using `s_idx` */
+    uint16_t   s_off;
+    /* length of a single source field (FIXED, DOUBLE, SWAP) */
+    uint16_t   s_len;
+    /* octets written to the destination (COPY, SWAP, ZERO, SKIP; the
+     * length of the dest field for FIXED and DOUBLE) */
+    uint16_t   d_len;
+    /* number of values that a SWAP operation byte-swaps */
+    uint16_t   count;
+    /* the fbTranscodeOpType_t */
+    uint8_t    type;
+    /* the `is_endian` value to pass to fbDecodeFixed() / fbEncodeFixed() */
+    uint8_t    is_endian;
+    /* the `is_signed` value to pass to fbDecodeFixed() / fbEncodeFixed() */
+    uint8_t    is_signed;
+} fbTranscodeOp_t;
+
+/*
+ *  The byte shuffle performed by an FB_TCOP_SHUFFLE operation.  The
+ *  destination of the run is covered by chunks of FB_TC_SHUFFLE_CHUNK
+ *  octets; when the length of the run is not a multiple of the chunk size,
+ *  the final chunk overlaps the one before it.  Every source octet a chunk
+ *  uses lies in a window of FB_TC_SHUFFLE_CHUNK octets within the source of
+ *  the run.
+ */
+typedef struct fbTranscodeShuffle_st {
+    /* for each chunk, FB_TC_SHUFFLE_CHUNK octets: for each octet of the
+     * chunk's destination, the index within the chunk's window of its
+     * source octet, or 0x80 when the octet is zero */
+    uint8_t    *masks;
+    /* for each chunk, the offset of its destination from the start of the
+     * run's destination */
+    uint16_t   *d_offs;
+    /* for each chunk, the offset of its window from the start of the run's
+     * source */
+    uint16_t   *s_offs;
+    /* for the octets at the end of the run that no chunk covers, the offset
+     * of each one's source octet from the start of the run's source, or -1
+     * when the octet is zero */
+    int32_t    *tail;
+    /* number of chunks */
+    uint16_t    chunks;
+    /* offset of the first octet of the tail from the start of the run's
+     * destination */
+    uint16_t    tail_off;
+    /* number of octets in the tail */
+    uint16_t    tail_len;
+} fbTranscodeShuffle_t;
+
+/*
+ *  A function that performs the byte shuffle `shuf`, reading from `sp` and
+ *  writing to `dp`.
+ */
+typedef void (*fbTranscodeShuffle_fn)(
+    uint8_t                     *dp,
+    const uint8_t               *sp,
+    const fbTranscodeShuffle_t  *shuf);
 
 typedef struct fbTranscodePlan_st {
     /* source template */
@@ -51,6 +172,28 @@ typedef struct fbTranscodePlan_st {
     /* source index array: for each field in `d_tmpl` the index of that field
      * in `s_tmpl` or FB_TCPLAN_NULL if not present */
     int32_t            *si;
+    /* the compiled operations; built once by fbTranscodePlan() */
+    fbTranscodeOp_t    *ops;
+    /* the shuffles of the FB_TCOP_SHUFFLE operations in `ops` */
+    fbTranscodeShuffle_t *shuffles;
+    /* the kernel that performs `shuffles`; NULL when there are none */
+    fbTranscodeShuffle_fn shuffle_fn;
+    /* number of entries in `ops` */
+    uint16_t            op_count;
+    /* number of entries in `shuffles` */
+    uint16_t            shuffle_count;
+    /* length of the source record when `s_static` is TRUE */
+    uint16_t            s_len;
+    /* number of octets to zero at the start of each destination record
+     * when the zero-fill of missing fields has been hoisted; 0 otherwise */
+    uint16_t            d_zero;
+    /* number of transcodes in progress that use this plan; a plan that is
+     * in use is never evicted from the plan cache */
+    uint16_t            in_use;
+    /* whether this plan decodes (TRUE) or encodes (FALSE) */
+    gboolean            decode;
+    /* TRUE when the offsets of the source fields do not vary by record */
+    gboolean            s_static;
 } fbTranscodePlan_t;
 
 typedef struct fbDLL_st fbDLL_t;
@@ -59,6 +202,91 @@ struct fbDLL_st {
     fbDLL_t  *prev;
 };
 
+/**
+ *  Minimum size of a block allocated by a list arena.
+ */
+#define FB_LIST_ARENA_BLOCK_SIZE  65536
+
+/**
+ *  Rounds `_len_` up to the alignment used by list arena allocations.
+ */
+#define FB_LIST_ARENA_ALIGN(_len_)  (((_len_) + 7) & ~((size_t)7))
+
+/**
+ *  When the offset scratch stack of an fBuf is first sized, the number of
+ *  records of the requesting template it can hold; room for the nested
+ *  transcodes of list sub-records.
+ */
+#define FB_TC_OFFSET_NESTING  4
+
+/**
+ *  The number of fbRecordCopyToTemplate() plans, one per source template,
+ *  that a destination template keeps.
+ */
+#define FB_RECORD_COPY_PLAN_MAX  8
+
+/*
+ *  A block of memory owned by a list arena.  The block's storage follows
+ *  this header.
+ */
+typedef struct fbListArenaBlock_st fbListArenaBlock_t;
+struct fbListArenaBlock_st {
+    /* the block allocated before this one */
+    fbListArenaBlock_t  *next;
+    /* the octets of storage in the block */
+    size_t               size;
+};
+
+/*
+ *  A list arena bump-allocates the storage for decoded lists from blocks
+ *  of memory that are released all at once.
+ */
+typedef struct fbListArena_st {
+    /* most recently allocated block; the one `cp` points into */
+    fbListArenaBlock_t  *blocks;
+    /* next free octet in the current block */
+    uint8_t             *cp;
+    /* end of the current block */
+    uint8_t             *end;
+    /* octets allocated since the arena was last reset */
+    size_t               used;
+} fbListArena_t;
+
+/*
+ *  The value of the `fromArena` member of a list structure whose decoding
+ *  was deferred by fBufSetLazyLists().  The `dataPtr` member of such a
+ *  basicList or subTemplateList, or the `firstEntry` member of such a
+ *  subTemplateMultiList, points to the fbListDeferred_t holding the list.
+ */
+#define FB_LIST_DEFERRED  2
+
+/*
+ *  A list whose decoding was deferred.  It stays on the `deferred` list of
+ *  the Buffer that read it until it is decoded into `list`, and the
+ *  application's list structure refers to it until the list is cleared.
+ */
+typedef struct fbListDeferred_st fbListDeferred_t;
+struct fbListDeferred_st {
+    /* the next and previous pending lists of `fbuf`; see fbDLL_t */
+    fbListDeferred_t  *next;
+    fbListDeferred_t  *prev;
+    /* the Buffer that read the list */
+    fBuf_t            *fbuf;
+    /* the encoded list in the Buffer's message, or NULL once decoded */
+    uint8_t           *src;
+    /* the type of list: FB_BASIC_LIST, FB_SUB_TMPL_LIST, or
+     * FB_SUB_TMPL_MULTI_LIST */
+    uint8_t            type;
+    /* nonzero when this structure is in the Buffer's list arena */
+    uint8_t            fromArena;
+    /* the decoded list */
+    union {
+        fbBasicList_t             bl;
+        fbSubTemplateList_t       stl;
+        fbSubTemplateMultiList_t  stml;
+    } list;
+};
+
 typedef struct fbTCPlanEntry_st fbTCPlanEntry_t;
 struct fbTCPlanEntry_st {
     fbTCPlanEntry_t    *next;
@@ -74,8 +302,56 @@ struct fBuf_st {
     fbExporter_t     *exporter;
     /** Collector. Reads messages from a remote endpoint on demand. */
     fbCollector_t    *collector;
-    /** Cached transcoder plan */
+    /** Cached transcoder plans, most recently used first. */
     fbTCPlanEntry_t  *latestTcplan;
+    /** The least recently used cached transcoder plan. */
+    fbTCPlanEntry_t  *oldestTcplan;
+    /**
+     * Index of the cached transcoder plans.  Maps a fbTranscodePlan_t (using
+     * only its templates and direction) to its fbTCPlanEntry_t.
+     */
+    GHashTable       *tcplan_table;
+    /** Number of entries in the transcoder plan cache. */
+    unsigned int      tcplan_count;
+    /** Maximum number of cached transcoder plans; 0 for no limit. */
+    unsigned int      tcplan_capacity;
+    /** Number of transcoder plan lookups found in the cache. */
+    uint64_t          tcplan_hits;
+    /** Number of transcoder plan lookups that required a new plan. */
+    uint64_t          tcplan_misses;
+    /** Counters returned by fBufGetStats(). */
+    fbStats_t         stats;
+    /** Function called at each message boundary, or NULL. */
+    fBufMessageCallback_fn msg_callback;
+    /** Context passed to `msg_callback`. */
+    void             *msg_callback_ctx;
+    /**
+     * Field offsets of the record returned by the most recent call to
+     * fBufNextView() when its template is variable length.
+     */
+    uint16_t         *view_offsets;
+    /** Number of elements allocated for `view_offsets`. */
+    uint32_t          view_offsets_count;
+    /**
+     * Scratch stack holding the field offsets of the records being
+     * transcoded when their templates are variable length; the transcodes
+     * of list sub-records nest.  See fbTranscodeOffsetsPush().
+     */
+    uint16_t         *off_stack;
+    /** Number of elements allocated for `off_stack`. */
+    uint32_t          off_stack_size;
+    /** Number of elements of `off_stack` in use. */
+    uint32_t          off_stack_used;
+    /** Largest number of elements of `off_stack` requested. */
+    uint32_t          off_stack_peak;
+    /** How decoded lists are allocated. */
+    fbListArenaMode_t list_arena_mode;
+    /** Storage for decoded lists when `list_arena_mode` is not NONE. */
+    fbListArena_t     list_arena;
+    /** Whether decoding lists is deferred; see fBufSetLazyLists(). */
+    gboolean          lazy_lists;
+    /** Deferred lists read from the current message not yet decoded. */
+    fbListDeferred_t *deferred;
     /** Current internal template. */
     fbTemplate_t     *int_tmpl;
     /** Current external template. */
@@ -92,6 +368,8 @@ struct fBuf_st {
     gboolean          auto_tmplInfo;
     /** Automatic read/write next message mode flag */
     gboolean          auto_next_msg;
+    /** Set while templates are exported to the start of a rotated file */
+    gboolean          rotating;
     /** Export time in seconds since 0UTC 1 Jan 1970 */
     uint32_t          extime;
     /** Record counter. */
@@ -216,14 +494,14 @@ attachHeadToDLL(
  * moves an entry within the dynamically linked list to the head of the list
  *
  * @param head - the head of the dynamic linked list
- * @param tail - unused
+ * @param tail - the tail of the dynamic linked list; may be NULL
  * @param thisEntry - list element to move to the head
  *
  */
 static void
 moveThisEntryToHeadOfDLL(
     fbDLL_t **head,
-    fbDLL_t **tail __attribute__((unused)),
+    fbDLL_t **tail,
     fbDLL_t  *thisEntry)
 {
     if (thisEntry == *head) {
@@ -236,6 +514,9 @@ moveThisEntryToHeadOfDLL(
 
     if (thisEntry->next) {
         thisEntry->next->prev = thisEntry->prev;
+    } else if (tail) {
+        /*  moving the tail; its predecessor becomes the tail */
+        *tail = thisEntry->prev;
     }
 
     thisEntry->prev = NULL;
@@ -286,6 +567,138 @@ detachThisEntryOfDLL(
     entry->next = NULL;
 }
 
+/*==================================================================
+ *
+ * List Arena Functions
+ *
+ *==================================================================*/
+
+/**
+ *  Releases all blocks owned by the list arena `arena`.
+ */
+static void
+fbListArenaFree(
+    fbListArena_t  *arena)
+{
+    fbListArenaBlock_t *block;
+
+    while ((block = arena->blocks)) {
+        arena->blocks = block->next;
+        g_free(block);
+    }
+    memset(arena, 0, sizeof(*arena));
+}
+
+/**
+ *  Adds a block of at least `size` octets to the list arena `arena` and
+ *  makes it the current block.
+ */
+static void
+fbListArenaAddBlock(
+    fbListArena_t  *arena,
+    size_t          size)
+{
+    fbListArenaBlock_t *block;
+
+    size = MAX(size, FB_LIST_ARENA_BLOCK_SIZE);
+    block = (fbListArenaBlock_t *)g_malloc(sizeof(*block) + size);
+    block->size = size;
+    block->next = arena->blocks;
+    arena->blocks = block;
+    arena->cp = (uint8_t *)(block + 1);
+    arena->end = arena->cp + size;
+}
+
+/**
+ *  Returns `len` octets of zeroed memory from the list arena `arena`, or
+ *  NULL when `len` is 0.
+ */
+static void *
+fbListArenaAlloc(
+    fbListArena_t  *arena,
+    size_t          len)
+{
+    uint8_t *p;
+
+    if (0 == len) {
+        return NULL;
+    }
+    len = FB_LIST_ARENA_ALIGN(len);
+    if ((size_t)(arena->end - arena->cp) < len) {
+        fbListArenaAddBlock(arena, len);
+    }
+    p = arena->cp;
+    arena->cp += len;
+    arena->used += len;
+    return memset(p, 0, len);
+}
+
+/**
+ *  Releases everything allocated from the list arena `arena`.  If the
+ *  allocations spilled into several blocks, they are replaced by a single
+ *  block large enough for all of them so subsequent messages of the same
+ *  size need only one block.
+ */
+static void
+fbListArenaReset(
+    fbListArena_t  *arena)
+{
+    size_t used = arena->used;
+
+    if (NULL == arena->blocks) {
+        return;
+    }
+    if (arena->blocks->next) {
+        fbListArenaFree(arena);
+        fbListArenaAddBlock(arena, used);
+    } else {
+        arena->cp = (uint8_t *)(arena->blocks + 1);
+    }
+    arena->used = 0;
+}
+
+/**
+ *  Allocates `len` octets of zeroed storage for a list being decoded by
+ *  `fbuf`, from the Buffer's list arena when enabled or with g_slice
+ *  otherwise, and sets the referent of `fromArena` to reflect which was
+ *  used.
+ */
+static void *
+fBufListAlloc(
+    fBuf_t   *fbuf,
+    size_t    len,
+    uint8_t  *fromArena)
+{
+    ++fbuf->stats.list_allocs;
+    if (FB_LIST_ARENA_NONE == fbuf->list_arena_mode) {
+        *fromArena = 0;
+        return g_slice_alloc0(len);
+    }
+    *fromArena = 1;
+    return fbListArenaAlloc(&fbuf->list_arena, len);
+}
+
+/**
+ *  Forgets the deferred lists of `fbuf` that are in its list arena, which
+ *  is about to be reset or freed; they are released without being decoded.
+ */
+static void
+fBufListArenaDropDeferred(
+    fBuf_t  *fbuf)
+{
+    fbListDeferred_t *deferred;
+    fbListDeferred_t *next;
+
+    for (deferred = fbuf->deferred; deferred; deferred = next) {
+        next = deferred->next;
+        if (deferred->fromArena) {
+            detachThisEntryOfDLL((fbDLL_t **)(void *)&(fbuf->deferred), NULL,
+                                 (fbDLL_t *)deferred);
+        }
+    }
+}
+
+
 /*==================================================================
  *
  * Debugger Functions
@@ -373,6 +786,13 @@ fBufDebugTranscodePlan(
     for (i = 0; i < tcplan->d_tmpl->ie_count; i++) {
         fprintf(stderr, "\td[%2u]=s[%2d]\n", i, tcplan->si[i]);
     }
+    for (i = 0; i < tcplan->op_count; i++) {
+        fprintf(stderr, "\top[%2u] type %2u s[%2u] s_off %4x s_len %5u"
+                " d_len %5u count %u\n",
+                i, tcplan->ops[i].type, tcplan->ops[i].s_idx,
+                tcplan->ops[i].s_off, tcplan->ops[i].s_len,
+                tcplan->ops[i].d_len, tcplan->ops[i].count);
+    }
 }
 
 static void
@@ -491,6 +911,67 @@ fbSubTemplateMultiListEntryAllocData(
     fbSubTemplateMultiListEntry_t  *entry,
     uint16_t                        numElements);
 
+static gboolean
+fbDecodeListDeferred(
+    uint8_t   *src,
+    uint8_t  **dst,
+    uint32_t  *d_rem,
+    fBuf_t    *fbuf,
+    uint8_t    type,
+    GError   **err);
+
+static void
+fBufBLRecordFree(
+    fbBasicList_t  *bl);
+
+static void
+fBufSTLRecordFree(
+    fbSubTemplateList_t  *stl);
+
+static void
+fBufSTMLRecordFree(
+    fbSubTemplateMultiList_t  *stml);
+
+static fbListDeferred_t *
+fbListDeferredDecode(
+    fbListDeferred_t  *deferred);
+
+static void
+fbListDeferredTake(
+    void              *list,
+    fbListDeferred_t  *deferred,
+    size_t             len);
+
+/*
+ *  When the decoding of the list that `_list_` points to was deferred,
+ *  decodes it if needed and changes `_list_` to point to the decoded list,
+ *  which is the `_member_` of the fbListDeferred_t in the list's `_ptr_`.
+ *  The application's list structure is not changed.
+ */
+#define FB_LIST_RESOLVE(_list_, _ptr_, _member_)                        \
+    {                                                                   \
+        if (FB_LIST_DEFERRED == (_list_)->fromArena) {                  \
+            (_list_) = &fbListDeferredDecode(                           \
+                (fbListDeferred_t *)(void *)(_list_)->_ptr_)            \
+                ->list._member_;                                        \
+        }                                                               \
+    }
+
+/*
+ *  When the decoding of the list that `_list_` points to was deferred,
+ *  decodes it if needed and moves the decoded list into `_list_`, so that
+ *  it may be changed.  `_ptr_` is the member that holds the
+ *  fbListDeferred_t.
+ */
+#define FB_LIST_TAKE(_list_, _ptr_)                                     \
+    {                                                                   \
+        if (FB_LIST_DEFERRED == (_list_)->fromArena) {                  \
+            fbListDeferredTake((_list_),                                \
+                               (fbListDeferred_t *)(void *)(_list_)->_ptr_, \
+                               sizeof(*(_list_)));                      \
+        }                                                               \
+    }
+
 static gboolean
 fBufCheckTemplateDefaultLength(
     const fbTemplate_t  *int_tmpl,
@@ -530,41 +1011,881 @@ fBufSetEncodeSubTemplates(
 #define FB_TC_DBC_ERR(_need_, _op_) \
     FB_TC_DBC_DEST((_need_), (_op_), goto err)
 
+/*
+ *  Returns the size of the memory needed to hold an info element.
+ *
+ *  For fixed-length elements, this is its length.  For variable
+ *  length elements, it is the size of a struct, either fbVarfield_t
+ *  or one of the List structures.
+ */
+static uint16_t
+fbSizeofIE(
+    const fbTemplateField_t  *ie)
+{
+    if (FB_IE_VARLEN != ie->len) {
+        return ie->len;
+    }
+    switch (fbTemplateFieldGetType(ie)) {
+      case FB_BASIC_LIST:
+        return sizeof(fbBasicList_t);
+      case FB_SUB_TMPL_LIST:
+        return sizeof(fbSubTemplateList_t);
+      case FB_SUB_TMPL_MULTI_LIST:
+        return sizeof(fbSubTemplateMultiList_t);
+      default:
+        return sizeof(fbVarfield_t);
+    }
+}
+
+/*
+ *  Appends `op` to the operations of `tcplan`, fusing it into the previous
+ *  operation when both are copies, byte-swaps of values having the same
+ *  length, or zero-fills, and the source fields are adjacent.  `s_next` is
+ *  the index of the source field that follows the final source field of the
+ *  previous operation; it is updated.
+ */
+static void
+fbTranscodePlanAddOp(
+    fbTranscodePlan_t      *tcplan,
+    const fbTranscodeOp_t  *op,
+    int32_t                *s_next)
+{
+    fbTranscodeOp_t *prev;
+
+    if (tcplan->op_count) {
+        prev = &tcplan->ops[tcplan->op_count - 1];
+        if (prev->type == op->type
+            && ((uint32_t)prev->d_len + op->d_len) <= UINT16_MAX)
+        {
+            switch (op->type) {
+              case FB_TCOP_ZERO:
+                prev->d_len += op->d_len;
+                return;
+              case FB_TCOP_COPY:
+                if (op->s_idx == *s_next) {
+                    prev->d_len += op->d_len;
+                    ++*s_next;
+                    return;
+                }
+                break;
+              case FB_TCOP_SWAP:
+                if (op->s_idx == *s_next && op->s_len == prev->s_len) {
+                    prev->d_len += op->d_len;
+                    ++prev->count;
+                    ++*s_next;
+                    return;
+                }
+                break;
+              default:
+                break;
+            }
+        }
+    }
+
+    tcplan->ops[tcplan->op_count++] = *op;
+    if (op->type != FB_TCOP_ZERO) {
+        *s_next = op->s_idx + 1;
+    }
+}
+
+/*
+ *  Fills in the operation `op` for a fixed-length field whose source length
+ *  is `op->s_len` and whose destination length is `op->d_len`.  Equal
+ *  length fields become a copy or a byte-swap.
+ */
+static void
+fbTranscodePlanFixedOp(
+    fbTranscodeOp_t  *op,
+    gboolean          is_endian,
+    gboolean          is_signed)
+{
+    if (op->s_len != op->d_len) {
+        op->type = FB_TCOP_FIXED;
+        op->is_endian = is_endian;
+        op->is_signed = is_signed;
+#if G_BYTE_ORDER != G_BIG_ENDIAN
+    } else if (is_endian && op->d_len > 1) {
+        op->type = FB_TCOP_SWAP;
+        op->count = 1;
+#endif
+    } else {
+        op->type = FB_TCOP_COPY;
+    }
+}
+
+#if FB_TC_SHUFFLE_X86
+/*
+ *  Performs the byte shuffle `shuf` using SSSE3.
+ */
+__attribute__((target("ssse3")))
+static void
+fbTranscodeShuffleSSSE3(
+    uint8_t                     *dp,
+    const uint8_t               *sp,
+    const fbTranscodeShuffle_t  *shuf)
+{
+    __m128i  v, m;
+    uint16_t i;
+
+    for (i = 0; i < shuf->chunks; ++i) {
+        v = _mm_loadu_si128((const __m128i *)(sp + shuf->s_offs[i]));
+        m = _mm_loadu_si128((const __m128i *)(shuf->masks
+                                              + FB_TC_SHUFFLE_CHUNK * i));
+        _mm_storeu_si128((__m128i *)(dp + shuf->d_offs[i]),
+                         _mm_shuffle_epi8(v, m));
+    }
+}
+
+/*
+ *  Performs the byte shuffle `shuf` using AVX2, two chunks at a time.
+ */
+__attribute__((target("avx2")))
+static void
+fbTranscodeShuffleAVX2(
+    uint8_t                     *dp,
+    const uint8_t               *sp,
+    const fbTranscodeShuffle_t  *shuf)
+{
+    __m256i  v, m;
+    __m128i  v1, m1;
+    uint16_t i;
+
+    for (i = 0; i + 1 < shuf->chunks; i += 2) {
+        v = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(
+                _mm_loadu_si128((const __m128i *)(sp + shuf->s_offs[i]))),
+            _mm_loadu_si128((const __m128i *)(sp + shuf->s_offs[i + 1])), 1);
+        m = _mm256_loadu_si256((const __m256i *)(shuf->masks
+                                                 + FB_TC_SHUFFLE_CHUNK * i));
+        v = _mm256_shuffle_epi8(v, m);
+        if (shuf->d_offs[i + 1] == shuf->d_offs[i] + FB_TC_SHUFFLE_CHUNK) {
+            _mm256_storeu_si256((__m256i *)(dp + shuf->d_offs[i]), v);
+        } else {
+            _mm_storeu_si128((__m128i *)(dp + shuf->d_offs[i]),
+                             _mm256_castsi256_si128(v));
+            _mm_storeu_si128((__m128i *)(dp + shuf->d_offs[i + 1]),
+                             _mm256_extracti128_si256(v, 1));
+        }
+    }
+    if (i < shuf->chunks) {
+        v1 = _mm_loadu_si128((const __m128i *)(sp + shuf->s_offs[i]));
+        m1 = _mm_loadu_si128((const __m128i *)(shuf->masks
+                                               + FB_TC_SHUFFLE_CHUNK * i));
+        _mm_storeu_si128((__m128i *)(dp + shuf->d_offs[i]),
+                         _mm_shuffle_epi8(v1, m1));
+    }
+}
+#endif  /* FB_TC_SHUFFLE_X86 */
+
+#if FB_TC_SHUFFLE_NEON
+/*
+ *  Performs the byte shuffle `shuf` using NEON.  A table index of 0x80 is
+ *  out of range and yields zero.
+ */
+static void
+fbTranscodeShuffleNEON(
+    uint8_t                     *dp,
+    const uint8_t               *sp,
+    const fbTranscodeShuffle_t  *shuf)
+{
+    uint8x16_t v, m;
+    uint16_t   i;
+
+    for (i = 0; i < shuf->chunks; ++i) {
+        v = vld1q_u8(sp + shuf->s_offs[i]);
+        m = vld1q_u8(shuf->masks + FB_TC_SHUFFLE_CHUNK * i);
+        vst1q_u8(dp + shuf->d_offs[i], vqtbl1q_u8(v, m));
+    }
+}
+#endif  /* FB_TC_SHUFFLE_NEON */
+
+#if FB_TC_SHUFFLE
+/*
+ *  Returns the best shuffle kernel the CPU supports, or NULL if it supports
+ *  none.
+ */
+static fbTranscodeShuffle_fn
+fbTranscodeShuffleKernel(
+    void)
+{
+#if FB_TC_SHUFFLE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return fbTranscodeShuffleAVX2;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return fbTranscodeShuffleSSSE3;
+    }
+    return NULL;
+#else
+    return fbTranscodeShuffleNEON;
+#endif  /* FB_TC_SHUFFLE_X86 */
+}
+
+/*
+ *  Frees the arrays of `shuf`.
+ */
+static void
+fbTranscodeShuffleFree(
+    fbTranscodeShuffle_t  *shuf)
+{
+    g_free(shuf->masks);
+    g_free(shuf->d_offs);
+    g_free(shuf->s_offs);
+    g_free(shuf->tail);
+}
+
+/*
+ *  Performs the byte shuffle `shuf` of `tcplan`, reading from `sp` and
+ *  writing to `dp`.
+ */
+static void
+fbTranscodeShuffle(
+    const fbTranscodePlan_t     *tcplan,
+    uint8_t                     *dp,
+    const uint8_t               *sp,
+    const fbTranscodeShuffle_t  *shuf)
+{
+    uint16_t k;
+
+    tcplan->shuffle_fn(dp, sp, shuf);
+    for (k = 0, dp += shuf->tail_off; k < shuf->tail_len; ++k) {
+        dp[k] = (shuf->tail[k] < 0) ? 0 : sp[shuf->tail[k]];
+    }
+}
+
+/*
+ *  Fills `map` with the source octet of each of the `op->d_len` destination
+ *  octets of the fixed-width operation `op`, where `s_rel` is the offset of
+ *  the operation's source from the start of the run's source; -1 denotes a
+ *  zero octet.  Returns the number of source octets the operation reads.
+ *  The mapping matches fbTranscodeCopySwapValues(),
+ *  fbDecodeFixedLittleEndian(), and fbEncodeFixedLittleEndian().
+ */
+static uint32_t
+fbTranscodePlanShuffleMap(
+    const fbTranscodeOp_t  *op,
+    gboolean                decode,
+    int32_t                 s_rel,
+    int32_t                *map)
+{
+    int32_t s_len = op->s_len;
+    int32_t d_len = op->d_len;
+    int32_t k, v;
+
+    switch (op->type) {
+      case FB_TCOP_COPY:
+        for (k = 0; k < d_len; ++k) {
+            map[k] = s_rel + k;
+        }
+        return d_len;
+      case FB_TCOP_SWAP:
+        for (v = 0; v < op->count; ++v, map += s_len, s_rel += s_len) {
+            for (k = 0; k < s_len; ++k) {
+                map[k] = s_rel + s_len - 1 - k;
+            }
+        }
+        return op->d_len;
+      case FB_TCOP_FIXED:
+        for (k = 0; k < d_len; ++k) {
+            if (!op->is_endian) {
+                map[k] = (k < s_len) ? s_rel + k : -1;
+            } else if (decode) {
+                map[k] = (k < s_len) ? s_rel + s_len - 1 - k : -1;
+            } else {
+                map[k] = (d_len - k > s_len) ? -1 : s_rel + d_len - 1 - k;
+            }
+        }
+        return s_len;
+      default:
+        for (k = 0; k < d_len; ++k) {
+            map[k] = -1;
+        }
+        return 0;
+    }
+}
+
+/*
+ *  Returns the offset of the window of a chunk whose destination is the
+ *  `len` entries of `map` in a run whose source is `s_len` octets, or -1 if
+ *  the source octets of the chunk do not fit in one window.
+ */
+static int32_t
+fbTranscodePlanShuffleWindow(
+    const int32_t  *map,
+    uint32_t        len,
+    uint32_t        s_len)
+{
+    int32_t  lo = INT32_MAX;
+    int32_t  hi = -1;
+    int32_t  w;
+    uint32_t k;
+
+    for (k = 0; k < len; ++k) {
+        if (map[k] >= 0) {
+            lo = MIN(lo, map[k]);
+            hi = MAX(hi, map[k]);
+        }
+    }
+    /* keep the window within the source of the run */
+    w = MIN(lo, (int32_t)(s_len - FB_TC_SHUFFLE_CHUNK));
+    return (hi - w < FB_TC_SHUFFLE_CHUNK) ? w : -1;
+}
+
+/*
+ *  Builds the chunks of `shuf` from the `d_len` entries of `map` for a run
+ *  whose source is `s_len` octets.
+ *
+ *  Each chunk covers as many destination octets as fit in a window, but it
+ *  always stores FB_TC_SHUFFLE_CHUNK octets; the excess is overwritten by
+ *  the chunks that follow.  A chunk is therefore never started within
+ *  FB_TC_SHUFFLE_CHUNK octets of the end of the run; the end is covered by
+ *  a chunk that overlaps its predecessor when its source fits in a window,
+ *  and otherwise by the scalar `tail`.
+ */
+static void
+fbTranscodePlanShuffleChunks(
+    fbTranscodeShuffle_t  *shuf,
+    const int32_t         *map,
+    uint32_t               d_len,
+    uint32_t               s_len)
+{
+    uint16_t *d_offs = g_new(uint16_t, d_len);
+    uint32_t  d_off, len, c, k;
+    int32_t   w;
+
+    memset(shuf, 0, sizeof(*shuf));
+
+    /* find the extent of each chunk */
+    for (d_off = 0; d_off + FB_TC_SHUFFLE_CHUNK <= d_len; d_off += len) {
+        d_offs[shuf->chunks++] = d_off;
+        for (len = 2; len <= FB_TC_SHUFFLE_CHUNK; ++len) {
+            if (fbTranscodePlanShuffleWindow(map + d_off, len, s_len) < 0) {
+                break;
+            }
+        }
+        --len;
+    }
+    if (d_off < d_len) {
+        if (fbTranscodePlanShuffleWindow(map + d_len - FB_TC_SHUFFLE_CHUNK,
+                                         FB_TC_SHUFFLE_CHUNK, s_len) >= 0)
+        {
+            d_offs[shuf->chunks++] = d_len - FB_TC_SHUFFLE_CHUNK;
+        } else {
+            shuf->tail_off = d_off;
+            shuf->tail_len = d_len - d_off;
+            shuf->tail = g_new(int32_t, shuf->tail_len);
+            memcpy(shuf->tail, map + d_off, shuf->tail_len * sizeof(int32_t));
+        }
+    }
+
+    shuf->masks = g_new(uint8_t, FB_TC_SHUFFLE_CHUNK * shuf->chunks);
+    shuf->d_offs = g_new(uint16_t, shuf->chunks);
+    shuf->s_offs = g_new(uint16_t, shuf->chunks);
+    for (c = 0; c < shuf->chunks; ++c) {
+        d_off = d_offs[c];
+        /* the octets after the chunk's extent are overwritten later */
+        if (c + 1 < shuf->chunks) {
+            len = MIN(d_offs[c + 1] - d_off, FB_TC_SHUFFLE_CHUNK);
+        } else if (shuf->tail_len) {
+            len = shuf->tail_off - d_off;
+        } else {
+            len = d_len - d_off;
+        }
+        w = fbTranscodePlanShuffleWindow(map + d_off, len, s_len);
+        shuf->d_offs[c] = d_off;
+        shuf->s_offs[c] = w;
+        for (k = 0; k < FB_TC_SHUFFLE_CHUNK; ++k) {
+            shuf->masks[FB_TC_SHUFFLE_CHUNK * c + k] =
+                ((k >= len || map[d_off + k] < 0)
+                 ? 0x80 : (map[d_off + k] - w));
+        }
+    }
+    g_free(d_offs);
+}
+
+/*
+ *  Replaces runs of fixed-width operations of `tcplan` with FB_TCOP_SHUFFLE
+ *  operations when the CPU has a shuffle kernel.
+ *
+ *  A run is a sequence of copies, byte-swaps, unsigned (or narrowing)
+ *  fixed-length conversions, and zero-fills whose source fields lie in a
+ *  part of the source record that contains no variable-length field, in
+ *  increasing order of offset.  The operations of the run are reduced to a
+ *  map from each destination octet to a source octet (or zero), which the
+ *  kernel applies a chunk at a time.  Runs shorter than a chunk, that read
+ *  fewer octets than a chunk, or that are a single operation are left
+ *  alone.
+ */
+static void
+fbTranscodePlanShuffle(
+    fbTranscodePlan_t  *tcplan)
+{
+    const fbTemplate_t   *s_tmpl = tcplan->s_tmpl;
+    const fbTemplateField_t *s_ie;
+    fbTranscodeShuffle_t  shuf;
+    fbTranscodeOp_t      *op;
+    fbTranscodeOp_t       run_op;
+    uint32_t   *s_rel;
+    uint32_t   *s_seg;
+    int32_t    *map;
+    uint32_t    d_total = 0;
+    uint32_t    off, seg, i, j, k, out;
+    uint32_t    d_run, s_run, used, rel, swaps;
+    int32_t     base;
+
+    tcplan->shuffle_fn = fbTranscodeShuffleKernel();
+    if (NULL == tcplan->shuffle_fn) {
+        return;
+    }
+
+    /* offset of each source field from the start of its segment, where
+     * each variable-length source field starts a new segment */
+    s_rel = g_new(uint32_t, s_tmpl->ie_count + 1);
+    s_seg = g_new(uint32_t, s_tmpl->ie_count + 1);
+    for (i = 0, off = 0, seg = 0; i < s_tmpl->ie_count; ++i) {
+        s_ie = s_tmpl->ie_ary[i];
+        s_rel[i] = off;
+        s_seg[i] = seg;
+        if (!tcplan->decode) {
+            off += fbSizeofIE(s_ie);
+        } else if (FB_IE_VARLEN == s_ie->len) {
+            off = 0;
+            ++seg;
+        } else {
+            off += s_ie->len;
+        }
+    }
+
+    for (i = 0; i < tcplan->op_count; ++i) {
+        d_total += tcplan->ops[i].d_len;
+    }
+    map = g_new(int32_t, d_total + 1);
+
+    for (i = 0, out = 0; i < tcplan->op_count; i = j) {
+        /* find the run that starts at operation `i` */
+        base = -1;
+        d_run = s_run = swaps = 0;
+        for (j = i; j < tcplan->op_count; ++j) {
+            op = &tcplan->ops[j];
+            if (FB_TCOP_COPY == op->type || FB_TCOP_SWAP == op->type ||
+                (FB_TCOP_FIXED == op->type &&
+                 (!op->is_signed || op->d_len <= op->s_len)))
+            {
+                if (base < 0) {
+                    base = j;
+                } else if (s_seg[op->s_idx] != s_seg[tcplan->ops[base].s_idx]
+                           || (s_rel[op->s_idx]
+                               < s_rel[tcplan->ops[base].s_idx]))
+                {
+                    break;
+                }
+                rel = s_rel[op->s_idx] - s_rel[tcplan->ops[base].s_idx];
+            } else if (FB_TCOP_ZERO == op->type || FB_TCOP_SKIP == op->type) {
+                rel = 0;
+            } else {
+                break;
+            }
+            if (d_run + op->d_len > UINT16_MAX) {
+                break;
+            }
+            used = fbTranscodePlanShuffleMap(op, tcplan->decode, rel,
+                                             map + d_run);
+            if (used && rel + used > UINT16_MAX) {
+                break;
+            }
+            s_run = MAX(s_run, rel + used);
+            d_run += op->d_len;
+            if (FB_TCOP_SWAP == op->type || FB_TCOP_FIXED == op->type) {
+                ++swaps;
+            }
+        }
+        if (j == i) {
+            /* operation `i` cannot be part of a run */
+            tcplan->ops[out++] = tcplan->ops[i];
+            j = i + 1;
+            continue;
+        }
+
+        if (j - i >= 2 && d_run >= FB_TC_SHUFFLE_CHUNK
+            && s_run >= FB_TC_SHUFFLE_CHUNK && swaps
+            && tcplan->shuffle_count < UINT16_MAX)
+        {
+            fbTranscodePlanShuffleChunks(&shuf, map, d_run, s_run);
+            /* a run whose source is so scattered that few octets fit in a
+             * window is better left to the scalar operations */
+            if (shuf.tail_len + FB_TC_SHUFFLE_MIN_FILL * shuf.chunks
+                > d_run)
+            {
+                fbTranscodeShuffleFree(&shuf);
+                swaps = 0;
+            }
+        } else {
+            swaps = 0;
+        }
+        if (0 == swaps) {
+            for (k = i; k < j; ++k) {
+                tcplan->ops[out++] = tcplan->ops[k];
+            }
+            continue;
+        }
+
+        memset(&run_op, 0, sizeof(run_op));
+        run_op.type = FB_TCOP_SHUFFLE;
+        run_op.s_idx = tcplan->ops[base].s_idx;
+        run_op.s_off = tcplan->ops[base].s_off;
+        run_op.s_len = s_run;
+        run_op.d_len = d_run;
+        run_op.count = tcplan->shuffle_count;
+        tcplan->shuffles = g_renew(fbTranscodeShuffle_t, tcplan->shuffles,
+                                   tcplan->shuffle_count + 1);
+        tcplan->shuffles[tcplan->shuffle_count++] = shuf;
+        tcplan->ops[out++] = run_op;
+    }
+    tcplan->op_count = out;
+
+    g_free(map);
+    g_free(s_seg);
+    g_free(s_rel);
+}
+#endif  /* FB_TC_SHUFFLE */
+
+/*
+ *  Compiles the operations of `tcplan` from its templates and its source
+ *  index array.
+ *
+ *  Fields are classified once by type and length so that fbTranscode() does
+ *  not need to inspect each field of each record.  Adjacent fields that are
+ *  copied verbatim or that are byte-swapped values of a single length are
+ *  fused into one operation, as are adjacent fields missing from the source.
+ *  When the destination record has a fixed size and nothing in it depends
+ *  on its prior contents, the zero-fill of missing fields is hoisted into a
+ *  single memset() of the record.
+ */
+static void
+fbTranscodePlanCompile(
+    fbTranscodePlan_t  *tcplan)
+{
+    const fbTemplate_t *s_tmpl = tcplan->s_tmpl;
+    const fbTemplate_t *d_tmpl = tcplan->d_tmpl;
+    const fbTemplateField_t *s_ie, *d_ie;
+    fbTranscodeOp_t  op;
+    uint16_t        *s_offsets = NULL;
+    uint32_t         d_total = 0;
+    uint32_t         s_off, i;
+    int32_t          s_next = FB_TCPLAN_NULL;
+    unsigned int     zero_runs = 0;
+
+    tcplan->ops = g_new0(fbTranscodeOp_t, d_tmpl->ie_count);
+    tcplan->op_count = 0;
+
+    /* when encoding, the source is always an internal record; when
+     * decoding, the source offsets are fixed unless the source has varlen
+     * fields */
+    tcplan->s_static = !(tcplan->decode && s_tmpl->is_varlen);
+    if (tcplan->s_static) {
+        s_offsets = g_new0(uint16_t, s_tmpl->ie_count);
+        for (i = 0, s_off = 0; i < s_tmpl->ie_count; ++i) {
+            s_offsets[i] = s_off;
+            s_off += (tcplan->decode
+                      ? s_tmpl->ie_ary[i]->len
+                      : fbSizeofIE(s_tmpl->ie_ary[i]));
+        }
+        tcplan->s_len = s_off;
+    }
+
+    for (i = 0; i < d_tmpl->ie_count; ++i) {
+        d_ie = d_tmpl->ie_ary[i];
+        memset(&op, 0, sizeof(op));
+        d_total += (tcplan->decode ? fbSizeofIE(d_ie) : d_ie->len);
+
+        if (FB_TCPLAN_NULL == tcplan->si[i]) {
+            /* Null source */
+            op.type = FB_TCOP_ZERO;
+            if (tcplan->decode) {
+                op.d_len = fbSizeofIE(d_ie);
+            } else if (FB_IE_VARLEN == d_ie->len) {
+                op.d_len = 1;
+            } else {
+                op.d_len = d_ie->len;
+            }
+            fbTranscodePlanAddOp(tcplan, &op, &s_next);
+            continue;
+        }
+
+        s_ie = s_tmpl->ie_ary[tcplan->si[i]];
+        op.s_idx = tcplan->si[i];
+        op.s_off = s_offsets ? s_offsets[op.s_idx] : 0;
+        op.s_len = s_ie->len;
+        op.d_len = d_ie->len;
+
+        switch (fbTemplateFieldGetType(d_ie)) {
+          case FB_BOOL:
+          case FB_UINT_8:
+          case FB_INT_8:
+          case FB_IP6_ADDR:
+          case FB_MAC_ADDR:
+            fbTranscodePlanFixedOp(&op, 0, 0);
+            break;
+          case FB_UINT_16:
+          case FB_UINT_32:
+          case FB_UINT_64:
+          case FB_IP4_ADDR:
+          case FB_DT_SEC:
+          case FB_DT_MILSEC:
+          case FB_DT_MICROSEC:
+          case FB_DT_NANOSEC:
+          case FB_FLOAT_32:
+            fbTranscodePlanFixedOp(&op, 1, 0);
+            break;
+          case FB_INT_16:
+          case FB_INT_32:
+          case FB_INT_64:
+            fbTranscodePlanFixedOp(&op, 1, 1);
+            break;
+          case FB_FLOAT_64:
+            if (op.s_len == op.d_len) {
+                fbTranscodePlanFixedOp(&op, 1, 0);
+            } else {
+                op.type = FB_TCOP_DOUBLE;
+            }
+            break;
+          case FB_STRING:
+          case FB_OCTET_ARRAY:
+            if ((FB_IE_VARLEN == s_ie->len) ^ (FB_IE_VARLEN == d_ie->len)) {
+                op.type = FB_TCOP_MIXED_LENGTH;
+            } else if (FB_IE_VARLEN == s_ie->len) {
+                op.type = FB_TCOP_VARFIELD;
+            } else {
+                fbTranscodePlanFixedOp(&op, 0, 0);
+            }
+            break;
+          case FB_BASIC_LIST:
+            op.type = FB_TCOP_BASICLIST;
+            break;
+          case FB_SUB_TMPL_LIST:
+            op.type = FB_TCOP_SUBTMPLLIST;
+            break;
+          case FB_SUB_TMPL_MULTI_LIST:
+            op.type = FB_TCOP_SUBTMPLMULTILIST;
+            break;
+          default:
+            continue;
+        }
+        fbTranscodePlanAddOp(tcplan, &op, &s_next);
+    }
+
+    g_free(s_offsets);
+
+    for (i = 0; i < tcplan->op_count; ++i) {
+        if (FB_TCOP_ZERO == tcplan->ops[i].type) {
+            ++zero_runs;
+        }
+    }
+
+    /* Hoist the zero-fill when there is more than one run of missing fields
+     * and the destination has a fixed size.  Decoding a list frees the list
+     * already in the destination, so do not hoist in that case. */
+    if (zero_runs > 1 && d_total <= UINT16_MAX
+        && (tcplan->decode ? !d_tmpl->contains_list : !d_tmpl->is_varlen))
+    {
+        tcplan->d_zero = d_total;
+        for (i = 0; i < tcplan->op_count; ++i) {
+            if (FB_TCOP_ZERO == tcplan->ops[i].type) {
+                tcplan->ops[i].type = FB_TCOP_SKIP;
+            }
+        }
+    }
+
+#if FB_TC_SHUFFLE
+    fbTranscodePlanShuffle(tcplan);
+#endif
+}
+
+/**
+ * fbTranscodePlanFree
+ *
+ * Frees a transcode plan created by fbTranscodePlan().
+ *
+ * @param tcplan
+ *
+ */
+static void
+fbTranscodePlanFree(
+    fbTranscodePlan_t  *tcplan)
+{
+#if FB_TC_SHUFFLE
+    uint16_t i;
+
+    for (i = 0; i < tcplan->shuffle_count; ++i) {
+        fbTranscodeShuffleFree(&tcplan->shuffles[i]);
+    }
+#endif
+    g_free(tcplan->shuffles);
+    g_free(tcplan->si);
+    g_free(tcplan->ops);
+    g_slice_free(fbTranscodePlan_t, tcplan);
+}
+
+/**
+ * fbTranscodePlanHash
+ *
+ * Hash function for the transcode plan cache.  Uses the templates and the
+ * direction of the plan.
+ *
+ * @param v a fbTranscodePlan_t
+ *
+ */
+static guint
+fbTranscodePlanHash(
+    gconstpointer  v)
+{
+    const fbTranscodePlan_t *tcplan = (const fbTranscodePlan_t *)v;
+    uint64_t h;
+
+    h = (uint64_t)(uintptr_t)tcplan->s_tmpl * UINT64_C(0x9E3779B97F4A7C15);
+    h ^= (uint64_t)(uintptr_t)tcplan->d_tmpl + (h << 6) + (h >> 2);
+    h ^= (uint64_t)tcplan->decode;
+
+    return (guint)(h ^ (h >> 32));
+}
+
+/**
+ * fbTranscodePlanEqual
+ *
+ * Equality function for the transcode plan cache.
+ *
+ * @param a a fbTranscodePlan_t
+ * @param b a fbTranscodePlan_t
+ *
+ */
+static gboolean
+fbTranscodePlanEqual(
+    gconstpointer  a,
+    gconstpointer  b)
+{
+    const fbTranscodePlan_t *pa = (const fbTranscodePlan_t *)a;
+    const fbTranscodePlan_t *pb = (const fbTranscodePlan_t *)b;
+
+    return (pa->s_tmpl == pb->s_tmpl && pa->d_tmpl == pb->d_tmpl
+            && pa->decode == pb->decode);
+}
+
+/**
+ * fBufRemoveTcplanEntry
+ *
+ * Removes `entry` from the transcode plan cache of `fbuf` and frees it.
+ *
+ * @param fbuf
+ * @param entry
+ *
+ */
+static void
+fBufRemoveTcplanEntry(
+    fBuf_t           *fbuf,
+    fbTCPlanEntry_t  *entry)
+{
+    g_hash_table_remove(fbuf->tcplan_table, entry->tcplan);
+    detachThisEntryOfDLL((fbDLL_t **)(void *)&(fbuf->latestTcplan),
+                         (fbDLL_t **)(void *)&(fbuf->oldestTcplan),
+                         (fbDLL_t *)entry);
+    fbTranscodePlanFree(entry->tcplan);
+    g_slice_free(fbTCPlanEntry_t, entry);
+    --fbuf->tcplan_count;
+}
+
+/**
+ * fBufTrimTcplanCache
+ *
+ * Discards the least recently used transcode plans from the cache of `fbuf`
+ * until it holds no more than `limit` plans.  Plans in use by a transcode in
+ * progress (the sub-records of a list are transcoded while the plan for the
+ * record holding the list runs) are kept, so the cache may briefly exceed
+ * `limit`.
+ *
+ * @param fbuf
+ * @param limit
+ *
+ */
+static void
+fBufTrimTcplanCache(
+    fBuf_t        *fbuf,
+    unsigned int   limit)
+{
+    fbTCPlanEntry_t *entry;
+    fbTCPlanEntry_t *prev;
+
+    entry = fbuf->oldestTcplan;
+    while (entry && fbuf->tcplan_count > limit) {
+        prev = entry->prev;
+        if (0 == entry->tcplan->in_use) {
+            fBufRemoveTcplanEntry(fbuf, entry);
+        }
+        entry = prev;
+    }
+}
+
 /**
  * fbTranscodePlan
  *
+ * Returns the transcode plan to use to decode (when `decode` is TRUE) or
+ * encode records from `s_tmpl` to `d_tmpl`, creating and caching the plan if
+ * necessary.
+ *
  * @param fbuf
  * @param s_tmpl
  * @param d_tmpl
+ * @param decode
  *
  */
 static fbTranscodePlan_t *
 fbTranscodePlan(
     fBuf_t        *fbuf,
     fbTemplate_t  *s_tmpl,
-    fbTemplate_t  *d_tmpl)
+    fbTemplate_t  *d_tmpl,
+    gboolean       decode)
 {
     void            *sik, *siv;
     uint32_t         i;
     fbTCPlanEntry_t *entry;
     fbTranscodePlan_t *tcplan;
+    fbTranscodePlan_t  key;
+
+    /* the most recently used plan is the common case */
+    entry = fbuf->latestTcplan;
+    if (entry &&
+        entry->tcplan->s_tmpl == s_tmpl &&
+        entry->tcplan->d_tmpl == d_tmpl &&
+        entry->tcplan->decode == decode)
+    {
+        ++fbuf->tcplan_hits;
+        return entry->tcplan;
+    }
 
     /* check to see if plan is cached */
-    if (fbuf->latestTcplan) {
-        entry = fbuf->latestTcplan;
-        while (entry) {
-            tcplan = entry->tcplan;
-            if (tcplan->s_tmpl == s_tmpl &&
-                tcplan->d_tmpl == d_tmpl)
-            {
-                moveThisEntryToHeadOfDLL(
-                    (fbDLL_t **)(void *)&(fbuf->latestTcplan),
-                    NULL,
-                    (fbDLL_t *)entry);
-                return tcplan;
-            }
-            entry = entry->next;
+    if (fbuf->tcplan_table) {
+        key.s_tmpl = s_tmpl;
+        key.d_tmpl = d_tmpl;
+        key.decode = decode;
+        entry = (fbTCPlanEntry_t *)g_hash_table_lookup(fbuf->tcplan_table,
+                                                       &key);
+        if (entry) {
+            moveThisEntryToHeadOfDLL(
+                (fbDLL_t **)(void *)&(fbuf->latestTcplan),
+                (fbDLL_t **)(void *)&(fbuf->oldestTcplan),
+                (fbDLL_t *)entry);
+            ++fbuf->tcplan_hits;
+            return entry->tcplan;
         }
+    } else {
+        fbuf->tcplan_table = g_hash_table_new(fbTranscodePlanHash,
+                                              fbTranscodePlanEqual);
+    }
+    ++fbuf->tcplan_misses;
+
+    /* make room for the new plan */
+    if (fbuf->tcplan_capacity) {
+        fBufTrimTcplanCache(fbuf, fbuf->tcplan_capacity - 1);
     }
 
     entry = g_slice_new0(fbTCPlanEntry_t);
@@ -576,6 +1897,7 @@ fbTranscodePlan(
     /* fill in template refs */
     tcplan->s_tmpl = s_tmpl;
     tcplan->d_tmpl = d_tmpl;
+    tcplan->decode = decode;
 
     tcplan->si = g_new0(int32_t, d_tmpl->ie_count);
     /* for each destination element */
@@ -591,25 +1913,84 @@ fbTranscodePlan(
         }
     }
 
+    fbTranscodePlanCompile(tcplan);
+
+    g_hash_table_insert(fbuf->tcplan_table, tcplan, entry);
     attachHeadToDLL((fbDLL_t **)(void *)&(fbuf->latestTcplan),
-                    NULL,
+                    (fbDLL_t **)(void *)&(fbuf->oldestTcplan),
                     (fbDLL_t *)entry);
+    ++fbuf->tcplan_count;
+
     return tcplan;
 }
 
+/**
+ * fbTranscodeOffsetsPush
+ *
+ *  Returns an array of `count` elements for the field offsets of a record
+ *  with a variable-length template.  The array is taken from the scratch
+ *  stack on `fbuf` when it fits; the stack is shared by the nested
+ *  transcodes of list sub-records and must be released in LIFO order by
+ *  fbTranscodeFreeVarlenOffsets().  The stack is only resized while it is
+ *  empty; a nested request that does not fit is allocated from the heap
+ *  and grows the stack on the next top-level request.
+ *
+ */
+static uint16_t *
+fbTranscodeOffsetsPush(
+    fBuf_t    *fbuf,
+    uint32_t   count)
+{
+    uint16_t *offsets;
+
+    if (fbuf->off_stack_used + count > fbuf->off_stack_peak) {
+        fbuf->off_stack_peak = fbuf->off_stack_used + count;
+    }
+    if (0 == fbuf->off_stack_used &&
+        fbuf->off_stack_size < fbuf->off_stack_peak)
+    {
+        g_free(fbuf->off_stack);
+        fbuf->off_stack_size = MAX(fbuf->off_stack_peak,
+                                   count * FB_TC_OFFSET_NESTING);
+        fbuf->off_stack = g_new(uint16_t, fbuf->off_stack_size);
+    }
+    if (fbuf->off_stack_used + count > fbuf->off_stack_size) {
+        return g_new(uint16_t, count);
+    }
+    offsets = fbuf->off_stack + fbuf->off_stack_used;
+    fbuf->off_stack_used += count;
+    return offsets;
+}
+
+
 /**
  * fbTranscodeFreeVarlenOffsets
  *
+ *  Releases the `offsets` returned by fbTranscodeOffsets() for `s_tmpl`.
+ *  The offsets of a fixed-length template are cached on the template and
+ *  are not released.
+ *
+ * @param fbuf
  * @param s_tmpl
  * @param offsets
  *
  */
 static void
 fbTranscodeFreeVarlenOffsets(
+    fBuf_t        *fbuf,
     fbTemplate_t  *s_tmpl,
     uint16_t      *offsets)
 {
-    if (s_tmpl->is_varlen) {g_free(offsets);}
+    if (!s_tmpl->is_varlen) {
+        return;
+    }
+    if (fbuf->off_stack && offsets >= fbuf->off_stack &&
+        offsets < fbuf->off_stack + fbuf->off_stack_size)
+    {
+        fbuf->off_stack_used = offsets - fbuf->off_stack;
+    } else {
+        g_free(offsets);
+    }
 }
 
 /**
@@ -762,45 +2143,61 @@ fbTranscodeFreeVarlenOffsets(
 
 
 /**
- * fbTranscodeOffsets
+ * fbTranscodeFillOffsets
+ *
+ *  Fills `offsets`, an array of `s_tmpl->ie_count + 1` elements, with the
+ *  offset of each field of the record at `s_base` described by `s_tmpl`
+ *  followed by the end-of-record offset, and returns the end-of-record
+ *  offset.  When `offsets` is NULL, only returns the end-of-record offset.
+ *  `s_rem` is the number of octets available at `s_base`.  Returns -1 and
+ *  sets `err` if the record is longer than `s_rem`.
+ *
+ *  The fields before the first variable-length field have the same offsets
+ *  in both directions, and those offsets are computed by the template, so
+ *  only the remaining fields are scanned.
  *
  * @param s_tmpl
  * @param s_base
  * @param s_rem
  * @param decode
- * @param offsets_out
+ * @param offsets
  * @param err - glib2 GError structure that returns the message on failure
  *
  * @return
  *
  */
 static ssize_t
-fbTranscodeOffsets(
-    fbTemplate_t  *s_tmpl,
-    uint8_t       *s_base,
-    uint32_t       s_rem,
-    gboolean       decode,
-    uint16_t     **offsets_out,
-    GError       **err)
+fbTranscodeFillOffsets(
+    const fbTemplate_t  *s_tmpl,
+    const uint8_t       *s_base,
+    uint32_t             s_rem,
+    gboolean             decode,
+    uint16_t            *offsets,
+    GError             **err)
 {
-    fbTemplateField_t *s_ie;
-    uint8_t           *sp;
-    uint16_t          *offsets;
-    uint32_t           s_len, i;
-
-    /* short circuit - return offset cache if present in template */
-    if (s_tmpl->off_cache) {
-        if (offsets_out) {*offsets_out = s_tmpl->off_cache;}
-        return s_tmpl->off_cache[s_tmpl->ie_count];
+    const fbTemplateField_t *s_ie;
+    const uint8_t           *sp;
+    uint32_t                 s_len, i;
+
+    /* handle the fixed-length prefix */
+    i = s_tmpl->fixed_prefix_count;
+    sp = s_base;
+    if (i) {
+        s_len = ((i < s_tmpl->ie_count)
+                 ? s_tmpl->ie_ary[i]->offset : s_tmpl->ie_len);
+        FB_TC_SBC_OFF(s_len);
+        if (offsets) {
+            uint32_t j;
+            for (j = 0; j < i; ++j) {
+                offsets[j] = s_tmpl->ie_ary[j]->offset;
+            }
+        }
+        sp += s_len; s_rem -= s_len;
     }
 
-    /* create new offsets array */
-    offsets = g_new0(uint16_t, s_tmpl->ie_count + 1);
-
-    /* populate it */
     if (decode) {
-        for (i = 0, sp = s_base; i < s_tmpl->ie_count; i++) {
-            offsets[i] = sp - s_base;
+        for ( ; i < s_tmpl->ie_count; i++) {
+            if (offsets) {offsets[i] = sp - s_base;}
             s_ie = s_tmpl->ie_ary[i];
             if (s_ie->len == FB_IE_VARLEN) {
                 FB_TC_SBC_OFF((*sp == 255) ? 3 : 1);
@@ -813,8 +2210,8 @@ fbTranscodeOffsets(
             }
         }
     } else {
-        for (i = 0, sp = s_base; i < s_tmpl->ie_count; i++) {
-            offsets[i] = sp - s_base;
+        for ( ; i < s_tmpl->ie_count; i++) {
+            if (offsets) {offsets[i] = sp - s_base;}
             s_ie = s_tmpl->ie_ary[i];
             if (s_ie->len == FB_IE_VARLEN) {
                 if (s_ie->canon->type == FB_BASIC_LIST) {
@@ -842,27 +2239,131 @@ fbTranscodeOffsets(
     }
 
     /* get EOR offset */
-    s_len = offsets[i] = sp - s_base;
+    if (offsets) {offsets[i] = sp - s_base;}
+    return sp - s_base;
+
+  err:
+    return -1;
+}
+
+
+/**
+ * fbTranscodeOffsets
+ *
+ *  Computes the field offsets of the record at `s_base` and returns the
+ *  end-of-record offset.  When `offsets_out` is not NULL, it is set to the
+ *  offsets, which the caller must release with
+ *  fbTranscodeFreeVarlenOffsets().
+ *
+ * @param fbuf
+ * @param s_tmpl
+ * @param s_base
+ * @param s_rem
+ * @param decode
+ * @param offsets_out
+ * @param err - glib2 GError structure that returns the message on failure
+ *
+ * @return
+ *
+ */
+static ssize_t
+fbTranscodeOffsets(
+    fBuf_t        *fbuf,
+    fbTemplate_t  *s_tmpl,
+    uint8_t       *s_base,
+    uint32_t       s_rem,
+    gboolean       decode,
+    uint16_t     **offsets_out,
+    GError       **err)
+{
+    uint16_t *offsets;
+    ssize_t   s_len;
+
+    /* short circuit - return offset cache if present in template; it is
+     * published by another thread's compare-and-swap below */
+    offsets = g_atomic_pointer_get(&s_tmpl->off_cache);
+    if (offsets) {
+        if (offsets_out) {*offsets_out = offsets;}
+        return offsets[s_tmpl->ie_count];
+    }
+
+    if (!s_tmpl->is_varlen) {
+        /* offsets never change; compute them once and cache them */
+        offsets = g_new0(uint16_t, s_tmpl->ie_count + 1);
+        s_len = fbTranscodeFillOffsets(s_tmpl, s_base, s_rem, decode,
+                                       offsets, err);
+        if (s_len < 0) {
+            g_free(offsets);
+            return -1;
+        }
+        /* templates may be shared by threads (see fbTemplateIntern());
+         * keep whichever cache is published first */
+        if (!g_atomic_pointer_compare_and_exchange(&s_tmpl->off_cache,
+                                                   NULL, offsets))
+        {
+            g_free(offsets);
+            offsets = g_atomic_pointer_get(&s_tmpl->off_cache);
+        }
+        if (offsets_out) {*offsets_out = offsets;}
+        return s_len;
+    }
 
     if (NULL == offsets_out) {
         /* can only return s_len, not the offsets */
-        fbTranscodeFreeVarlenOffsets(s_tmpl, offsets);
-    } else {
-        /* cache offsets if possible */
-        if (!s_tmpl->is_varlen) {
-            s_tmpl->off_cache = offsets;
-        }
+        return fbTranscodeFillOffsets(s_tmpl, s_base, s_rem, decode,
+                                      NULL, err);
+    }
 
-        /* return offsets */
-        *offsets_out = offsets;
+    /* use the buffer's scratch stack for the offsets */
+    offsets = fbTranscodeOffsetsPush(fbuf, (uint32_t)s_tmpl->ie_count + 1);
+    s_len = fbTranscodeFillOffsets(s_tmpl, s_base, s_rem, decode,
+                                   offsets, err);
+    if (s_len < 0) {
+        fbTranscodeFreeVarlenOffsets(fbuf, s_tmpl, offsets);
+        return -1;
     }
 
-    /* return EOR offset */
+    /* return offsets and EOR offset */
+    *offsets_out = offsets;
     return s_len;
+}
 
-  err:
-    g_free(offsets);
-    return -1;
+
+/**
+ * fbDecodeCountRecords
+ *
+ *  Returns the number of records described by the external template
+ *  `s_tmpl` in the `s_rem` octets at `s_base`.  A partial record at the end
+ *  is counted so that decoding it reports the error.
+ *
+ */
+static uint16_t
+fbDecodeCountRecords(
+    const fbTemplate_t  *s_tmpl,
+    const uint8_t       *s_base,
+    size_t               s_rem)
+{
+    ssize_t s_len;
+    size_t  count = 0;
+
+    if (0 == s_tmpl->ie_len) {
+        return 0;
+    }
+    if (!s_tmpl->is_varlen) {
+        count = (s_rem + s_tmpl->ie_len - 1) / s_tmpl->ie_len;
+    } else {
+        while (s_rem && count < UINT16_MAX) {
+            ++count;
+            s_len = fbTranscodeFillOffsets(s_tmpl, s_base, s_rem, TRUE,
+                                           NULL, NULL);
+            if (s_len <= 0) {
+                break;
+            }
+            s_base += s_len;
+            s_rem -= s_len;
+        }
+    }
+    return (uint16_t)MIN(count, UINT16_MAX);
 }
 
 
@@ -1015,7 +2516,7 @@ fbTranscodeDoubleBigEndian(
     } else {
         g_warning("float transcode: Unexpected element lengths"
                   " s_len = %u, d_len = %u", s_len, d_len);
-        memset(dp, 0, d_len);
+        memset(*dp, 0, d_len);
     }
 
     /* maintain counters */
@@ -1122,6 +2623,42 @@ fbTranscodeCopySwap(
 }
 
 
+/**
+ *  Copies `count` values, each `len` octets long, from `sp` to `dp` swapping
+ *  the bytes of each value as it is copied.
+ */
+static void
+fbTranscodeCopySwapValues(
+    uint8_t        *dp,
+    const uint8_t  *sp,
+    uint32_t        len,
+    uint32_t        count)
+{
+    /* switch outside the loop so each case has a constant length */
+    switch (len) {
+      case 2:
+        for ( ; count > 0; --count, dp += 2, sp += 2) {
+            fbTranscodeCopySwap(dp, sp, 2);
+        }
+        break;
+      case 4:
+        for ( ; count > 0; --count, dp += 4, sp += 4) {
+            fbTranscodeCopySwap(dp, sp, 4);
+        }
+        break;
+      case 8:
+        for ( ; count > 0; --count, dp += 8, sp += 8) {
+            fbTranscodeCopySwap(dp, sp, 8);
+        }
+        break;
+      default:
+        for ( ; count > 0; --count, dp += len, sp += len) {
+            fbTranscodeCopySwap(dp, sp, len);
+        }
+        break;
+    }
+}
+
 
 /**
  *  Implements fbEncodeFixed() on a little endian system.
@@ -1324,9 +2861,12 @@ fbEncodeDoubleLittleEndian(
     } else {
         g_warning("float LE transcode: Unexpected element lengths"
                   " s_len = %u, d_len = %u", s_len, d_len);
-        memset(dp, 0, d_len);
+        memset(*dp, 0, d_len);
     }
 
+    /* maintain counters */
+    *dp += d_len; *d_rem -= d_len;
+
     return TRUE;
 }
 
@@ -1383,9 +2923,12 @@ fbDecodeDoubleLittleEndian(
     } else {
         g_warning("float LE transcode: Unexpected element lengths"
                   " s_len = %u, d_len = %u", s_len, d_len);
-        memset(dp, 0, d_len);
+        memset(*dp, 0, d_len);
     }
 
+    /* maintain counters */
+    *dp += d_len; *d_rem -= d_len;
+
     return TRUE;
 }
 
@@ -1617,32 +3160,6 @@ fbDecodeVarfield(
 #endif  /* 0 */
 
 
-/*
- *  Returns the size of the memory needed to hold an info element.
- *
- *  For fixed-length elements, this is its length.  For variable
- *  length elements, it is the size of a struct, either fbVarfield_t
- *  or one of the List structures.
- */
-static uint16_t
-fbSizeofIE(
-    const fbTemplateField_t  *ie)
-{
-    if (FB_IE_VARLEN != ie->len) {
-        return ie->len;
-    }
-    switch (fbTemplateFieldGetType(ie)) {
-      case FB_BASIC_LIST:
-        return sizeof(fbBasicList_t);
-      case FB_SUB_TMPL_LIST:
-        return sizeof(fbSubTemplateList_t);
-      case FB_SUB_TMPL_MULTI_LIST:
-        return sizeof(fbSubTemplateMultiList_t);
-      default:
-        return sizeof(fbVarfield_t);
-    }
-}
-
 static gboolean
 validBasicList(
     fbBasicList_t  *basicList,
@@ -1804,6 +3321,9 @@ fbEncodeBasicList(
     basicList = (fbBasicList_t *)src;
 #endif /* if HAVE_ALIGNED_ACCESS_REQUIRED */
 
+    /* encode the decoded list of a list read with its decoding deferred */
+    FB_LIST_RESOLVE(basicList, dataPtr, bl);
+
     if (!validBasicList(basicList, err)) {
         return FALSE;
     }
@@ -2045,7 +3565,11 @@ fbDecodeBasicList(
             basicList->numElements++;
         }
 
-        thisItem = fbBasicListAllocData(basicList, basicList->numElements);
+        basicList->dataLength = (basicList->numElements *
+                                 fbSizeofIE(&basicList->field));
+        basicList->dataPtr = fBufListAlloc(fbuf, basicList->dataLength,
+                                           &basicList->fromArena);
+        thisItem = basicList->dataPtr;
 
         /* parse the specific varlen field */
         switch (fbTemplateFieldGetType(&basicList->field)) {
@@ -2114,7 +3638,11 @@ fbDecodeBasicList(
             uint32_t dRem     = (uint32_t)srcLen;
 
             basicList->numElements = srcLen / elementLen;
-            thisItem = fbBasicListAllocData(basicList, basicList->numElements);
+            basicList->dataLength = (basicList->numElements *
+                                     fbSizeofIE(&basicList->field));
+            basicList->dataPtr = fBufListAlloc(fbuf, basicList->dataLength,
+                                               &basicList->fromArena);
+            thisItem = basicList->dataPtr;
 
             /* Since the length of source and dest are the same, we can use
              * fbDecodeFixed() for everything with is_endian set correctly and
@@ -2169,6 +3697,9 @@ fbEncodeSubTemplateList(
     subTemplateList = (fbSubTemplateList_t *)src;
 #endif /* if HAVE_ALIGNED_ACCESS_REQUIRED */
 
+    /* encode the decoded list of a list read with its decoding deferred */
+    FB_LIST_RESOLVE(subTemplateList, dataPtr, stl);
+
     if (!validSubTemplateList(subTemplateList, err)) {
         return FALSE;
     }
@@ -2261,6 +3792,7 @@ fbDecodeSubTemplateList(
     uint8_t      *subTemplateDst  = NULL;
     uint16_t      int_tid = 0;
     uint16_t      ext_tid;
+    uint16_t      i;
 #ifdef HAVE_ALIGNED_ACCESS_REQUIRED
     fbSubTemplateList_t subTemplateList_local;
     subTemplateList = &subTemplateList_local;
@@ -2338,10 +3870,19 @@ fbDecodeSubTemplateList(
     fbuf->int_tmpl = intTemplate;
     fbuf->ext_tmpl = extTemplate;
 
-    dstLen = subTemplateList->recordLength;
-    while (srcLen) {
-        subTemplateDst = fbSubTemplateListAddNewElements(subTemplateList, 1);
+    /* size the list for all of its records at once */
+    subTemplateList->numElements = fbDecodeCountRecords(extTemplate, src,
+                                                        srcLen);
+    subTemplateList->dataLength = (subTemplateList->numElements *
+                                   subTemplateList->recordLength);
+    subTemplateList->dataPtr = fBufListAlloc(fbuf,
+                                             subTemplateList->dataLength,
+                                             &subTemplateList->fromArena);
+
+    subTemplateDst = subTemplateList->dataPtr;
+    for (i = 0; i < subTemplateList->numElements; ++i) {
         recLen = srcLen;
+        dstLen = subTemplateList->recordLength;
         rc = fbTranscode(fbuf, TRUE, src, subTemplateDst, &recLen,
                          &dstLen, err);
         if (!rc) {
@@ -2351,6 +3892,7 @@ fbDecodeSubTemplateList(
         g_assert(dstLen == subTemplateList->recordLength);
         srcLen -= recLen;
         src    += recLen;
+        subTemplateDst += dstLen;
     }
 
     /* restore the cached templates */
@@ -2401,6 +3943,9 @@ fbEncodeSubTemplateMultiList(
     multiList = (fbSubTemplateMultiList_t *)src;
 #endif /* if HAVE_ALIGNED_ACCESS_REQUIRED */
 
+    /* encode the decoded list of a list read with its decoding deferred */
+    FB_LIST_RESOLVE(multiList, firstEntry, stml);
+
     /* calculate total destination length */
 
     if (!validSubTemplateMultiList(multiList, err)) {
@@ -2508,7 +4053,7 @@ fbDecodeSubTemplateMultiList(
     uint8_t      *srcWalker  = NULL;
     fbSubTemplateMultiListEntry_t *entry = NULL;
     uint16_t      entryLength;
-    uint16_t      i;
+    uint16_t      i, j;
     uint16_t      int_tid = 0;
     uint16_t      ext_tid;
     uint8_t      *thisTemplateDst;
@@ -2520,6 +4065,11 @@ fbDecodeSubTemplateMultiList(
     multiList = (fbSubTemplateMultiList_t *)*dst;
 #endif /* if HAVE_ALIGNED_ACCESS_REQUIRED */
 
+    /* release a list whose decoding was deferred */
+    if (FB_LIST_DEFERRED == multiList->fromArena) {
+        fbSubTemplateMultiListClear(multiList);
+    }
+
     FB_READ_LIST_LENGTH(srcLen, src);
     if (srcLen == 0) {
         /* FIXME: Should we use Clear or memset to zero? */
@@ -2556,8 +4106,9 @@ fbDecodeSubTemplateMultiList(
         multiList->numElements++;
     }
 
-    multiList->firstEntry = g_slice_alloc0(
-        multiList->numElements * sizeof(fbSubTemplateMultiListEntry_t));
+    multiList->firstEntry = fBufListAlloc(
+        fbuf, multiList->numElements * sizeof(fbSubTemplateMultiListEntry_t),
+        &multiList->fromArena);
     entry = multiList->firstEntry;
 
     for (i = 0; i < multiList->numElements; ++i, ++entry) {
@@ -2607,11 +4158,17 @@ fbDecodeSubTemplateMultiList(
         fbuf->int_tmpl = intTemplate;
         fbuf->ext_tmpl = extTemplate;
 
-        dstLen = entry->recordLength;
-        while (entryLength) {
-            thisTemplateDst
-                = fbSubTemplateMultiListEntryAddNewElements(entry, 1);
+        /* size the entry for all of its records at once */
+        entry->numElements = fbDecodeCountRecords(extTemplate, src,
+                                                  entryLength);
+        entry->dataLength = entry->numElements * entry->recordLength;
+        entry->dataPtr = fBufListAlloc(fbuf, entry->dataLength,
+                                       &entry->fromArena);
+
+        thisTemplateDst = entry->dataPtr;
+        for (j = 0; j < entry->numElements; ++j) {
             recLen = entryLength;
+            dstLen = entry->recordLength;
             rc = fbTranscode(fbuf, TRUE, src, thisTemplateDst, &recLen,
                              &dstLen, err);
             if (!rc) {
@@ -2626,7 +4183,10 @@ fbDecodeSubTemplateMultiList(
             g_assert(dstLen == entry->recordLength);
             entryLength -= recLen;
             src         += recLen;
+            thisTemplateDst += dstLen;
         }
+        /* skip anything not consumed, such as a zero-length template */
+        src += entryLength;
     }
 
     /* restore the cached templates */
@@ -2642,65 +4202,440 @@ fbDecodeSubTemplateMultiList(
     if (d_rem) {
         *d_rem -= sizeof(fbSubTemplateMultiList_t);
     }
-    return TRUE;
+    return TRUE;
+}
+
+
+/*
+ *  Decodes the list of type `type` (FB_BASIC_LIST, FB_SUB_TMPL_LIST, or
+ *  FB_SUB_TMPL_MULTI_LIST) at `src` into the list structure at `*dst` only
+ *  far enough to set its semantic, and points the structure to a new
+ *  fbListDeferred_t on `fbuf` that records where the encoded list is so
+ *  that fbListDeferredDecode() may finish decoding it later.  An empty list
+ *  is decoded at once.  Clears any list the structure held.  Moves `*dst`
+ *  forward and reduces `*d_rem` by the size of the structure.
+ */
+static gboolean
+fbDecodeListDeferred(
+    uint8_t   *src,
+    uint8_t  **dst,
+    uint32_t  *d_rem,
+    fBuf_t    *fbuf,
+    uint8_t    type,
+    GError   **err)
+{
+    union {
+        fbBasicList_t             bl;
+        fbSubTemplateList_t       stl;
+        fbSubTemplateMultiList_t  stml;
+    } list;
+    fbListDeferred_t *deferred;
+    uint8_t          *srcWalker = src;
+    uint16_t          srcLen;
+    uint8_t           fromArena;
+    size_t            len;
+
+    FB_READ_LIST_LENGTH(srcLen, srcWalker);
+    if (0 == srcLen) {
+        switch (type) {
+          case FB_BASIC_LIST:
+            return fbDecodeBasicList(fbuf->ext_tmpl->model, src, dst, d_rem,
+                                     fbuf, err);
+          case FB_SUB_TMPL_LIST:
+            return fbDecodeSubTemplateList(src, dst, d_rem, fbuf, err);
+          default:
+            return fbDecodeSubTemplateMultiList(src, dst, d_rem, fbuf, err);
+        }
+    }
+
+    /* release the list the structure held */
+    switch (type) {
+      case FB_BASIC_LIST:
+        len = sizeof(fbBasicList_t);
+        FB_TC_DBC(len, "basic-list decode");
+        memcpy(&list.bl, *dst, len);
+        if (list.bl.dataLength || list.bl.dataPtr) {
+            fbBasicListClear(&list.bl);
+        }
+        break;
+      case FB_SUB_TMPL_LIST:
+        len = sizeof(fbSubTemplateList_t);
+        FB_TC_DBC(len, "sub-template-list decode");
+        memcpy(&list.stl, *dst, len);
+        if (list.stl.dataLength || list.stl.dataPtr) {
+            fbSubTemplateListClear(&list.stl);
+        }
+        break;
+      default:
+        len = sizeof(fbSubTemplateMultiList_t);
+        FB_TC_DBC(len, "sub-template-multi-list decode");
+        memcpy(&list.stml, *dst, len);
+        if (list.stml.firstEntry) {
+            fbSubTemplateMultiListClear(&list.stml);
+        }
+        break;
+    }
+
+    deferred = (fbListDeferred_t *)fBufListAlloc(fbuf, sizeof(*deferred),
+                                                 &fromArena);
+    deferred->fbuf = fbuf;
+    deferred->src = src;
+    deferred->type = type;
+    deferred->fromArena = fromArena;
+    attachHeadToDLL((fbDLL_t **)(void *)&(fbuf->deferred), NULL,
+                    (fbDLL_t *)deferred);
+
+    memset(&list, 0, len);
+    switch (type) {
+      case FB_BASIC_LIST:
+        list.bl.semantic = *srcWalker;
+        list.bl.dataPtr = (uint8_t *)deferred;
+        list.bl.fromArena = FB_LIST_DEFERRED;
+        break;
+      case FB_SUB_TMPL_LIST:
+        list.stl.semantic = *srcWalker;
+        list.stl.dataPtr = (uint8_t *)deferred;
+        list.stl.fromArena = FB_LIST_DEFERRED;
+        break;
+      default:
+        list.stml.semantic = *srcWalker;
+        list.stml.firstEntry = (fbSubTemplateMultiListEntry_t *)(void *)
+            deferred;
+        list.stml.fromArena = FB_LIST_DEFERRED;
+        break;
+    }
+
+    memcpy(*dst, &list, len);
+    *dst += len;
+    *d_rem -= len;
+    return TRUE;
+}
+
+/*
+ *  Frees the lists decoded into `deferred` and leaves its list empty.
+ */
+static void
+fbListDeferredClear(
+    fbListDeferred_t  *deferred)
+{
+    switch (deferred->type) {
+      case FB_BASIC_LIST:
+        fBufBLRecordFree(&deferred->list.bl);
+        fbBasicListClear(&deferred->list.bl);
+        break;
+      case FB_SUB_TMPL_LIST:
+        fBufSTLRecordFree(&deferred->list.stl);
+        fbSubTemplateListClear(&deferred->list.stl);
+        break;
+      default:
+        fBufSTMLRecordFree(&deferred->list.stml);
+        fbSubTemplateMultiListClear(&deferred->list.stml);
+        break;
+    }
+}
+
+/*
+ *  Finishes decoding the list held by `deferred` if fbDecodeListDeferred()
+ *  deferred it and it has not yet been decoded, and returns `deferred`.
+ *  Logs a warning and leaves the list empty when it cannot be decoded.
+ */
+static fbListDeferred_t *
+fbListDeferredDecode(
+    fbListDeferred_t  *deferred)
+{
+    fBuf_t           *fbuf = deferred->fbuf;
+    uint8_t          *dst = (uint8_t *)&deferred->list;
+    fbListArenaMode_t arena_mode;
+    fbTemplate_t     *tempIntPtr;
+    fbTemplate_t     *tempExtPtr;
+    uint16_t          tempIntID;
+    uint16_t          tempExtID;
+    GError           *err = NULL;
+    gboolean          ok;
+
+    if (NULL == deferred->src) {
+        return deferred;
+    }
+    detachThisEntryOfDLL((fbDLL_t **)(void *)&(fbuf->deferred), NULL,
+                         (fbDLL_t *)deferred);
+
+    /* the decoders change the fbuf's templates; keep the record's */
+    tempIntID = fbuf->int_tid;
+    tempExtID = fbuf->ext_tid;
+    tempIntPtr = fbuf->int_tmpl;
+    tempExtPtr = fbuf->ext_tmpl;
+
+    /* the list's storage has the same owner as `deferred` */
+    arena_mode = fbuf->list_arena_mode;
+    if (!deferred->fromArena) {
+        fbuf->list_arena_mode = FB_LIST_ARENA_NONE;
+    }
+
+    switch (deferred->type) {
+      case FB_BASIC_LIST:
+        ok = fbDecodeBasicList(fbSessionGetInfoModel(fbuf->session),
+                               deferred->src, &dst, NULL, fbuf, &err);
+        break;
+      case FB_SUB_TMPL_LIST:
+        ok = fbDecodeSubTemplateList(deferred->src, &dst, NULL, fbuf, &err);
+        break;
+      default:
+        ok = fbDecodeSubTemplateMultiList(deferred->src, &dst, NULL, fbuf,
+                                          &err);
+        break;
+    }
+    deferred->src = NULL;
+
+    fbuf->list_arena_mode = arena_mode;
+    fbuf->int_tid = tempIntID;
+    fbuf->ext_tid = tempExtID;
+    fbuf->int_tmpl = tempIntPtr;
+    fbuf->ext_tmpl = tempExtPtr;
+
+    if (!ok) {
+        g_warning("Unable to decode deferred list: %s", err->message);
+        g_clear_error(&err);
+        fbListDeferredClear(deferred);
+    }
+    return deferred;
+}
+
+/*
+ *  Decodes the list held by `deferred` if needed, moves it into the list
+ *  structure `list` of `len` octets that refers to `deferred`, and frees
+ *  `deferred`.
+ */
+static void
+fbListDeferredTake(
+    void              *list,
+    fbListDeferred_t  *deferred,
+    size_t             len)
+{
+    fbListDeferredDecode(deferred);
+    memcpy(list, &deferred->list, len);
+    if (!deferred->fromArena) {
+        g_slice_free(fbListDeferred_t, deferred);
+    }
+}
+
+/*
+ *  Frees `deferred`, the list whose decoding was deferred that a list
+ *  structure being cleared refers to, and any lists decoded into it.
+ */
+static void
+fbListDeferredFree(
+    fbListDeferred_t  *deferred)
+{
+    if (deferred->src) {
+        /* never decoded; forget it */
+        detachThisEntryOfDLL((fbDLL_t **)(void *)&(deferred->fbuf->deferred),
+                             NULL, (fbDLL_t *)deferred);
+    } else {
+        fbListDeferredClear(deferred);
+    }
+    if (!deferred->fromArena) {
+        g_slice_free(fbListDeferred_t, deferred);
+    }
+}
+
+/*
+ *  Decodes the lists that `fbuf` deferred and that have not been examined,
+ *  before the message or the templates they refer to change.
+ */
+static void
+fBufDecodeDeferredLists(
+    fBuf_t  *fbuf)
+{
+    /* decoding a list may defer the lists nested in it */
+    while (fbuf->deferred) {
+        fbListDeferredDecode(fbuf->deferred);
+    }
+}
+
+
+/**
+ * fbTranscodeExecute
+ *
+ *  Runs the compiled operations of `tcplan` to transcode the record at
+ *  `s_base` to `dp`.  `offsets` holds the offsets of the source fields and
+ *  must be non-NULL unless the plan's source offsets are static.  Moves `dp`
+ *  forward and reduces `d_rem` by the number of octets written.
+ */
+static gboolean
+fbTranscodeExecute(
+    fBuf_t                   *fbuf,
+    const fbTranscodePlan_t  *tcplan,
+    uint8_t                  *s_base,
+    const uint16_t           *offsets,
+    uint8_t                 **dp,
+    uint32_t                 *d_rem,
+    GError                  **err)
+{
+    const fbTranscodeOp_t *op;
+    const fbTranscodeOp_t *end;
+    uint8_t               *sp;
+    gboolean               ok = TRUE;
+
+    if (tcplan->d_zero) {
+        FB_TC_DBC(tcplan->d_zero, "zero transcode");
+        memset(*dp, 0, tcplan->d_zero);
+    }
+
+    end = tcplan->ops + tcplan->op_count;
+    for (op = tcplan->ops; ok && op < end; ++op) {
+        sp = s_base + (offsets ? offsets[op->s_idx] : op->s_off);
+        switch (op->type) {
+          case FB_TCOP_COPY:
+            FB_TC_DBC(op->d_len, "copy transcode");
+            memcpy(*dp, sp, op->d_len);
+            *dp += op->d_len; *d_rem -= op->d_len;
+            break;
+#if G_BYTE_ORDER != G_BIG_ENDIAN
+          case FB_TCOP_SWAP:
+            FB_TC_DBC(op->d_len, "swap transcode");
+            fbTranscodeCopySwapValues(*dp, sp, op->s_len, op->count);
+            *dp += op->d_len; *d_rem -= op->d_len;
+            break;
+#endif  /* G_BYTE_ORDER != G_BIG_ENDIAN */
+          case FB_TCOP_ZERO:
+            ok = fbTranscodeZero(dp, d_rem, op->d_len, err);
+            break;
+#if FB_TC_SHUFFLE
+          case FB_TCOP_SHUFFLE:
+            FB_TC_DBC(op->d_len, "shuffle transcode");
+            fbTranscodeShuffle(tcplan, *dp, sp,
+                               &tcplan->shuffles[op->count]);
+            *dp += op->d_len; *d_rem -= op->d_len;
+            break;
+#endif  /* FB_TC_SHUFFLE */
+          case FB_TCOP_SKIP:
+            /* bounds were checked when the record was zeroed */
+            *dp += op->d_len; *d_rem -= op->d_len;
+            break;
+          case FB_TCOP_FIXED:
+            if (tcplan->decode) {
+                ok = fbDecodeFixed(sp, dp, d_rem, op->s_len, op->d_len,
+                                   op->is_endian, op->is_signed, err);
+            } else {
+                ok = fbEncodeFixed(sp, dp, d_rem, op->s_len, op->d_len,
+                                   op->is_endian, op->is_signed, err);
+            }
+            break;
+          case FB_TCOP_DOUBLE:
+            if (tcplan->decode) {
+                ok = fbDecodeDouble(sp, dp, d_rem, op->s_len, op->d_len, err);
+            } else {
+                ok = fbEncodeDouble(sp, dp, d_rem, op->s_len, op->d_len, err);
+            }
+            break;
+          case FB_TCOP_VARFIELD:
+            if (tcplan->decode) {
+                ok = fbDecodeVarfield(sp, dp, d_rem, err);
+            } else {
+                ok = fbEncodeVarfield(sp, dp, d_rem, err);
+            }
+            break;
+          case FB_TCOP_BASICLIST:
+            if (tcplan->decode && fbuf->lazy_lists) {
+                ok = fbDecodeListDeferred(sp, dp, d_rem, fbuf,
+                                          FB_BASIC_LIST, err);
+            } else if (tcplan->decode) {
+                ok = fbDecodeBasicList(fbuf->ext_tmpl->model, sp, dp, d_rem,
+                                       fbuf, err);
+            } else {
+                ok = fbEncodeBasicList(sp, dp, d_rem, fbuf, err);
+            }
+            break;
+          case FB_TCOP_SUBTMPLLIST:
+            if (tcplan->decode && fbuf->lazy_lists) {
+                ok = fbDecodeListDeferred(sp, dp, d_rem, fbuf,
+                                          FB_SUB_TMPL_LIST, err);
+            } else if (tcplan->decode) {
+                ok = fbDecodeSubTemplateList(sp, dp, d_rem, fbuf, err);
+            } else {
+                ok = fbEncodeSubTemplateList(sp, dp, d_rem, fbuf, err);
+            }
+            break;
+          case FB_TCOP_SUBTMPLMULTILIST:
+            if (tcplan->decode && fbuf->lazy_lists) {
+                ok = fbDecodeListDeferred(sp, dp, d_rem, fbuf,
+                                          FB_SUB_TMPL_MULTI_LIST, err);
+            } else if (tcplan->decode) {
+                ok = fbDecodeSubTemplateMultiList(sp, dp, d_rem, fbuf, err);
+            } else {
+                ok = fbEncodeSubTemplateMultiList(sp, dp, d_rem, fbuf, err);
+            }
+            break;
+          case FB_TCOP_MIXED_LENGTH:
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
+                        "Transcoding between fixed and varlen IE "
+                        "is not supported by this version of libfixbuf.");
+            return FALSE;
+          default:
+            g_assert_not_reached();
+        }
+    }
+
+    return ok;
 }
 
 
 /**
- * fbTranscode
+ * fbTranscodeWithPlan
  *
  *
  *
- *  When called, the template information on `fbuf` must be set to those to
- *  use for transcoding.  If `decode` is TRUE, decodes the incoming data in
- *  `s_base` to an internal represenation in `d_base`, otherwise encodes the
- *  internal data in `s_base` to the external represenation in `d_base` for
- *  export.  The caller should set the referents of `s_len` and `d_len` to the
- *  octets of data to process and the available space, respectively.  On
- *  return, the referents are the octets of data read and the amount of space
- *  consumed, respectively.
+ *  Transcodes one record using the transcode plan `tcplan`, which must be
+ *  the plan for the templates currently set on `fbuf`; the plan's `decode`
+ *  member determines the direction.  The caller should set the referents of
+ *  `s_len` and `d_len` to the octets of data in `s_base` to process and the
+ *  available space in `d_base`, respectively.  On return, the referents are
+ *  the octets of data read and the amount of space consumed, respectively.
+ *
+ *  The work is done by running the operations of the plan; see
+ *  fbTranscodePlanCompile().
  *
  */
 static gboolean
-fbTranscode(
-    fBuf_t    *fbuf,
-    gboolean   decode,
-    uint8_t   *s_base,
-    uint8_t   *d_base,
-    size_t    *s_len,
-    size_t    *d_len,
-    GError   **err)
-{
-    fbTranscodePlan_t *tcplan;
-    fbTemplate_t      *s_tmpl, *d_tmpl;
-    ssize_t            s_len_offset;
-    uint16_t          *offsets;
-    uint8_t           *dp;
-    uint32_t           s_off, d_rem, i;
-    fbTemplateField_t *s_ie, *d_ie;
-    gboolean           ok = TRUE;
+fbTranscodeWithPlan(
+    fBuf_t             *fbuf,
+    fbTranscodePlan_t  *tcplan,
+    uint8_t            *s_base,
+    uint8_t            *d_base,
+    size_t             *s_len,
+    size_t             *d_len,
+    GError            **err)
+{
+    gboolean      decode = tcplan->decode;
+    fbTemplate_t *s_tmpl = (decode ? fbuf->ext_tmpl : fbuf->int_tmpl);
+    ssize_t       s_len_offset;
+    uint16_t     *offsets = NULL;
+    uint8_t      *dp;
+    uint32_t      d_rem;
+    gboolean      ok;
 
     /* initialize walk of dest buffer */
     dp = d_base; d_rem = *d_len;
-    /* select templates for transcode */
-    if (decode) {
-        s_tmpl = fbuf->ext_tmpl;
-        d_tmpl = fbuf->int_tmpl;
-    } else {
-        s_tmpl = fbuf->int_tmpl;
-        d_tmpl = fbuf->ext_tmpl;
-    }
 
-    /* get a transcode plan */
-    tcplan = fbTranscodePlan(fbuf, s_tmpl, d_tmpl);
-
-    /* get source record length and offsets */
-    if ((s_len_offset = fbTranscodeOffsets(s_tmpl, s_base, *s_len,
-                                           decode, &offsets, err)) < 0)
-    {
-        return FALSE;
+    /* get source record length and, if they vary, the offsets */
+    if (tcplan->s_static) {
+        if (*s_len < tcplan->s_len) {
+            g_set_error(err, FB_ERROR_DOMAIN, FB_ERROR_EOM,
+                        "End of message. "
+                        "Underrun on transcode offset calculation "
+                        "(need %lu bytes, %lu available)",
+                        (unsigned long)tcplan->s_len, (unsigned long)*s_len);
+            return FALSE;
+        }
+        *s_len = tcplan->s_len;
+    } else {
+        if ((s_len_offset = fbTranscodeOffsets(fbuf, s_tmpl, s_base, *s_len,
+                                               decode, &offsets, err)) < 0)
+        {
+            return FALSE;
+        }
+        *s_len = s_len_offset;
     }
-    *s_len = s_len_offset;
 #if FB_DEBUG_TC && FB_DEBUG_RD && FB_DEBUG_WR
     fBufDebugTranscodePlan(tcplan);
     if (offsets) {fBufDebugTranscodeOffsets(s_tmpl, offsets);}
@@ -2718,191 +4653,11 @@ fbTranscode(
     }
 #endif /* if FB_DEBUG_TC && FB_DEBUG_RD && FB_DEBUG_WR */
 
-    /* iterate over destination IEs, copying from source */
-    if (decode) {
-        for (i = 0; ok && i < d_tmpl->ie_count; i++) {
-            /* Get pointers to information elements and source offset */
-            d_ie = d_tmpl->ie_ary[i];
-            s_ie = ((tcplan->si[i] == FB_TCPLAN_NULL) ?
-                    NULL : s_tmpl->ie_ary[tcplan->si[i]]);
-            s_off = s_ie ? offsets[tcplan->si[i]] : 0;
-            if (s_ie == NULL) {
-                /* Null source */
-                uint32_t null_len;
-                if (d_ie->len != FB_IE_VARLEN) {
-                    null_len = d_ie->len;
-                } else if (d_ie->canon->type == FB_BASIC_LIST) {
-                    null_len = sizeof(fbBasicList_t);
-                } else if (d_ie->canon->type == FB_SUB_TMPL_LIST) {
-                    null_len = sizeof(fbSubTemplateList_t);
-                } else if (d_ie->canon->type == FB_SUB_TMPL_MULTI_LIST) {
-                    null_len = sizeof(fbSubTemplateMultiList_t);
-                } else {
-                    null_len = sizeof(fbVarfield_t);
-                }
-                ok = fbTranscodeZero(&dp, &d_rem, null_len, err);
-            } else {
-                switch (fbTemplateFieldGetType(d_ie)) {
-                  case FB_BOOL:
-                  case FB_UINT_8:
-                  case FB_INT_8:
-                  case FB_IP6_ADDR:
-                  case FB_MAC_ADDR:
-                    ok = fbDecodeFixed(s_base + s_off, &dp, &d_rem,
-                                       s_ie->len, d_ie->len,
-                                       0, 0, err);
-                    break;
-                  case FB_UINT_16:
-                  case FB_UINT_32:
-                  case FB_UINT_64:
-                  case FB_IP4_ADDR:
-                  case FB_DT_SEC:
-                  case FB_DT_MILSEC:
-                  case FB_DT_MICROSEC:
-                  case FB_DT_NANOSEC:
-                  case FB_FLOAT_32:
-                    ok = fbDecodeFixed(s_base + s_off, &dp, &d_rem,
-                                       s_ie->len, d_ie->len,
-                                       1, 0, err);
-                    break;
-                  case FB_INT_16:
-                  case FB_INT_32:
-                  case FB_INT_64:
-                    ok = fbDecodeFixed(s_base + s_off, &dp, &d_rem,
-                                       s_ie->len, d_ie->len,
-                                       1, 1, err);
-                    break;
-                  case FB_FLOAT_64:
-                    ok = fbDecodeDouble(s_base + s_off, &dp, &d_rem,
-                                        s_ie->len, d_ie->len, err);
-                    break;
-                  case FB_STRING:
-                  case FB_OCTET_ARRAY:
-                    if ((FB_IE_VARLEN == s_ie->len) ^
-                        (FB_IE_VARLEN == d_ie->len))
-                    {
-                        g_set_error(
-                            err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
-                            "Transcoding between fixed and varlen IE "
-                            "is not supported by this version of libfixbuf.");
-                        ok = FALSE;
-                        goto end;
-                    }
-                    if (FB_IE_VARLEN == s_ie->len) {
-                        ok = fbDecodeVarfield(s_base + s_off, &dp,
-                                              &d_rem, err);
-                    } else {
-                        ok = fbDecodeFixed(s_base + s_off, &dp, &d_rem,
-                                           s_ie->len, d_ie->len,
-                                           0, 0, err);
-                    }
-                    break;
-                  case FB_BASIC_LIST:
-                    ok = fbDecodeBasicList(fbuf->ext_tmpl->model,
-                                           s_base + s_off,
-                                           &dp, &d_rem, fbuf,
-                                           err);
-                    break;
-                  case FB_SUB_TMPL_LIST:
-                    ok = fbDecodeSubTemplateList(s_base + s_off,
-                                                 &dp, &d_rem, fbuf, err);
-                    break;
-                  case FB_SUB_TMPL_MULTI_LIST:
-                    ok = fbDecodeSubTemplateMultiList(s_base + s_off,
-                                                      &dp, &d_rem, fbuf, err);
-                    break;
-                }
-            }
-        }
-    } else {
-        /* decode == FALSE */
-        for (i = 0; ok && i < d_tmpl->ie_count; i++) {
-            /* Get pointers to information elements and source offset */
-            d_ie = d_tmpl->ie_ary[i];
-            s_ie = ((tcplan->si[i] == FB_TCPLAN_NULL) ?
-                    NULL : s_tmpl->ie_ary[tcplan->si[i]]);
-            s_off = s_ie ? offsets[tcplan->si[i]] : 0;
-            if (s_ie == NULL) {
-                /* Null source */
-                uint32_t null_len;
-                if (d_ie->len == FB_IE_VARLEN) {
-                    null_len = 1;
-                } else {
-                    null_len = d_ie->len;
-                }
-                ok = fbTranscodeZero(&dp, &d_rem, null_len, err);
-            } else {
-                switch (fbTemplateFieldGetType(d_ie)) {
-                  case FB_BOOL:
-                  case FB_UINT_8:
-                  case FB_INT_8:
-                  case FB_IP6_ADDR:
-                  case FB_MAC_ADDR:
-                    ok = fbEncodeFixed(s_base + s_off, &dp, &d_rem,
-                                       s_ie->len, d_ie->len,
-                                       0, 0, err);
-                    break;
-                  case FB_UINT_16:
-                  case FB_UINT_32:
-                  case FB_UINT_64:
-                  case FB_IP4_ADDR:
-                  case FB_DT_SEC:
-                  case FB_DT_MILSEC:
-                  case FB_DT_MICROSEC:
-                  case FB_DT_NANOSEC:
-                  case FB_FLOAT_32:
-                    ok = fbEncodeFixed(s_base + s_off, &dp, &d_rem,
-                                       s_ie->len, d_ie->len,
-                                       1, 0, err);
-                    break;
-                  case FB_INT_16:
-                  case FB_INT_32:
-                  case FB_INT_64:
-                    ok = fbEncodeFixed(s_base + s_off, &dp, &d_rem,
-                                       s_ie->len, d_ie->len,
-                                       1, 1, err);
-                    break;
-                  case FB_FLOAT_64:
-                    ok = fbEncodeDouble(s_base + s_off, &dp, &d_rem,
-                                        s_ie->len, d_ie->len, err);
-                    break;
-                  case FB_STRING:
-                  case FB_OCTET_ARRAY:
-                    if ((FB_IE_VARLEN == s_ie->len) ^
-                        (FB_IE_VARLEN == d_ie->len))
-                    {
-                        g_set_error(
-                            err, FB_ERROR_DOMAIN, FB_ERROR_IMPL,
-                            "Transcoding between fixed and varlen IE "
-                            "not supported by this version of libfixbuf.");
-                        ok = FALSE;
-                        goto end;
-                    }
-                    if (FB_IE_VARLEN == s_ie->len) {
-                        ok = fbEncodeVarfield(s_base + s_off, &dp,
-                                              &d_rem, err);
-                    } else {
-                        ok = fbEncodeFixed(s_base + s_off, &dp, &d_rem,
-                                           s_ie->len, d_ie->len,
-                                           0, 0, err);
-                    }
-                    break;
-                  case FB_BASIC_LIST:
-                    ok = fbEncodeBasicList(s_base + s_off, &dp,
-                                           &d_rem, fbuf, err);
-                    break;
-                  case FB_SUB_TMPL_LIST:
-                    ok = fbEncodeSubTemplateList(s_base + s_off, &dp,
-                                                 &d_rem, fbuf, err);
-                    break;
-                  case FB_SUB_TMPL_MULTI_LIST:
-                    ok = fbEncodeSubTemplateMultiList(s_base + s_off, &dp,
-                                                      &d_rem, fbuf, err);
-                    break;
-                }
-            }
-        }
-    }
+    /* keep the plan in the cache while the sub-records of any lists are
+     * transcoded */
+    ++tcplan->in_use;
+    ok = fbTranscodeExecute(fbuf, tcplan, s_base, offsets, &dp, &d_rem, err);
+    --tcplan->in_use;
     if (!ok) {
         goto end;
     }
@@ -2919,10 +4674,52 @@ fbTranscode(
 #endif /* if FB_DEBUG_TC && FB_DEBUG_RD && FB_DEBUG_WR */
     /* All done */
   end:
-    fbTranscodeFreeVarlenOffsets(s_tmpl, offsets);
+    if (offsets) {
+        fbTranscodeFreeVarlenOffsets(fbuf, s_tmpl, offsets);
+    }
     return ok;
 }
 
+
+/**
+ * fbTranscode
+ *
+ *
+ *
+ *  When called, the template information on `fbuf` must be set to those to
+ *  use for transcoding.  If `decode` is TRUE, decodes the incoming data in
+ *  `s_base` to an internal represenation in `d_base`, otherwise encodes the
+ *  internal data in `s_base` to the external represenation in `d_base` for
+ *  export.  The caller should set the referents of `s_len` and `d_len` to the
+ *  octets of data to process and the available space, respectively.  On
+ *  return, the referents are the octets of data read and the amount of space
+ *  consumed, respectively.
+ *
+ *  Finds the cached transcode plan for the template pair and calls
+ *  fbTranscodeWithPlan().
+ *
+ */
+static gboolean
+fbTranscode(
+    fBuf_t    *fbuf,
+    gboolean   decode,
+    uint8_t   *s_base,
+    uint8_t   *d_base,
+    size_t    *s_len,
+    size_t    *d_len,
+    GError   **err)
+{
+    fbTranscodePlan_t *tcplan;
+
+    if (decode) {
+        tcplan = fbTranscodePlan(fbuf, fbuf->ext_tmpl, fbuf->int_tmpl, TRUE);
+    } else {
+        tcplan = fbTranscodePlan(fbuf, fbuf->int_tmpl, fbuf->ext_tmpl, FALSE);
+    }
+    return fbTranscodeWithPlan(fbuf, tcplan, s_base, d_base,
+                               s_len, d_len, err);
+}
+
 /*==================================================================
  *
  * Common Buffer Management Functions
@@ -2956,8 +4753,12 @@ fBufRewind(
     fbuf->setbase = NULL;
     fbuf->sep = NULL;
 
-    /* No records in buffer either */
+    /* No records in buffer either; count those of the finished message */
+    fbuf->stats.records += fbuf->rc;
     fbuf->rc = 0;
+
+    /* Decode the deferred lists before their message goes away */
+    fBufDecodeDeferredLists(fbuf);
 }
 
 
@@ -3129,6 +4930,127 @@ fBufGetSession(
 }
 
 
+/**
+ * fBufSetTranscodePlanCacheSize
+ *
+ *
+ *
+ *
+ *
+ */
+void
+fBufSetTranscodePlanCacheSize(
+    fBuf_t        *fbuf,
+    unsigned int   capacity)
+{
+    fbuf->tcplan_capacity = capacity;
+    if (capacity) {
+        fBufTrimTcplanCache(fbuf, capacity);
+    }
+}
+
+
+/**
+ * fBufGetTranscodePlanCacheStats
+ *
+ *
+ *
+ *
+ *
+ */
+void
+fBufGetTranscodePlanCacheStats(
+    const fBuf_t  *fbuf,
+    uint64_t      *hits,
+    uint64_t      *misses)
+{
+    if (hits) {
+        *hits = fbuf->tcplan_hits;
+    }
+    if (misses) {
+        *misses = fbuf->tcplan_misses;
+    }
+}
+
+
+/**
+ * fBufGetStats
+ *
+ *
+ *
+ *
+ *
+ */
+void
+fBufGetStats(
+    const fBuf_t  *fbuf,
+    fbStats_t     *stats)
+{
+    *stats = fbuf->stats;
+    /* include the records of the current message */
+    stats->records += fbuf->rc;
+    stats->plan_hits = fbuf->tcplan_hits;
+    stats->plan_misses = fbuf->tcplan_misses;
+}
+
+
+/**
+ * fBufSetMessageCallback
+ *
+ *
+ *
+ *
+ *
+ */
+void
+fBufSetMessageCallback(
+    fBuf_t                  *fbuf,
+    fBufMessageCallback_fn   callback,
+    void                    *app_ctx)
+{
+    fbuf->msg_callback = callback;
+    fbuf->msg_callback_ctx = app_ctx;
+}
+
+
+/**
+ * fBufSetListArena
+ *
+ *
+ *
+ *
+ *
+ */
+void
+fBufSetListArena(
+    fBuf_t             *fbuf,
+    fbListArenaMode_t   mode)
+{
+    fbuf->list_arena_mode = mode;
+    if (FB_LIST_ARENA_NONE == mode) {
+        fBufListArenaDropDeferred(fbuf);
+        fbListArenaFree(&fbuf->list_arena);
+    }
+}
+
+
+/**
+ * fBufSetLazyLists
+ *
+ *
+ *
+ *
+ *
+ */
+void
+fBufSetLazyLists(
+    fBuf_t    *fbuf,
+    gboolean   lazy)
+{
+    fbuf->lazy_lists = lazy;
+}
+
+
 /**
  * fBufFree
  *
@@ -3147,17 +5069,28 @@ fBufFree(
         return;
     }
 
+    /* the application owns the deferred lists; decode those not in the
+     * arena while the message and templates are still available */
+    fBufListArenaDropDeferred(fbuf);
+    fBufDecodeDeferredLists(fbuf);
+
     /* free the tcplans */
     while (fbuf->latestTcplan) {
         entry = fbuf->latestTcplan;
 
-        detachHeadOfDLL((fbDLL_t **)(void *)&(fbuf->latestTcplan), NULL,
+        detachHeadOfDLL((fbDLL_t **)(void *)&(fbuf->latestTcplan),
+                        (fbDLL_t **)(void *)&(fbuf->oldestTcplan),
                         (fbDLL_t **)(void *)&entry);
-        g_free(entry->tcplan->si);
-
-        g_slice_free(fbTranscodePlan_t, entry->tcplan);
+        fbTranscodePlanFree(entry->tcplan);
         g_slice_free(fbTCPlanEntry_t, entry);
     }
+    if (fbuf->tcplan_table) {
+        g_hash_table_destroy(fbuf->tcplan_table);
+        fbuf->tcplan_table = NULL;
+    }
+    g_free(fbuf->view_offsets);
+    g_free(fbuf->off_stack);
+    fbListArenaFree(&fbuf->list_arena);
     if (fbuf->exporter) {
         fbExporterFree(fbuf->exporter);
     }
@@ -3266,6 +5199,7 @@ fBufAppendSetHeader(
 
     /* set set base pointer to show we have an active set */
     fbuf->setbase = fbuf->cp;
+    ++fbuf->stats.sets;
 
     /* add set ID to buffer */
     FB_APPEND_U16(set_id);
@@ -3465,40 +5399,18 @@ fBufRemoveTemplateTcplan(
     const fbTemplate_t  *tmpl)
 {
     fbTCPlanEntry_t *entry;
-    fbTCPlanEntry_t *otherEntry;
+    fbTCPlanEntry_t *nextEntry;
 
     if (!fbuf || !tmpl) {
         return;
     }
 
-    entry = fbuf->latestTcplan;
-
-    while (entry) {
+    for (entry = fbuf->latestTcplan; entry != NULL; entry = nextEntry) {
+        nextEntry = entry->next;
         if (entry->tcplan->s_tmpl == tmpl ||
             entry->tcplan->d_tmpl == tmpl)
         {
-            if (entry == fbuf->latestTcplan) {
-                otherEntry = NULL;
-            } else {
-                otherEntry = entry->next;
-            }
-
-            detachThisEntryOfDLL((fbDLL_t **)(void *)(&(fbuf->latestTcplan)),
-                                 NULL,
-                                 (fbDLL_t *)entry);
-
-            g_free(entry->tcplan->si);
-
-            g_slice_free(fbTranscodePlan_t, entry->tcplan);
-            g_slice_free(fbTCPlanEntry_t, entry);
-
-            if (otherEntry) {
-                entry = otherEntry;
-            } else {
-                entry = fbuf->latestTcplan;
-            }
-        } else {
-            entry = entry->next;
+            fBufRemoveTcplanEntry(fbuf, entry);
         }
     }
 }
@@ -3594,6 +5506,12 @@ fBufAppendTemplateSingle(
         }
     }
 
+    if (revoked) {
+        ++fbuf->stats.templates_withdrawn;
+    } else {
+        ++fbuf->stats.templates_added;
+    }
+
 #if FB_DEBUG_TMPL
     fbTemplateDebug("apd", tmpl_id, tmpl);
 #endif
@@ -3750,11 +5668,92 @@ fBufAppend(
     /* Retryable. Clear error. */
     g_clear_error(&child_err);
 
-    /* Emit message */
-    if (!fBufEmit(fbuf, err)) {return FALSE;}
+    /* Emit message */
+    if (!fBufEmit(fbuf, err)) {return FALSE;}
+
+    /* Retry single append */
+    return fBufAppendSingle(fbuf, recbase, recsize, err);
+}
+
+
+/**
+ * fBufAppendBatch
+ *
+ *
+ *
+ *
+ *
+ */
+gboolean
+fBufAppendBatch(
+    fBuf_t   *fbuf,
+    uint8_t  *recs,
+    size_t    recsize,
+    size_t    count,
+    GError  **err)
+{
+    fbTranscodePlan_t *tcplan;
+    uint8_t           *recbase;
+    size_t             s_len;
+    size_t             bufsize;
+    size_t             i;
+    GError            *child_err = NULL;
+    gboolean           ok = TRUE;
+
+    g_assert(recs);
+
+    if (0 == count) {
+        return TRUE;
+    }
+
+    /* Append the first record normally; this starts the message and set
+     * and checks for an active template export */
+    if (!fBufAppend(fbuf, recs, recsize, err)) {
+        return FALSE;
+    }
+
+    /* The remaining records use the same templates, so the plan only needs
+     * to be found once; the current set stays open until the message is
+     * full */
+    tcplan = fbTranscodePlan(fbuf, fbuf->int_tmpl, fbuf->ext_tmpl, FALSE);
+    ++tcplan->in_use;
+
+    for (i = 1, recbase = recs + recsize; i < count; ++i, recbase += recsize) {
+        s_len = recsize;
+        bufsize = FB_REM_MSG(fbuf);
+        if (fbTranscodeWithPlan(fbuf, tcplan, recbase, fbuf->cp,
+                                &s_len, &bufsize, &child_err))
+        {
+            /* Move current pointer forward by number of bytes written */
+            fbuf->cp += bufsize;
+            ++(fbuf->rc);
+#if FB_DEBUG_WR
+            fBufDebugBuffer("arec", fbuf, bufsize, TRUE);
+#endif
+            continue;
+        }
+
+        /* Fail if not EOM or not automatic */
+        if (!g_error_matches(child_err, FB_ERROR_DOMAIN, FB_ERROR_EOM) ||
+            !fbuf->auto_next_msg)
+        {
+            g_propagate_error(err, child_err);
+            ok = FALSE;
+            break;
+        }
+        g_clear_error(&child_err);
+
+        /* Emit the full message and append the record to a new one */
+        if (!fBufEmit(fbuf, err) ||
+            !fBufAppendSingle(fbuf, recbase, recsize, err))
+        {
+            ok = FALSE;
+            break;
+        }
+    }
 
-    /* Retry single append */
-    return fBufAppendSingle(fbuf, recbase, recsize, err);
+    --tcplan->in_use;
+    return ok;
 }
 
 
@@ -3805,6 +5804,12 @@ fBufEmit(
     {
         return FALSE;
     }
+    ++fbuf->stats.messages;
+    fbuf->stats.message_octets += fbuf->cp - fbuf->msgbase;
+    if (fbuf->msg_callback) {
+        fbuf->msg_callback(fbuf, fbuf->msgbase, fbuf->cp - fbuf->msgbase,
+                           TRUE, fbuf->msg_callback_ctx);
+    }
 
     /* Increment next record sequence number */
     fbSessionSetSequence(fbuf->session, fbSessionGetSequence(fbuf->session) +
@@ -3813,6 +5818,26 @@ fBufEmit(
     /* Rewind message */
     fBufRewind(fbuf);
 
+    /* Start the next file of a rotating file exporter; templates are
+     * exported again so that each file stands alone.  They are emitted in
+     * a message of their own and the template set is closed, so the next
+     * append starts a data message instead of failing with EOM. */
+    if (!fbuf->rotating && fbExporterRotateDue(fbuf->exporter)) {
+        gboolean ok;
+
+        if (!fbExporterRotate(fbuf->exporter, err)) {
+            return FALSE;
+        }
+        fbuf->rotating = TRUE;
+        ok = (fbSessionExportTemplates(fbuf->session, err) &&
+              fBufEmit(fbuf, err));
+        fbuf->rotating = FALSE;
+        fbuf->spec_tid = 0;
+        if (!ok) {
+            return FALSE;
+        }
+    }
+
     /* All done */
     return TRUE;
 }
@@ -3853,6 +5878,9 @@ fBufSetExporter(
 {
     g_assert(exporter);
 
+    /* Decode the deferred lists while their message is available */
+    fBufDecodeDeferredLists(fbuf);
+
     if (fbuf->collector) {
         fbCollectorFree(fbuf->collector);
         fbuf->collector = NULL;
@@ -3960,13 +5988,28 @@ fBufNextMessage(
     fbuf->ext_tid = 0;
     fbuf->ext_tmpl = NULL;
 
+    /* Release the lists decoded from the previous message */
+    if (FB_LIST_ARENA_MESSAGE == fbuf->list_arena_mode) {
+        fBufListArenaDropDeferred(fbuf);
+        fbListArenaReset(&fbuf->list_arena);
+    }
+
     /* Rewind the buffer before reading a new message */
     fBufRewind(fbuf);
 
     /* Read next message from the collector */
     if (fbuf->collector) {
         msglen = sizeof(fbuf->buf);
-        if (!fbCollectMessage(fbuf->collector, fbuf->buf, &msglen, err)) {
+        if (fbCollectorIsMapped(fbuf->collector)) {
+            /* decode straight out of the file mapping */
+            if (!fbCollectMessageInPlace(fbuf->collector, &fbuf->cp,
+                                         &msglen, err))
+            {
+                return FALSE;
+            }
+        } else if (!fbCollectMessage(fbuf->collector, fbuf->buf,
+                                     &msglen, err))
+        {
             return FALSE;
         }
     } else {
@@ -3987,7 +6030,7 @@ fBufNextMessage(
     fbuf->mep = fbuf->cp + msglen;
 
 #if FB_DEBUG_RD
-    fBufDebugHex("read", fbuf->buf, msglen);
+    fBufDebugHex("read", fbuf->cp, msglen);
 #endif
 #if FB_DEBUG_LWR
     fprintf(stderr, "read %lu (%04lx)\n", msglen, msglen);
@@ -4059,6 +6102,13 @@ fBufNextMessage(
      */
     fbuf->msgbase = fbuf->cp - 16;
 
+    ++fbuf->stats.messages;
+    fbuf->stats.message_octets += msglen;
+    if (fbuf->msg_callback) {
+        fbuf->msg_callback(fbuf, fbuf->msgbase, msglen, FALSE,
+                           fbuf->msg_callback_ctx);
+    }
+
     return TRUE;
 }
 
@@ -4131,6 +6181,7 @@ fBufNextSetHeader(
 
         /* Verify set body fits in the message */
         FB_CHECK_AVAIL("checking set length", setlen - 4);
+        ++fbuf->stats.sets;
         /* Set up special set ID or external templates  */
         if (set_id < FB_TID_MIN_DATA) {
             if (!(FB_TID_TS == set_id || FB_TID_OTS == set_id)) {
@@ -4156,6 +6207,7 @@ fBufNextSetHeader(
                     /* Merely warn and skip on missing templates */
                     g_warning("Skipping set: %s", child_err->message);
                     g_clear_error(&child_err);
+                    ++fbuf->stats.skipped;
                     fbuf->setbase = fbuf->cp - 4;
                     fbuf->sep = fbuf->setbase + setlen;
                     fBufSkipCurrentSet(fbuf);
@@ -4195,6 +6247,11 @@ fBufConsumeTemplateSet(
     fbTemplate_t   *tmpl = NULL;
     fbInfoElement_t ex_ie = FB_IE_NULL;
     GError         *child_err = NULL;
+    gboolean        interned;
+    gboolean        withdrawal;
+
+    /* Deferred lists must be decoded with the templates they were read with */
+    fBufDecodeDeferredLists(fbuf);
 
     /* Keep reading until the set contains only padding. */
     while (FB_REM_SET(fbuf) >= 4) {
@@ -4203,6 +6260,7 @@ fBufConsumeTemplateSet(
         FB_NEXT_U16(ie_count);
 
         /* FIXME: Add withdrawal template handling here */
+        withdrawal = (0 == ie_count);
 
         /* check for necessary length assuming no scope or enterprise
          * numbers */
@@ -4269,6 +6327,7 @@ fBufConsumeTemplateSet(
         }
         if (!tmpl) {
             /* rejected template, but may continue reading set */
+            ++fbuf->stats.skipped;
             continue;
         }
 
@@ -4277,12 +6336,32 @@ fBufConsumeTemplateSet(
             fbTemplateSetOptionsScope(tmpl, scope_count);
         }
 
+        /* Share an identical template already read by any session.  Not
+         * done when the callback may attach a context to the template. */
+        interned = (fbSessionGetInternTemplates(fbuf->session) &&
+                    !fbSessionGetNewTemplateCallback(fbuf->session));
+        if (interned) {
+            tmpl = fbTemplateIntern(tmpl);
+        }
+
         if (!fbSessionAddTemplate(fbuf->session, FALSE, tid, tmpl, NULL, err)) {
+            if (interned) {
+                fbTemplateRelease(tmpl);
+            }
             return FALSE;
         }
 
-        /* Invoke the received-new-template callback */
-        if (fbSessionGetNewTemplateCallback(fbuf->session)) {
+        if (withdrawal) {
+            ++fbuf->stats.templates_withdrawn;
+        } else {
+            ++fbuf->stats.templates_added;
+        }
+
+        if (interned) {
+            /* the session holds the template now */
+            fbTemplateRelease(tmpl);
+        } else if (fbSessionGetNewTemplateCallback(fbuf->session)) {
+            /* Invoke the received-new-template callback */
             g_assert(tmpl->app_ctx == NULL);
             (fbSessionGetNewTemplateCallback(fbuf->session))(
                 fbuf->session, tid, tmpl,
@@ -4320,6 +6399,7 @@ fBufConsumeTemplateSet(
     g_warning("End of set reading template record %#06x "
               "(need %u bytes, %ld available)",
               tid, required, FB_REM_SET(fbuf));
+    ++fbuf->stats.skipped;
     if (tmpl) { fbTemplateFreeUnused(tmpl); }
     fBufSkipCurrentSet(fbuf);
     fbuf->spec_tid = 0;
@@ -4393,6 +6473,7 @@ fBufConsumeTemplateInfoSet(
     uint16_t tid       = fbuf->int_tid;
     size_t   bufsize;
     GError  *child_err = NULL;
+    gboolean lazy_lists = fbuf->lazy_lists;
 
     fbuf->int_tmpl = fbSessionGetInternalTemplateInfoTemplate(
         fbuf->session, &fbuf->int_tid, err);
@@ -4407,8 +6488,10 @@ fBufConsumeTemplateInfoSet(
     fbTemplateInfoRecordInit(&mdRec);
 
     /* Disable template-pairs so the STL used by fbBasicListInfo_t is
-     * transcoded using the external template. */
+     * transcoded using the external template, which requires that the STL
+     * is decoded now and not deferred. */
     fbSessionSetTemplatePairsDisabled(fbuf->session, TRUE);
+    fbuf->lazy_lists = FALSE;
 
     /* Keep reading until the set contains only padding. */
     while ((bufsize = FB_REM_SET(fbuf)) >= fbuf->ext_tmpl->ie_len) {
@@ -4417,6 +6500,7 @@ fBufConsumeTemplateInfoSet(
                          &bufsize, &len, err))
         {
             fbSessionSetTemplatePairsDisabled(fbuf->session, FALSE);
+            fbuf->lazy_lists = lazy_lists;
             return FALSE;
         }
 
@@ -4441,6 +6525,7 @@ fBufConsumeTemplateInfoSet(
 
     /* Re-enable the template pairs. */
     fbSessionSetTemplatePairsDisabled(fbuf->session, FALSE);
+    fbuf->lazy_lists = lazy_lists;
 
     /*printf("read %d TMD records\n", fbuf->rc);*/
     if (!tid || !fBufSetInternalTemplate(fbuf, tid, NULL)) {
@@ -4720,6 +6805,12 @@ fBufNext(
     g_assert(recbase);
     g_assert(recsize);
 
+    /* Release the lists decoded by the previous call */
+    if (FB_LIST_ARENA_RECORD == fbuf->list_arena_mode) {
+        fBufListArenaDropDeferred(fbuf);
+        fbListArenaReset(&fbuf->list_arena);
+    }
+
     for (;; ) {
         /* Attempt single record read */
         if (fBufNextSingle(fbuf, recbase, recsize, &child_err)) {return TRUE;}
@@ -4746,6 +6837,180 @@ fBufNext(
 }
 
 
+/**
+ * fBufNextBatch
+ *
+ *
+ *
+ *
+ *
+ */
+gboolean
+fBufNextBatch(
+    fBuf_t   *fbuf,
+    uint8_t  *recs,
+    size_t    recsize,
+    size_t    max,
+    size_t   *count,
+    GError  **err)
+{
+    fbTranscodePlan_t *tcplan;
+    uint8_t           *recbase;
+    size_t             bufsize;
+    size_t             d_len;
+
+    g_assert(recs);
+    g_assert(count);
+
+    *count = 0;
+    if (0 == max) {
+        return TRUE;
+    }
+
+    /* Read the first record normally; this reads a new message or set
+     * header as needed and handles the end of a message */
+    d_len = recsize;
+    if (!fBufNext(fbuf, recs, &d_len, err)) {
+        return FALSE;
+    }
+    *count = 1;
+
+    /* The remaining records of the current set use the same templates, so
+     * the plan only needs to be found once */
+    tcplan = fbTranscodePlan(fbuf, fbuf->ext_tmpl, fbuf->int_tmpl, TRUE);
+    ++tcplan->in_use;
+
+    recbase = recs + recsize;
+    while (*count < max && FB_REM_SET(fbuf) >= fbuf->ext_tmpl->ie_len) {
+        bufsize = FB_REM_SET(fbuf);
+        d_len = recsize;
+        /* Stop the batch on error; the next read of the buffer will
+         * encounter the error again and report it.  The record is not
+         * returned, so free any lists decoded before the error. */
+        if (!fbTranscodeWithPlan(fbuf, tcplan, fbuf->cp, recbase,
+                                 &bufsize, &d_len, NULL))
+        {
+            fBufListFree(fbuf->int_tmpl, recbase);
+            break;
+        }
+        fbuf->cp += bufsize;
+        ++(fbuf->rc);
+#if FB_DEBUG_RD
+        fBufDebugBuffer("rrec", fbuf, bufsize, TRUE);
+#endif
+        recbase += recsize;
+        ++(*count);
+    }
+
+    --tcplan->in_use;
+    return TRUE;
+}
+
+
+/**
+ * fBufNextViewSingle
+ *
+ *
+ *
+ *
+ *
+ */
+static gboolean
+fBufNextViewSingle(
+    fBuf_t          *fbuf,
+    fbRecordView_t  *view,
+    GError         **err)
+{
+    fbTemplate_t *tmpl;
+    uint16_t     *offsets;
+    ssize_t       reclen;
+
+    /* Read the message and set headers and skip to the next data record */
+    if (!fBufNextCollectionTemplateSingle(fbuf, NULL, err)) {
+        return FALSE;
+    }
+    tmpl = fbuf->ext_tmpl;
+
+    /* Find the fields.  The offsets of a fixed-length template are cached
+     * on the template; otherwise use the buffer's scratch array. */
+    if (!tmpl->is_varlen) {
+        reclen = fbTranscodeOffsets(fbuf, tmpl, fbuf->cp, FB_REM_SET(fbuf),
+                                    TRUE, &offsets, err);
+    } else {
+        if (fbuf->view_offsets_count < (uint32_t)tmpl->ie_count + 1) {
+            g_free(fbuf->view_offsets);
+            fbuf->view_offsets_count = (uint32_t)tmpl->ie_count + 1;
+            fbuf->view_offsets = g_new(uint16_t, fbuf->view_offsets_count);
+        }
+        offsets = fbuf->view_offsets;
+        reclen = fbTranscodeFillOffsets(tmpl, fbuf->cp, FB_REM_SET(fbuf),
+                                        TRUE, offsets, err);
+    }
+    if (reclen < 0) {
+        return FALSE;
+    }
+
+    view->tmpl = tmpl;
+    view->data = fbuf->cp;
+    view->datalen = reclen;
+    view->offsets = offsets;
+    view->tid = fbuf->ext_tid;
+
+    /* Advance current record pointer by bytes read */
+    fbuf->cp += reclen;
+    /* Increment record count */
+    ++(fbuf->rc);
+#if FB_DEBUG_RD
+    fBufDebugBuffer("rrec", fbuf, reclen, TRUE);
+#endif
+    return TRUE;
+}
+
+
+/**
+ * fBufNextView
+ *
+ *
+ *
+ *
+ *
+ */
+gboolean
+fBufNextView(
+    fBuf_t          *fbuf,
+    fbRecordView_t  *view,
+    GError         **err)
+{
+    GError *child_err = NULL;
+
+    g_assert(view);
+
+    for (;; ) {
+        /* Attempt single record read */
+        if (fBufNextViewSingle(fbuf, view, &child_err)) {return TRUE;}
+        /* Finish the message at EOM */
+        if (g_error_matches(child_err, FB_ERROR_DOMAIN, FB_ERROR_EOM)) {
+            /* Store next expected sequence number */
+            fbSessionSetSequence(fbuf->session,
+                                 fbSessionGetSequence(fbuf->session) +
+                                 fbuf->rc);
+            /* Rewind buffer to force next record read
+             * to consume a new message. */
+            fBufRewind(fbuf);
+            /* Clear error and try again in automatic mode */
+            if (fbuf->auto_next_msg) {
+                g_clear_error(&child_err);
+                continue;
+            }
+        }
+
+        /* Error. Not EOM or not retryable. Fail. */
+        g_propagate_error(err, child_err);
+        return FALSE;
+    }
+}
+
+
 /*
  * fBufNextRecord
  *
@@ -4796,6 +7061,9 @@ fBufSetBuffer(
     fbuf->collector = NULL;
     fbuf->exporter = NULL;
 
+    /* Decode the deferred lists before their message goes away */
+    fBufDecodeDeferredLists(fbuf);
+
     fbuf->cp = buf;
     fbuf->mep = fbuf->cp;
     fbuf->buflen = buflen;
@@ -4830,6 +7098,9 @@ fBufSetCollector(
     fBuf_t         *fbuf,
     fbCollector_t  *collector)
 {
+    /* Decode the deferred lists while their message is available */
+    fBufDecodeDeferredLists(fbuf);
+
     if (fbuf->exporter) {
         fbSessionSetTemplateBuffer(fbuf->session, NULL);
         fbExporterFree(fbuf->exporter);
@@ -4891,6 +7162,8 @@ fBufSetSession(
     fBuf_t       *fbuf,
     fbSession_t  *session)
 {
+    /* Deferred lists must be decoded with the templates they were read with */
+    fBufDecodeDeferredLists(fbuf);
     fbuf->session = session;
 }
 
@@ -4945,6 +7218,7 @@ fbBasicListAllocData(
     basicList->numElements = numElements;
     basicList->dataLength = numElements * fbSizeofIE(&basicList->field);
     basicList->dataPtr = g_slice_alloc0(basicList->dataLength);
+    basicList->fromArena = 0;
     return (void *)basicList->dataPtr;
 }
 
@@ -4993,13 +7267,18 @@ fbBasicListCollectorInit(
     basicList->numElements = 0;
     basicList->dataLength = 0;
     basicList->dataPtr = NULL;
+    basicList->fromArena = 0;
 }
 
 void
 fbBasicListClear(
     fbBasicList_t  *basicList)
 {
-    g_slice_free1(basicList->dataLength, basicList->dataPtr);
+    if (FB_LIST_DEFERRED == basicList->fromArena) {
+        fbListDeferredFree((fbListDeferred_t *)(void *)basicList->dataPtr);
+    } else if (!basicList->fromArena) {
+        g_slice_free1(basicList->dataLength, basicList->dataPtr);
+    }
     fbBasicListCollectorInit(basicList);
 }
 
@@ -5007,6 +7286,11 @@ void
 fbBasicListClearWithoutFree(
     fbBasicList_t  *basicList)
 {
+    /* the storage of a deferred list belongs to fixbuf */
+    if (FB_LIST_DEFERRED == basicList->fromArena) {
+        fbBasicListClear(basicList);
+        return;
+    }
     memset(&basicList->field, 0, sizeof(basicList->field));
     basicList->semantic = 0;
     basicList->numElements = 0;
@@ -5026,6 +7310,7 @@ uint16_t
 fbBasicListCountElements(
     const fbBasicList_t  *basicList)
 {
+    FB_LIST_RESOLVE(basicList, dataPtr, bl);
     return basicList->numElements;
 }
 
@@ -5040,6 +7325,7 @@ uint16_t
 fbBasicListGetElementLength(
     const fbBasicList_t  *basicList)
 {
+    FB_LIST_RESOLVE(basicList, dataPtr, bl);
     return basicList->field.len;
 }
 
@@ -5047,6 +7333,7 @@ const fbInfoElement_t *
 fbBasicListGetInfoElement(
     const fbBasicList_t  *basicList)
 {
+    FB_LIST_RESOLVE(basicList, dataPtr, bl);
     return basicList->field.canon;
 }
 
@@ -5055,6 +7342,7 @@ fbBasicListGetElementIdent(
     const fbBasicList_t  *basicList,
     uint32_t             *pen)
 {
+    FB_LIST_RESOLVE(basicList, dataPtr, bl);
     if (pen) {
         *pen = basicList->field.canon->ent;
     }
@@ -5065,6 +7353,7 @@ const fbTemplateField_t *
 fbBasicListGetTemplateField(
     const fbBasicList_t  *basicList)
 {
+    FB_LIST_RESOLVE(basicList, dataPtr, bl);
     return &basicList->field;
 }
 
@@ -5072,6 +7361,7 @@ void *
 fbBasicListGetDataPtr(
     const fbBasicList_t  *basicList)
 {
+    FB_LIST_RESOLVE(basicList, dataPtr, bl);
     return (void *)basicList->dataPtr;
 }
 
@@ -5080,6 +7370,7 @@ fbBasicListGetIndexedDataPtr(
     const fbBasicList_t  *basicList,
     uint16_t              bl_index)
 {
+    FB_LIST_RESOLVE(basicList, dataPtr, bl);
     if (bl_index >= basicList->numElements) {
         return NULL;
     }
@@ -5094,7 +7385,11 @@ fbBasicListGetIndexedRecordValue(
 {
     const uint8_t *item;
 
-    if (NULL == basicList || index >= basicList->numElements) {
+    if (NULL == basicList) {
+        return FALSE;
+    }
+    FB_LIST_RESOLVE(basicList, dataPtr, bl);
+    if (index >= basicList->numElements) {
         return FALSE;
     }
     item = basicList->dataPtr + (index * fbSizeofIE(&basicList->field));
@@ -5110,6 +7405,7 @@ fbBasicListGetNextPtr(
     uint16_t ie_len;
     uint8_t *currentPtr = (uint8_t *)curPtr;
 
+    FB_LIST_RESOLVE(basicList, dataPtr, bl);
     if (!currentPtr) {
         return basicList->dataPtr;
     }
@@ -5131,6 +7427,7 @@ fbBasicListSetSemantic(
     fbBasicList_t  *basicList,
     uint8_t         semantic)
 {
+    FB_LIST_TAKE(basicList, dataPtr);
     basicList->semantic = semantic;
 }
 
@@ -5139,11 +7436,14 @@ fbBasicListResize(
     fbBasicList_t  *basicList,
     uint16_t        numElements)
 {
+    FB_LIST_TAKE(basicList, dataPtr);
     if (numElements == basicList->numElements) {
         return memset(basicList->dataPtr, 0, basicList->dataLength);
     }
 
-    g_slice_free1(basicList->dataLength, basicList->dataPtr);
+    if (!basicList->fromArena) {
+        g_slice_free1(basicList->dataLength, basicList->dataPtr);
+    }
     return fbBasicListAllocData(basicList, numElements);
 }
 
@@ -5152,14 +7452,22 @@ fbBasicListAddNewElements(
     fbBasicList_t  *basicList,
     uint16_t        additional)
 {
-    uint16_t oldDataLength = basicList->dataLength;
-    uint8_t *oldDataPtr    = basicList->dataPtr;
+    uint16_t oldDataLength;
+    uint8_t *oldDataPtr;
+    uint8_t  oldFromArena;
+
+    FB_LIST_TAKE(basicList, dataPtr);
+    oldDataLength = basicList->dataLength;
+    oldDataPtr    = basicList->dataPtr;
+    oldFromArena  = basicList->fromArena;
 
     fbBasicListAllocData(basicList, basicList->numElements + additional);
 
     if (oldDataPtr) {
         memcpy(basicList->dataPtr, oldDataPtr, oldDataLength);
-        g_slice_free1(oldDataLength, oldDataPtr);
+        if (!oldFromArena) {
+            g_slice_free1(oldDataLength, oldDataPtr);
+        }
     }
 
     return (void *)(basicList->dataPtr + oldDataLength);
@@ -5186,6 +7494,7 @@ fbSubTemplateListAllocData(
     subTemplateList->numElements = numElements;
     subTemplateList->dataLength = numElements * subTemplateList->recordLength;
     subTemplateList->dataPtr = g_slice_alloc0(subTemplateList->dataLength);
+    subTemplateList->fromArena = 0;
     return (void *)subTemplateList->dataPtr;
 }
 
@@ -5221,13 +7530,19 @@ fbSubTemplateListCollectorInit(
     subTemplateList->tmpl = NULL;
     subTemplateList->dataLength = 0;
     subTemplateList->dataPtr = NULL;
+    subTemplateList->fromArena = 0;
 }
 
 void
 fbSubTemplateListClear(
     fbSubTemplateList_t  *subTemplateList)
 {
-    g_slice_free1(subTemplateList->dataLength, subTemplateList->dataPtr);
+    if (FB_LIST_DEFERRED == subTemplateList->fromArena) {
+        fbListDeferredFree(
+            (fbListDeferred_t *)(void *)subTemplateList->dataPtr);
+    } else if (!subTemplateList->fromArena) {
+        g_slice_free1(subTemplateList->dataLength, subTemplateList->dataPtr);
+    }
     fbSubTemplateListCollectorInit(subTemplateList);
 }
 
@@ -5246,6 +7561,11 @@ void
 fbSubTemplateListClearWithoutFree(
     fbSubTemplateList_t  *subTemplateList)
 {
+    /* the storage of a deferred list belongs to fixbuf */
+    if (FB_LIST_DEFERRED == subTemplateList->fromArena) {
+        fbSubTemplateListClear(subTemplateList);
+        return;
+    }
     subTemplateList->semantic = 0;
     subTemplateList->numElements = 0;
     subTemplateList->recordLength = 0;
@@ -5258,6 +7578,7 @@ void *
 fbSubTemplateListGetDataPtr(
     const fbSubTemplateList_t  *subTemplateList)
 {
+    FB_LIST_RESOLVE(subTemplateList, dataPtr, stl);
     return subTemplateList->dataPtr;
 }
 
@@ -5267,6 +7588,7 @@ fbSubTemplateListGetIndexedDataPtr(
     const fbSubTemplateList_t  *subTemplateList,
     uint16_t                    stlIndex)
 {
+    FB_LIST_RESOLVE(subTemplateList, dataPtr, stl);
     if (stlIndex >= subTemplateList->numElements) {
         return NULL;
     }
@@ -5282,6 +7604,7 @@ fbSubTemplateListGetNextPtr(
 {
     uint8_t *currentPtr = (uint8_t *)curPtr;
 
+    FB_LIST_RESOLVE(subTemplateList, dataPtr, stl);
     if (!currentPtr) {
         return subTemplateList->dataPtr;
     }
@@ -5304,6 +7627,7 @@ uint16_t
 fbSubTemplateListCountElements(
     const fbSubTemplateList_t  *subTemplateList)
 {
+    FB_LIST_RESOLVE(subTemplateList, dataPtr, stl);
     return subTemplateList->numElements;
 }
 
@@ -5312,6 +7636,7 @@ fbSubTemplateListSetSemantic(
     fbSubTemplateList_t  *subTemplateList,
     uint8_t               semantic)
 {
+    FB_LIST_TAKE(subTemplateList, dataPtr);
     subTemplateList->semantic = semantic;
 }
 
@@ -5326,6 +7651,7 @@ const fbTemplate_t *
 fbSubTemplateListGetTemplate(
     const fbSubTemplateList_t  *subTemplateList)
 {
+    FB_LIST_RESOLVE(subTemplateList, dataPtr, stl);
     return subTemplateList->tmpl;
 }
 
@@ -5333,6 +7659,7 @@ uint16_t
 fbSubTemplateListGetTemplateID(
     const fbSubTemplateList_t  *subTemplateList)
 {
+    FB_LIST_RESOLVE(subTemplateList, dataPtr, stl);
     return subTemplateList->tmplID;
 }
 
@@ -5341,10 +7668,13 @@ fbSubTemplateListResize(
     fbSubTemplateList_t  *subTemplateList,
     uint16_t              newCount)
 {
+    FB_LIST_TAKE(subTemplateList, dataPtr);
     if (newCount == subTemplateList->numElements) {
         return memset(subTemplateList->dataPtr, 0, subTemplateList->dataLength);
     }
-    g_slice_free1(subTemplateList->dataLength, subTemplateList->dataPtr);
+    if (!subTemplateList->fromArena) {
+        g_slice_free1(subTemplateList->dataLength, subTemplateList->dataPtr);
+    }
     return fbSubTemplateListAllocData(subTemplateList, newCount);
 }
 
@@ -5353,15 +7683,23 @@ fbSubTemplateListAddNewElements(
     fbSubTemplateList_t  *subTemplateList,
     uint16_t              additional)
 {
-    uint16_t oldDataLength = subTemplateList->dataLength;
-    uint8_t *oldDataPtr    = subTemplateList->dataPtr;
+    uint16_t oldDataLength;
+    uint8_t *oldDataPtr;
+    uint8_t  oldFromArena;
+
+    FB_LIST_TAKE(subTemplateList, dataPtr);
+    oldDataLength = subTemplateList->dataLength;
+    oldDataPtr    = subTemplateList->dataPtr;
+    oldFromArena  = subTemplateList->fromArena;
 
     fbSubTemplateListAllocData(
         subTemplateList, subTemplateList->numElements + additional);
 
     if (oldDataPtr) {
         memcpy(subTemplateList->dataPtr, oldDataPtr, oldDataLength);
-        g_slice_free1(oldDataLength, oldDataPtr);
+        if (!oldFromArena) {
+            g_slice_free1(oldDataLength, oldDataPtr);
+        }
     }
 
     return subTemplateList->dataPtr + oldDataLength;
@@ -5390,6 +7728,7 @@ fbSubTemplateMultiListInit(
     sTML->numElements = numElements;
     sTML->firstEntry = g_slice_alloc0(sTML->numElements *
                                       sizeof(fbSubTemplateMultiListEntry_t));
+    sTML->fromArena = 0;
     return sTML->firstEntry;
 }
 
@@ -5397,6 +7736,7 @@ uint16_t
 fbSubTemplateMultiListCountElements(
     const fbSubTemplateMultiList_t  *STML)
 {
+    FB_LIST_RESOLVE(STML, firstEntry, stml);
     return STML->numElements;
 }
 
@@ -5405,6 +7745,7 @@ fbSubTemplateMultiListSetSemantic(
     fbSubTemplateMultiList_t  *STML,
     uint8_t                    semantic)
 {
+    FB_LIST_TAKE(STML, firstEntry);
     STML->semantic = semantic;
 }
 
@@ -5419,12 +7760,18 @@ void
 fbSubTemplateMultiListClear(
     fbSubTemplateMultiList_t  *sTML)
 {
-    fbSubTemplateMultiListClearEntries(sTML);
-
-    g_slice_free1(sTML->numElements * sizeof(fbSubTemplateMultiListEntry_t),
-                  sTML->firstEntry);
+    /* the entries of an arena list are also in the arena */
+    if (FB_LIST_DEFERRED == sTML->fromArena) {
+        fbListDeferredFree((fbListDeferred_t *)(void *)sTML->firstEntry);
+    } else if (!sTML->fromArena) {
+        fbSubTemplateMultiListClearEntries(sTML);
+        g_slice_free1(
+            sTML->numElements * sizeof(fbSubTemplateMultiListEntry_t),
+            sTML->firstEntry);
+    }
     sTML->numElements = 0;
     sTML->firstEntry = NULL;
+    sTML->fromArena = 0;
 }
 
 void
@@ -5432,6 +7779,8 @@ fbSubTemplateMultiListClearEntries(
     fbSubTemplateMultiList_t  *sTML)
 {
     fbSubTemplateMultiListEntry_t *entry = NULL;
+
+    FB_LIST_TAKE(sTML, firstEntry);
     while ((entry = fbSubTemplateMultiListGetNextEntry(sTML, entry))) {
         fbSubTemplateMultiListEntryClear(entry);
     }
@@ -5452,17 +7801,22 @@ fbSubTemplateMultiListResize(
     fbSubTemplateMultiList_t  *sTML,
     uint16_t                   newCount)
 {
+    FB_LIST_TAKE(sTML, firstEntry);
     fbSubTemplateMultiListClearEntries(sTML);
     if (newCount == sTML->numElements) {
         return memset(sTML->firstEntry, 0,
                       (sTML->numElements *
                        sizeof(fbSubTemplateMultiListEntry_t)));
     }
-    g_slice_free1(sTML->numElements * sizeof(fbSubTemplateMultiListEntry_t),
-                  sTML->firstEntry);
+    if (!sTML->fromArena) {
+        g_slice_free1(
+            sTML->numElements * sizeof(fbSubTemplateMultiListEntry_t),
+            sTML->firstEntry);
+    }
     sTML->numElements = newCount;
     sTML->firstEntry = g_slice_alloc0(sTML->numElements *
                                       sizeof(fbSubTemplateMultiListEntry_t));
+    sTML->fromArena = 0;
     return sTML->firstEntry;
 }
 
@@ -5471,17 +7825,25 @@ fbSubTemplateMultiListAddNewEntries(
     fbSubTemplateMultiList_t  *sTML,
     uint16_t                   additional)
 {
-    fbSubTemplateMultiListEntry_t *oldEntries = sTML->firstEntry;
-    size_t oldEntryLength =
-        sTML->numElements * sizeof(fbSubTemplateMultiListEntry_t);
+    fbSubTemplateMultiListEntry_t *oldEntries;
+    size_t  oldEntryLength;
+    uint8_t oldFromArena;
+
+    FB_LIST_TAKE(sTML, firstEntry);
+    oldEntries = sTML->firstEntry;
+    oldEntryLength = sTML->numElements * sizeof(fbSubTemplateMultiListEntry_t);
+    oldFromArena = sTML->fromArena;
 
     sTML->numElements += additional;
     sTML->firstEntry = g_slice_alloc0(sTML->numElements *
                                       sizeof(fbSubTemplateMultiListEntry_t));
+    sTML->fromArena = 0;
 
     if (oldEntries) {
         memcpy(sTML->firstEntry, oldEntries, oldEntryLength);
-        g_slice_free1(oldEntryLength, oldEntries);
+        if (!oldFromArena) {
+            g_slice_free1(oldEntryLength, oldEntries);
+        }
     }
 
     return sTML->firstEntry + (sTML->numElements - additional);
@@ -5491,6 +7853,7 @@ fbSubTemplateMultiListEntry_t *
 fbSubTemplateMultiListGetFirstEntry(
     const fbSubTemplateMultiList_t  *sTML)
 {
+    FB_LIST_RESOLVE(sTML, firstEntry, stml);
     return sTML->firstEntry;
 }
 
@@ -5499,6 +7862,7 @@ fbSubTemplateMultiListGetIndexedEntry(
     const fbSubTemplateMultiList_t  *sTML,
     uint16_t                         stmlIndex)
 {
+    FB_LIST_RESOLVE(sTML, firstEntry, stml);
     if (stmlIndex >= sTML->numElements) {
         return NULL;
     }
@@ -5511,6 +7875,7 @@ fbSubTemplateMultiListGetNextEntry(
     const fbSubTemplateMultiList_t       *sTML,
     const fbSubTemplateMultiListEntry_t  *currentEntry)
 {
+    FB_LIST_RESOLVE(sTML, firstEntry, stml);
     if (!currentEntry) {
         return sTML->firstEntry;
     }
@@ -5534,6 +7899,7 @@ fbSubTemplateMultiListEntryAllocData(
     entry->numElements = numElements;
     entry->dataLength = numElements * entry->recordLength;
     entry->dataPtr = g_slice_alloc0(entry->dataLength);
+    entry->fromArena = 0;
     return (void *)entry->dataPtr;
 }
 
@@ -5541,11 +7907,14 @@ void
 fbSubTemplateMultiListEntryClear(
     fbSubTemplateMultiListEntry_t  *entry)
 {
-    g_slice_free1(entry->dataLength, entry->dataPtr);
+    if (!entry->fromArena) {
+        g_slice_free1(entry->dataLength, entry->dataPtr);
+    }
     entry->tmplID = 0;
     entry->tmpl = NULL;
     entry->dataLength = 0;
     entry->dataPtr = NULL;
+    entry->fromArena = 0;
 }
 
 void *
@@ -5603,7 +7972,9 @@ fbSubTemplateMultiListEntryResize(
     if (newCount == entry->numElements) {
         return memset(entry->dataPtr, 0, entry->dataLength);
     }
-    g_slice_free1(entry->dataLength, entry->dataPtr);
+    if (!entry->fromArena) {
+        g_slice_free1(entry->dataLength, entry->dataPtr);
+    }
     return fbSubTemplateMultiListEntryAllocData(entry, newCount);
 }
 
@@ -5614,13 +7985,16 @@ fbSubTemplateMultiListEntryAddNewElements(
 {
     uint16_t oldDataLength = entry->dataLength;
     uint8_t *oldDataPtr = entry->dataPtr;
+    uint8_t  oldFromArena = entry->fromArena;
 
     fbSubTemplateMultiListEntryAllocData(
         entry, entry->numElements + additional);
 
     if (oldDataPtr) {
         memcpy(entry->dataPtr, oldDataPtr, oldDataLength);
-        g_slice_free1(oldDataLength, oldDataPtr);
+        if (!oldFromArena) {
+            g_slice_free1(oldDataLength, oldDataPtr);
+        }
     }
 
     return entry->dataPtr + oldDataLength;
@@ -5732,6 +8106,10 @@ fBufSTMLEntryRecordFree(
 {
     uint8_t *data = NULL;
 
+    /* records nested in arena storage are also in the arena */
+    if (entry->fromArena) {
+        return;
+    }
     while ((data = fbSubTemplateMultiListEntryNextDataPtr(entry, data))) {
         fBufListFree(entry->tmpl, data);
     }
@@ -5751,6 +8129,9 @@ fBufSTMLRecordFree(
 {
     fbSubTemplateMultiListEntry_t *entry = NULL;
 
+    if (stml->fromArena) {
+        return;
+    }
     while ((entry = fbSubTemplateMultiListGetNextEntry(stml, entry))) {
         fBufSTMLEntryRecordFree(entry);
     }
@@ -5768,6 +8149,9 @@ fBufSTLRecordFree(
 {
     uint8_t *data = NULL;
 
+    if (stl->fromArena) {
+        return;
+    }
     while ((data = fbSubTemplateListGetNextPtr(stl, data))) {
         fBufListFree((fbTemplate_t *)(stl->tmpl), data);
     }
@@ -5785,6 +8169,11 @@ fBufBLRecordFree(
 {
     uint8_t *data = NULL;
 
+    /* nothing was decoded into a list that has no element (e.g., one
+     * whose decode failed) */
+    if (bl->fromArena || NULL == bl->field.canon) {
+        return;
+    }
     switch (fbTemplateFieldGetType(&bl->field)) {
       case FB_SUB_TMPL_MULTI_LIST:
         while ((data = fbBasicListGetNextPtr(bl, data))) {
@@ -5878,6 +8267,42 @@ fbRecordGetFieldCount(
 }
 
 
+/*
+ * fbRecordViewGetFieldByPosition
+ *
+ *
+ */
+const uint8_t *
+fbRecordViewGetFieldByPosition(
+    const fbRecordView_t  *view,
+    uint16_t               position,
+    size_t                *len)
+{
+    const uint8_t *dp;
+    size_t         fieldlen;
+
+    if (position >= view->tmpl->ie_count) {
+        return NULL;
+    }
+    dp = view->data + view->offsets[position];
+    fieldlen = view->offsets[position + 1] - view->offsets[position];
+    if (FB_IE_VARLEN == view->tmpl->ie_ary[position]->len) {
+        /* skip the length prefix */
+        if (255 == *dp) {
+            dp += 3;
+            fieldlen -= 3;
+        } else {
+            dp += 1;
+            fieldlen -= 1;
+        }
+    }
+    if (len) {
+        *len = fieldlen;
+    }
+    return dp;
+}
+
+
 /*
  * fbRecordFreeLists
  *
@@ -6349,6 +8774,28 @@ fbRecordFindValueForInfoElement(
 }
 
 
+/*
+ * fbRecordGetValueForAccessor
+ *
+ *
+ */
+gboolean
+fbRecordGetValueForAccessor(
+    const fbRecord_t         *record,
+    const fbFieldAccessor_t  *accessor,
+    fbRecordValue_t          *value)
+{
+    const fbTemplateField_t *field;
+
+    field = fbFieldAccessorGetField(accessor, record->tmpl);
+    if (field) {
+        fbRecordFillValue(field, record->rec + field->offset, value);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+
 /*
  * fbRecordGetValueForField
  *
@@ -6476,10 +8923,11 @@ fbRecordFindAllElementValues(
 
     /* check its basicLists */
     for (i = 0; (bl = fbRecordGetNthBL(record, i)); ++i) {
-        if (bl->field.canon == ie) {
+        if (fbBasicListGetInfoElement(bl) == ie) {
             item = NULL;
             while ((item = fbBLNext(uint8_t, bl, item))) {
-                fbRecordFillValue(&bl->field, item, &value);
+                fbRecordFillValue(fbBasicListGetTemplateField(bl), item,
+                                  &value);
                 rv = callback(record, bl, ie, &value, ctx);
                 if (rv) { return rv; }
             }
@@ -6635,7 +9083,7 @@ fbRecordFindAllSubRecordsBL(
     const fbBasicList_t            *subBL;
     int rv;
 
-    switch (fbTemplateFieldGetType(&bl->field)) {
+    switch (fbTemplateFieldGetType(fbBasicListGetTemplateField(bl))) {
       case FB_BASIC_LIST:
         subBL = NULL;
         while ((subBL = fbBLNext(const fbBasicList_t, bl, subBL))) {
@@ -6830,6 +9278,115 @@ fbRecordCopyField(
 }
 
 
+/*
+ *  Returns TRUE if fbRecordCopyField() copies `srcField` to `dstField` by
+ *  copying their octets unchanged.
+ */
+static gboolean
+fbRecordCopyFieldIsRaw(
+    const fbTemplateField_t  *srcField,
+    const fbTemplateField_t  *dstField)
+{
+    if (srcField->len != dstField->len ||
+        srcField->canon->len != dstField->canon->len)
+    {
+        return FALSE;
+    }
+    switch (fbTemplateFieldGetType(srcField)) {
+      case FB_BASIC_LIST:
+      case FB_SUB_TMPL_LIST:
+      case FB_SUB_TMPL_MULTI_LIST:
+        return FALSE;
+      default:
+        return TRUE;
+    }
+}
+
+/*
+ *  Returns the plan for fbRecordCopyToTemplate() to copy records of
+ *  `srcTmpl` to `dstTmpl`, building it and caching it on `dstTmpl` if
+ *  needed.  Both templates must be active.  The plan copies runs of fields
+ *  with matching layouts as one block.
+ */
+static const fbRecordCopyPlan_t *
+fbRecordCopyPlanGet(
+    const fbTemplate_t  *srcTmpl,
+    const fbTemplate_t  *dstTmpl)
+{
+    fbTemplate_t        *dst = (fbTemplate_t *)dstTmpl;
+    fbRecordCopyPlan_t **prev;
+    fbRecordCopyPlan_t  *plan;
+    fbRecordCopyOp_t    *op;
+    const fbTemplateField_t *srcField;
+    const fbTemplateField_t *dstField;
+    unsigned int count = 0;
+    uint16_t     i;
+    uint16_t     len;
+    gpointer     v;
+
+    for (prev = &dst->copy_plans; *prev; prev = &(*prev)->next) {
+        plan = *prev;
+        if (plan->src_tmpl == srcTmpl && plan->src_serial == srcTmpl->serial) {
+            /* move to the front so the least recently used plan is last */
+            *prev = plan->next;
+            plan->next = dst->copy_plans;
+            dst->copy_plans = plan;
+            return plan;
+        }
+        ++count;
+    }
+
+    if (count >= FB_RECORD_COPY_PLAN_MAX) {
+        /* forget the least recently used plan */
+        for (prev = &dst->copy_plans; (*prev)->next; prev = &(*prev)->next)
+            ;
+        plan = *prev;
+        *prev = NULL;
+        g_free(plan->ops);
+        g_slice_free(fbRecordCopyPlan_t, plan);
+    }
+
+    plan = g_slice_new0(fbRecordCopyPlan_t);
+    plan->src_tmpl = srcTmpl;
+    plan->src_serial = srcTmpl->serial;
+    plan->ops = g_new(fbRecordCopyOp_t, MAX(dstTmpl->ie_count, 1));
+
+    for (i = 0; i < dstTmpl->ie_count; ++i) {
+        dstField = dstTmpl->ie_ary[i];
+        if (!g_hash_table_lookup_extended(srcTmpl->indices,
+                                          dstField, NULL, &v))
+        {
+            continue;
+        }
+        srcField = srcTmpl->ie_ary[GPOINTER_TO_INT(v)];
+        op = &plan->ops[plan->op_count];
+        if (!fbRecordCopyFieldIsRaw(srcField, dstField)) {
+            op->src_pos = GPOINTER_TO_INT(v);
+            op->dst_pos = i;
+            op->len = 0;
+            ++plan->op_count;
+            continue;
+        }
+        len = fbSizeofIE(dstField);
+        if (plan->op_count && (op - 1)->len &&
+            (op - 1)->src_off + (op - 1)->len == srcField->offset &&
+            (op - 1)->dst_off + (op - 1)->len == dstField->offset)
+        {
+            (op - 1)->len += len;
+        } else {
+            op->src_off = srcField->offset;
+            op->dst_off = dstField->offset;
+            op->len = len;
+            ++plan->op_count;
+        }
+    }
+
+    plan->next = dst->copy_plans;
+    dst->copy_plans = plan;
+    return plan;
+}
+
+
 gboolean
 fbRecordCopyToTemplate(
     const fbRecord_t    *srcRec,
@@ -6838,8 +9395,10 @@ fbRecordCopyToTemplate(
     uint16_t             tid,
     GError             **err)
 {
-    const fbTemplateField_t *srcField;
-    const fbTemplateField_t *dstField;
+    const fbRecordCopyPlan_t *plan;
+    const fbRecordCopyOp_t   *op;
+    const fbTemplateField_t  *srcField;
+    const fbTemplateField_t  *dstField;
     uint16_t i;
     gpointer v;
 
@@ -6855,6 +9414,26 @@ fbRecordCopyToTemplate(
     dstRec->tid = tid;
     dstRec->recsize = tmpl->ie_internal_len;
 
+    /* the plans live on the destination template; do not cache them on an
+     * interned template, which may be used by several threads */
+    if (tmpl->active && srcRec->tmpl->active && !tmpl->interned) {
+        plan = fbRecordCopyPlanGet(srcRec->tmpl, tmpl);
+        for (i = 0, op = plan->ops; i < plan->op_count; ++i, ++op) {
+            if (op->len) {
+                memcpy(dstRec->rec + op->dst_off, srcRec->rec + op->src_off,
+                       op->len);
+            } else if (!fbRecordCopyField(
+                           srcRec, srcRec->tmpl->ie_ary[op->src_pos],
+                           dstRec, tmpl->ie_ary[op->dst_pos], err))
+            {
+                return FALSE;
+            }
+        }
+        return TRUE;
+    }
+
+    /* a template that is still being built may gain fields; do not cache a
+     * plan for it */
     for (i = 0; i < tmpl->ie_count; ++i) {
         dstField = tmpl->ie_ary[i];
         if (g_hash_table_lookup_extended(srcRec->tmpl->indices,
@@ -0,0 +1,1414 @@
+/* This file was automatically generated by the make-infomodel script
+ * using the "*.xml" files in the infomodel directory.
+ */
+
+#include "infomodel.h"
+
+
+/*  Include each generated file not marked as excluded. */
+
+/* FOREACH */
+
+#if !defined(INFOMODEL_EXCLUDE_cert)
+#include "infomodel/cert.i"
+#endif  /* !defined(INFOMODEL_EXCLUDE_cert) */
+
+#if !defined(INFOMODEL_EXCLUDE_ipfix)
+#include "infomodel/ipfix.i"
+#endif  /* !defined(INFOMODEL_EXCLUDE_ipfix) */
+
+#if !defined(INFOMODEL_EXCLUDE_netflowv9)
+#include "infomodel/netflowv9.i"
+#endif  /* !defined(INFOMODEL_EXCLUDE_netflowv9) */
+
+/* END_FOREACH */
+
+void infomodelAddGlobalElements(fbInfoModel_t *model)
+{
+    if (!model) {
+        return;
+    }
+    /* FOREACH */
+
+#if !defined(INFOMODEL_EXCLUDE_cert)
+    fbInfoModelAddElementArray(model, infomodel_array_static_cert);
+#endif
+
+#if !defined(INFOMODEL_EXCLUDE_ipfix)
+    fbInfoModelAddElementArray(model, infomodel_array_static_ipfix);
+#endif
+
+#if !defined(INFOMODEL_EXCLUDE_netflowv9)
+    fbInfoModelAddElementArray(model, infomodel_array_static_netflowv9);
+#endif
+
+    /* END_FOREACH */
+}
+
+const fbInfoElement_t *infomodelGetArrayByName(const char *name)
+{
+    if (!name) {
+        return NULL;
+    }
+    /* FOREACH*/
+
+#if !defined(INFOMODEL_EXCLUDE_cert)
+    if (0 == strcmp(name, "cert")) {
+        return infomodel_array_static_cert;
+    }
+#endif
+
+#if !defined(INFOMODEL_EXCLUDE_ipfix)
+    if (0 == strcmp(name, "ipfix")) {
+        return infomodel_array_static_ipfix;
+    }
+#endif
+
+#if !defined(INFOMODEL_EXCLUDE_netflowv9)
+    if (0 == strcmp(name, "netflowv9")) {
+        return infomodel_array_static_netflowv9;
+    }
+#endif
+
+    /* END_FOREACH */
+    return NULL;
+}
+
+size_t infomodelGetArrayLengthByName(const char *name)
+{
+    if (!name) {
+        return 0;
+    }
+    /* FOREACH*/
+
+#if !defined(INFOMODEL_EXCLUDE_cert)
+    if (0 == strcmp(name, "cert")) {
+        return sizeof(infomodel_array_static_cert)/sizeof(infomodel_array_static_cert[0]);
+    }
+#endif
+
+#if !defined(INFOMODEL_EXCLUDE_ipfix)
+    if (0 == strcmp(name, "ipfix")) {
+        return sizeof(infomodel_array_static_ipfix)/sizeof(infomodel_array_static_ipfix[0]);
+    }
+#endif
+
+#if !defined(INFOMODEL_EXCLUDE_netflowv9)
+    if (0 == strcmp(name, "netflowv9")) {
+        return sizeof(infomodel_array_static_netflowv9)/sizeof(infomodel_array_static_netflowv9[0]);
+    }
+#endif
+
+    /* END_FOREACH */
+    return 0;
+}
+
+/*  Every element from the *.i files and their reverses, sorted by
+ *  enterprise number and element ID. */
+static const fbInfoElement_t infomodel_prebuilt_elements[] = {
+    FB_IE_INIT_FULL("octetDeltaCount", 0, 1, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("packetDeltaCount", 0, 2, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("deltaFlowCount", 0, 3, 8, FB_IE_DELTACOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("protocolIdentifier", 0, 4, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ipClassOfService", 0, 5, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("tcpControlBits", 0, 6, 2, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("sourceTransportPort", 0, 7, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("sourceIPv4Address", 0, 8, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("sourceIPv4PrefixLength", 0, 9, 1, FB_IE_QUANTITY | FB_UNITS_BITS | FB_IE_F_REVERSIBLE, 0, 32, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ingressInterface", 0, 10, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("destinationTransportPort", 0, 11, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("destinationIPv4Address", 0, 12, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("destinationIPv4PrefixLength", 0, 13, 1, FB_IE_QUANTITY | FB_UNITS_BITS | FB_IE_F_REVERSIBLE, 0, 32, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("egressInterface", 0, 14, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("ipNextHopIPv4Address", 0, 15, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("bgpSourceAsNumber", 0, 16, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("bgpDestinationAsNumber", 0, 17, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("bgpNextHopIPv4Address", 0, 18, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("postMCastPacketDeltaCount", 0, 19, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("postMCastOctetDeltaCount", 0, 20, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("flowEndSysUpTime", 0, 21, 4, FB_IE_QUANTITY | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("flowStartSysUpTime", 0, 22, 4, FB_IE_QUANTITY | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("postOctetDeltaCount", 0, 23, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("postPacketDeltaCount", 0, 24, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("minimumIpTotalLength", 0, 25, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("maximumIpTotalLength", 0, 26, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("sourceIPv6Address", 0, 27, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("destinationIPv6Address", 0, 28, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("sourceIPv6PrefixLength", 0, 29, 1, FB_IE_QUANTITY | FB_UNITS_BITS | FB_IE_F_REVERSIBLE, 0, 128, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("destinationIPv6PrefixLength", 0, 30, 1, FB_IE_QUANTITY | FB_UNITS_BITS | FB_IE_F_REVERSIBLE, 0, 128, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("flowLabelIPv6", 0, 31, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0xFFFFF, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("icmpTypeCodeIPv4", 0, 32, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("igmpType", 0, 33, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("samplingInterval", 0, 34, 4, FB_IE_QUANTITY | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("samplingAlgorithm", 0, 35, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("flowActiveTimeout", 0, 36, 2, FB_IE_QUANTITY | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("flowIdleTimeout", 0, 37, 2, FB_IE_QUANTITY | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("engineType", 0, 38, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("engineId", 0, 39, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("exportedOctetTotalCount", 0, 40, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("exportedMessageTotalCount", 0, 41, 8, FB_IE_TOTALCOUNTER | FB_UNITS_MESSAGES | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("exportedFlowRecordTotalCount", 0, 42, 8, FB_IE_TOTALCOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("ipv4RouterSc", 0, 43, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("sourceIPv4Prefix", 0, 44, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("destinationIPv4Prefix", 0, 45, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("mplsTopLabelType", 0, 46, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("mplsTopLabelIPv4Address", 0, 47, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("samplerId", 0, 48, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("samplerMode", 0, 49, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("samplerRandomInterval", 0, 50, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("classId", 0, 51, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("minimumTTL", 0, 52, 1, FB_IE_QUANTITY | FB_UNITS_HOPS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("maximumTTL", 0, 53, 1, FB_IE_QUANTITY | FB_UNITS_HOPS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("fragmentIdentification", 0, 54, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("postIpClassOfService", 0, 55, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("sourceMacAddress", 0, 56, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("postDestinationMacAddress", 0, 57, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("vlanId", 0, 58, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("postVlanId", 0, 59, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("ipVersion", 0, 60, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("flowDirection", 0, 61, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ipNextHopIPv6Address", 0, 62, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("bgpNextHopIPv6Address", 0, 63, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("ipv6ExtensionHeaders", 0, 64, 4, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("mplsTopLabelStackSection", 0, 70, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackSection2", 0, 71, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackSection3", 0, 72, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackSection4", 0, 73, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackSection5", 0, 74, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackSection6", 0, 75, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackSection7", 0, 76, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackSection8", 0, 77, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackSection9", 0, 78, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackSection10", 0, 79, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("destinationMacAddress", 0, 80, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("postSourceMacAddress", 0, 81, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("interfaceName", 0, 82, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("interfaceDescription", 0, 83, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("samplerName", 0, 84, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("octetTotalCount", 0, 85, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("packetTotalCount", 0, 86, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("flagsAndSamplerId", 0, 87, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("fragmentOffset", 0, 88, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0x1FFF, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("forwardingStatus", 0, 89, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("mplsVpnRouteDistinguisher", 0, 90, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsTopLabelPrefixLength", 0, 91, 1, FB_IE_QUANTITY | FB_UNITS_BITS | FB_IE_F_REVERSIBLE, 0, 32, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("srcTrafficIndex", 0, 92, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("dstTrafficIndex", 0, 93, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("applicationDescription", 0, 94, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("applicationId", 0, 95, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("applicationName", 0, 96, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("postIpDiffServCodePoint", 0, 98, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 63, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("multicastReplicationFactor", 0, 99, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("className", 0, 100, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("classificationEngineId", 0, 101, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("layer2packetSectionOffset", 0, 102, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("layer2packetSectionSize", 0, 103, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("layer2packetSectionData", 0, 104, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("bgpNextAdjacentAsNumber", 0, 128, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("bgpPrevAdjacentAsNumber", 0, 129, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("exporterIPv4Address", 0, 130, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("exporterIPv6Address", 0, 131, 16, FB_IE_DEFAULT, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("droppedOctetDeltaCount", 0, 132, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("droppedPacketDeltaCount", 0, 133, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("droppedOctetTotalCount", 0, 134, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("droppedPacketTotalCount", 0, 135, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("flowEndReason", 0, 136, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("commonPropertiesId", 0, 137, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("observationPointId", 0, 138, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("icmpTypeCodeIPv6", 0, 139, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("mplsTopLabelIPv6Address", 0, 140, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("lineCardId", 0, 141, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("portId", 0, 142, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("meteringProcessId", 0, 143, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("exportingProcessId", 0, 144, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("templateId", 0, 145, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("wlanChannelId", 0, 146, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("wlanSSID", 0, 147, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("flowId", 0, 148, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("observationDomainId", 0, 149, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("flowStartSeconds", 0, 150, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("flowEndSeconds", 0, 151, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("flowStartMilliseconds", 0, 152, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("flowEndMilliseconds", 0, 153, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("flowStartMicroseconds", 0, 154, 8, FB_IE_DEFAULT | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MICROSEC, NULL),
+    FB_IE_INIT_FULL("flowEndMicroseconds", 0, 155, 8, FB_IE_DEFAULT | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MICROSEC, NULL),
+    FB_IE_INIT_FULL("flowStartNanoseconds", 0, 156, 8, FB_IE_DEFAULT | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_NANOSEC, NULL),
+    FB_IE_INIT_FULL("flowEndNanoseconds", 0, 157, 8, FB_IE_DEFAULT | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_NANOSEC, NULL),
+    FB_IE_INIT_FULL("flowStartDeltaMicroseconds", 0, 158, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("flowEndDeltaMicroseconds", 0, 159, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("systemInitTimeMilliseconds", 0, 160, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("flowDurationMilliseconds", 0, 161, 4, FB_IE_QUANTITY | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("flowDurationMicroseconds", 0, 162, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("observedFlowTotalCount", 0, 163, 8, FB_IE_TOTALCOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("ignoredPacketTotalCount", 0, 164, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("ignoredOctetTotalCount", 0, 165, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("notSentFlowTotalCount", 0, 166, 8, FB_IE_TOTALCOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("notSentPacketTotalCount", 0, 167, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("notSentOctetTotalCount", 0, 168, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("destinationIPv6Prefix", 0, 169, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("sourceIPv6Prefix", 0, 170, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("postOctetTotalCount", 0, 171, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("postPacketTotalCount", 0, 172, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("flowKeyIndicator", 0, 173, 8, FB_IE_FLAGS | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("postMCastPacketTotalCount", 0, 174, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("postMCastOctetTotalCount", 0, 175, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("icmpTypeIPv4", 0, 176, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("icmpCodeIPv4", 0, 177, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("icmpTypeIPv6", 0, 178, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("icmpCodeIPv6", 0, 179, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("udpSourcePort", 0, 180, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("udpDestinationPort", 0, 181, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("tcpSourcePort", 0, 182, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("tcpDestinationPort", 0, 183, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("tcpSequenceNumber", 0, 184, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("tcpAcknowledgementNumber", 0, 185, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("tcpWindowSize", 0, 186, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("tcpUrgentPointer", 0, 187, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("tcpHeaderLength", 0, 188, 1, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ipHeaderLength", 0, 189, 1, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("totalLengthIPv4", 0, 190, 2, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("payloadLengthIPv6", 0, 191, 2, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("ipTTL", 0, 192, 1, FB_IE_QUANTITY | FB_UNITS_HOPS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("nextHeaderIPv6", 0, 193, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("mplsPayloadLength", 0, 194, 4, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("ipDiffServCodePoint", 0, 195, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 63, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ipPrecedence", 0, 196, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 7, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("fragmentFlags", 0, 197, 1, FB_IE_FLAGS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("octetDeltaSumOfSquares", 0, 198, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("octetTotalSumOfSquares", 0, 199, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("mplsTopLabelTTL", 0, 200, 1, FB_IE_QUANTITY | FB_UNITS_HOPS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackLength", 0, 201, 4, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackDepth", 0, 202, 4, FB_IE_QUANTITY | FB_UNITS_ENTRIES | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("mplsTopLabelExp", 0, 203, 1, FB_IE_FLAGS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ipPayloadLength", 0, 204, 4, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("udpMessageLength", 0, 205, 2, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("isMulticast", 0, 206, 1, FB_IE_FLAGS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ipv4IHL", 0, 207, 1, FB_IE_QUANTITY | FB_UNITS_WORDS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ipv4Options", 0, 208, 4, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("tcpOptions", 0, 209, 8, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("paddingOctets", 0, 210, FB_IE_VARLEN, FB_IE_DEFAULT, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("collectorIPv4Address", 0, 211, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("collectorIPv6Address", 0, 212, 16, FB_IE_DEFAULT, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("exportInterface", 0, 213, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("exportProtocolVersion", 0, 214, 1, FB_IE_IDENTIFIER, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("exportTransportProtocol", 0, 215, 1, FB_IE_IDENTIFIER, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("collectorTransportPort", 0, 216, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("exporterTransportPort", 0, 217, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("tcpSynTotalCount", 0, 218, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("tcpFinTotalCount", 0, 219, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("tcpRstTotalCount", 0, 220, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("tcpPshTotalCount", 0, 221, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("tcpAckTotalCount", 0, 222, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("tcpUrgTotalCount", 0, 223, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("ipTotalLength", 0, 224, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("postNATSourceIPv4Address", 0, 225, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("postNATDestinationIPv4Address", 0, 226, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("postNAPTSourceTransportPort", 0, 227, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("postNAPTDestinationTransportPort", 0, 228, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("natOriginatingAddressRealm", 0, 229, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 1, 2, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("natEvent", 0, 230, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("initiatorOctets", 0, 231, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("responderOctets", 0, 232, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("firewallEvent", 0, 233, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ingressVRFID", 0, 234, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("egressVRFID", 0, 235, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("VRFname", 0, 236, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("postMplsTopLabelExp", 0, 237, 1, FB_IE_FLAGS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("tcpWindowScale", 0, 238, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("biflowDirection", 0, 239, 1, FB_IE_IDENTIFIER, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ethernetHeaderLength", 0, 240, 1, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ethernetPayloadLength", 0, 241, 2, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("ethernetTotalLength", 0, 242, 2, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("dot1qVlanId", 0, 243, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("dot1qPriority", 0, 244, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("dot1qCustomerVlanId", 0, 245, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("dot1qCustomerPriority", 0, 246, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("metroEvcId", 0, 247, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("metroEvcType", 0, 248, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("pseudoWireId", 0, 249, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("pseudoWireType", 0, 250, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("pseudoWireControlWord", 0, 251, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("ingressPhysicalInterface", 0, 252, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("egressPhysicalInterface", 0, 253, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("postDot1qVlanId", 0, 254, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("postDot1qCustomerVlanId", 0, 255, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("ethernetType", 0, 256, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("postIpPrecedence", 0, 257, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 7, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("collectionTimeMilliseconds", 0, 258, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("exportSctpStreamId", 0, 259, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("maxExportSeconds", 0, 260, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("maxFlowEndSeconds", 0, 261, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("messageMD5Checksum", 0, 262, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("messageScope", 0, 263, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("minExportSeconds", 0, 264, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("minFlowStartSeconds", 0, 265, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("opaqueOctets", 0, 266, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("sessionScope", 0, 267, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("maxFlowEndMicroseconds", 0, 268, 8, FB_IE_DEFAULT | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MICROSEC, NULL),
+    FB_IE_INIT_FULL("maxFlowEndMilliseconds", 0, 269, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("maxFlowEndNanoseconds", 0, 270, 8, FB_IE_DEFAULT | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_NANOSEC, NULL),
+    FB_IE_INIT_FULL("minFlowStartMicroseconds", 0, 271, 8, FB_IE_DEFAULT | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MICROSEC, NULL),
+    FB_IE_INIT_FULL("minFlowStartMilliseconds", 0, 272, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("minFlowStartNanoseconds", 0, 273, 8, FB_IE_DEFAULT | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_NANOSEC, NULL),
+    FB_IE_INIT_FULL("collectorCertificate", 0, 274, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("exporterCertificate", 0, 275, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("dataRecordsReliability", 0, 276, 1, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_BOOL, NULL),
+    FB_IE_INIT_FULL("observationPointType", 0, 277, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("newConnectionDeltaCount", 0, 278, 4, FB_IE_DELTACOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("connectionSumDurationSeconds", 0, 279, 8, FB_IE_QUANTITY | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("connectionTransactionId", 0, 280, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("postNATSourceIPv6Address", 0, 281, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("postNATDestinationIPv6Address", 0, 282, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("natPoolId", 0, 283, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("natPoolName", 0, 284, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("anonymizationFlags", 0, 285, 2, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("anonymizationTechnique", 0, 286, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("informationElementIndex", 0, 287, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("p2pTechnology", 0, 288, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("tunnelTechnology", 0, 289, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("encryptedTechnology", 0, 290, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("basicList", 0, 291, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("subTemplateList", 0, 292, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_SUB_TMPL_LIST, NULL),
+    FB_IE_INIT_FULL("subTemplateMultiList", 0, 293, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_SUB_TMPL_MULTI_LIST, NULL),
+    FB_IE_INIT_FULL("bgpValidityState", 0, 294, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("IPSecSPI", 0, 295, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("greKey", 0, 296, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("natType", 0, 297, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("initiatorPackets", 0, 298, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("responderPackets", 0, 299, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("observationDomainName", 0, 300, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("selectionSequenceId", 0, 301, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("selectorId", 0, 302, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("informationElementId", 0, 303, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("selectorAlgorithm", 0, 304, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("samplingPacketInterval", 0, 305, 4, FB_IE_QUANTITY | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("samplingPacketSpace", 0, 306, 4, FB_IE_QUANTITY | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("samplingTimeInterval", 0, 307, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("samplingTimeSpace", 0, 308, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("samplingSize", 0, 309, 4, FB_IE_QUANTITY | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("samplingPopulation", 0, 310, 4, FB_IE_QUANTITY | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("samplingProbability", 0, 311, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("dataLinkFrameSize", 0, 312, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("ipHeaderPacketSection", 0, 313, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("ipPayloadPacketSection", 0, 314, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("dataLinkFrameSection", 0, 315, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsLabelStackSection", 0, 316, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mplsPayloadPacketSection", 0, 317, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("selectorIdTotalPktsObserved", 0, 318, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("selectorIdTotalPktsSelected", 0, 319, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("absoluteError", 0, 320, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("relativeError", 0, 321, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("observationTimeSeconds", 0, 322, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("observationTimeMilliseconds", 0, 323, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("observationTimeMicroseconds", 0, 324, 8, FB_IE_DEFAULT | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MICROSEC, NULL),
+    FB_IE_INIT_FULL("observationTimeNanoseconds", 0, 325, 8, FB_IE_DEFAULT | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_NANOSEC, NULL),
+    FB_IE_INIT_FULL("digestHashValue", 0, 326, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("hashIPPayloadOffset", 0, 327, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("hashIPPayloadSize", 0, 328, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("hashOutputRangeMin", 0, 329, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("hashOutputRangeMax", 0, 330, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("hashSelectedRangeMin", 0, 331, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("hashSelectedRangeMax", 0, 332, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("hashDigestOutput", 0, 333, 1, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_BOOL, NULL),
+    FB_IE_INIT_FULL("hashInitialiserValue", 0, 334, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("selectorName", 0, 335, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("upperCILimit", 0, 336, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("lowerCILimit", 0, 337, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("confidenceLevel", 0, 338, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("informationElementDataType", 0, 339, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("informationElementDescription", 0, 340, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("informationElementName", 0, 341, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("informationElementRangeBegin", 0, 342, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("informationElementRangeEnd", 0, 343, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("informationElementSemantics", 0, 344, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("informationElementUnits", 0, 345, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("privateEnterpriseNumber", 0, 346, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("virtualStationInterfaceId", 0, 347, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("virtualStationInterfaceName", 0, 348, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("virtualStationUUID", 0, 349, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("virtualStationName", 0, 350, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("layer2SegmentId", 0, 351, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("layer2OctetDeltaCount", 0, 352, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("layer2OctetTotalCount", 0, 353, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("ingressUnicastPacketTotalCount", 0, 354, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("ingressMulticastPacketTotalCount", 0, 355, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("ingressBroadcastPacketTotalCount", 0, 356, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("egressUnicastPacketTotalCount", 0, 357, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("egressBroadcastPacketTotalCount", 0, 358, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("monitoringIntervalStartMilliSeconds", 0, 359, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("monitoringIntervalEndMilliSeconds", 0, 360, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("portRangeStart", 0, 361, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("portRangeEnd", 0, 362, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("portRangeStepSize", 0, 363, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("portRangeNumPorts", 0, 364, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("staMacAddress", 0, 365, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("staIPv4Address", 0, 366, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("wtpMacAddress", 0, 367, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("ingressInterfaceType", 0, 368, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("egressInterfaceType", 0, 369, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("rtpSequenceNumber", 0, 370, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("userName", 0, 371, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("applicationCategoryName", 0, 372, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("applicationSubCategoryName", 0, 373, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("applicationGroupName", 0, 374, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("originalFlowsPresent", 0, 375, 8, FB_IE_DELTACOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("originalFlowsInitiated", 0, 376, 8, FB_IE_DELTACOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("originalFlowsCompleted", 0, 377, 8, FB_IE_DELTACOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("distinctCountOfSourceIPAddress", 0, 378, 8, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("distinctCountOfDestinationIPAddress", 0, 379, 8, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("distinctCountOfSourceIPv4Address", 0, 380, 4, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("distinctCountOfDestinationIPv4Address", 0, 381, 4, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("distinctCountOfSourceIPv6Address", 0, 382, 8, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("distinctCountOfDestinationIPv6Address", 0, 383, 8, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("valueDistributionMethod", 0, 384, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("rfc3550JitterMilliseconds", 0, 385, 4, FB_IE_QUANTITY | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("rfc3550JitterMicroseconds", 0, 386, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("rfc3550JitterNanoseconds", 0, 387, 4, FB_IE_QUANTITY | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("dot1qDEI", 0, 388, 1, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_BOOL, NULL),
+    FB_IE_INIT_FULL("dot1qCustomerDEI", 0, 389, 1, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_BOOL, NULL),
+    FB_IE_INIT_FULL("flowSelectorAlgorithm", 0, 390, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("flowSelectedOctetDeltaCount", 0, 391, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("flowSelectedPacketDeltaCount", 0, 392, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("flowSelectedFlowDeltaCount", 0, 393, 8, FB_IE_DELTACOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("selectorIDTotalFlowsObserved", 0, 394, 8, FB_IE_QUANTITY | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("selectorIDTotalFlowsSelected", 0, 395, 8, FB_IE_QUANTITY | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("samplingFlowInterval", 0, 396, 8, FB_IE_QUANTITY | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("samplingFlowSpacing", 0, 397, 8, FB_IE_QUANTITY | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("flowSamplingTimeInterval", 0, 398, 8, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("flowSamplingTimeSpacing", 0, 399, 8, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("hashFlowDomain", 0, 400, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("transportOctetDeltaCount", 0, 401, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("transportPacketDeltaCount", 0, 402, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("originalExporterIPv4Address", 0, 403, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("originalExporterIPv6Address", 0, 404, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("originalObservationDomainId", 0, 405, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("intermediateProcessId", 0, 406, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("ignoredDataRecordTotalCount", 0, 407, 8, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("dataLinkFrameType", 0, 408, 2, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("sectionOffset", 0, 409, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("sectionExportedOctets", 0, 410, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("dot1qServiceInstanceTag", 0, 411, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("dot1qServiceInstanceId", 0, 412, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0xFFFFFF, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("dot1qServiceInstancePriority", 0, 413, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 7, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("dot1qCustomerSourceMacAddress", 0, 414, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("dot1qCustomerDestinationMacAddress", 0, 415, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("postLayer2OctetDeltaCount", 0, 417, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("postMCastLayer2OctetDeltaCount", 0, 418, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("postLayer2OctetTotalCount", 0, 420, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("postMCastLayer2OctetTotalCount", 0, 421, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("minimumLayer2TotalLength", 0, 422, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("maximumLayer2TotalLength", 0, 423, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("droppedLayer2OctetDeltaCount", 0, 424, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("droppedLayer2OctetTotalCount", 0, 425, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("ignoredLayer2OctetTotalCount", 0, 426, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("notSentLayer2OctetTotalCount", 0, 427, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("layer2OctetDeltaSumOfSquares", 0, 428, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("layer2OctetTotalSumOfSquares", 0, 429, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("layer2FrameDeltaCount", 0, 430, 8, FB_IE_DELTACOUNTER | FB_UNITS_FRAMES | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("layer2FrameTotalCount", 0, 431, 8, FB_IE_TOTALCOUNTER | FB_UNITS_FRAMES | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("pseudoWireDestinationIPv4Address", 0, 432, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("ignoredLayer2FrameTotalCount", 0, 433, 8, FB_IE_TOTALCOUNTER | FB_UNITS_FRAMES | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("mibObjectValueInteger", 0, 434, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_INT_32, NULL),
+    FB_IE_INIT_FULL("mibObjectValueOctetString", 0, 435, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mibObjectValueOID", 0, 436, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mibObjectValueBits", 0, 437, FB_IE_VARLEN, FB_IE_FLAGS | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mibObjectValueIPAddress", 0, 438, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("mibObjectValueCounter", 0, 439, 8, FB_IE_SNMPCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("mibObjectValueGauge", 0, 440, 4, FB_IE_SNMPGAUGE | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("mibObjectValueTimeTicks", 0, 441, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("mibObjectValueUnsigned", 0, 442, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("mibObjectValueTable", 0, 443, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_SUB_TMPL_LIST, NULL),
+    FB_IE_INIT_FULL("mibObjectValueRow", 0, 444, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_SUB_TMPL_LIST, NULL),
+    FB_IE_INIT_FULL("mibObjectIdentifier", 0, 445, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mibSubIdentifier", 0, 446, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("mibIndexIndicator", 0, 447, 8, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("mibCaptureTimeSemantics", 0, 448, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("mibContextEngineID", 0, 449, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("mibContextName", 0, 450, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("mibObjectName", 0, 451, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("mibObjectDescription", 0, 452, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("mibObjectSyntax", 0, 453, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("mibModuleName", 0, 454, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("mobileIMSI", 0, 455, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("mobileMSISDN", 0, 456, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("httpStatusCode", 0, 457, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 999, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("sourceTransportPortsLimit", 0, 458, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 1, 65535, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("httpRequestMethod", 0, 459, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("httpRequestHost", 0, 460, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("httpRequestTarget", 0, 461, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("httpMessageVersion", 0, 462, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("natInstanceID", 0, 463, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("internalAddressRealm", 0, 464, FB_IE_VARLEN, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("externalAddressRealm", 0, 465, FB_IE_VARLEN, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("natQuotaExceededEvent", 0, 466, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("natThresholdEvent", 0, 467, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("httpUserAgent", 0, 468, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("httpContentType", 0, 469, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("httpReasonPhrase", 0, 470, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("maxSessionEntries", 0, 471, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("maxBIBEntries", 0, 472, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("maxEntriesPerUser", 0, 473, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("maxSubscribers", 0, 474, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("maxFragmentsPendingReassembly", 0, 475, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("addressPoolHighThreshold", 0, 476, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("addressPoolLowThreshold", 0, 477, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("addressPortMappingHighThreshold", 0, 478, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("addressPortMappingLowThreshold", 0, 479, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("addressPortMappingPerUserHighThreshold", 0, 480, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("globalAddressMappingHighThreshold", 0, 481, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("vpnIdentifier", 0, 482, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("bgpCommunity", 0, 483, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("bgpSourceCommunityList", 0, 484, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("bgpDestinationCommunityList", 0, 485, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("bgpExtendedCommunity", 0, 486, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("bgpSourceExtendedCommunityList", 0, 487, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("bgpDestinationExtendedCommunityList", 0, 488, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("bgpLargeCommunity", 0, 489, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("bgpSourceLargeCommunityList", 0, 490, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("bgpDestinationLargeCommunityList", 0, 491, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("NF_F_FW_EXT_EVENT", 0, 9997, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("NF_F_FW_EVENT", 0, 9998, 1, FB_IE_IDENTIFIER, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("ciscoNetflowGeneric", 0, 9999, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("templateName", 6871, 1000, FB_IE_VARLEN, FB_IE_DEFAULT, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("templateDescription", 6871, 1001, FB_IE_VARLEN, FB_IE_DEFAULT, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseOctetDeltaCount", 29305, 1, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePacketDeltaCount", 29305, 2, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseDeltaFlowCount", 29305, 3, 8, FB_IE_DELTACOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseProtocolIdentifier", 29305, 4, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIpClassOfService", 29305, 5, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseTcpControlBits", 29305, 6, 2, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseSourceTransportPort", 29305, 7, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseSourceIPv4Address", 29305, 8, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseSourceIPv4PrefixLength", 29305, 9, 1, FB_IE_QUANTITY | FB_UNITS_BITS | FB_IE_F_REVERSIBLE, 0, 32, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIngressInterface", 29305, 10, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseDestinationTransportPort", 29305, 11, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseDestinationIPv4Address", 29305, 12, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseDestinationIPv4PrefixLength", 29305, 13, 1, FB_IE_QUANTITY | FB_UNITS_BITS | FB_IE_F_REVERSIBLE, 0, 32, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseEgressInterface", 29305, 14, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseIpNextHopIPv4Address", 29305, 15, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseBgpSourceAsNumber", 29305, 16, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseBgpDestinationAsNumber", 29305, 17, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseBgpNextHopIPv4Address", 29305, 18, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reversePostMCastPacketDeltaCount", 29305, 19, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePostMCastOctetDeltaCount", 29305, 20, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseFlowEndSysUpTime", 29305, 21, 4, FB_IE_QUANTITY | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseFlowStartSysUpTime", 29305, 22, 4, FB_IE_QUANTITY | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reversePostOctetDeltaCount", 29305, 23, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePostPacketDeltaCount", 29305, 24, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseMinimumIpTotalLength", 29305, 25, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseMaximumIpTotalLength", 29305, 26, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseSourceIPv6Address", 29305, 27, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseDestinationIPv6Address", 29305, 28, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseSourceIPv6PrefixLength", 29305, 29, 1, FB_IE_QUANTITY | FB_UNITS_BITS | FB_IE_F_REVERSIBLE, 0, 128, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseDestinationIPv6PrefixLength", 29305, 30, 1, FB_IE_QUANTITY | FB_UNITS_BITS | FB_IE_F_REVERSIBLE, 0, 128, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseFlowLabelIPv6", 29305, 31, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0xFFFFF, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseIcmpTypeCodeIPv4", 29305, 32, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseIgmpType", 29305, 33, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseSamplingInterval", 29305, 34, 4, FB_IE_QUANTITY | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseSamplingAlgorithm", 29305, 35, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseFlowActiveTimeout", 29305, 36, 2, FB_IE_QUANTITY | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseFlowIdleTimeout", 29305, 37, 2, FB_IE_QUANTITY | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseEngineType", 29305, 38, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseEngineId", 29305, 39, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIpv4RouterSc", 29305, 43, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseSourceIPv4Prefix", 29305, 44, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseDestinationIPv4Prefix", 29305, 45, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseMplsTopLabelType", 29305, 46, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseMplsTopLabelIPv4Address", 29305, 47, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseSamplerId", 29305, 48, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseSamplerMode", 29305, 49, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseSamplerRandomInterval", 29305, 50, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseClassId", 29305, 51, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseMinimumTTL", 29305, 52, 1, FB_IE_QUANTITY | FB_UNITS_HOPS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseMaximumTTL", 29305, 53, 1, FB_IE_QUANTITY | FB_UNITS_HOPS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseFragmentIdentification", 29305, 54, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reversePostIpClassOfService", 29305, 55, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseSourceMacAddress", 29305, 56, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("reversePostDestinationMacAddress", 29305, 57, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseVlanId", 29305, 58, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reversePostVlanId", 29305, 59, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseIpVersion", 29305, 60, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseFlowDirection", 29305, 61, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIpNextHopIPv6Address", 29305, 62, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseBgpNextHopIPv6Address", 29305, 63, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseIpv6ExtensionHeaders", 29305, 64, 4, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMplsTopLabelStackSection", 29305, 70, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackSection2", 29305, 71, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackSection3", 29305, 72, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackSection4", 29305, 73, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackSection5", 29305, 74, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackSection6", 29305, 75, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackSection7", 29305, 76, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackSection8", 29305, 77, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackSection9", 29305, 78, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackSection10", 29305, 79, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseDestinationMacAddress", 29305, 80, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("reversePostSourceMacAddress", 29305, 81, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseInterfaceName", 29305, 82, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseInterfaceDescription", 29305, 83, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseSamplerName", 29305, 84, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseOctetTotalCount", 29305, 85, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePacketTotalCount", 29305, 86, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseFlagsAndSamplerId", 29305, 87, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseFragmentOffset", 29305, 88, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0x1FFF, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseForwardingStatus", 29305, 89, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseMplsVpnRouteDistinguisher", 29305, 90, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsTopLabelPrefixLength", 29305, 91, 1, FB_IE_QUANTITY | FB_UNITS_BITS | FB_IE_F_REVERSIBLE, 0, 32, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseSrcTrafficIndex", 29305, 92, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseDstTrafficIndex", 29305, 93, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseApplicationDescription", 29305, 94, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseApplicationId", 29305, 95, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseApplicationName", 29305, 96, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reversePostIpDiffServCodePoint", 29305, 98, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 63, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseMulticastReplicationFactor", 29305, 99, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseClassName", 29305, 100, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseClassificationEngineId", 29305, 101, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseLayer2packetSectionOffset", 29305, 102, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseLayer2packetSectionSize", 29305, 103, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseLayer2packetSectionData", 29305, 104, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseBgpNextAdjacentAsNumber", 29305, 128, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseBgpPrevAdjacentAsNumber", 29305, 129, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseDroppedOctetDeltaCount", 29305, 132, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseDroppedPacketDeltaCount", 29305, 133, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseDroppedOctetTotalCount", 29305, 134, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseDroppedPacketTotalCount", 29305, 135, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseFlowEndReason", 29305, 136, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseObservationPointId", 29305, 138, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseIcmpTypeCodeIPv6", 29305, 139, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseMplsTopLabelIPv6Address", 29305, 140, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseLineCardId", 29305, 141, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reversePortId", 29305, 142, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMeteringProcessId", 29305, 143, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseExportingProcessId", 29305, 144, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseWlanChannelId", 29305, 146, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseWlanSSID", 29305, 147, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseFlowStartSeconds", 29305, 150, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("reverseFlowEndSeconds", 29305, 151, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("reverseFlowStartMilliseconds", 29305, 152, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("reverseFlowEndMilliseconds", 29305, 153, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("reverseFlowStartMicroseconds", 29305, 154, 8, FB_IE_DEFAULT | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MICROSEC, NULL),
+    FB_IE_INIT_FULL("reverseFlowEndMicroseconds", 29305, 155, 8, FB_IE_DEFAULT | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MICROSEC, NULL),
+    FB_IE_INIT_FULL("reverseFlowStartNanoseconds", 29305, 156, 8, FB_IE_DEFAULT | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_NANOSEC, NULL),
+    FB_IE_INIT_FULL("reverseFlowEndNanoseconds", 29305, 157, 8, FB_IE_DEFAULT | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_NANOSEC, NULL),
+    FB_IE_INIT_FULL("reverseFlowStartDeltaMicroseconds", 29305, 158, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseFlowEndDeltaMicroseconds", 29305, 159, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseSystemInitTimeMilliseconds", 29305, 160, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("reverseFlowDurationMilliseconds", 29305, 161, 4, FB_IE_QUANTITY | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseFlowDurationMicroseconds", 29305, 162, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseDestinationIPv6Prefix", 29305, 169, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseSourceIPv6Prefix", 29305, 170, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("reversePostOctetTotalCount", 29305, 171, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePostPacketTotalCount", 29305, 172, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePostMCastPacketTotalCount", 29305, 174, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePostMCastOctetTotalCount", 29305, 175, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseIcmpTypeIPv4", 29305, 176, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIcmpCodeIPv4", 29305, 177, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIcmpTypeIPv6", 29305, 178, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIcmpCodeIPv6", 29305, 179, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseUdpSourcePort", 29305, 180, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseUdpDestinationPort", 29305, 181, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseTcpSourcePort", 29305, 182, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseTcpDestinationPort", 29305, 183, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseTcpSequenceNumber", 29305, 184, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseTcpAcknowledgementNumber", 29305, 185, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseTcpWindowSize", 29305, 186, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseTcpUrgentPointer", 29305, 187, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseTcpHeaderLength", 29305, 188, 1, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIpHeaderLength", 29305, 189, 1, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseTotalLengthIPv4", 29305, 190, 2, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reversePayloadLengthIPv6", 29305, 191, 2, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseIpTTL", 29305, 192, 1, FB_IE_QUANTITY | FB_UNITS_HOPS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseNextHeaderIPv6", 29305, 193, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseMplsPayloadLength", 29305, 194, 4, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseIpDiffServCodePoint", 29305, 195, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 63, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIpPrecedence", 29305, 196, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 7, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseFragmentFlags", 29305, 197, 1, FB_IE_FLAGS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseOctetDeltaSumOfSquares", 29305, 198, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseOctetTotalSumOfSquares", 29305, 199, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseMplsTopLabelTTL", 29305, 200, 1, FB_IE_QUANTITY | FB_UNITS_HOPS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackLength", 29305, 201, 4, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackDepth", 29305, 202, 4, FB_IE_QUANTITY | FB_UNITS_ENTRIES | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMplsTopLabelExp", 29305, 203, 1, FB_IE_FLAGS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIpPayloadLength", 29305, 204, 4, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseUdpMessageLength", 29305, 205, 2, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseIsMulticast", 29305, 206, 1, FB_IE_FLAGS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIpv4IHL", 29305, 207, 1, FB_IE_QUANTITY | FB_UNITS_WORDS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIpv4Options", 29305, 208, 4, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseTcpOptions", 29305, 209, 8, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseTcpSynTotalCount", 29305, 218, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseTcpFinTotalCount", 29305, 219, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseTcpRstTotalCount", 29305, 220, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseTcpPshTotalCount", 29305, 221, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseTcpAckTotalCount", 29305, 222, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseTcpUrgTotalCount", 29305, 223, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseIpTotalLength", 29305, 224, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePostNATSourceIPv4Address", 29305, 225, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reversePostNATDestinationIPv4Address", 29305, 226, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reversePostNAPTSourceTransportPort", 29305, 227, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reversePostNAPTDestinationTransportPort", 29305, 228, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseNatOriginatingAddressRealm", 29305, 229, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 1, 2, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseNatEvent", 29305, 230, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseInitiatorOctets", 29305, 231, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseResponderOctets", 29305, 232, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseFirewallEvent", 29305, 233, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIngressVRFID", 29305, 234, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseEgressVRFID", 29305, 235, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseVRFname", 29305, 236, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reversePostMplsTopLabelExp", 29305, 237, 1, FB_IE_FLAGS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseTcpWindowScale", 29305, 238, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseEthernetHeaderLength", 29305, 240, 1, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseEthernetPayloadLength", 29305, 241, 2, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseEthernetTotalLength", 29305, 242, 2, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseDot1qVlanId", 29305, 243, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseDot1qPriority", 29305, 244, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseDot1qCustomerVlanId", 29305, 245, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseDot1qCustomerPriority", 29305, 246, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseMetroEvcId", 29305, 247, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseMetroEvcType", 29305, 248, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reversePseudoWireId", 29305, 249, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reversePseudoWireType", 29305, 250, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reversePseudoWireControlWord", 29305, 251, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseIngressPhysicalInterface", 29305, 252, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseEgressPhysicalInterface", 29305, 253, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reversePostDot1qVlanId", 29305, 254, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reversePostDot1qCustomerVlanId", 29305, 255, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseEthernetType", 29305, 256, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reversePostIpPrecedence", 29305, 257, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 7, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseCollectionTimeMilliseconds", 29305, 258, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("reverseExportSctpStreamId", 29305, 259, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseMaxExportSeconds", 29305, 260, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("reverseMaxFlowEndSeconds", 29305, 261, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("reverseMessageMD5Checksum", 29305, 262, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMessageScope", 29305, 263, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseMinExportSeconds", 29305, 264, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("reverseMinFlowStartSeconds", 29305, 265, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("reverseOpaqueOctets", 29305, 266, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseSessionScope", 29305, 267, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseMaxFlowEndMicroseconds", 29305, 268, 8, FB_IE_DEFAULT | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MICROSEC, NULL),
+    FB_IE_INIT_FULL("reverseMaxFlowEndMilliseconds", 29305, 269, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("reverseMaxFlowEndNanoseconds", 29305, 270, 8, FB_IE_DEFAULT | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_NANOSEC, NULL),
+    FB_IE_INIT_FULL("reverseMinFlowStartMicroseconds", 29305, 271, 8, FB_IE_DEFAULT | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MICROSEC, NULL),
+    FB_IE_INIT_FULL("reverseMinFlowStartMilliseconds", 29305, 272, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("reverseMinFlowStartNanoseconds", 29305, 273, 8, FB_IE_DEFAULT | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_NANOSEC, NULL),
+    FB_IE_INIT_FULL("reverseCollectorCertificate", 29305, 274, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseExporterCertificate", 29305, 275, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseDataRecordsReliability", 29305, 276, 1, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_BOOL, NULL),
+    FB_IE_INIT_FULL("reverseObservationPointType", 29305, 277, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseNewConnectionDeltaCount", 29305, 278, 4, FB_IE_DELTACOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseConnectionSumDurationSeconds", 29305, 279, 8, FB_IE_QUANTITY | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseConnectionTransactionId", 29305, 280, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePostNATSourceIPv6Address", 29305, 281, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("reversePostNATDestinationIPv6Address", 29305, 282, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseNatPoolId", 29305, 283, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseNatPoolName", 29305, 284, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseAnonymizationFlags", 29305, 285, 2, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseAnonymizationTechnique", 29305, 286, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseInformationElementIndex", 29305, 287, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseP2pTechnology", 29305, 288, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseTunnelTechnology", 29305, 289, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseEncryptedTechnology", 29305, 290, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseBasicList", 29305, 291, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("reverseSubTemplateList", 29305, 292, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_SUB_TMPL_LIST, NULL),
+    FB_IE_INIT_FULL("reverseSubTemplateMultiList", 29305, 293, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_SUB_TMPL_MULTI_LIST, NULL),
+    FB_IE_INIT_FULL("reverseBgpValidityState", 29305, 294, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseIPSecSPI", 29305, 295, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseGreKey", 29305, 296, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseNatType", 29305, 297, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseInitiatorPackets", 29305, 298, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseResponderPackets", 29305, 299, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseObservationDomainName", 29305, 300, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseSelectionSequenceId", 29305, 301, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseSelectorId", 29305, 302, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseInformationElementId", 29305, 303, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseSelectorAlgorithm", 29305, 304, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseSamplingPacketInterval", 29305, 305, 4, FB_IE_QUANTITY | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseSamplingPacketSpace", 29305, 306, 4, FB_IE_QUANTITY | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseSamplingTimeInterval", 29305, 307, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseSamplingTimeSpace", 29305, 308, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseSamplingSize", 29305, 309, 4, FB_IE_QUANTITY | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseSamplingPopulation", 29305, 310, 4, FB_IE_QUANTITY | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseSamplingProbability", 29305, 311, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("reverseDataLinkFrameSize", 29305, 312, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseIpHeaderPacketSection", 29305, 313, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseIpPayloadPacketSection", 29305, 314, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseDataLinkFrameSection", 29305, 315, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsLabelStackSection", 29305, 316, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMplsPayloadPacketSection", 29305, 317, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseSelectorIdTotalPktsObserved", 29305, 318, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseSelectorIdTotalPktsSelected", 29305, 319, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseAbsoluteError", 29305, 320, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("reverseRelativeError", 29305, 321, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("reverseObservationTimeSeconds", 29305, 322, 4, FB_IE_DEFAULT | FB_UNITS_SECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_SEC, NULL),
+    FB_IE_INIT_FULL("reverseObservationTimeMilliseconds", 29305, 323, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("reverseObservationTimeMicroseconds", 29305, 324, 8, FB_IE_DEFAULT | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MICROSEC, NULL),
+    FB_IE_INIT_FULL("reverseObservationTimeNanoseconds", 29305, 325, 8, FB_IE_DEFAULT | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_NANOSEC, NULL),
+    FB_IE_INIT_FULL("reverseDigestHashValue", 29305, 326, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseHashIPPayloadOffset", 29305, 327, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseHashIPPayloadSize", 29305, 328, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseHashOutputRangeMin", 29305, 329, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseHashOutputRangeMax", 29305, 330, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseHashSelectedRangeMin", 29305, 331, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseHashSelectedRangeMax", 29305, 332, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseHashDigestOutput", 29305, 333, 1, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_BOOL, NULL),
+    FB_IE_INIT_FULL("reverseHashInitialiserValue", 29305, 334, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseSelectorName", 29305, 335, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseUpperCILimit", 29305, 336, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("reverseLowerCILimit", 29305, 337, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("reverseConfidenceLevel", 29305, 338, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_FLOAT_64, NULL),
+    FB_IE_INIT_FULL("reverseInformationElementDataType", 29305, 339, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseInformationElementDescription", 29305, 340, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseInformationElementName", 29305, 341, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseInformationElementRangeBegin", 29305, 342, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseInformationElementRangeEnd", 29305, 343, 8, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseInformationElementSemantics", 29305, 344, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseInformationElementUnits", 29305, 345, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reversePrivateEnterpriseNumber", 29305, 346, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseVirtualStationInterfaceId", 29305, 347, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseVirtualStationInterfaceName", 29305, 348, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseVirtualStationUUID", 29305, 349, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseVirtualStationName", 29305, 350, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseLayer2SegmentId", 29305, 351, 8, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseLayer2OctetDeltaCount", 29305, 352, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseLayer2OctetTotalCount", 29305, 353, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseIngressUnicastPacketTotalCount", 29305, 354, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseIngressMulticastPacketTotalCount", 29305, 355, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseIngressBroadcastPacketTotalCount", 29305, 356, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseEgressUnicastPacketTotalCount", 29305, 357, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseEgressBroadcastPacketTotalCount", 29305, 358, 8, FB_IE_TOTALCOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseMonitoringIntervalStartMilliSeconds", 29305, 359, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("reverseMonitoringIntervalEndMilliSeconds", 29305, 360, 8, FB_IE_DEFAULT | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_DT_MILSEC, NULL),
+    FB_IE_INIT_FULL("reversePortRangeStart", 29305, 361, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reversePortRangeEnd", 29305, 362, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reversePortRangeStepSize", 29305, 363, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reversePortRangeNumPorts", 29305, 364, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseStaMacAddress", 29305, 365, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseStaIPv4Address", 29305, 366, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseWtpMacAddress", 29305, 367, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseIngressInterfaceType", 29305, 368, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseEgressInterfaceType", 29305, 369, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseRtpSequenceNumber", 29305, 370, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseUserName", 29305, 371, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseApplicationCategoryName", 29305, 372, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseApplicationSubCategoryName", 29305, 373, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseApplicationGroupName", 29305, 374, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseOriginalFlowsPresent", 29305, 375, 8, FB_IE_DELTACOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseOriginalFlowsInitiated", 29305, 376, 8, FB_IE_DELTACOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseOriginalFlowsCompleted", 29305, 377, 8, FB_IE_DELTACOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseDistinctCountOfSourceIPAddress", 29305, 378, 8, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseDistinctCountOfDestinationIPAddress", 29305, 379, 8, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseDistinctCountOfSourceIPv4Address", 29305, 380, 4, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseDistinctCountOfDestinationIPv4Address", 29305, 381, 4, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseDistinctCountOfSourceIPv6Address", 29305, 382, 8, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseDistinctCountOfDestinationIPv6Address", 29305, 383, 8, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseValueDistributionMethod", 29305, 384, 1, FB_IE_QUANTITY | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseRfc3550JitterMilliseconds", 29305, 385, 4, FB_IE_QUANTITY | FB_UNITS_MILLISECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseRfc3550JitterMicroseconds", 29305, 386, 4, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseRfc3550JitterNanoseconds", 29305, 387, 4, FB_IE_QUANTITY | FB_UNITS_NANOSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseDot1qDEI", 29305, 388, 1, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_BOOL, NULL),
+    FB_IE_INIT_FULL("reverseDot1qCustomerDEI", 29305, 389, 1, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_BOOL, NULL),
+    FB_IE_INIT_FULL("reverseFlowSelectorAlgorithm", 29305, 390, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseFlowSelectedOctetDeltaCount", 29305, 391, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseFlowSelectedPacketDeltaCount", 29305, 392, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseFlowSelectedFlowDeltaCount", 29305, 393, 8, FB_IE_DELTACOUNTER | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseSelectorIDTotalFlowsObserved", 29305, 394, 8, FB_IE_QUANTITY | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseSelectorIDTotalFlowsSelected", 29305, 395, 8, FB_IE_QUANTITY | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseSamplingFlowInterval", 29305, 396, 8, FB_IE_QUANTITY | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseSamplingFlowSpacing", 29305, 397, 8, FB_IE_QUANTITY | FB_UNITS_FLOWS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseFlowSamplingTimeInterval", 29305, 398, 8, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseFlowSamplingTimeSpacing", 29305, 399, 8, FB_IE_QUANTITY | FB_UNITS_MICROSECONDS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseHashFlowDomain", 29305, 400, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseTransportOctetDeltaCount", 29305, 401, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseTransportPacketDeltaCount", 29305, 402, 8, FB_IE_DELTACOUNTER | FB_UNITS_PACKETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseOriginalExporterIPv4Address", 29305, 403, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseOriginalExporterIPv6Address", 29305, 404, 16, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_IP6_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseOriginalObservationDomainId", 29305, 405, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseIntermediateProcessId", 29305, 406, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseIgnoredDataRecordTotalCount", 29305, 407, 8, FB_IE_TOTALCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseDataLinkFrameType", 29305, 408, 2, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseSectionOffset", 29305, 409, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseSectionExportedOctets", 29305, 410, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseDot1qServiceInstanceTag", 29305, 411, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseDot1qServiceInstanceId", 29305, 412, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0xFFFFFF, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseDot1qServiceInstancePriority", 29305, 413, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 7, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseDot1qCustomerSourceMacAddress", 29305, 414, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseDot1qCustomerDestinationMacAddress", 29305, 415, 6, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_MAC_ADDR, NULL),
+    FB_IE_INIT_FULL("reversePostLayer2OctetDeltaCount", 29305, 417, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePostMCastLayer2OctetDeltaCount", 29305, 418, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePostLayer2OctetTotalCount", 29305, 420, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePostMCastLayer2OctetTotalCount", 29305, 421, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseMinimumLayer2TotalLength", 29305, 422, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseMaximumLayer2TotalLength", 29305, 423, 8, FB_IE_QUANTITY | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseDroppedLayer2OctetDeltaCount", 29305, 424, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseDroppedLayer2OctetTotalCount", 29305, 425, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseIgnoredLayer2OctetTotalCount", 29305, 426, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseNotSentLayer2OctetTotalCount", 29305, 427, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseLayer2OctetDeltaSumOfSquares", 29305, 428, 8, FB_IE_DELTACOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseLayer2OctetTotalSumOfSquares", 29305, 429, 8, FB_IE_TOTALCOUNTER | FB_UNITS_OCTETS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseLayer2FrameDeltaCount", 29305, 430, 8, FB_IE_DELTACOUNTER | FB_UNITS_FRAMES | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseLayer2FrameTotalCount", 29305, 431, 8, FB_IE_TOTALCOUNTER | FB_UNITS_FRAMES | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reversePseudoWireDestinationIPv4Address", 29305, 432, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseIgnoredLayer2FrameTotalCount", 29305, 433, 8, FB_IE_TOTALCOUNTER | FB_UNITS_FRAMES | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectValueInteger", 29305, 434, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_INT_32, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectValueOctetString", 29305, 435, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectValueOID", 29305, 436, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectValueBits", 29305, 437, FB_IE_VARLEN, FB_IE_FLAGS | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectValueIPAddress", 29305, 438, 4, FB_IE_DEFAULT | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_IP4_ADDR, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectValueCounter", 29305, 439, 8, FB_IE_SNMPCOUNTER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectValueGauge", 29305, 440, 4, FB_IE_SNMPGAUGE | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectValueTimeTicks", 29305, 441, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectValueUnsigned", 29305, 442, 4, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectValueTable", 29305, 443, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_SUB_TMPL_LIST, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectValueRow", 29305, 444, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_SUB_TMPL_LIST, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectIdentifier", 29305, 445, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMibSubIdentifier", 29305, 446, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMibIndexIndicator", 29305, 447, 8, FB_IE_FLAGS | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_64, NULL),
+    FB_IE_INIT_FULL("reverseMibCaptureTimeSemantics", 29305, 448, 1, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_8, NULL),
+    FB_IE_INIT_FULL("reverseMibContextEngineID", 29305, 449, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseMibContextName", 29305, 450, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectName", 29305, 451, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectDescription", 29305, 452, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseMibObjectSyntax", 29305, 453, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseMibModuleName", 29305, 454, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseMobileIMSI", 29305, 455, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseMobileMSISDN", 29305, 456, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseHttpStatusCode", 29305, 457, 2, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 999, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseSourceTransportPortsLimit", 29305, 458, 2, FB_IE_QUANTITY | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 1, 65535, FB_UINT_16, NULL),
+    FB_IE_INIT_FULL("reverseHttpRequestMethod", 29305, 459, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseHttpRequestHost", 29305, 460, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseHttpRequestTarget", 29305, 461, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseHttpMessageVersion", 29305, 462, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseNatInstanceID", 29305, 463, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseInternalAddressRealm", 29305, 464, FB_IE_VARLEN, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseExternalAddressRealm", 29305, 465, FB_IE_VARLEN, FB_IE_IDENTIFIER | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseNatQuotaExceededEvent", 29305, 466, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseNatThresholdEvent", 29305, 467, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseHttpUserAgent", 29305, 468, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseHttpContentType", 29305, 469, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseHttpReasonPhrase", 29305, 470, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_STRING, NULL),
+    FB_IE_INIT_FULL("reverseMaxSessionEntries", 29305, 471, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMaxBIBEntries", 29305, 472, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMaxEntriesPerUser", 29305, 473, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMaxSubscribers", 29305, 474, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseMaxFragmentsPendingReassembly", 29305, 475, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseAddressPoolHighThreshold", 29305, 476, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseAddressPoolLowThreshold", 29305, 477, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseAddressPortMappingHighThreshold", 29305, 478, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseAddressPortMappingLowThreshold", 29305, 479, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseAddressPortMappingPerUserHighThreshold", 29305, 480, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseGlobalAddressMappingHighThreshold", 29305, 481, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseVpnIdentifier", 29305, 482, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseBgpCommunity", 29305, 483, 4, FB_IE_IDENTIFIER | FB_IE_F_ENDIAN | FB_IE_F_REVERSIBLE, 0, 0, FB_UINT_32, NULL),
+    FB_IE_INIT_FULL("reverseBgpSourceCommunityList", 29305, 484, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("reverseBgpDestinationCommunityList", 29305, 485, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("reverseBgpExtendedCommunity", 29305, 486, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseBgpSourceExtendedCommunityList", 29305, 487, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("reverseBgpDestinationExtendedCommunityList", 29305, 488, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("reverseBgpLargeCommunity", 29305, 489, FB_IE_VARLEN, FB_IE_DEFAULT | FB_IE_F_REVERSIBLE, 0, 0, FB_OCTET_ARRAY, NULL),
+    FB_IE_INIT_FULL("reverseBgpSourceLargeCommunityList", 29305, 490, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_INIT_FULL("reverseBgpDestinationLargeCommunityList", 29305, 491, FB_IE_VARLEN, FB_IE_LIST | FB_IE_F_REVERSIBLE, 0, 0, FB_BASIC_LIST, NULL),
+    FB_IE_NULL
+};
+
+static const uint32_t infomodel_prebuilt_id_seeds[] = {
+    7, 5, 44, 3, 2, 3, 1, 7,
+    10, 10, 20, 1, 2, 11, 3, 0,
+    23, 5, 97, 9, 0, 1, 43, 17,
+    1, 61, 4, 1, 20, 25, 63, 23,
+    9, 5, 4, 27, 8, 4, 63, 25,
+    8, 61, 1, 35, 6, 47, 5, 85,
+    42, 73, 14, 17, 3, 17, 9, 4,
+    19, 14, 25, 29, 7, 16, 16, 26,
+    5, 56, 3, 6, 1, 11, 39, 14,
+    2, 4, 8, 0, 73, 3, 13, 2,
+    16, 15, 60, 8, 34, 9, 2, 3,
+    7, 1, 56, 8, 29, 15, 78, 27,
+    1, 11, 2, 21, 2, 2, 4, 8,
+    9, 18, 10, 3, 3, 6, 24, 5,
+    78, 2, 2, 1, 22, 11, 4, 8,
+    14, 63, 128, 40, 25, 52, 4, 1,
+    201, 15, 69, 17, 6, 53, 15, 12,
+    22, 136, 2, 8, 31, 2, 98, 15,
+    1, 4, 190, 7, 2, 8, 10, 111,
+    28, 1, 24, 3, 159, 6, 20, 6,
+    5, 23, 34, 1, 8, 14, 10, 27,
+    2, 40, 174, 1, 43, 103, 4, 4,
+    1, 41, 76, 46, 5, 33, 132, 1,
+    1, 3, 6, 10, 1, 1, 39, 110,
+    3, 5, 12, 4, 12, 5, 14, 59,
+    50, 114, 21, 20, 2, 8, 5, 101,
+    44, 3, 225, 91, 91, 158, 8, 0,
+    72, 105, 107, 12, 32, 1, 12, 5,
+    0, 2, 60, 0, 0, 10, 106, 13,
+    34, 75, 346, 4, 106, 25, 136, 107,
+    92, 110, 69, 13, 4, 4, 15, 39,
+    0, 10, 75, 58, 5, 0, 35, 159,
+    24, 13, 61, 13, 444, 2, 144, 9,
+    39, 145, 493, 1, 355, 17, 42, 52,
+    1, 125, 331, 353, 51, 373, 384, 243,
+    18, 720, 20, 68, 104, 509, 3, 10,
+    225, 373, 4, 13, 0, 0, 0, 187,
+    443, 9, 18, 462, 19,
+};
+
+static const uint16_t infomodel_prebuilt_id_slots[] = {
+    187, 500, 195, 690, 182, 82, 372, 884,
+    479, 853, 214, 655, 617, 230, 544, 642,
+    818, 516, 339, 787, 259, 125, 168, 276,
+    337, 72, 562, 692, 483, 882, 782, 676,
+    105, 140, 879, 42, 133, 781, 257, 716,
+    812, 442, 612, 171, 132, 343, 328, 31,
+    300, 635, 828, 242, 597, 527, 530, 361,
+    219, 827, 293, 121, 157, 587, 751, 535,
+    95, 89, 569, 665, 674, 420, 209, 282,
+    53, 627, 649, 20, 613, 496, 43, 467,
+    533, 761, 645, 532, 501, 155, 596, 321,
+    346, 624, 843, 342, 550, 702, 142, 477,
+    746, 194, 54, 480, 239, 222, 107, 586,
+    334, 350, 364, 663, 384, 822, 5, 668,
+    685, 240, 83, 833, 720, 703, 158, 780,
+    253, 729, 32, 796, 338, 819, 64, 582,
+    687, 893, 366, 472, 27, 192, 405, 280,
+    765, 694, 790, 368, 304, 551, 395, 143,
+    578, 698, 762, 490, 869, 367, 763, 709,
+    123, 11, 475, 437, 163, 377, 797, 757,
+    728, 800, 62, 426, 68, 120, 260, 614,
+    414, 540, 874, 21, 212, 726, 896, 658,
+    202, 391, 249, 813, 545, 466, 474, 802,
+    256, 285, 229, 104, 29, 310, 553, 714,
+    135, 854, 592, 492, 650, 201, 759, 50,
+    19, 616, 48, 358, 335, 897, 35, 122,
+    599, 825, 37, 678, 745, 362, 296, 831,
+    52, 555, 742, 425, 85, 211, 289, 515,
+    91, 524, 305, 397, 509, 770, 1, 330,
+    134, 824, 750, 351, 38, 216, 353, 573,
+    59, 863, 428, 637, 380, 661, 507, 730,
+    461, 432, 468, 801, 556, 858, 636, 203,
+    463, 691, 888, 731, 760, 727, 542, 30,
+    498, 238, 722, 336, 175, 389, 292, 94,
+    172, 263, 416, 767, 519, 646, 852, 127,
+    252, 829, 160, 277, 25, 772, 320, 739,
+    178, 581, 849, 593, 218, 579, 710, 302,
+    208, 734, 602, 465, 567, 106, 575, 723,
+    484, 529, 215, 443, 232, 638, 588, 401,
+    76, 699, 65, 830, 410, 180, 139, 737,
+    521, 652, 161, 394, 376, 733, 841, 887,
+    626, 894, 615, 644, 58, 251, 47, 427,
+    152, 718, 69, 891, 228, 340, 421, 494,
+    799, 594, 595, 789, 570, 531, 756, 774,
+    90, 435, 322, 348, 753, 871, 407, 258,
+    184, 684, 864, 110, 144, 717, 176, 495,
+    453, 458, 347, 502, 842, 301, 70, 543,
+    840, 503, 872, 430, 504, 511, 633, 505,
+    559, 859, 294, 331, 609, 856, 71, 460,
+    892, 706, 77, 584, 136, 512, 357, 826,
+    876, 724, 817, 899, 149, 164, 711, 429,
+    279, 654, 269, 679, 3, 625, 795, 307,
+    63, 75, 446, 308, 563, 738, 445, 317,
+    137, 205, 778, 281, 325, 482, 14, 836,
+    835, 17, 883, 701, 821, 243, 244, 603,
+    153, 459, 577, 341, 895, 462, 46, 845,
+    754, 286, 220, 156, 299, 640, 60, 329,
+    725, 473, 254, 61, 398, 344, 457, 568,
+    898, 96, 546, 890, 508, 117, 196, 878,
+    634, 324, 352, 382, 241, 478, 528, 115,
+    598, 561, 67, 522, 261, 487, 327, 200,
+    440, 355, 119, 585, 287, 360, 98, 409,
+    284, 265, 309, 233, 647, 525, 169, 262,
+    755, 128, 388, 373, 114, 565, 680, 865,
+    786, 267, 662, 732, 798, 74, 452, 622,
+    873, 191, 449, 695, 815, 639, 510, 485,
+    386, 438, 400, 736, 851, 271, 554, 181,
+    810, 809, 116, 433, 439, 274, 275, 608,
+    165, 213, 820, 173, 832, 444, 79, 23,
+    651, 838, 206, 758, 619, 4, 312, 210,
+    24, 677, 0, 631, 207, 268, 235, 288,
+    246, 771, 860, 861, 375, 49, 548, 92,
+    87, 708, 315, 413, 2, 250, 313, 764,
+    839, 600, 493, 794, 141, 290, 688, 441,
+    162, 506, 670, 850, 109, 177, 704, 807,
+    792, 534, 777, 808, 16, 464, 424, 412,
+    55, 199, 80, 572, 392, 768, 471, 846,
+    170, 415, 124, 224, 399, 297, 434, 886,
+    857, 147, 370, 630, 855, 385, 641, 476,
+    311, 73, 423, 574, 369, 881, 247, 517,
+    278, 159, 539, 374, 793, 456, 8, 354,
+    666, 371, 514, 513, 390, 138, 686, 319,
+    333, 488, 186, 448, 576, 18, 221, 146,
+    417, 264, 270, 447, 204, 225, 591, 875,
+    773, 715, 705, 272, 108, 747, 837, 620,
+    248, 621, 298, 100, 365, 223, 174, 713,
+    520, 744, 683, 455, 217, 419, 190, 623,
+    712, 721, 885, 880, 470, 408, 57, 396,
+    469, 870, 743, 26, 154, 12, 112, 454,
+    552, 823, 7, 481, 653, 383, 497, 40,
+    234, 86, 749, 590, 45, 34, 84, 349,
+    6, 536, 189, 179, 693, 56, 198, 889,
+    862, 150, 560, 607, 848, 604, 589, 78,
+    558, 126, 306, 450, 868, 805, 363, 97,
+    814, 99, 193, 36, 39, 231, 185, 541,
+    188, 411, 406, 345, 877, 130, 791, 13,
+    847, 255, 22, 131, 381, 167, 697, 318,
+    103, 403, 844, 145, 689, 33, 9, 51,
+    605, 236, 332, 806, 245, 227, 518, 696,
+    566, 356, 422, 700, 549, 656, 783, 769,
+    682, 148, 779, 785, 610, 643, 102, 735,
+    183, 784, 266, 66, 402, 671, 323, 766,
+    648, 499, 431, 748, 669, 404, 660, 451,
+    15, 628, 88, 788, 314, 681, 226, 113,
+    359, 571, 326, 436, 283, 526, 197, 44,
+    523, 151, 866, 393, 580, 295, 273, 93,
+    601, 387, 672, 606, 618, 418, 237, 81,
+    316, 291, 564, 816, 378, 629, 166, 803,
+    707, 740, 675, 632, 804, 486, 673, 129,
+    659, 379, 583, 557, 867, 776, 775, 719,
+    657, 303, 537, 811, 118, 741, 664, 752,
+    111, 101, 41, 10, 667, 28, 491, 547,
+    611, 834, 489, 538,
+};
+
+static const uint32_t infomodel_prebuilt_name_seeds[] = {
+    4, 12, 42, 22, 1, 42, 8, 3,
+    0, 22, 5, 20, 2, 1, 1, 8,
+    10, 0, 34, 39, 0, 1, 12, 24,
+    2, 1, 4, 27, 92, 3, 9, 1,
+    1, 3, 3, 11, 3, 73, 2, 2,
+    24, 53, 111, 31, 1, 8, 23, 0,
+    39, 8, 23, 15, 6, 4, 18, 21,
+    8, 7, 5, 1, 18, 1, 7, 15,
+    26, 42, 114, 0, 2, 12, 203, 34,
+    3, 25, 14, 48, 1, 0, 12, 4,
+    106, 125, 5, 17, 32, 6, 13, 34,
+    3, 2, 20, 3, 37, 8, 8, 4,
+    17, 7, 48, 13, 4, 1, 27, 21,
+    56, 76, 1, 1, 2, 13, 16, 60,
+    3, 5, 149, 5, 87, 9, 12, 34,
+    4, 7, 5, 31, 0, 96, 1, 9,
+    33, 14, 81, 1, 7, 1, 2, 1,
+    7, 7, 13, 44, 63, 3, 7, 22,
+    3, 18, 69, 67, 50, 9, 7, 130,
+    40, 16, 15, 18, 2, 7, 133, 70,
+    135, 8, 1, 2, 48, 39, 33, 1,
+    15, 0, 2, 0, 2, 6, 59, 68,
+    11, 115, 57, 100, 32, 2, 14, 4,
+    234, 1, 10, 151, 21, 0, 144, 24,
+    78, 50, 21, 6, 28, 2, 0, 30,
+    0, 84, 12, 1, 1, 1, 39, 4,
+    104, 6, 2, 31, 33, 23, 7, 31,
+    43, 193, 1, 41, 2, 10, 105, 4,
+    20, 231, 106, 111, 1, 48, 0, 152,
+    0, 187, 113, 1, 1, 9, 13, 2,
+    42, 162, 389, 21, 171, 9, 10, 16,
+    530, 0, 50, 5, 4, 15, 563, 87,
+    6, 294, 5, 39, 87, 4, 30, 21,
+    2, 27, 17, 31, 0, 4, 92, 121,
+    187, 0, 84, 30, 20, 10, 212, 9,
+    101, 159, 254, 2, 71, 2, 54, 47,
+    25, 222, 7, 11, 670, 753, 314, 0,
+    388, 1, 416, 1450, 371,
+};
+
+static const uint16_t infomodel_prebuilt_name_slots[] = {
+    124, 481, 460, 153, 94, 254, 591, 799,
+    693, 391, 667, 586, 865, 369, 598, 243,
+    190, 840, 579, 443, 677, 838, 551, 685,
+    60, 63, 198, 217, 108, 332, 19, 344,
+    410, 346, 182, 758, 672, 77, 423, 195,
+    659, 412, 144, 753, 706, 20, 854, 696,
+    576, 171, 129, 536, 803, 91, 317, 38,
+    830, 27, 550, 767, 202, 783, 118, 43,
+    322, 477, 497, 625, 104, 805, 814, 760,
+    10, 511, 769, 629, 820, 231, 499, 836,
+    445, 831, 859, 561, 131, 388, 839, 492,
+    380, 843, 451, 350, 8, 540, 692, 765,
+    403, 200, 444, 184, 250, 163, 399, 127,
+    773, 616, 785, 168, 650, 366, 201, 502,
+    430, 36, 789, 475, 596, 493, 447, 401,
+    224, 417, 891, 434, 276, 566, 278, 303,
+    211, 530, 16, 827, 359, 860, 735, 534,
+    786, 762, 680, 454, 164, 141, 107, 390,
+    491, 409, 349, 40, 137, 362, 407, 521,
+    732, 634, 397, 373, 757, 572, 382, 326,
+    117, 356, 627, 297, 872, 687, 458, 370,
+    590, 210, 644, 714, 582, 709, 770, 657,
+    526, 26, 255, 46, 93, 474, 309, 312,
+    72, 815, 710, 868, 483, 728, 432, 754,
+    674, 567, 504, 595, 554, 822, 661, 691,
+    395, 342, 13, 518, 408, 126, 895, 355,
+    208, 470, 686, 607, 509, 811, 143, 396,
+    570, 741, 722, 631, 562, 894, 215, 819,
+    157, 386, 779, 331, 35, 727, 675, 175,
+    539, 678, 172, 341, 879, 333, 833, 81,
+    506, 398, 673, 494, 755, 636, 177, 740,
+    774, 645, 76, 601, 794, 731, 523, 71,
+    92, 114, 441, 547, 713, 112, 581, 606,
+    552, 251, 21, 209, 639, 364, 245, 690,
+    553, 578, 438, 31, 528, 162, 875, 203,
+    797, 768, 541, 459, 666, 228, 371, 428,
+    729, 684, 622, 549, 347, 435, 507, 699,
+    826, 736, 186, 66, 898, 418, 448, 221,
+    733, 247, 270, 642, 772, 302, 275, 896,
+    329, 818, 334, 500, 878, 422, 469, 557,
+    194, 320, 149, 5, 462, 136, 849, 105,
+    744, 196, 531, 613, 223, 39, 863, 286,
+    575, 284, 726, 749, 702, 32, 212, 49,
+    545, 83, 720, 834, 310, 527, 2, 402,
+    197, 790, 777, 67, 248, 635, 730, 824,
+    155, 802, 234, 633, 419, 654, 238, 519,
+    577, 711, 537, 508, 599, 867, 174, 68,
+    817, 150, 48, 870, 354, 587, 23, 97,
+    715, 429, 893, 558, 597, 780, 439, 241,
+    298, 705, 123, 600, 308, 80, 289, 837,
+    465, 413, 594, 665, 411, 510, 240, 216,
+    602, 249, 89, 851, 283, 75, 226, 524,
+    405, 55, 847, 4, 385, 109, 707, 632,
+    723, 466, 806, 257, 656, 440, 853, 708,
+    47, 375, 649, 185, 886, 392, 330, 489,
+    188, 611, 273, 750, 738, 88, 28, 377,
+    564, 110, 873, 363, 119, 214, 170, 291,
+    158, 719, 829, 747, 87, 300, 262, 0,
+    147, 869, 233, 84, 472, 866, 44, 54,
+    336, 648, 272, 73, 325, 812, 647, 456,
+    339, 739, 573, 11, 862, 431, 306, 389,
+    515, 62, 442, 343, 825, 615, 1, 7,
+    379, 746, 299, 589, 259, 623, 154, 546,
+    800, 65, 808, 374, 159, 98, 563, 160,
+    850, 96, 501, 449, 721, 113, 236, 156,
+    670, 15, 488, 378, 712, 683, 85, 327,
+    889, 626, 246, 556, 468, 756, 646, 725,
+    890, 324, 583, 42, 703, 609, 608, 337,
+    116, 357, 457, 261, 748, 455, 372, 689,
+    58, 610, 821, 844, 86, 311, 381, 544,
+    103, 503, 892, 471, 810, 845, 809, 383,
+    204, 816, 166, 453, 592, 751, 498, 897,
+    222, 165, 792, 882, 505, 745, 61, 274,
+    846, 99, 621, 51, 520, 496, 353, 111,
+    638, 535, 33, 25, 416, 316, 513, 181,
+    668, 187, 292, 314, 604, 189, 345, 271,
+    651, 612, 798, 57, 887, 70, 560, 559,
+    242, 305, 669, 618, 679, 142, 321, 295,
+    125, 133, 294, 74, 102, 617, 479, 191,
+    658, 148, 264, 476, 3, 45, 387, 858,
+    384, 701, 804, 285, 682, 115, 22, 253,
+    580, 452, 743, 207, 406, 225, 653, 37,
+    619, 192, 90, 764, 681, 267, 269, 660,
+    842, 835, 206, 24, 179, 855, 880, 697,
+    688, 881, 620, 517, 323, 605, 14, 252,
+    69, 361, 568, 265, 34, 813, 17, 593,
+    167, 885, 52, 193, 351, 640, 832, 169,
+    788, 548, 791, 79, 478, 56, 95, 78,
+    857, 884, 565, 807, 315, 856, 348, 368,
+    360, 140, 671, 795, 282, 490, 128, 229,
+    652, 424, 778, 752, 485, 852, 53, 135,
+    571, 486, 415, 784, 717, 584, 404, 761,
+    871, 480, 279, 425, 464, 352, 161, 82,
+    420, 304, 433, 759, 781, 290, 288, 101,
+    775, 277, 340, 120, 232, 12, 220, 152,
+    146, 700, 542, 426, 796, 484, 694, 603,
+    663, 514, 876, 64, 427, 614, 414, 335,
+    266, 734, 637, 293, 450, 256, 151, 446,
+    630, 861, 533, 121, 782, 676, 367, 29,
+    318, 393, 771, 574, 244, 301, 737, 793,
+    776, 134, 718, 828, 801, 628, 695, 106,
+    219, 235, 787, 555, 664, 180, 467, 138,
+    365, 437, 874, 569, 239, 394, 525, 227,
+    436, 662, 888, 178, 296, 130, 205, 588,
+    585, 263, 538, 763, 543, 473, 641, 145,
+    704, 400, 237, 461, 899, 9, 766, 6,
+    281, 313, 41, 624, 463, 122, 30, 100,
+    376, 877, 50, 260, 199, 532, 213, 268,
+    716, 522, 883, 328, 421, 287, 643, 59,
+    482, 139, 18, 307, 742, 280, 319, 698,
+    841, 724, 495, 529, 183, 516, 823, 338,
+    230, 512, 487, 173, 358, 864, 655, 258,
+    848, 218, 132, 176,
+};
+
+#define INFOMODEL_PREBUILT_ELEMENT_COUNT      900
+#define INFOMODEL_PREBUILT_ID_BUCKET_COUNT    301
+#define INFOMODEL_PREBUILT_NAME_COUNT         900
+#define INFOMODEL_PREBUILT_NAME_BUCKET_COUNT  301
+#define INFOMODEL_PREBUILT_ID_SLOT_COUNT      900
+#define INFOMODEL_PREBUILT_NAME_SLOT_COUNT    900
+
+/*
+ *    Returns the hash of the 'len' octets at 'key' using 'seed'.
+ *    Must match prebuilt_hash() in make-infomodel.
+ */
+static uint32_t
+infomodelPrebuiltHash(
+    const uint8_t  *key,
+    size_t          len,
+    uint32_t        seed)
+{
+    uint32_t h = 0x811c9dc5u ^ seed;
+    size_t   i;
+
+    for (i = 0; i < len; ++i) {
+        h = (h ^ key[i]) * 0x01000193u;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+const fbInfoElement_t *infomodelPrebuiltGetElements(size_t *count)
+{
+    *count = INFOMODEL_PREBUILT_ELEMENT_COUNT;
+    return infomodel_prebuilt_elements;
+}
+
+const fbInfoElement_t *infomodelPrebuiltGetElementByID(
+    uint32_t    ent,
+    uint16_t    num)
+{
+    const fbInfoElement_t *ie;
+    uint8_t                key[6];
+    uint32_t               seed;
+
+    if (0 == INFOMODEL_PREBUILT_ELEMENT_COUNT) {
+        return NULL;
+    }
+    key[0] = ent >> 24;
+    key[1] = ent >> 16;
+    key[2] = ent >> 8;
+    key[3] = ent;
+    key[4] = num >> 8;
+    key[5] = num;
+    seed = infomodel_prebuilt_id_seeds[
+        infomodelPrebuiltHash(key, sizeof(key), 0)
+        % INFOMODEL_PREBUILT_ID_BUCKET_COUNT];
+    ie = &infomodel_prebuilt_elements[infomodel_prebuilt_id_slots[
+        infomodelPrebuiltHash(key, sizeof(key), seed)
+        % INFOMODEL_PREBUILT_ID_SLOT_COUNT]];
+    return ((ie->ent == ent && ie->num == num) ? ie : NULL);
+}
+
+const fbInfoElement_t *infomodelPrebuiltGetElementByName(const char *name)
+{
+    const fbInfoElement_t *ie;
+    size_t                 len;
+    uint32_t               seed;
+
+    if (0 == INFOMODEL_PREBUILT_NAME_COUNT || !name) {
+        return NULL;
+    }
+    len = strlen(name);
+    seed = infomodel_prebuilt_name_seeds[
+        infomodelPrebuiltHash((const uint8_t *)name, len, 0)
+        % INFOMODEL_PREBUILT_NAME_BUCKET_COUNT];
+    ie = &infomodel_prebuilt_elements[infomodel_prebuilt_name_slots[
+        infomodelPrebuiltHash((const uint8_t *)name, len, seed)
+        % INFOMODEL_PREBUILT_NAME_SLOT_COUNT]];
+    return ((0 == strcmp(ie->name, name)) ? ie : NULL);
+}
+
+/*
+** Local Variables:
+** mode:c
+** indent-tabs-mode:nil
+** c-basic-offset:4
+** End:
+*/
@@ -0,0 +1,71 @@
+/* This file was automatically generated by the make-infomodel script
+ * using the "*.xml" files in the infomodel directory.
+ */
+
+#ifndef _GUARD_INFOMODEL_H
+#define _GUARD_INFOMODEL_H
+
+#include <fixbuf/public.h>
+
+/**
+ *    Updates the information model 'model' with the elements defined
+ *    in the *.i files, created from the corresponding *.xml files.
+ */
+#define infomodelAddGlobalElements infomodelAddGlobalElements_libfixbuf
+void infomodelAddGlobalElements(fbInfoModel_t *model);
+
+/**
+ *    Returns a handle to the information element array defined in the
+ *    file whose name is '<name>.i', created from '<name>.xml'.
+ *    Returns NULL if 'name' is NULL or does not name a known file.
+ */
+#define infomodelGetArrayByName infomodelGetArrayByName_libfixbuf
+const fbInfoElement_t *infomodelGetArrayByName(const char *name);
+
+/**
+ *    Returns the number of elements (including the final FB_IE_NULL)
+ *    in the information element array defined in the file whose name
+ *    is '<name>.i', created from '<name>.xml'.  Returns 0 if 'name'
+ *    is NULL or does not name a known file.
+ */
+#define infomodelGetArrayLengthByName infomodelGetArrayLengthByName_libfixbuf
+size_t infomodelGetArrayLengthByName(const char *name);
+
+/**
+ *    Returns the read-only table holding every element defined in the
+ *    *.i files plus the reverse of each reversible element, sorted by
+ *    enterprise number and element ID and resolved the same way
+ *    infomodelAddGlobalElements() would resolve duplicates.  Sets the
+ *    referent of 'count' to the number of elements.  The table is
+ *    shared by every caller and must not be modified.
+ */
+#define infomodelPrebuiltGetElements infomodelPrebuiltGetElements_libfixbuf
+const fbInfoElement_t *infomodelPrebuiltGetElements(size_t *count);
+
+/**
+ *    Returns the element in the prebuilt table whose enterprise
+ *    number is 'ent' and whose element ID is 'num', or NULL if there
+ *    is none.  Uses a minimal perfect hash computed by make-infomodel.
+ */
+#define infomodelPrebuiltGetElementByID infomodelPrebuiltGetElementByID_libfixbuf
+const fbInfoElement_t *infomodelPrebuiltGetElementByID(
+    uint32_t    ent,
+    uint16_t    num);
+
+/**
+ *    Returns the element in the prebuilt table whose name is 'name',
+ *    or NULL if there is none.  Uses a minimal perfect hash computed
+ *    by make-infomodel.
+ */
+#define infomodelPrebuiltGetElementByName infomodelPrebuiltGetElementByName_libfixbuf
+const fbInfoElement_t *infomodelPrebuiltGetElementByName(const char *name);
+
+#endif  /* _GUARD_INFOMODEL_H */
+
+/*
+** Local Variables:
+** mode:c
+** indent-tabs-mode:nil
+** c-basic-offset:4
+** End:
+*/
@@ -13,6 +13,7 @@
  */
 
 #include "ipfix2json.h"
+#include <pthread.h>
 
 /* CERT IPFIX Private Enterprise Number */
 #define CERT_PEN    6871
@@ -20,6 +21,150 @@
 /* Initial size of the buffer for an in-memory record. */
 #define RECBUF_CAPACITY_INITIAL 256
 
+/* When reading serially, the amount of text the writer holds before it is
+ * written to the output. */
+#define WRITER_FLUSH_OCTETS     65536
+
+/* The octets of input that the framing thread gathers into one batch of
+ * messages for a worker thread. */
+#define BATCH_OCTETS            (256 * 1024)
+
+/* The size of the largest IPFIX message. */
+#define MESSAGE_MAX             65535
+
+/* The largest accepted value for --threads. */
+#define THREADS_MAX             256
+
+/**
+ *  The state for decoding and printing a sequence of IPFIX messages: the
+ *  entire input when reading serially, or the batches handed to one worker
+ *  thread.
+ */
+typedef struct idStream_st {
+    /* the information model, one per stream */
+    fbInfoModel_t  *model;
+    /* the buffer being read, which owns the session */
+    fBuf_t         *fbuf;
+    /* holds the record being printed */
+    fbRecord_t      record;
+    /* the writer that receives the templates and records */
+    idWriter_t     *writer;
+    /* the file to flush the writer to as it fills, or NULL to leave the
+     * text in the writer */
+    FILE           *outfp;
+    /* whether templates are being replayed from a snapshot, in which case
+     * they have been printed already */
+    gboolean        replaying;
+} idStream_t;
+
+/**
+ *  The templates that are in effect at some position of the input, as a
+ *  series of IPFIX messages that contain only template sets.  A worker that
+ *  did not read the batch preceding its own replays these to bring a new
+ *  session up to date.  Reference counted; the counts are changed while
+ *  holding the pipeline's mutex.
+ */
+typedef struct idSnapshot_st {
+    uint8_t       *msgs;
+    size_t         len;
+    unsigned int   refcount;
+} idSnapshot_t;
+
+/**
+ *  A run of complete IPFIX messages handed from the framing thread to a
+ *  worker, and the text the worker formats from them.
+ */
+typedef struct idBatch_st {
+    /* next batch in the work queue or the free list */
+    struct idBatch_st  *next;
+    /* the position of this batch in the input and output */
+    uint64_t            seq;
+    /* the messages; octets past `len` belong to the next batch */
+    uint8_t            *msgs;
+    size_t              len;
+    /* the templates in effect before the first message */
+    idSnapshot_t       *snapshot;
+    /* the output formatted from the messages */
+    idWriter_t          out;
+    /* whether the batch holds options records, which change state that
+     * every worker uses and so must be read while no other batch is */
+    gboolean            serial;
+    /* whether the worker has finished formatting the batch */
+    gboolean            done;
+} idBatch_t;
+
+/**
+ *  The raw bytes of a template record that the framing thread has seen,
+ *  keyed by observation domain and template ID.
+ */
+typedef struct idRawTemplate_st {
+    uint32_t   domain;
+    uint16_t   tid;
+    /* the ID of the set that held the record: 2 or 3 */
+    uint16_t   set_id;
+    uint16_t   len;
+    uint8_t   *rec;
+} idRawTemplate_t;
+
+/**
+ *  The framing thread's view of the input: the templates in effect and
+ *  the snapshot of them handed to new batches.
+ */
+typedef struct idFramer_st {
+    GHashTable    *templates;
+    idSnapshot_t  *snapshot;
+    /* whether a template has changed since the snapshot was made */
+    gboolean       changed;
+} idFramer_t;
+
+/**
+ *  A worker thread and the stream it decodes its batches with.
+ */
+typedef struct idWorker_st {
+    pthread_t     thread;
+    idStream_t    stream;
+    /* the sequence number of the batch read most recently */
+    uint64_t      last_seq;
+    gboolean      have_last;
+    /* the number of the pipeline's elements added to the stream's model */
+    size_t        elements_applied;
+} idWorker_t;
+
+/**
+ *  The queue between the framing thread and the workers, and the ring of
+ *  batches that are being formatted or are waiting to be written in order.
+ */
+typedef struct idPipeline_st {
+    pthread_mutex_t         mutex;
+    /* signaled when a batch is queued or the input ends */
+    pthread_cond_t          work_cond;
+    /* signaled when a batch has been written */
+    pthread_cond_t          written_cond;
+    /* batches waiting for a worker */
+    idBatch_t              *queue_head;
+    idBatch_t              *queue_tail;
+    /* batches to be reused */
+    idBatch_t              *free_list;
+    /* batches that have been submitted and not written, indexed by
+     * sequence number modulo `ring_size` */
+    idBatch_t             **ring;
+    unsigned int            ring_size;
+    unsigned int            inflight;
+    uint64_t                next_seq;
+    uint64_t                next_write;
+    /* whether a worker is writing batches to the output */
+    gboolean                writing;
+    /* whether the framing thread has submitted its last batch */
+    gboolean                finished;
+    /* the RFC 5610 elements read so far, which each worker adds to its own
+     * model; only changed by a serial batch */
+    fbInfoElementOptRec_t  *elements;
+    size_t                  elements_len;
+    size_t                  elements_cap;
+    idWorker_t             *workers;
+    unsigned int            worker_count;
+} idPipeline_t;
+
 /* String used in option descriptions when the text wraps multiple
  * lines. */
 #define WRAP_STRING "\n                                   "
@@ -31,6 +176,7 @@ static gboolean     rfc5610 = FALSE;
 static gboolean     only_tmpl = FALSE;
 static gboolean     only_data = FALSE;
 static gchar       *octet_format_string = NULL;
+static int          thread_count = 0;
 
 static FILE        *outfile = NULL;
 static FILE        *infile = NULL;
@@ -39,7 +185,9 @@ static gchar      **xml_files = NULL;
 static gchar       *cert_element_file_path;
 
 GHashTable         *template_names;
-GStringChunk       *object_keys;
+
+/* the threads of a multi-threaded run; NULL when reading serially */
+static idPipeline_t *pipeline = NULL;
 
 gboolean            full_structure = FALSE;
 gboolean            allow_duplicate_keys = FALSE;
@@ -71,6 +219,9 @@ static GOptionEntry id_core_option[] = {
     {"octet-format", '\0', 0, G_OPTION_ARG_STRING, &octet_format_string,
      ("Print octetArray values in 'format' [base64]" WRAP_STRING
       "Choices: base64,string,hexadecimal,empty"), "format"},
+    {"threads", '\0', 0, G_OPTION_ARG_INT, &thread_count,
+     ("Decode and format records on this many" WRAP_STRING
+      "worker threads [1]"), "count"},
     {"version", 'V', 0, G_OPTION_ARG_NONE, &id_version,
      "Print application version to stderr and exit", NULL},
     { NULL, 0, 0, G_OPTION_ARG_NONE, NULL, NULL, NULL }
@@ -241,6 +392,12 @@ idParseOptions(
         }
     }
 
+    if (thread_count < 0 || thread_count > THREADS_MAX) {
+        fprintf(stderr, "%s: Invalid threads value %d: must be from 1 to %d\n",
+                g_get_prgname(), thread_count, THREADS_MAX);
+        exit(1);
+    }
+
     if (inspec != NULL) {
         if ((strlen(inspec) == 1) && inspec[0] == '-') {
             infile = stdin;
@@ -339,6 +496,7 @@ idTemplateCallback(
     void                 **ctx,
     fbTemplateCtxFree_fn  *fn)
 {
+    idStream_t    *st = (idStream_t *)app_ctx;
     GError        *err = NULL;
     tmplContext_t *myctx = g_new0(tmplContext_t, 1);
     static fbInfoElementSpec_t templateNameSpec[] = {
@@ -347,14 +505,12 @@ idTemplateCallback(
         FB_IESPEC_NULL
     };
 
-    (void)app_ctx;
-
     myctx->count = fbTemplateCountElements(tmpl);
     myctx->len = fbTemplateGetIELenOfMemBuffer(tmpl);
     myctx->tid = tid;
 
-    if (!only_data) {
-        idPrintTemplate(outfile, tmpl, myctx);
+    if (!only_data && !st->replaying) {
+        idPrintTemplate(st->writer, tmpl, myctx);
     }
 
     if (!fbSessionAddTemplate(session, TRUE, tid, tmpl, NULL, &err)) {
@@ -413,7 +569,8 @@ idTemplateNameRecord(
 
 /**
  *    Process an RFC5610 Record describing an InfoElement and add that
- *    element to the InfoModel.
+ *    element to the InfoModel.  When running multi-threaded, also keep a
+ *    copy of the record for the other workers' models.
  */
 static gboolean
 idInfoElementRecord(
@@ -482,27 +639,43 @@ idInfoElementRecord(
         }
     }
 
-    return fbInfoElementAddOptRecElement(model, &rec);
+    if (!fbInfoElementAddOptRecElement(model, &rec)) {
+        return FALSE;
+    }
+
+    if (pipeline) {
+        fbInfoElementOptRec_t *copy;
+
+        if (pipeline->elements_len == pipeline->elements_cap) {
+            pipeline->elements_cap = MAX(16, 2 * pipeline->elements_cap);
+            pipeline->elements = g_renew(fbInfoElementOptRec_t,
+                                         pipeline->elements,
+                                         pipeline->elements_cap);
+        }
+        copy = &pipeline->elements[pipeline->elements_len++];
+        *copy = rec;
+        copy->ie_name.buf = (uint8_t *)g_strndup((char *)rec.ie_name.buf,
+                                                 rec.ie_name.len);
+        copy->ie_desc.buf = (uint8_t *)g_strndup((char *)rec.ie_desc.buf,
+                                                 rec.ie_desc.len);
+    }
+
+    return TRUE;
 }
 
 
-int
-main(
-    int    argc,
-    char  *argv[])
+/**
+ *    Allocates an information model and loads the CERT elements and any
+ *    element files given on the command line into it.  Exits on error.
+ */
+static fbInfoModel_t *
+idInfoModelLoad(
+    void)
 {
-    fbInfoModel_t *model = NULL;
-    fBuf_t        *fbuf = NULL;
+    fbInfoModel_t *model;
     GError        *err = NULL;
-    gboolean       rc;
-    fbSession_t   *session = NULL;
-    fbCollector_t *collector = NULL;
-    tmplContext_t *tctx;
-    fbRecord_t     record = FB_RECORD_INIT;
     gchar        **xml_file;
 
-    idParseOptions(&argc, &argv);
-
     model = fbInfoModelAlloc();
 
     if (cert_xml) {
@@ -512,7 +685,6 @@ main(
             g_clear_error(&err);
             exit(-1);
         }
-        g_free(cert_xml);
     }
     if (xml_files) {
         for (xml_file = xml_files; *xml_file; ++xml_file) {
@@ -523,34 +695,90 @@ main(
                 exit(-1);
             }
         }
-        g_strfreev(xml_files);
     }
 
-    /* Create New Session */
-    session = fbSessionAlloc(model);
+    return model;
+}
 
-    template_names = g_hash_table_new_full(g_direct_hash, NULL, NULL, g_free);
-    object_keys = g_string_chunk_new(1024);
 
-    /* Create a Collector */
-    collector = fbCollectorAllocFP(NULL, infile);
+/**
+ *    Initializes a stream whose model is `model`.  The caller opens its fBuf
+ *    with idStreamOpen().
+ */
+static void
+idStreamInit(
+    idStream_t     *st,
+    fbInfoModel_t  *model)
+{
+    memset(st, 0, sizeof(*st));
+    st->model = model;
+    st->record.reccapacity = RECBUF_CAPACITY_INITIAL;
+    st->record.rec = g_new(uint8_t, st->record.reccapacity);
+}
+
+
+/**
+ *    Allocates a new session and a collection buffer that reads from
+ *    `collector` for the stream, freeing the previous ones.  When
+ *    `collector` is NULL, the caller supplies messages with
+ *    fBufSetBuffer().
+ */
+static void
+idStreamOpen(
+    idStream_t     *st,
+    fbCollector_t  *collector)
+{
+    fbSession_t *session;
+
+    if (st->fbuf) {
+        fBufFree(st->fbuf);
+    }
+    session = fbSessionAlloc(st->model);
+    st->fbuf = fBufAllocForCollection(session, collector);
+    fbSessionAddNewTemplateCallback(session, idTemplateCallback, st);
+}
+
 
-    /* Allocate Collection Buffer */
-    fbuf = fBufAllocForCollection(session, collector);
+/**
+ *    Frees the stream's fBuf, session, record buffer, and model.
+ */
+static void
+idStreamFree(
+    idStream_t  *st)
+{
+    if (st->fbuf) {
+        fBufFree(st->fbuf);
+    }
+    fbInfoModelFree(st->model);
+    g_free(st->record.rec);
+    memset(st, 0, sizeof(*st));
+}
 
-    fbSessionAddNewTemplateCallback(session, idTemplateCallback, fbuf);
 
-    /* Allocate buffer for a single in-memory record */
-    record.reccapacity = RECBUF_CAPACITY_INITIAL;
-    record.rec = g_new(uint8_t, record.reccapacity);
+/**
+ *    Reads the records available to the stream's fBuf and prints them.
+ *    Returns at the end of the input, which for an fBuf without a collector
+ *    is the end of the octets given to fBufSetBuffer().
+ */
+static void
+idStreamProcess(
+    idStream_t  *st)
+{
+    fbRecord_t    *record = &st->record;
+    fBuf_t        *fbuf = st->fbuf;
+    GError        *err = NULL;
+    tmplContext_t *tctx;
+    gboolean       rc;
 
     for (;;) {
-        record.tmpl = fBufNextCollectionTemplate(fbuf, &record.tid, &err);
-        if (!record.tmpl) {
-            if (g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_EOF)) {
-                fBufFree(fbuf);
+        record->tmpl = fBufNextCollectionTemplate(fbuf, &record->tid, &err);
+        if (!record->tmpl) {
+            if (g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_EOF) ||
+                (NULL == fBufGetCollector(fbuf) &&
+                 g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_BUFSZ)))
+            {
                 g_clear_error(&err);
-                break;
+                return;
             }
             fprintf(stderr, "%s: Warning: %s\n",
                     g_get_prgname(), err->message);
@@ -558,24 +786,23 @@ main(
             continue;
         }
 
-        tctx = fbTemplateGetContext(record.tmpl);
-        record.recsize = tctx->len;
+        tctx = fbTemplateGetContext(record->tmpl);
+        record->recsize = tctx->len;
 
-        if (record.recsize > record.reccapacity) {
+        if (record->recsize > record->reccapacity) {
             do {
-                record.reccapacity <<= 1;
-            } while (record.recsize > record.reccapacity);
-            record.rec = g_renew(uint8_t, record.rec, record.reccapacity);
+                record->reccapacity <<= 1;
+            } while (record->recsize > record->reccapacity);
+            record->rec = g_renew(uint8_t, record->rec, record->reccapacity);
         }
-        memset(record.rec, 0, record.reccapacity);
+        memset(record->rec, 0, record->reccapacity);
 
-        rc = fBufNextRecord(fbuf, &record, &err);
+        rc = fBufNextRecord(fbuf, record, &err);
         if (FALSE == rc) {
             if (g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_EOF)) {
                 fprintf(stderr, "%s: END OF FILE\n", g_get_prgname());
-                fBufFree(fbuf);
                 g_clear_error(&err);
-                break;
+                return;
             }
             if (!g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_EOM) &&
                 !g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_BUFSZ))
@@ -588,27 +815,769 @@ main(
         }
 
         if (tctx->is_meta_template) {
-            idTemplateNameRecord(model, tctx, &record);
+            idTemplateNameRecord(st->model, tctx, record);
         } else if (tctx->is_meta_element) {
-            idInfoElementRecord(model, tctx, &record);
+            idInfoElementRecord(st->model, tctx, record);
         }
         if (only_tmpl) {
-            fBufListFree(record.tmpl, record.rec);
+            fBufListFree(record->tmpl, record->rec);
         } else {
-            char str_template[TMPL_NAME_BUFSIZ];
-            idFormatTemplateId(str_template, record.tid, sizeof(str_template));
-            fprintf(outfile, "{\"%s\": {", str_template);
-            /*fprintf(outfile, "{\"data record\": {");*/
-            idPrintDataRecord(outfile, &record);
-            fprintf(outfile, "}}\n");
+            idPrintRecord(st->writer, record);
+            if (st->outfp && st->writer->len >= WRITER_FLUSH_OCTETS) {
+                idWriterFlush(st->writer, st->outfp);
+            }
+        }
+    }
+}
+
+
+/**
+ *    Reads the entire input on the main thread.
+ */
+static void
+idRunSerial(
+    void)
+{
+    idStream_t     st;
+    idWriter_t     writer;
+    fbCollector_t *collector;
+
+    idWriterInit(&writer);
+    idStreamInit(&st, idInfoModelLoad());
+    st.writer = &writer;
+    st.outfp = outfile;
+
+    /* Create a Collector */
+    collector = fbCollectorAllocFP(NULL, infile);
+    /* decode regular files in place; stdin and pipes remain on stdio */
+    fbCollectorMapFile(collector, NULL);
+
+    idStreamOpen(&st, collector);
+    idStreamProcess(&st);
+
+    idWriterFlush(&writer, outfile);
+    idStreamFree(&st);
+    idWriterClear(&writer);
+}
+
+
+/*
+ *  Read and write big-endian integers in the framer's message buffers,
+ *  where a set or record may begin at any octet.
+ */
+static uint16_t
+idReadU16(
+    const uint8_t  *p)
+{
+    uint16_t v;
+    memcpy(&v, p, sizeof(v));
+    return g_ntohs(v);
+}
+
+static uint32_t
+idReadU32(
+    const uint8_t  *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return g_ntohl(v);
+}
+
+static void
+idWriteU16(
+    uint8_t   *p,
+    uint16_t   v)
+{
+    v = g_htons(v);
+    memcpy(p, &v, sizeof(v));
+}
+
+static void
+idWriteU32(
+    uint8_t   *p,
+    uint32_t   v)
+{
+    v = g_htonl(v);
+    memcpy(p, &v, sizeof(v));
+}
+
+
+/*
+ *  Hash and equality functions for the framer's table of idRawTemplate_t.
+ */
+static guint
+idRawTemplateHash(
+    gconstpointer   v)
+{
+    const idRawTemplate_t *raw = (const idRawTemplate_t *)v;
+    return (raw->domain * 65537u) ^ raw->tid;
+}
+
+static gboolean
+idRawTemplateEqual(
+    gconstpointer   a,
+    gconstpointer   b)
+{
+    const idRawTemplate_t *ra = (const idRawTemplate_t *)a;
+    const idRawTemplate_t *rb = (const idRawTemplate_t *)b;
+    return (ra->domain == rb->domain && ra->tid == rb->tid);
+}
+
+static void
+idRawTemplateFree(
+    gpointer   v)
+{
+    idRawTemplate_t *raw = (idRawTemplate_t *)v;
+    g_free(raw->rec);
+    g_slice_free(idRawTemplate_t, raw);
+}
+
+/*
+ *  Orders idRawTemplate_t pointers by domain, set ID, and template ID.
+ */
+static int
+idRawTemplateCompare(
+    const void  *a,
+    const void  *b)
+{
+    const idRawTemplate_t *ra = *(idRawTemplate_t * const *)a;
+    const idRawTemplate_t *rb = *(idRawTemplate_t * const *)b;
+
+    if (ra->domain != rb->domain) {
+        return (ra->domain < rb->domain) ? -1 : 1;
+    }
+    if (ra->set_id != rb->set_id) {
+        return (int)ra->set_id - (int)rb->set_id;
+    }
+    return (int)ra->tid - (int)rb->tid;
+}
+
+
+/**
+ *    Returns TRUE if the message `msg` must be read while no other batch is
+ *    being read: when it holds an options template set or a data set whose
+ *    template is an options template.  The records in those sets may name
+ *    templates or define elements, which changes state every worker uses.
+ */
+static gboolean
+idFramerIsSerial(
+    idFramer_t     *fr,
+    const uint8_t  *msg,
+    size_t          msglen)
+{
+    idRawTemplate_t        key;
+    const idRawTemplate_t *raw;
+    const uint8_t         *sp;
+    uint16_t               setlen;
+
+    key.domain = idReadU32(msg + 12);
+    for (sp = msg + 16; sp + 4 <= msg + msglen; sp += setlen) {
+        key.tid = idReadU16(sp);
+        setlen = idReadU16(sp + 2);
+        if (setlen < 4) {
+            break;
+        }
+        if (FB_TID_OTS == key.tid) {
+            return TRUE;
+        }
+        if (key.tid >= FB_TID_MIN_DATA) {
+            raw = (const idRawTemplate_t *)g_hash_table_lookup(fr->templates,
+                                                               &key);
+            if (raw && FB_TID_OTS == raw->set_id) {
+                return TRUE;
+            }
         }
     }
+    return FALSE;
+}
+
 
-    fbInfoModelFree(model);
-    g_free(record.rec);
+/**
+ *    Records the templates defined by the template sets in the message
+ *    `msg` so they may be given to later batches.  A withdrawal drops the
+ *    recorded template.  Records with an illegal scope count are skipped as
+ *    fixbuf skips them.
+ */
+static void
+idFramerAddTemplates(
+    idFramer_t     *fr,
+    const uint8_t  *msg,
+    size_t          msglen)
+{
+    idRawTemplate_t  key;
+    idRawTemplate_t *raw;
+    const uint8_t   *sp;
+    const uint8_t   *se;
+    const uint8_t   *rp;
+    const uint8_t   *fp;
+    uint16_t         set_id;
+    uint16_t         setlen;
+    uint16_t         ie_count;
+    uint16_t         scope_count;
+    uint16_t         i;
+
+    key.domain = idReadU32(msg + 12);
+    for (sp = msg + 16; sp + 4 <= msg + msglen; sp += setlen) {
+        set_id = idReadU16(sp);
+        setlen = idReadU16(sp + 2);
+        if (setlen < 4 || sp + setlen > msg + msglen) {
+            break;
+        }
+        if (FB_TID_TS != set_id && FB_TID_OTS != set_id) {
+            continue;
+        }
+        se = sp + setlen;
+        for (rp = sp + 4; rp + 4 <= se; rp = fp) {
+            key.tid = idReadU16(rp);
+            ie_count = idReadU16(rp + 2);
+            fp = rp + 4;
+            scope_count = 0;
+            if (FB_TID_OTS == set_id && ie_count > 0) {
+                if (fp + 2 > se) {
+                    break;
+                }
+                scope_count = idReadU16(fp);
+                fp += 2;
+            }
+            for (i = 0; i < ie_count && fp + 4 <= se; ++i) {
+                fp += ((fp[0] & 0x80) ? 8 : 4);
+            }
+            if (i < ie_count || fp > se) {
+                /* truncated record */
+                break;
+            }
+            if (FB_TID_OTS == set_id && ie_count > 0 &&
+                (scope_count == 0 || scope_count > ie_count))
+            {
+                continue;
+            }
+
+            if (0 == ie_count) {
+                /* a withdrawal: forget the template, or for a template ID
+                 * of 2 or 3, every template of the domain */
+                if (FB_TID_TS == key.tid || FB_TID_OTS == key.tid) {
+                    GHashTableIter iter;
+                    g_hash_table_iter_init(&iter, fr->templates);
+                    while (g_hash_table_iter_next(&iter, (gpointer *)&raw,
+                                                  NULL))
+                    {
+                        if (raw->domain == key.domain) {
+                            g_hash_table_iter_remove(&iter);
+                            fr->changed = TRUE;
+                        }
+                    }
+                } else if (g_hash_table_remove(fr->templates, &key)) {
+                    fr->changed = TRUE;
+                }
+                continue;
+            }
+
+            raw = (idRawTemplate_t *)g_hash_table_lookup(fr->templates, &key);
+            if (raw) {
+                if (raw->set_id == set_id && raw->len == fp - rp &&
+                    0 == memcmp(raw->rec, rp, raw->len))
+                {
+                    /* a repeat of the template in effect */
+                    continue;
+                }
+                g_free(raw->rec);
+            } else {
+                raw = g_slice_new(idRawTemplate_t);
+                raw->domain = key.domain;
+                raw->tid = key.tid;
+                g_hash_table_insert(fr->templates, raw, raw);
+            }
+            raw->set_id = set_id;
+            raw->len = fp - rp;
+            raw->rec = (uint8_t *)g_malloc(raw->len);
+            memcpy(raw->rec, rp, raw->len);
+            fr->changed = TRUE;
+        }
+    }
+}
+
+
+/**
+ *    Builds a snapshot of the templates the framer has recorded.  Each
+ *    message holds the templates of a single observation domain.
+ */
+static idSnapshot_t *
+idFramerSnapshot(
+    idFramer_t  *fr)
+{
+    idSnapshot_t     *snap;
+    idRawTemplate_t **raws;
+    idRawTemplate_t  *raw;
+    GHashTableIter    iter;
+    uint8_t          *msg = NULL;
+    uint8_t          *set = NULL;
+    size_t            cap;
+    guint             count;
+    guint             i;
+
+    count = g_hash_table_size(fr->templates);
+    raws = g_new(idRawTemplate_t *, count);
+    i = 0;
+    g_hash_table_iter_init(&iter, fr->templates);
+    while (g_hash_table_iter_next(&iter, (gpointer *)&raw, NULL)) {
+        raws[i++] = raw;
+    }
+    qsort(raws, count, sizeof(*raws), idRawTemplateCompare);
+
+    snap = g_slice_new0(idSnapshot_t);
+    snap->refcount = 1;
+    cap = 1024;
+    snap->msgs = (uint8_t *)g_malloc(cap);
+
+    for (i = 0; i < count; ++i) {
+        raw = raws[i];
+        if (cap < snap->len + 16 + 4 + raw->len) {
+            size_t msg_off = msg ? (size_t)(msg - snap->msgs) : 0;
+            size_t set_off = set ? (size_t)(set - snap->msgs) : 0;
+            do {
+                cap <<= 1;
+            } while (cap < snap->len + 16 + 4 + raw->len);
+            snap->msgs = (uint8_t *)g_realloc(snap->msgs, cap);
+            msg = msg ? snap->msgs + msg_off : NULL;
+            set = set ? snap->msgs + set_off : NULL;
+        }
+        /* start a new message for a new domain or when this one is full */
+        if (NULL == msg ||
+            idReadU32(msg + 12) != raw->domain ||
+            (snap->len - (msg - snap->msgs)) + 4 + raw->len > MESSAGE_MAX)
+        {
+            msg = snap->msgs + snap->len;
+            memset(msg, 0, 16);
+            idWriteU16(msg, 0x000A);
+            idWriteU32(msg + 12, raw->domain);
+            snap->len += 16;
+            set = NULL;
+        }
+        if (NULL == set || idReadU16(set) != raw->set_id) {
+            set = snap->msgs + snap->len;
+            idWriteU16(set, raw->set_id);
+            snap->len += 4;
+        }
+        memcpy(snap->msgs + snap->len, raw->rec, raw->len);
+        snap->len += raw->len;
+        idWriteU16(set + 2, snap->msgs + snap->len - set);
+        idWriteU16(msg + 2, snap->msgs + snap->len - msg);
+    }
+
+    g_free(raws);
+    return snap;
+}
+
+
+/*
+ *    Drops a reference to `snap`.  The caller holds the pipeline's mutex.
+ */
+static void
+idSnapshotUnref(
+    idSnapshot_t  *snap)
+{
+    if (snap && 0 == --snap->refcount) {
+        g_free(snap->msgs);
+        g_slice_free(idSnapshot_t, snap);
+    }
+}
+
+
+/**
+ *    Returns an empty batch, reusing one from the free list when possible.
+ */
+static idBatch_t *
+idPipelineGetBatch(
+    idPipeline_t  *pl)
+{
+    idBatch_t *batch;
+
+    pthread_mutex_lock(&pl->mutex);
+    batch = pl->free_list;
+    if (batch) {
+        pl->free_list = batch->next;
+    }
+    pthread_mutex_unlock(&pl->mutex);
+
+    if (NULL == batch) {
+        batch = g_slice_new0(idBatch_t);
+        batch->msgs = g_new(uint8_t, BATCH_OCTETS + MESSAGE_MAX);
+        idWriterInit(&batch->out);
+    }
+    batch->next = NULL;
+    batch->len = 0;
+    batch->snapshot = NULL;
+    batch->serial = FALSE;
+    batch->done = FALSE;
+    return batch;
+}
+
+
+/**
+ *    Queues `batch` for a worker.  Waits while the ring of unwritten batches
+ *    is full.  A serial batch waits for every earlier batch to be written
+ *    before it is queued, and the function does not return until the
+ *    serial batch has been written.
+ */
+static void
+idPipelineSubmit(
+    idPipeline_t  *pl,
+    idBatch_t     *batch)
+{
+    pthread_mutex_lock(&pl->mutex);
+    while (pl->inflight == pl->ring_size ||
+           (batch->serial && pl->inflight > 0))
+    {
+        pthread_cond_wait(&pl->written_cond, &pl->mutex);
+    }
+    if (batch->snapshot) {
+        ++batch->snapshot->refcount;
+    }
+    batch->seq = pl->next_seq++;
+    pl->ring[batch->seq % pl->ring_size] = batch;
+    ++pl->inflight;
+    if (pl->queue_tail) {
+        pl->queue_tail->next = batch;
+    } else {
+        pl->queue_head = batch;
+    }
+    pl->queue_tail = batch;
+    pthread_cond_signal(&pl->work_cond);
+    if (batch->serial) {
+        while (pl->inflight > 0) {
+            pthread_cond_wait(&pl->written_cond, &pl->mutex);
+        }
+    }
+    pthread_mutex_unlock(&pl->mutex);
+}
+
+
+/**
+ *    Marks `batch` as formatted and, unless another worker is doing so,
+ *    writes the finished batches at the head of the ring to the output in
+ *    order.
+ */
+static void
+idPipelineComplete(
+    idPipeline_t  *pl,
+    idBatch_t     *batch)
+{
+    unsigned int slot;
+
+    pthread_mutex_lock(&pl->mutex);
+    batch->done = TRUE;
+    if (!pl->writing) {
+        pl->writing = TRUE;
+        for (;;) {
+            slot = pl->next_write % pl->ring_size;
+            batch = pl->ring[slot];
+            if (NULL == batch || !batch->done) {
+                break;
+            }
+            pl->ring[slot] = NULL;
+            pthread_mutex_unlock(&pl->mutex);
+            idWriterFlush(&batch->out, outfile);
+            pthread_mutex_lock(&pl->mutex);
+            ++pl->next_write;
+            --pl->inflight;
+            idSnapshotUnref(batch->snapshot);
+            batch->snapshot = NULL;
+            batch->next = pl->free_list;
+            pl->free_list = batch;
+            pthread_cond_broadcast(&pl->written_cond);
+        }
+        pl->writing = FALSE;
+    }
+    pthread_mutex_unlock(&pl->mutex);
+}
+
+
+/**
+ *    Decodes and formats one batch on a worker.  When the worker did not read
+ *    the batch immediately before this one, its session is replaced and the
+ *    batch's template snapshot is replayed into it first.
+ */
+static void
+idWorkerProcessBatch(
+    idWorker_t  *wk,
+    idBatch_t   *batch)
+{
+    idStream_t *st = &wk->stream;
+
+    /* apply the elements that serial batches on other workers defined */
+    for ( ; wk->elements_applied < pipeline->elements_len;
+          ++wk->elements_applied)
+    {
+        fbInfoElementAddOptRecElement(
+            st->model, &pipeline->elements[wk->elements_applied]);
+    }
+
+    st->writer = &batch->out;
+
+    if (!wk->have_last || wk->last_seq + 1 != batch->seq) {
+        idStreamOpen(st, NULL);
+        if (batch->snapshot) {
+            st->replaying = TRUE;
+            fBufSetBuffer(st->fbuf, batch->snapshot->msgs,
+                          batch->snapshot->len);
+            idStreamProcess(st);
+            st->replaying = FALSE;
+        }
+    }
+
+    fBufSetBuffer(st->fbuf, batch->msgs, batch->len);
+    idStreamProcess(st);
+
+    wk->last_seq = batch->seq;
+    wk->have_last = TRUE;
+    if (batch->serial) {
+        wk->elements_applied = pipeline->elements_len;
+    }
+}
+
+
+/**
+ *    The body of a worker thread: takes batches from the queue until the
+ *    input ends.
+ */
+static void *
+idWorkerMain(
+    void  *arg)
+{
+    idWorker_t   *wk = (idWorker_t *)arg;
+    idPipeline_t *pl = pipeline;
+    idBatch_t    *batch;
+
+    for (;;) {
+        pthread_mutex_lock(&pl->mutex);
+        while (NULL == pl->queue_head && !pl->finished) {
+            pthread_cond_wait(&pl->work_cond, &pl->mutex);
+        }
+        batch = pl->queue_head;
+        if (NULL == batch) {
+            pthread_mutex_unlock(&pl->mutex);
+            break;
+        }
+        pl->queue_head = batch->next;
+        if (NULL == pl->queue_head) {
+            pl->queue_tail = NULL;
+        }
+        pthread_mutex_unlock(&pl->mutex);
+
+        idWorkerProcessBatch(wk, batch);
+        idPipelineComplete(pl, batch);
+    }
+    return NULL;
+}
+
+
+/**
+ *    Hands `batch`, whose messages are the first `batch->len` of the `fill`
+ *    octets read into it, to the workers.  Returns a new batch that holds
+ *    the remaining octets and sets `fill` to their count.
+ */
+static idBatch_t *
+idFramerDispatch(
+    idBatch_t  *batch,
+    size_t     *fill)
+{
+    idBatch_t *next;
+
+    next = idPipelineGetBatch(pipeline);
+    *fill -= batch->len;
+    memcpy(next->msgs, batch->msgs + batch->len, *fill);
+    idPipelineSubmit(pipeline, batch);
+    return next;
+}
+
+
+/**
+ *    The framing loop of a multi-threaded run.  Reads the input in large
+ *    blocks, finds the message boundaries, tracks the templates, and cuts the
+ *    messages into batches for the workers.
+ */
+static void
+idFramerRun(
+    idFramer_t  *fr)
+{
+    idBatch_t *batch;
+    uint8_t   *msg;
+    size_t     fill = 0;
+    size_t     avail;
+    size_t     count;
+    uint16_t   version;
+    uint16_t   msglen;
+    gboolean   eof = FALSE;
+    gboolean   serial;
+
+    batch = idPipelineGetBatch(pipeline);
+    for (;;) {
+        /* make sure a complete message is at the end of the batch */
+        avail = fill - batch->len;
+        msg = batch->msgs + batch->len;
+        msglen = ((avail >= 4) ? idReadU16(msg + 2) : 0);
+        if (avail < 16 || avail < msglen) {
+            if (eof) {
+                break;
+            }
+            count = fread(batch->msgs + fill, 1,
+                          BATCH_OCTETS + MESSAGE_MAX - fill, infile);
+            if (0 == count) {
+                eof = TRUE;
+            }
+            fill += count;
+            continue;
+        }
+        version = idReadU16(msg);
+        if (version != 0x000A) {
+            fprintf(stderr, ("%s: Warning: Illegal IPFIX Message version %#06x;"
+                             " input is probably not an IPFIX Message"
+                             " stream.\n"), g_get_prgname(), version);
+            avail = 0;
+            break;
+        }
+        if (msglen < 16) {
+            fprintf(stderr, ("%s: Warning: Illegal IPFIX Message length %#06x;"
+                             " input is probably not an IPFIX Message"
+                             " stream.\n"), g_get_prgname(), msglen);
+            avail = 0;
+            break;
+        }
+
+        serial = idFramerIsSerial(fr, msg, msglen);
+        if (serial && batch->len > 0) {
+            /* the options records go in a batch of their own */
+            batch = idFramerDispatch(batch, &fill);
+            continue;
+        }
+        if (0 == batch->len) {
+            if (fr->changed || NULL == fr->snapshot) {
+                pthread_mutex_lock(&pipeline->mutex);
+                idSnapshotUnref(fr->snapshot);
+                pthread_mutex_unlock(&pipeline->mutex);
+                fr->snapshot = idFramerSnapshot(fr);
+                fr->changed = FALSE;
+            }
+            batch->snapshot = fr->snapshot;
+        }
+        idFramerAddTemplates(fr, msg, msglen);
+        batch->len += msglen;
+        if (serial || batch->len >= BATCH_OCTETS) {
+            batch->serial = serial;
+            batch = idFramerDispatch(batch, &fill);
+        }
+    }
+
+    if (avail > 0) {
+        fprintf(stderr, ("%s: Warning: IPFIX Message length mismatch"
+                         " (message size %u, buffer has %lu)\n"),
+                g_get_prgname(), msglen, (unsigned long)avail);
+    }
+    if (batch->len > 0) {
+        fill = batch->len;
+        batch = idFramerDispatch(batch, &fill);
+    }
+
+    pthread_mutex_lock(&pipeline->mutex);
+    batch->next = pipeline->free_list;
+    pipeline->free_list = batch;
+    idSnapshotUnref(fr->snapshot);
+    fr->snapshot = NULL;
+    pipeline->finished = TRUE;
+    pthread_cond_broadcast(&pipeline->work_cond);
+    pthread_mutex_unlock(&pipeline->mutex);
+}
+
+
+/**
+ *    Reads the input with a framing thread (the main thread) that cuts it
+ *    into batches of messages and `thread_count` worker threads that decode
+ *    and format the batches.  Each worker has its own information model and
+ *    session; the batches' output is written in the order of the input.
+ */
+static void
+idRunThreaded(
+    void)
+{
+    idPipeline_t pl;
+    idFramer_t   fr;
+    idBatch_t   *batch;
+    unsigned int i;
+    int          rv;
+
+    memset(&pl, 0, sizeof(pl));
+    pthread_mutex_init(&pl.mutex, NULL);
+    pthread_cond_init(&pl.work_cond, NULL);
+    pthread_cond_init(&pl.written_cond, NULL);
+    pl.ring_size = 2 * thread_count;
+    pl.ring = g_new0(idBatch_t *, pl.ring_size);
+    pl.worker_count = thread_count;
+    pl.workers = g_new0(idWorker_t, pl.worker_count);
+    pipeline = &pl;
+
+    memset(&fr, 0, sizeof(fr));
+    fr.templates = g_hash_table_new_full(idRawTemplateHash,
+                                         idRawTemplateEqual,
+                                         NULL, idRawTemplateFree);
+
+    for (i = 0; i < pl.worker_count; ++i) {
+        idStreamInit(&pl.workers[i].stream, idInfoModelLoad());
+        rv = pthread_create(&pl.workers[i].thread, NULL, idWorkerMain,
+                            &pl.workers[i]);
+        if (rv != 0) {
+            fprintf(stderr, "%s: Unable to start worker thread: %s\n",
+                    g_get_prgname(), strerror(rv));
+            exit(1);
+        }
+    }
+
+    idFramerRun(&fr);
+
+    for (i = 0; i < pl.worker_count; ++i) {
+        pthread_join(pl.workers[i].thread, NULL);
+        idStreamFree(&pl.workers[i].stream);
+    }
+    g_assert(0 == pl.inflight);
+
+    while ((batch = pl.free_list)) {
+        pl.free_list = batch->next;
+        idWriterClear(&batch->out);
+        g_free(batch->msgs);
+        g_slice_free(idBatch_t, batch);
+    }
+    for (i = 0; i < pl.elements_len; ++i) {
+        g_free(pl.elements[i].ie_name.buf);
+        g_free(pl.elements[i].ie_desc.buf);
+    }
+    g_free(pl.elements);
+    g_hash_table_destroy(fr.templates);
+    g_free(pl.workers);
+    g_free(pl.ring);
+    pthread_cond_destroy(&pl.written_cond);
+    pthread_cond_destroy(&pl.work_cond);
+    pthread_mutex_destroy(&pl.mutex);
+    pipeline = NULL;
+}
+
+
+int
+main(
+    int    argc,
+    char  *argv[])
+{
+    idParseOptions(&argc, &argv);
+
+    template_names = g_hash_table_new_full(g_direct_hash, NULL, NULL, g_free);
+
+    if (thread_count > 1) {
+        idRunThreaded();
+    } else {
+        idRunSerial();
+    }
 
+    g_free(cert_xml);
+    g_strfreev(xml_files);
     g_hash_table_destroy(template_names);
-    g_string_chunk_free(object_keys);
 
     return 0;
 }
@@ -13,122 +13,582 @@
 
 #include "ipfix2json.h"
 
+/* Initial sizes of the buffers owned by an idWriter_t. */
+#define WRITER_CAPACITY_INITIAL 65536
+#define WRITER_NAMES_INITIAL    16
+#define WRITER_KEYS_INITIAL     512
+
+/* Appends the string literal `lit_` to the writer `w_`. */
+#define idWriterAppendLiteral(w_, lit_) \
+    idWriterAppend((w_), (lit_), sizeof(lit_) - 1)
+
+/* The two-digit decimal representation of each value from 0 to 99 */
+static const char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char hex_lower[] = "0123456789abcdef";
+static const char hex_upper[] = "0123456789ABCDEF";
+
+static const char base64_alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
 static void
 idPrintValue(
-    FILE                     *fp,
+    idWriter_t               *w,
     const fbTemplateField_t  *field,
     fbRecordValue_t          *value,
-    GHashTable              **uniq_names);
+    size_t                    scope);
 
 
 /**
- *  Prints the name of `tmpl_field_`, a fbTemplateField_t, to `fp`, a FILE
- *  pointer, adding a repeat-count suffix if needed.  The name is surrounded
- *  by double-quotes and is followed by a space and colon.
+ *  idWriterInit
+ *
+ *
  */
-#define PRINT_FIELD_NAME(fp_, tmpl_field_)                             \
-    if (allow_duplicate_keys                                           \
-        || 0 == fbTemplateFieldGetRepeat(tmpl_field_))                 \
-    {                                                                  \
-        fprintf(fp_, "\"%s\": ", fbTemplateFieldGetName(tmpl_field_)); \
-    } else {                                                           \
-        fprintf(fp_, "\"%s-%u\": ",                                    \
-                fbTemplateFieldGetName(tmpl_field_),                   \
-                1 + fbTemplateFieldGetRepeat(tmpl_field_));            \
-    }
+void
+idWriterInit(
+    idWriter_t  *w)
+{
+    memset(w, 0, sizeof(*w));
+    w->cap = WRITER_CAPACITY_INITIAL;
+    w->buf = g_new(char, w->cap);
+    w->names_cap = WRITER_NAMES_INITIAL;
+    w->names = g_new(idUniqName_t, w->names_cap);
+    w->keys_cap = WRITER_KEYS_INITIAL;
+    w->keys = g_new(char, w->keys_cap);
+}
 
 
 /**
- *  Looks for 'name' in referent of 'table'.
+ *  idWriterClear
  *
- *  If found, increments the counter in the table.  If 'namelen' is non-zero,
- *  appends the counter to 'name'.  Returns the updated counter.
  *
- *  If not found, initializes it, adds it to the table, does not modify
- *  'name', and returns 0.
+ */
+void
+idWriterClear(
+    idWriter_t  *w)
+{
+    g_free(w->buf);
+    g_free(w->names);
+    g_free(w->keys);
+    memset(w, 0, sizeof(*w));
+}
+
+
+/**
+ *  idWriterFlush
  *
- *  Creates the table if it does not exist.
+ *    Writes the text held by the writer to `fp` and empties the writer.
  */
-static unsigned int
-idUpdateUniqNameCount(
-    GHashTable **table,
-    char        *name,
-    size_t       namelen)
+void
+idWriterFlush(
+    idWriter_t  *w,
+    FILE        *fp)
 {
-    unsigned int *current;
-    gchar        *uniqname;
-    size_t        sz;
+    if (w->len) {
+        fwrite(w->buf, 1, w->len, fp);
+        w->len = 0;
+    }
+}
 
-    if (allow_duplicate_keys) {
-        return 0;
+
+/*
+ *    Ensures the writer has room for `n` more octets of text and returns
+ *    the location where they go.  The caller updates `len`.
+ */
+static inline char *
+idWriterReserve(
+    idWriter_t  *w,
+    size_t       n)
+{
+    if (w->len + n > w->cap) {
+        do {
+            w->cap <<= 1;
+        } while (w->len + n > w->cap);
+        w->buf = g_renew(char, w->buf, w->cap);
     }
-    uniqname = g_string_chunk_insert_const(object_keys, name);
+    return w->buf + w->len;
+}
 
-    if (*table) {
-        /* if current exists in the table, update it in place */
-        current = (unsigned int *)g_hash_table_lookup(*table, uniqname);
-        if (current) {
-            ++*current;
-            if (namelen) {
-                sz = strlen(name);
-                snprintf(name + sz, namelen - sz, "-%u", *current);
-            }
-            return *current;
-        }
+
+static inline void
+idWriterAppend(
+    idWriter_t  *w,
+    const void  *text,
+    size_t       len)
+{
+    memcpy(idWriterReserve(w, len), text, len);
+    w->len += len;
+}
+
+
+static inline void
+idWriterAppendChar(
+    idWriter_t  *w,
+    char         c)
+{
+    *idWriterReserve(w, 1) = c;
+    ++w->len;
+}
+
+
+static inline void
+idWriterAppendStr(
+    idWriter_t  *w,
+    const char  *str)
+{
+    idWriterAppend(w, str, strlen(str));
+}
+
+
+/*
+ *    Writes the decimal representation of `val` so that it ends
+ *    immediately before `end` and returns where it begins.  The caller's
+ *    buffer must have room for 20 characters.
+ */
+static inline char *
+idFormatU64(
+    char      *end,
+    uint64_t   val)
+{
+    char *cp = end;
+
+    while (val >= 100) {
+        cp -= 2;
+        memcpy(cp, digit_pairs + 2 * (val % 100), 2);
+        val /= 100;
+    }
+    if (val >= 10) {
+        cp -= 2;
+        memcpy(cp, digit_pairs + 2 * val, 2);
     } else {
-        *table = g_hash_table_new_full(g_direct_hash, NULL, NULL, &g_free);
+        *--cp = (char)('0' + val);
     }
+    return cp;
+}
 
-    /* add it to the table */
-    current = g_new(unsigned int, 1);
-    *current = 1;
-    g_hash_table_insert(*table, uniqname, current);
-    return 0;
+
+static void
+idWriterAppendU64(
+    idWriter_t  *w,
+    uint64_t     val)
+{
+    char  tmp[20];
+    char *cp = idFormatU64(tmp + sizeof(tmp), val);
+
+    idWriterAppend(w, cp, tmp + sizeof(tmp) - cp);
 }
 
 
-/**
- * mdPrintIP6Address
- *
- *
+static void
+idWriterAppendS64(
+    idWriter_t  *w,
+    int64_t      val)
+{
+    if (val < 0) {
+        idWriterAppendChar(w, '-');
+        idWriterAppendU64(w, (uint64_t)0 - (uint64_t)val);
+    } else {
+        idWriterAppendU64(w, (uint64_t)val);
+    }
+}
+
+
+/*
+ *    Writes `val`, which must be less than 10^`width`, as exactly `width`
+ *    decimal digits into `cp`.
+ */
+static inline void
+idFormatPadded(
+    char          *cp,
+    uint32_t       val,
+    unsigned int   width)
+{
+    cp += width;
+    while (width >= 2) {
+        cp -= 2;
+        memcpy(cp, digit_pairs + 2 * (val % 100), 2);
+        val /= 100;
+        width -= 2;
+    }
+    if (width) {
+        *--cp = (char)('0' + val % 10);
+    }
+}
+
+
+/*
+ *    Writes `tid` as printf's "%#06x" would into the 6 characters at
+ *    `cp`.
  */
+static inline void
+idFormatTid(
+    char          *cp,
+    unsigned int   tid)
+{
+    if (0 == tid) {
+        memcpy(cp, "000000", 6);
+        return;
+    }
+    cp[0] = '0';
+    cp[1] = 'x';
+    cp[2] = hex_lower[(tid >> 12) & 0xF];
+    cp[3] = hex_lower[(tid >> 8) & 0xF];
+    cp[4] = hex_lower[(tid >> 4) & 0xF];
+    cp[5] = hex_lower[tid & 0xF];
+}
+
+
 static void
-mdPrintIP6Address(
-    char           *ipaddr_buf,
+idWriterAppendIP4(
+    idWriter_t  *w,
+    uint32_t     ip4)
+{
+    char        *cp = idWriterReserve(w, 17);
+    char        *start = cp;
+    unsigned int octet;
+    int          shift;
+
+    *cp++ = '"';
+    for (shift = 24; shift >= 0; shift -= 8) {
+        octet = (ip4 >> shift) & 0xFF;
+        if (octet >= 100) {
+            *cp++ = (char)('0' + octet / 100);
+            memcpy(cp, digit_pairs + 2 * (octet % 100), 2);
+            cp += 2;
+        } else if (octet >= 10) {
+            memcpy(cp, digit_pairs + 2 * octet, 2);
+            cp += 2;
+        } else {
+            *cp++ = (char)('0' + octet);
+        }
+        *cp++ = (shift ? '.' : '"');
+    }
+    w->len += cp - start;
+}
+
+
+/*
+ *    Appends the IPv6 address `ipaddr` as a string.  Each group is printed
+ *    as four hexadecimal digits, and the first run of zero-valued groups
+ *    is collapsed.
+ */
+static void
+idWriterAppendIP6(
+    idWriter_t     *w,
     const uint8_t  *ipaddr)
 {
-    char          *cp = ipaddr_buf;
+    char          *cp = idWriterReserve(w, 42);
+    char          *start = cp;
     const uint8_t *aqp;
-    uint16_t       aq;
     gboolean       colon_start = FALSE;
     gboolean       colon_end = FALSE;
 
+    *cp++ = '"';
     for (aqp = ipaddr; aqp < ipaddr + 16; aqp += 2) {
-        aq = g_ntohs(*((const uint16_t *)aqp));
-        if (aq || colon_end) {
+        if (aqp[0] || aqp[1] || colon_end) {
+            *cp++ = hex_lower[aqp[0] >> 4];
+            *cp++ = hex_lower[aqp[0] & 0xF];
+            *cp++ = hex_lower[aqp[1] >> 4];
+            *cp++ = hex_lower[aqp[1] & 0xF];
             if (aqp < ipaddr + 14) {
-                snprintf(cp, 6, "%04hx:", aq);
-                cp += 5;
-            } else {
-                snprintf(cp, 5, "%04hx", aq);
-                cp += 4;
+                *cp++ = ':';
             }
             if (colon_start) {
                 colon_end = TRUE;
             }
         } else if (!colon_start) {
             if (aqp == ipaddr) {
-                snprintf(cp, 3, "::");
-                cp += 2;
-            } else {
-                snprintf(cp, 2, ":");
-                cp += 1;
+                *cp++ = ':';
             }
+            *cp++ = ':';
             colon_start = TRUE;
         }
     }
+    *cp++ = '"';
+    w->len += cp - start;
+}
+
+
+static void
+idWriterAppendMac(
+    idWriter_t     *w,
+    const uint8_t  *mac)
+{
+    char        *cp = idWriterReserve(w, 19);
+    unsigned int i;
+
+    *cp++ = '"';
+    for (i = 0; i < 6; ++i) {
+        *cp++ = hex_lower[mac[i] >> 4];
+        *cp++ = hex_lower[mac[i] & 0xF];
+        *cp++ = ((i < 5) ? ':' : '"');
+    }
+    w->len += 19;
 }
 
+
+/*
+ *    Appends a time stamp as "%F %T" (UTC), followed by `digits` digits
+ *    of fractional seconds when `digits` is not zero.  The date and time
+ *    of the most recent call are kept, since neighboring records tend to
+ *    share them.
+ */
+static void
+idWriterAppendTime(
+    idWriter_t             *w,
+    const struct timespec  *dt,
+    unsigned int            digits)
+{
+    static const long divisor[] = {1000000000, 0, 0, 1000000, 0, 0,
+                                   1000, 0, 0, 1};
+    struct tm time_tm;
+    long      frac;
+    char     *cp;
+
+    if (0 == w->time_len || dt->tv_sec != w->time_sec) {
+        gmtime_r(&dt->tv_sec, &time_tm);
+        if (time_tm.tm_year >= 1000 - 1900 && time_tm.tm_year <= 9999 - 1900) {
+            cp = w->time_str;
+            idFormatPadded(cp, time_tm.tm_year + 1900, 4);
+            cp[4] = '-';
+            idFormatPadded(cp + 5, time_tm.tm_mon + 1, 2);
+            cp[7] = '-';
+            idFormatPadded(cp + 8, time_tm.tm_mday, 2);
+            cp[10] = ' ';
+            idFormatPadded(cp + 11, time_tm.tm_hour, 2);
+            cp[13] = ':';
+            idFormatPadded(cp + 14, time_tm.tm_min, 2);
+            cp[16] = ':';
+            idFormatPadded(cp + 17, time_tm.tm_sec, 2);
+            w->time_len = 19;
+        } else {
+            /* "%Y-%m-%d %H:%M:%S" */
+            w->time_len = strftime(w->time_str, sizeof(w->time_str), "%F %T",
+                                   &time_tm);
+        }
+        w->time_sec = dt->tv_sec;
+    }
+
+    cp = idWriterReserve(w, w->time_len + 32);
+    cp[0] = '"';
+    memcpy(cp + 1, w->time_str, w->time_len);
+    cp += 1 + w->time_len;
+    if (digits) {
+        frac = dt->tv_nsec / divisor[digits];
+        *cp++ = '.';
+        if (frac >= 0 && frac < 1000000000 / divisor[digits]) {
+            idFormatPadded(cp, (uint32_t)frac, digits);
+            cp += digits;
+        } else {
+            cp += snprintf(cp, 24, "%0*ld", (int)digits, frac);
+        }
+    }
+    cp[0] = 'Z';
+    cp[1] = '"';
+    w->len = cp + 2 - w->buf;
+}
+
+
+/*
+ *    Appends `len` octets of `c` as a quoted string, escaping control and
+ *    non-ASCII characters using unicode notation and backslash-escaping
+ *    double quote and backslash.
+ */
+static void
+idWriterAppendEscaped(
+    idWriter_t     *w,
+    const uint8_t  *c,
+    size_t          len)
+{
+    const uint8_t *end = c + len;
+    const uint8_t *run;
+    char          *cp;
+
+    idWriterAppendChar(w, '"');
+    while (c < end) {
+        for (run = c;
+             c < end && *c >= (uint8_t)' ' && *c <= (uint8_t)'~' &&
+             *c != (uint8_t)'\\' && *c != (uint8_t)'\"';
+             ++c)
+            ;
+        if (c > run) {
+            idWriterAppend(w, run, c - run);
+        }
+        if (c == end) {
+            break;
+        }
+        if (*c < (uint8_t)' ' || *c > (uint8_t)'~') {
+            cp = idWriterReserve(w, 6);
+            memcpy(cp, "\\u00", 4);
+            cp[4] = hex_upper[*c >> 4];
+            cp[5] = hex_upper[*c & 0xF];
+            w->len += 6;
+        } else {
+            cp = idWriterReserve(w, 2);
+            cp[0] = '\\';
+            cp[1] = (char)*c;
+            w->len += 2;
+        }
+        ++c;
+    }
+    idWriterAppendChar(w, '"');
+}
+
+
+static void
+idWriterAppendHex(
+    idWriter_t     *w,
+    const uint8_t  *c,
+    size_t          len)
+{
+    char  *cp = idWriterReserve(w, 2 * len + 2);
+    size_t i;
+
+    *cp++ = '"';
+    for (i = 0; i < len; ++i) {
+        *cp++ = hex_lower[c[i] >> 4];
+        *cp++ = hex_lower[c[i] & 0xF];
+    }
+    *cp = '"';
+    w->len += 2 * len + 2;
+}
+
+
+static void
+idWriterAppendBase64(
+    idWriter_t     *w,
+    const uint8_t  *c,
+    size_t          len)
+{
+    char  *cp = idWriterReserve(w, 4 * ((len + 2) / 3) + 2);
+    char  *start = cp;
+    size_t i;
+
+    *cp++ = '"';
+    for (i = 0; i + 3 <= len; i += 3) {
+        cp[0] = base64_alphabet[c[i] >> 2];
+        cp[1] = base64_alphabet[((c[i] & 0x03) << 4) | (c[i + 1] >> 4)];
+        cp[2] = base64_alphabet[((c[i + 1] & 0x0F) << 2) | (c[i + 2] >> 6)];
+        cp[3] = base64_alphabet[c[i + 2] & 0x3F];
+        cp += 4;
+    }
+    if (len - i == 1) {
+        cp[0] = base64_alphabet[c[i] >> 2];
+        cp[1] = base64_alphabet[(c[i] & 0x03) << 4];
+        cp[2] = '=';
+        cp[3] = '=';
+        cp += 4;
+    } else if (len - i == 2) {
+        cp[0] = base64_alphabet[c[i] >> 2];
+        cp[1] = base64_alphabet[((c[i] & 0x03) << 4) | (c[i + 1] >> 4)];
+        cp[2] = base64_alphabet[(c[i + 1] & 0x0F) << 2];
+        cp[3] = '=';
+        cp += 4;
+    }
+    *cp++ = '"';
+    w->len += cp - start;
+}
+
+
+/*
+ *    Appends the name of `field` surrounded by double-quotes and followed
+ *    by a colon and space, adding a repeat-count suffix if needed.
+ */
+static void
+idWriterAppendFieldName(
+    idWriter_t               *w,
+    const fbTemplateField_t  *field)
+{
+    idWriterAppendChar(w, '"');
+    idWriterAppendStr(w, fbTemplateFieldGetName(field));
+    if (!allow_duplicate_keys && 0 != fbTemplateFieldGetRepeat(field)) {
+        idWriterAppendChar(w, '-');
+        idWriterAppendU64(w, 1 + fbTemplateFieldGetRepeat(field));
+    }
+    idWriterAppendLiteral(w, "\": ");
+}
+
+
+/**
+ *  Looks for 'name' among the keys of the object whose keys begin at
+ *  index 'scope' of the writer's list.
+ *
+ *  If found, increments its counter.  If 'namelen' is non-zero, appends the
+ *  counter to 'name'.  Returns the updated counter.
+ *
+ *  If not found, adds it to the list with a count of one, does not modify
+ *  'name', and returns 0.
+ */
+static unsigned int
+idUpdateUniqNameCount(
+    idWriter_t  *w,
+    size_t       scope,
+    char        *name,
+    size_t       namelen)
+{
+    size_t i;
+    size_t sz;
+
+    if (allow_duplicate_keys) {
+        return 0;
+    }
+    for (i = scope; i < w->names_len; ++i) {
+        if (0 == strcmp(w->keys + w->names[i].off, name)) {
+            ++w->names[i].count;
+            if (namelen) {
+                sz = strlen(name);
+                snprintf(name + sz, namelen - sz, "-%u", w->names[i].count);
+            }
+            return w->names[i].count;
+        }
+    }
+
+    /* add it to the list */
+    sz = strlen(name) + 1;
+    if (w->names_len == w->names_cap) {
+        w->names_cap <<= 1;
+        w->names = g_renew(idUniqName_t, w->names, w->names_cap);
+    }
+    if (w->keys_len + sz > w->keys_cap) {
+        do {
+            w->keys_cap <<= 1;
+        } while (w->keys_len + sz > w->keys_cap);
+        w->keys = g_renew(char, w->keys, w->keys_cap);
+    }
+    memcpy(w->keys + w->keys_len, name, sz);
+    w->names[w->names_len].off = w->keys_len;
+    w->names[w->names_len].count = 1;
+    ++w->names_len;
+    w->keys_len += sz;
+    return 0;
+}
+
+
+/*
+ *    Forgets the keys of the object whose keys begin at index `scope`.
+ */
+static void
+idUniqNamesRelease(
+    idWriter_t  *w,
+    size_t       scope)
+{
+    if (scope < w->names_len) {
+        w->keys_len = w->names[scope].off;
+        w->names_len = scope;
+    }
+}
+
+
 /**
  *    Puts textual information about the template whose ID is 'tid'
  *    into 'tmpl_str'.  The information is the template ID (both
@@ -137,58 +597,97 @@ mdPrintIP6Address(
  *    @param tmpl_str        The buffer to write to
  *    @param tid             The ID of the template to get info of
  *    @param tmpl_str_bufsiz The sizeof the tmpl_str buffer
+ *    @return The length of the text written to tmpl_str
  *
  */
-void
+size_t
 idFormatTemplateId(
     char    *tmpl_str,
     int      tid,
     size_t   tmpl_str_bufsiz)
 {
     const char *name;
+    size_t      len;
+    size_t      namelen;
+    size_t      avail;
+    int         rv;
 
     name = (char *)g_hash_table_lookup(template_names, GINT_TO_POINTER(tid));
-    snprintf(tmpl_str, tmpl_str_bufsiz, "template:%#06x(%s)",
-             tid, ((name) ? name : ""));
+
+    if (tid < 0 || tid > UINT16_MAX || tmpl_str_bufsiz < 24) {
+        rv = snprintf(tmpl_str, tmpl_str_bufsiz, "template:%#06x(%s)",
+                      tid, ((name) ? name : ""));
+        return MIN((size_t)rv, tmpl_str_bufsiz - 1);
+    }
+
+    memcpy(tmpl_str, "template:", 9);
+    idFormatTid(tmpl_str + 9, tid);
+    tmpl_str[15] = '(';
+    len = 16;
+
+    /* truncate as snprintf() would */
+    namelen = ((name) ? strlen(name) : 0);
+    avail = tmpl_str_bufsiz - 1 - len;
+    if (namelen >= avail) {
+        memcpy(tmpl_str + len, name, avail);
+        len += avail;
+    } else {
+        memcpy(tmpl_str + len, name, namelen);
+        len += namelen;
+        tmpl_str[len++] = ')';
+    }
+    tmpl_str[len] = '\0';
+    return len;
 }
 
 
 /**
- *    Print a textual representation of 'tmpl' to 'fp'.  'ctx' is the
+ *    Print a textual representation of 'tmpl' to 'w'.  'ctx' is the
  *    template context created when the template was first read.
  */
 void
 idPrintTemplate(
-    FILE           *fp,
+    idWriter_t     *w,
     fbTemplate_t   *tmpl,
     tmplContext_t  *ctx)
 {
     const fbTemplateField_t *field = NULL;
     unsigned int             i;
     const char              *name;
+    char                     tidbuf[6];
 
     name = (char *)g_hash_table_lookup(template_names,
                                        GINT_TO_POINTER(ctx->tid));
-    fprintf(fp, "{\"template_record:%#06x(%s)\":[",
-            ctx->tid, ((name) ? name : ""));
+    idWriterAppendLiteral(w, "{\"template_record:");
+    idFormatTid(tidbuf, ctx->tid);
+    idWriterAppend(w, tidbuf, sizeof(tidbuf));
+    idWriterAppendChar(w, '(');
+    if (name) {
+        idWriterAppendStr(w, name);
+    }
+    idWriterAppendLiteral(w, ")\":[");
 
     for (i = 0; i < ctx->count; ++i) {
         field = fbTemplateGetFieldByPosition(tmpl, i);
-        fprintf(fp, "%s\"%s\"", ((i > 0) ? "," : ""),
-                fbTemplateFieldGetName(field));
+        if (i > 0) {
+            idWriterAppendChar(w, ',');
+        }
+        idWriterAppendChar(w, '"');
+        idWriterAppendStr(w, fbTemplateFieldGetName(field));
+        idWriterAppendChar(w, '"');
     }
-    fprintf(fp, "]}\n");
+    idWriterAppendLiteral(w, "]}\n");
 }
 
 
 /**
- *    Print a textual representation of 'entry' to 'fp'.
+ *    Print a textual representation of 'entry' to 'w'.
  */
 static void
 idPrintSTMLEntry(
-    FILE                           *fp,
+    idWriter_t                     *w,
     fbSubTemplateMultiListEntry_t  *entry,
-    GHashTable                    **uniq_names)
+    size_t                          scope)
 {
     gboolean   first = TRUE;
     char       str_template[TMPL_NAME_BUFSIZ];
@@ -197,30 +696,32 @@ idPrintSTMLEntry(
     subrec.tid = fbSubTemplateMultiListEntryGetTemplateID(entry);
     subrec.tmpl = fbSubTemplateMultiListEntryGetTemplate(entry);
     idFormatTemplateId(str_template, subrec.tid, sizeof(str_template));
-    idUpdateUniqNameCount(uniq_names, str_template, sizeof(str_template));
-    fprintf(fp, "\"%s\": [{", str_template);
+    idUpdateUniqNameCount(w, scope, str_template, sizeof(str_template));
+    idWriterAppendChar(w, '"');
+    idWriterAppendStr(w, str_template);
+    idWriterAppendLiteral(w, "\": [{");
 
     while ((subrec.rec = fbSTMLEntryNext(uint8_t, entry, subrec.rec))) {
         if (!first) {
-            fprintf(fp, "},{");
+            idWriterAppendLiteral(w, "},{");
         } else {
             first = FALSE;
         }
-        idPrintDataRecord(fp, &subrec);
+        idPrintDataRecord(w, &subrec);
     }
-    fprintf(fp, "}]");
+    idWriterAppendLiteral(w, "}]");
 }
 
 
 /**
- *    Print a textual representation of 'stl' to 'fp'.
+ *    Print a textual representation of 'stl' to 'w'.
  */
 static void
 idPrintSTL(
-    FILE                       *fp,
+    idWriter_t                 *w,
     const fbTemplateField_t    *field,
     const fbSubTemplateList_t  *stl,
-    GHashTable                **uniq_names)
+    size_t                      scope)
 {
     char       str_template[TMPL_NAME_BUFSIZ];
     gboolean   first = TRUE;
@@ -231,267 +732,218 @@ idPrintSTL(
     idFormatTemplateId(str_template, subrec.tid, sizeof(str_template));
 
     if (full_structure) {
-        PRINT_FIELD_NAME(fp, field);
-        fprintf(fp, "{");
+        idWriterAppendFieldName(w, field);
+        idWriterAppendChar(w, '{');
     } else {
-        idUpdateUniqNameCount(uniq_names, str_template, sizeof(str_template));
+        idUpdateUniqNameCount(w, scope, str_template, sizeof(str_template));
     }
-    fprintf(fp, "\"%s\": [{", str_template);
+    idWriterAppendChar(w, '"');
+    idWriterAppendStr(w, str_template);
+    idWriterAppendLiteral(w, "\": [{");
 
     while ((subrec.rec = fbSTLNext(uint8_t, stl, subrec.rec))) {
         if (!first) {
-            fprintf(fp, "},{");
+            idWriterAppendLiteral(w, "},{");
         } else {
             first = FALSE;
         }
-        idPrintDataRecord(fp, &subrec);
+        idPrintDataRecord(w, &subrec);
     }
 
-    fprintf(fp, "}]%s", (full_structure ? "}" : ""));
+    idWriterAppendLiteral(w, "}]");
+    if (full_structure) {
+        idWriterAppendChar(w, '}');
+    }
 }
 
 
 /**
- *    Print a textual representation of 'stml' to 'fp'.
+ *    Print a textual representation of 'stml' to 'w'.
  */
 static void
 idPrintSTML(
-    FILE                            *fp,
+    idWriter_t                      *w,
     const fbTemplateField_t         *field,
     const fbSubTemplateMultiList_t  *stml,
-    GHashTable                     **uniq_names)
+    size_t                           scope)
 {
     fbSubTemplateMultiListEntry_t *entry = NULL;
-    GHashTable *uniq_children = NULL;
-    gboolean    first = TRUE;
+    gboolean first = TRUE;
 
     /* protect against a double or trailing comma in the parent
      * when this STML is empty */
     if (0 == fbSubTemplateMultiListCountElements(stml)) {
-        PRINT_FIELD_NAME(fp, field);
-        fprintf(fp, "{}");
+        idWriterAppendFieldName(w, field);
+        idWriterAppendLiteral(w, "{}");
         return;
     }
 
     if (full_structure) {
-        PRINT_FIELD_NAME(fp, field);
-        fprintf(fp, "{");
+        idWriterAppendFieldName(w, field);
+        idWriterAppendChar(w, '{');
 
-        /* use a local hash table in the unusual case were multiple STML
+        /* use a separate set of keys in the unusual case were multiple STML
          * Entries use the same template. */
-        uniq_names = &uniq_children;
+        scope = w->names_len;
     }
     while ((entry = fbSTMLNext(stml, entry))) {
         if (!first) {
-            fprintf(fp, ",");
+            idWriterAppendChar(w, ',');
         } else {
             first = FALSE;
         }
-        idPrintSTMLEntry(fp, entry, uniq_names);
+        idPrintSTMLEntry(w, entry, scope);
     }
     if (full_structure) {
-        fprintf(fp, "}");
-        if (uniq_children) {
-            g_hash_table_destroy(uniq_children);
-        }
+        idWriterAppendChar(w, '}');
+        idUniqNamesRelease(w, scope);
     }
 }
 
 
 /**
- *    Print a textual representation of 'bl' to 'fp'.
+ *    Print a textual representation of 'bl' to 'w'.
  */
 static void
 idPrintBL(
-    FILE                     *fp,
+    idWriter_t               *w,
     const fbTemplateField_t  *parent_field,
     const fbBasicList_t      *bl,
-    GHashTable              **uniq_names)
+    size_t                    scope)
 {
     const fbTemplateField_t *field;
     fbRecordValue_t          value = FB_RECORD_VALUE_INIT;
-    GHashTable              *uniq_children = NULL;
+    size_t                   children;
     unsigned int             i;
 
     field = fbBasicListGetTemplateField(bl);
 
     if (full_structure) {
-        PRINT_FIELD_NAME(fp, parent_field);
-        fprintf(fp, "{\"%s\": [", fbTemplateFieldGetName(field));
+        idWriterAppendFieldName(w, parent_field);
+        idWriterAppendLiteral(w, "{\"");
+        idWriterAppendStr(w, fbTemplateFieldGetName(field));
+        idWriterAppendLiteral(w, "\": [");
     } else {
         unsigned int count = idUpdateUniqNameCount(
-            uniq_names, (char *)fbTemplateFieldGetName(field), 0);
-        if (0 == count) {
-            fprintf(fp, "\"%s\": [", fbTemplateFieldGetName(field));
-        } else {
-            fprintf(fp, "\"%s-%u\": [", fbTemplateFieldGetName(field), count);
+            w, scope, (char *)fbTemplateFieldGetName(field), 0);
+        idWriterAppendChar(w, '"');
+        idWriterAppendStr(w, fbTemplateFieldGetName(field));
+        if (count) {
+            idWriterAppendChar(w, '-');
+            idWriterAppendU64(w, count);
         }
+        idWriterAppendLiteral(w, "\": [");
     }
 
+    children = w->names_len;
     for (i = 0; fbBasicListGetIndexedRecordValue(bl, i, &value); ++i) {
         if (i > 0) {
-            fprintf(fp, ",");
+            idWriterAppendChar(w, ',');
         }
-        idPrintValue(fp, field, &value, &uniq_children);
-    }
-    if (uniq_children) {
-        g_hash_table_destroy(uniq_children);
+        idPrintValue(w, field, &value, children);
     }
+    idUniqNamesRelease(w, children);
 
-    fprintf(fp, "]%s", (full_structure ? "}" : ""));
+    idWriterAppendChar(w, ']');
+    if (full_structure) {
+        idWriterAppendChar(w, '}');
+    }
 }
 
 
 /**
- *    Print the value of element 'field' to 'fp'.  The value is given in
+ *    Print the value of element 'field' to 'w'.  The value is given in
  *    'val'.
  */
 static void
 idPrintValue(
-    FILE                     *fp,
+    idWriter_t               *w,
     const fbTemplateField_t  *field,
     fbRecordValue_t          *value,
-    GHashTable              **uniq_names)
+    size_t                    scope)
 {
-    struct tm time_tm;
-    char      timebuf[32];
-
     switch (fbTemplateFieldGetType(field)) {
       case FB_BOOL:
       case FB_UINT_8:
       case FB_UINT_16:
       case FB_UINT_32:
       case FB_UINT_64:
-        fprintf(fp, "%" PRIu64, value->v.u64);
+        idWriterAppendU64(w, value->v.u64);
         break;
 
       case FB_INT_8:
       case FB_INT_16:
       case FB_INT_32:
       case FB_INT_64:
-        fprintf(fp, "%" PRId64, value->v.s64);
+        idWriterAppendS64(w, value->v.s64);
         break;
 
       case FB_IP4_ADDR:
-        fprintf(fp, "\"%u.%u.%u.%u\"",
-                (value->v.ip4 >> 24), (value->v.ip4 >> 16) & 0xFF,
-                (value->v.ip4 >> 8) & 0xFF, value->v.ip4 & 0xFF);
+        idWriterAppendIP4(w, value->v.ip4);
         break;
       case FB_IP6_ADDR:
-        {
-            char ip_buf[40];
-            mdPrintIP6Address(ip_buf, value->v.ip6);
-            fprintf(fp, "\"%s\"", ip_buf);
-            break;
-        }
+        idWriterAppendIP6(w, value->v.ip6);
+        break;
 
       case FB_FLOAT_64:
       case FB_FLOAT_32:
-        fprintf(fp, "%.8g", value->v.dbl);
+        {
+            char *cp = idWriterReserve(w, 32);
+            w->len += snprintf(cp, 32, "%.8g", value->v.dbl);
+        }
         break;
 
       case FB_DT_SEC:
-        /* "%Y-%m-%d %H:%M:%S" */
-        strftime(timebuf, sizeof(timebuf), "%F %T",
-                 gmtime_r(&value->v.dt.tv_sec, &time_tm));
-        fprintf(fp, "\"%sZ\"", timebuf);
+        idWriterAppendTime(w, &value->v.dt, 0);
         break;
       case FB_DT_MILSEC:
-        strftime(timebuf, sizeof(timebuf), "%F %T",
-                 gmtime_r(&value->v.dt.tv_sec, &time_tm));
-        fprintf(fp, "\"%s.%03ldZ\"", timebuf, value->v.dt.tv_nsec / 1000000);
+        idWriterAppendTime(w, &value->v.dt, 3);
         break;
       case FB_DT_MICROSEC:
-        strftime(timebuf, sizeof(timebuf), "%F %T",
-                 gmtime_r(&value->v.dt.tv_sec, &time_tm));
-        fprintf(fp, "\"%s.%06ldZ\"", timebuf, value->v.dt.tv_nsec / 1000);
+        idWriterAppendTime(w, &value->v.dt, 6);
         break;
       case FB_DT_NANOSEC:
-        strftime(timebuf, sizeof(timebuf), "%F %T",
-                 gmtime_r(&value->v.dt.tv_sec, &time_tm));
-        fprintf(fp, "\"%s.%09ldZ\"", timebuf, value->v.dt.tv_nsec);
+        idWriterAppendTime(w, &value->v.dt, 9);
         break;
 
       case FB_BASIC_LIST:
-        idPrintBL(fp, field, value->v.bl, uniq_names);
+        idPrintBL(w, field, value->v.bl, scope);
         fbBasicListClear((fbBasicList_t *)value->v.bl);
         break;
       case FB_SUB_TMPL_LIST:
-        idPrintSTL(fp, field, value->v.stl, uniq_names);
+        idPrintSTL(w, field, value->v.stl, scope);
         fbSubTemplateListClear((fbSubTemplateList_t *)value->v.stl);
         break;
       case FB_SUB_TMPL_MULTI_LIST:
-        idPrintSTML(fp, field, value->v.stml, uniq_names);
+        idPrintSTML(w, field, value->v.stml, scope);
         fbSubTemplateMultiListClear((fbSubTemplateMultiList_t *)value->v.stml);
         break;
 
       case FB_MAC_ADDR:
-        fprintf(fp, "\"%02x:%02x:%02x:%02x:%02x:%02x\"",
-                value->v.mac[0], value->v.mac[1], value->v.mac[2],
-                value->v.mac[3], value->v.mac[4], value->v.mac[5]);
+        idWriterAppendMac(w, value->v.mac);
         break;
 
       case FB_STRING:
-        {
-            const uint8_t *c = value->v.varfield.buf;
-            size_t         i;
-
-            fprintf(fp, "\"");
-            for (i = 0; i < value->v.varfield.len; ++i, ++c) {
-                if (*c < (uint8_t)' ' || *c > (uint8_t)'~') {
-                    /* escape control character using unicode notation */
-                    fprintf(fp, "\\u00%02X", *c);
-                } else if (*c == (uint8_t)'\\' || *c == (uint8_t)'\"') {
-                    fprintf(fp, "\\%c", *c);
-                } else {
-                    fprintf(fp, "%c", *c);
-                }
-            }
-            fprintf(fp, "\"");
-            fbRecordValueClear(value);
-        }
+        idWriterAppendEscaped(w, value->v.varfield.buf, value->v.varfield.len);
+        fbRecordValueClear(value);
         break;
 
       case FB_OCTET_ARRAY:
         switch (octet_array_format) {
           case OCTET_ARRAY_EMPTY:
-            fprintf(fp, "\"\"");
+            idWriterAppendLiteral(w, "\"\"");
             break;
           case OCTET_ARRAY_BASE64:
-            {
-                char *b64buf = g_base64_encode(value->v.varfield.buf,
-                                               value->v.varfield.len);
-                fprintf(fp, "\"%s\"", b64buf);
-                g_free(b64buf);
-            }
+            idWriterAppendBase64(w, value->v.varfield.buf,
+                                 value->v.varfield.len);
             break;
           case OCTET_ARRAY_STRING:
-            {
-                const uint8_t *c = value->v.varfield.buf;
-                size_t         i;
-                fprintf(fp, "\"");
-                for (i = 0; i < value->v.varfield.len; ++i, ++c) {
-                    if (*c < (uint8_t)' ' || *c > (uint8_t)'~') {
-                        /* escape control character using unicode notation */
-                        fprintf(fp, "\\u00%02X", *c);
-                    } else if (*c == (uint8_t)'\\' || *c == (uint8_t)'\"') {
-                        fprintf(fp, "\\%c", *c);
-                    } else {
-                        fprintf(fp, "%c", *c);
-                    }
-                }
-                fprintf(fp, "\"");
-            }
+            idWriterAppendEscaped(w, value->v.varfield.buf,
+                                  value->v.varfield.len);
             break;
           case OCTET_ARRAY_HEXADECIMAL:
-            {
-                size_t i;
-                fprintf(fp, "\"");
-                for (i = 0; i < value->v.varfield.len; ++i) {
-                    fprintf(fp, "%02x", value->v.varfield.buf[i]);
-                }
-                fprintf(fp, "\"");
-            }
+            idWriterAppendHex(w, value->v.varfield.buf,
+                              value->v.varfield.len);
             break;
         }
         fbRecordValueClear(value);
@@ -501,19 +953,19 @@ idPrintValue(
 
 
 /**
- *    Print a textual representation of a record to 'fp'.  The
+ *    Print a textual representation of a record to 'w'.  The
  *    record's template is 'tmpl', its data is given by 'buffer'.
  */
 void
 idPrintDataRecord(
-    FILE        *fp,
+    idWriter_t  *w,
     fbRecord_t  *record)
 {
     const fbTemplateField_t *field = NULL;
     fbRecordValue_t          value = FB_RECORD_VALUE_INIT;
     fbTemplateIter_t         iter;
     gboolean first = TRUE;
-    GHashTable              *uniq_names = NULL;
+    size_t   scope = w->names_len;
 
     fbTemplateIterInit(&iter, record->tmpl);
     while ((field = fbTemplateIterNext(&iter))) {
@@ -522,21 +974,39 @@ idPrintDataRecord(
             continue;
         }
         if (!first) {
-            fprintf(fp, ",");
+            idWriterAppendChar(w, ',');
         } else {
             first = FALSE;
         }
         if (!fbInfoElementIsList(fbTemplateFieldGetIE(field))) {
-            PRINT_FIELD_NAME(fp, field);
+            idWriterAppendFieldName(w, field);
         }
         fbRecordGetValueForField(record, field, &value);
-        idPrintValue(fp, field, &value, &uniq_names);
-        /* fflush(fp); */
+        idPrintValue(w, field, &value, scope);
     }
 
-    if (uniq_names) {
-        g_hash_table_destroy(uniq_names);
-    }
+    idUniqNamesRelease(w, scope);
+}
+
+
+/**
+ *    Print a data record and the template ID that describes it as a
+ *    single line of JSON to 'w'.
+ */
+void
+idPrintRecord(
+    idWriter_t  *w,
+    fbRecord_t  *record)
+{
+    char   str_template[TMPL_NAME_BUFSIZ];
+    size_t len;
+
+    len = idFormatTemplateId(str_template, record->tid, sizeof(str_template));
+    idWriterAppendLiteral(w, "{\"");
+    idWriterAppend(w, str_template, len);
+    idWriterAppendLiteral(w, "\": {");
+    idPrintDataRecord(w, record);
+    idWriterAppendLiteral(w, "}}\n");
 }
 
 /*
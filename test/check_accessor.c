@@ -0,0 +1,236 @@
+//  Copyright 2023 Carnegie Mellon University
+//  See license information in LICENSE.txt.
+
+//  Checks that field accessor lookups and record copy plans are cached on
+//  templates once the templates are added to a session, and not before,
+//  and that threads sharing a template may look up fields at once.  Looks
+//  at the caches directly, so it includes the private header.
+
+#define _FIXBUF_SOURCE_
+#include <fixbuf/private.h>
+#include <pthread.h>
+#define FATAL(e)                                \
+    { fprintf(stderr, "Failed at %s:%d: %s\n",  \
+              __FILE__, __LINE__, e->message);  \
+        exit(1); }
+#define CHECK(c)                                        \
+    if (!(c)) {                                         \
+        fprintf(stderr, "Failed at %s:%d: %s\n",        \
+                __FILE__, __LINE__, #c);                \
+        exit(1);                                        \
+    }
+
+static fbInfoElementSpec_t srcSpec[] = {
+    {"octetTotalCount",                     8, 0 },
+    {"packetTotalCount",                    8, 0 },
+    {"sourceIPv4Address",                   4, 0 },
+    {"paddingOctets",                       4, 0 },
+    FB_IESPEC_NULL
+};
+
+static fbInfoElementSpec_t dstSpec[] = {
+    {"packetTotalCount",                    8, 0 },
+    {"octetTotalCount",                     8, 0 },
+    FB_IESPEC_NULL
+};
+
+typedef struct srcRecord_st {
+    uint64_t  octetTotalCount;
+    uint64_t  packetTotalCount;
+    uint32_t  sourceIPv4Address;
+    uint8_t   padding[4];
+} srcRecord_t;
+
+typedef struct dstRecord_st {
+    uint64_t  packetTotalCount;
+    uint64_t  octetTotalCount;
+} dstRecord_t;
+
+#define THREAD_COUNT    4
+#define ACCESSOR_COUNT  64
+#define LOOKUP_ROUNDS   2000
+
+//  The template and accessors shared by the lookup threads
+typedef struct lookup_st {
+    const fbTemplate_t     *tmpl;
+    fbFieldAccessor_t      *accessors[ACCESSOR_COUNT];
+    const fbInfoElement_t  *elements[ACCESSOR_COUNT];
+} lookup_t;
+
+//  Returns the entry of `tmpl`'s slot array that holds the slot for
+//  lookups of `ie`, or NULL.
+static fbTemplateAccessorSlot_t **
+findSlot(
+    const fbTemplate_t     *tmpl,
+    const fbInfoElement_t  *ie)
+{
+    fbTemplateAccessorSlots_t *slots = tmpl->accessor_slots;
+    uint32_t i;
+
+    for (i = 0; slots && i < slots->count; ++i) {
+        if (slots->slot[i] && slots->slot[i]->ie == ie) {
+            return &slots->slot[i];
+        }
+    }
+    return NULL;
+}
+
+//  Looks up every accessor of the lookup_t `vlookup` many times, starting
+//  at a different accessor in each thread, and checks the results.
+static void *
+lookupMain(
+    void  *vlookup)
+{
+    lookup_t                *lookup = (lookup_t *)vlookup;
+    const fbTemplateField_t *field;
+    unsigned int             round, i, j;
+    static int               next = 0;
+    int                      start = __sync_fetch_and_add(&next, 17);
+
+    for (round = 0; round < LOOKUP_ROUNDS; ++round) {
+        for (i = 0; i < ACCESSOR_COUNT; ++i) {
+            j = (start + i) % ACCESSOR_COUNT;
+            field = fbFieldAccessorGetField(lookup->accessors[j],
+                                            lookup->tmpl);
+            if (j % 2) {
+                //  odd accessors skip the only field of their element
+                CHECK(field == NULL);
+            } else {
+                CHECK(field && field->canon == lookup->elements[j]);
+            }
+        }
+    }
+    return NULL;
+}
+
+static fbTemplate_t *
+makeTemplate(
+    fbInfoModel_t        *model,
+    fbInfoElementSpec_t  *spec)
+{
+    fbTemplate_t *tmpl;
+    GError       *err = NULL;
+
+    tmpl = fbTemplateAlloc(model);
+    if (!fbTemplateAppendSpecArray(tmpl, spec, ~0, &err))
+        FATAL(err);
+    return tmpl;
+}
+
+int main()
+{
+    fbInfoModel_t            *model;
+    fbSession_t              *session;
+    fbTemplate_t             *srcTmpl;
+    fbTemplate_t             *dstTmpl;
+    fbTemplate_t             *looseTmpl;
+    const fbInfoElement_t    *ie;
+    const fbTemplateField_t  *field;
+    fbTemplateAccessorSlot_t **slotp;
+    fbTemplateAccessorSlot_t *saved;
+    fbTemplateAccessorSlot_t  tampered;
+    const fbRecordCopyPlan_t *plan;
+    lookup_t                  lookup;
+    pthread_t                 threads[THREAD_COUNT];
+    unsigned int              i;
+    fbFieldAccessor_t        *accessor;
+    srcRecord_t               srcData;
+    dstRecord_t               dstData;
+    fbRecord_t                srcRec = FB_RECORD_INIT;
+    fbRecord_t                dstRec = FB_RECORD_INIT;
+    GError                   *err = NULL;
+
+    model = fbInfoModelAlloc();
+    session = fbSessionAlloc(model);
+    ie = fbInfoModelGetElementByName(model, "packetTotalCount");
+    CHECK(ie);
+    accessor = fbFieldAccessorAlloc(ie, 0);
+
+    //  A template that is being built is searched but not cached
+    srcTmpl = makeTemplate(model, srcSpec);
+    CHECK(!srcTmpl->active);
+    field = fbFieldAccessorGetField(accessor, srcTmpl);
+    CHECK(field && field->canon == ie);
+    CHECK(srcTmpl->accessor_slots == NULL);
+
+    //  Adding it to a session makes it active
+    if (!fbSessionAddTemplate(session, TRUE, 0x1000, srcTmpl, NULL, &err))
+        FATAL(err);
+    CHECK(srcTmpl->active);
+
+    //  The first lookup fills the slot
+    field = fbFieldAccessorGetField(accessor, srcTmpl);
+    CHECK(field && field->canon == ie);
+    slotp = findSlot(srcTmpl, ie);
+    CHECK(slotp && (*slotp)->field == field && (*slotp)->skip == 0);
+
+    //  The second lookup reads the slot: one that was tampered with is
+    //  returned as is
+    saved = *slotp;
+    tampered = *saved;
+    tampered.field = srcTmpl->ie_ary[0];
+    *slotp = &tampered;
+    CHECK(fbFieldAccessorGetField(accessor, srcTmpl) == srcTmpl->ie_ary[0]);
+    *slotp = saved;
+    CHECK(fbFieldAccessorGetField(accessor, srcTmpl) == field);
+
+    //  Threads sharing the template fill and grow its slots at once
+    lookup.tmpl = srcTmpl;
+    for (i = 0; i < ACCESSOR_COUNT; ++i) {
+        lookup.elements[i] = fbInfoModelGetElementByName(
+            model, (i % 4 < 2) ? "octetTotalCount" : "sourceIPv4Address");
+        lookup.accessors[i] = fbFieldAccessorAlloc(lookup.elements[i], i % 2);
+    }
+    for (i = 0; i < THREAD_COUNT; ++i) {
+        CHECK(0 == pthread_create(&threads[i], NULL, lookupMain, &lookup));
+    }
+    for (i = 0; i < THREAD_COUNT; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    for (i = 0; i < ACCESSOR_COUNT; ++i) {
+        fbFieldAccessorFree(lookup.accessors[i]);
+    }
+
+    //  Record copies between active templates build a plan once
+    dstTmpl = makeTemplate(model, dstSpec);
+    if (!fbSessionAddTemplate(session, TRUE, 0x1001, dstTmpl, NULL, &err))
+        FATAL(err);
+    CHECK(dstTmpl->copy_plans == NULL);
+
+    memset(&srcData, 0, sizeof(srcData));
+    srcData.octetTotalCount = 1500;
+    srcData.packetTotalCount = 3;
+    srcData.sourceIPv4Address = 0x0a000001;
+    srcRec.tmpl = srcTmpl;
+    srcRec.tid = 0x1000;
+    srcRec.rec = (uint8_t *)&srcData;
+    srcRec.reccapacity = srcRec.recsize = sizeof(srcData);
+    dstRec.rec = (uint8_t *)&dstData;
+    dstRec.reccapacity = sizeof(dstData);
+
+    if (!fbRecordCopyToTemplate(&srcRec, &dstRec, dstTmpl, 0x1001, &err))
+        FATAL(err);
+    CHECK(dstData.octetTotalCount == 1500 && dstData.packetTotalCount == 3);
+    plan = dstTmpl->copy_plans;
+    CHECK(plan && plan->src_tmpl == srcTmpl && plan->next == NULL);
+
+    srcData.packetTotalCount = 4;
+    if (!fbRecordCopyToTemplate(&srcRec, &dstRec, dstTmpl, 0x1001, &err))
+        FATAL(err);
+    CHECK(dstData.octetTotalCount == 1500 && dstData.packetTotalCount == 4);
+    CHECK(dstTmpl->copy_plans == plan && plan->next == NULL);
+
+    //  A destination that no session references is not modified
+    looseTmpl = makeTemplate(model, dstSpec);
+    if (!fbRecordCopyToTemplate(&srcRec, &dstRec, looseTmpl, 0x1002, &err))
+        FATAL(err);
+    CHECK(dstData.octetTotalCount == 1500 && dstData.packetTotalCount == 4);
+    CHECK(looseTmpl->copy_plans == NULL && !looseTmpl->active);
+
+    fbTemplateFreeUnused(looseTmpl);
+    fbFieldAccessorFree(accessor);
+    fbSessionFree(session);
+    fbInfoModelFree(model);
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+//  Copyright 2023 Carnegie Mellon University
+//  See license information in LICENSE.txt.
+
+//  Reads a message whose fourth record holds a truncated basicList with
+//  fBufNextBatch(), and checks that the batch stops before that record
+//  and that the lists decoded into its slot before the error are freed.
+
+#include <fixbuf/public.h>
+#define FATAL(e)                                \
+    { fprintf(stderr, "Failed at %s:%d: %s\n",  \
+              __FILE__, __LINE__, e->message);  \
+        exit(1); }
+#define CHECK(c)                                        \
+    if (!(c)) {                                         \
+        fprintf(stderr, "Failed at %s:%d: %s\n",        \
+                __FILE__, __LINE__, #c);                \
+        exit(1);                                        \
+    }
+
+#define TID             0x0100
+#define BATCH_SIZE      8
+#define GOOD_RECORDS    3
+
+static fbInfoElementSpec_t recordSpec[] = {
+    {"octetTotalCount",                     8, 0 },
+    {"basicList",                           0, 0 },
+    {"basicList",                           0, 0 },
+    FB_IESPEC_NULL
+};
+
+typedef struct record_st {
+    uint64_t        octetTotalCount;
+    fbBasicList_t   ports;
+    fbBasicList_t   more_ports;
+} record_t;
+
+//  Appends `len` octets at `src` to `msg` and returns the new end.
+static uint8_t *
+put(
+    uint8_t        *msg,
+    const uint8_t  *src,
+    size_t          len)
+{
+    memcpy(msg, src, len);
+    return msg + len;
+}
+
+//  Writes the big-endian `v` to the 16-bit field at `p`.
+static void
+put16(
+    uint8_t   *p,
+    uint16_t   v)
+{
+    p[0] = v >> 8;
+    p[1] = v & 0xff;
+}
+
+//  Builds the message in `msg` and returns its length: a template of an
+//  octet count and two basicLists, GOOD_RECORDS records with two lists of
+//  two ports, and a record whose second list is too short for a
+//  basicList header.
+static size_t
+buildMessage(
+    uint8_t  *msg)
+{
+    static const uint8_t header[] = {
+        0x00, 0x0a, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00
+    };
+    static const uint8_t tmplSet[] = {
+        0x00, 0x02, 0x00, 0x14,  0x01, 0x00, 0x00, 0x03,
+        0x00, 0x55, 0x00, 0x08,  0x01, 0x23, 0xff, 0xff,
+        0x01, 0x23, 0xff, 0xff
+    };
+    static const uint8_t octets[] = {
+        0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x05, 0xdc
+    };
+    //  varlen length 9; allOf sourceTransportPort, length 2: 80, 443
+    static const uint8_t portList[] = {
+        0x09, 0x03, 0x00, 0x07,  0x00, 0x02, 0x00, 0x50,
+        0x01, 0xbb
+    };
+    //  varlen length 2: only a semantic and half an element ID
+    static const uint8_t shortList[] = {
+        0x02, 0x03, 0x00
+    };
+    uint8_t *p = msg;
+    uint8_t *set;
+    int      i;
+
+    p = put(p, header, sizeof(header));
+    p = put(p, tmplSet, sizeof(tmplSet));
+    set = p;
+    p += 4;
+    for (i = 0; i < GOOD_RECORDS; ++i) {
+        p = put(p, octets, sizeof(octets));
+        p = put(p, portList, sizeof(portList));
+        p = put(p, portList, sizeof(portList));
+    }
+    p = put(p, octets, sizeof(octets));
+    p = put(p, portList, sizeof(portList));
+    p = put(p, shortList, sizeof(shortList));
+    put16(set, TID);
+    put16(set + 2, p - set);
+    put16(msg + 2, p - msg);
+    return p - msg;
+}
+
+int main()
+{
+    fbInfoModel_t  *model;
+    fbSession_t    *session;
+    fbTemplate_t   *tmpl;
+    fBuf_t         *fbuf;
+    record_t        recs[BATCH_SIZE];
+    uint8_t         msg[512];
+    size_t          msglen;
+    size_t          count;
+    size_t          i;
+    GError         *err = NULL;
+
+    model = fbInfoModelAlloc();
+    session = fbSessionAlloc(model);
+    tmpl = fbTemplateAlloc(model);
+    if (!fbTemplateAppendSpecArray(tmpl, recordSpec, ~0, &err))
+        FATAL(err);
+    if (!fbSessionAddTemplate(session, TRUE, TID, tmpl, NULL, &err))
+        FATAL(err);
+
+    msglen = buildMessage(msg);
+    fbuf = fBufAllocForCollection(session, NULL);
+    fBufSetAutomaticMode(fbuf, FALSE);
+    fBufSetBuffer(fbuf, msg, msglen);
+    if (!fBufSetInternalTemplate(fbuf, TID, &err))
+        FATAL(err);
+
+    //  The batch stops at the record with the truncated list
+    memset(recs, 0, sizeof(recs));
+    if (!fBufNextBatch(fbuf, (uint8_t *)recs, sizeof(record_t), BATCH_SIZE,
+                       &count, &err))
+        FATAL(err);
+    CHECK(count == GOOD_RECORDS);
+    for (i = 0; i < count; ++i) {
+        CHECK(recs[i].octetTotalCount == 1500);
+        CHECK(fbBasicListCountElements(&recs[i].ports) == 2);
+        CHECK(fbBasicListCountElements(&recs[i].more_ports) == 2);
+    }
+
+    //  The first list of that record was decoded before the error; it is
+    //  freed rather than left in the slot
+    CHECK(recs[count].ports.dataPtr == NULL);
+    CHECK(recs[count].ports.numElements == 0);
+    CHECK(recs[count].more_ports.dataPtr == NULL);
+
+    //  Reading the record again reports the error
+    CHECK(!fBufNextBatch(fbuf, (uint8_t *)&recs[count], sizeof(record_t),
+                         BATCH_SIZE - count, &count, &err));
+    CHECK(count == 0);
+    g_clear_error(&err);
+
+    for (i = 0; i < BATCH_SIZE; ++i) {
+        fBufListFree(tmpl, (uint8_t *)&recs[i]);
+    }
+    fBufFree(fbuf);
+    fbInfoModelFree(model);
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+//  Copyright 2023 Carnegie Mellon University
+//  See license information in LICENSE.txt.
+
+//  Checks the information model's lookups, element count, and iterator on
+//  the built-in elements, after loading cert_ipfix.xml, and after
+//  elements are redefined and renamed.  Every element the iterator visits
+//  is looked up by name and by ID, which covers each entry of the perfect
+//  hashes of the built-in table.
+
+#include <fixbuf/public.h>
+#define FATAL(e)                                \
+    { fprintf(stderr, "Failed at %s:%d: %s\n",  \
+              __FILE__, __LINE__, e->message);  \
+        exit(1); }
+#define CHECK(c)                                        \
+    if (!(c)) {                                         \
+        fprintf(stderr, "Failed at %s:%d: %s\n",        \
+                __FILE__, __LINE__, #c);                \
+        exit(1);                                        \
+    }
+
+#define CERT_PEN    6871
+
+//  Visits every element of `model`, checking that each is found by its ID
+//  and is visited once, and that the visits agree with
+//  fbInfoModelCountElements().  Elements with different IDs may share a
+//  name (e.g., httpUserAgent in IANA's and CERT's registries), so a
+//  lookup by name must find an element of that name, and each name must
+//  find the element the iterator visits for it.  Returns the count.
+static guint
+checkModel(
+    const fbInfoModel_t  *model)
+{
+    fbInfoModelIter_t      iter;
+    const fbInfoElement_t *ie;
+    const fbInfoElement_t *named;
+    GHashTable            *ids;
+    GHashTable            *names;
+    gpointer               key;
+    guint                  count = 0;
+
+    ids = g_hash_table_new(g_direct_hash, g_direct_equal);
+    names = g_hash_table_new(g_str_hash, g_str_equal);
+    fbInfoModelIterInit(&iter, model);
+    while ((ie = fbInfoModelIterNext(&iter))) {
+        key = GUINT_TO_POINTER(((guint)ie->ent << 16) ^ ie->num);
+        if (ie->ent == 0 || ie->ent == FB_IE_PEN_REVERSE ||
+            ie->ent == CERT_PEN)
+        {
+            CHECK(!g_hash_table_contains(ids, key));
+            g_hash_table_add(ids, key);
+        }
+        named = fbInfoModelGetElementByName(model, ie->name);
+        CHECK(named && !strcmp(named->name, ie->name));
+        if (named == ie) {
+            CHECK(!g_hash_table_contains(names, ie->name));
+            g_hash_table_add(names, (gpointer)ie->name);
+        }
+        CHECK(fbInfoModelGetElementByID(model, ie->num, ie->ent) == ie);
+        CHECK(fbInfoModelContainsElement(model, ie));
+        ++count;
+    }
+    CHECK(count == fbInfoModelCountElements(model));
+    //  every name was found on an element the iterator visited
+    fbInfoModelIterInit(&iter, model);
+    while ((ie = fbInfoModelIterNext(&iter))) {
+        CHECK(g_hash_table_contains(names, ie->name));
+    }
+    g_hash_table_destroy(ids);
+    g_hash_table_destroy(names);
+    return count;
+}
+
+//  Adds a copy of `ie` named `name` to `model` and returns the element the
+//  model now holds for its ID.
+static const fbInfoElement_t *
+redefine(
+    fbInfoModel_t          *model,
+    const fbInfoElement_t  *ie,
+    const char             *name,
+    uint16_t                len)
+{
+    fbInfoElement_t copy = *ie;
+
+    copy.name = name;
+    copy.len = len;
+    fbInfoModelAddElement(model, &copy);
+    return fbInfoModelGetElementByID(model, ie->num, ie->ent);
+}
+
+int main()
+{
+    fbInfoModel_t         *model;
+    const fbInfoElement_t *ie;
+    const fbInfoElement_t *octets;
+    const fbInfoElement_t *packets;
+    const fbInfoElement_t *flags;
+    const char            *srcdir;
+    char                  *path;
+    guint                  count;
+    guint                  builtin;
+    GError                *err = NULL;
+
+    //  The built-in table
+    model = fbInfoModelAlloc();
+    builtin = checkModel(model);
+    CHECK(builtin > 0);
+    octets = fbInfoModelGetElementByName(model, "octetTotalCount");
+    CHECK(octets && octets->ent == 0 && octets->num == 85);
+    packets = fbInfoModelGetElementByName(model, "packetTotalCount");
+    CHECK(packets && packets->ent == 0 && packets->num == 86);
+    CHECK(fbInfoModelGetElementByName(model, "reverseOctetTotalCount"));
+    CHECK(!fbInfoModelGetElementByName(model, "noSuchElement"));
+    CHECK(!fbInfoModelGetElementByName(model, "OCTETTOTALCOUNT"));
+    CHECK(!fbInfoModelGetElementByName(model, ""));
+    CHECK(!fbInfoModelGetElementByID(model, 0x7ff0, 0));
+    CHECK(!fbInfoModelGetElementByID(model, 85, 12345));
+
+    //  Loading cert_ipfix.xml adds the CERT elements and keeps the built-in
+    //  elements it repeats
+    srcdir = getenv("srcdir");
+    path = g_build_filename(srcdir ? srcdir : ".", "..", "src",
+                            "cert_ipfix.xml", NULL);
+    if (!fbInfoModelReadXMLFile(model, path, &err))
+        FATAL(err);
+    g_free(path);
+    count = checkModel(model);
+    CHECK(count > builtin);
+    CHECK(fbInfoModelGetElementByName(model, "octetTotalCount") == octets);
+    flags = fbInfoModelGetElementByName(model, "initialTCPFlags");
+    CHECK(flags && flags->ent == CERT_PEN);
+
+    //  Redefining a built-in element with its own name replaces it
+    ie = redefine(model, octets, "octetTotalCount", 4);
+    CHECK(ie && ie != octets && ie->len == 4);
+    CHECK(fbInfoModelGetElementByName(model, "octetTotalCount") == ie);
+    CHECK(checkModel(model) == count);
+
+    //  Renaming a built-in element releases its old name
+    ie = redefine(model, packets, "packetsSeen", packets->len);
+    CHECK(ie && !strcmp(ie->name, "packetsSeen"));
+    CHECK(fbInfoModelGetElementByName(model, "packetsSeen") == ie);
+    CHECK(!fbInfoModelGetElementByName(model, "packetTotalCount"));
+    CHECK(checkModel(model) == count);
+
+    //  Renaming an element read from XML does too
+    ie = redefine(model, flags, "firstTCPFlags", flags->len);
+    CHECK(ie && ie->ent == CERT_PEN);
+    CHECK(fbInfoModelGetElementByName(model, "firstTCPFlags") == ie);
+    CHECK(!fbInfoModelGetElementByName(model, "initialTCPFlags"));
+    CHECK(checkModel(model) == count);
+
+    //  Restoring the original name brings it back
+    ie = redefine(model, ie, "initialTCPFlags", ie->len);
+    CHECK(fbInfoModelGetElementByName(model, "initialTCPFlags") == ie);
+    CHECK(!fbInfoModelGetElementByName(model, "firstTCPFlags"));
+    CHECK(checkModel(model) == count);
+
+    //  A new model is not affected by the changes to this one
+    fbInfoModelFree(model);
+    model = fbInfoModelAlloc();
+    CHECK(checkModel(model) == builtin);
+    CHECK(fbInfoModelGetElementByName(model, "packetTotalCount"));
+    CHECK(!fbInfoModelGetElementByName(model, "packetsSeen"));
+    fbInfoModelFree(model);
+
+    return 0;
+}
@@ -0,0 +1,292 @@
+//  Copyright 2023 Carnegie Mellon University
+//  See license information in LICENSE.txt.
+
+//  Reads records with fBufSetLazyLists() enabled and checks that the list
+//  structures keep their size, that a deferred list examined after the
+//  Buffer reads a template set or finishes the message (and the message is
+//  overwritten) holds its contents, and that deferred lists are released
+//  when cleared or overwritten.
+
+#include <fixbuf/public.h>
+#include <stddef.h>
+#define FATAL(e)                                \
+    { fprintf(stderr, "Failed at %s:%d: %s\n",  \
+              __FILE__, __LINE__, e->message);  \
+        exit(1); }
+#define CHECK(c)                                        \
+    if (!(c)) {                                         \
+        fprintf(stderr, "Failed at %s:%d: %s\n",        \
+                __FILE__, __LINE__, #c);                \
+        exit(1);                                        \
+    }
+
+#define TID             0x0100
+#define PORT_TID        0x0200
+#define RECORDS         7
+
+static fbInfoElementSpec_t recordSpec[] = {
+    {"octetTotalCount",                     8, 0 },
+    {"basicList",                           0, 0 },
+    {"subTemplateMultiList",                0, 0 },
+    FB_IESPEC_NULL
+};
+
+typedef struct record_st {
+    uint64_t                    octetTotalCount;
+    fbBasicList_t               ports;
+    fbSubTemplateMultiList_t    flows;
+} record_t;
+
+//  Appends `len` octets at `src` to `msg` and returns the new end.
+static uint8_t *
+put(
+    uint8_t        *msg,
+    const uint8_t  *src,
+    size_t          len)
+{
+    memcpy(msg, src, len);
+    return msg + len;
+}
+
+//  Writes the big-endian `v` to the 16-bit field at `p`.
+static void
+put16(
+    uint8_t   *p,
+    uint16_t   v)
+{
+    p[0] = v >> 8;
+    p[1] = v & 0xff;
+}
+
+//  Appends the record numbered `k` to `msg` and returns the new end: an
+//  octet count of 1000+k, a basicList of the ports 80+k and 443, and a
+//  subTemplateMultiList holding records of PORT_TID with the ports 1000+k
+//  and 2000+k.
+static uint8_t *
+putRecord(
+    uint8_t   *msg,
+    unsigned   k)
+{
+    //  varlen length 9; allOf sourceTransportPort, length 2
+    static const uint8_t blHeader[] = {
+        0x09, 0x03, 0x00, 0x07,  0x00, 0x02
+    };
+    //  varlen length 9; allOf, one entry of PORT_TID, length 8
+    static const uint8_t stmlHeader[] = {
+        0x09, 0x03, 0x02, 0x00,  0x00, 0x08
+    };
+    uint8_t *p = msg;
+
+    memset(p, 0, 6);
+    put16(p + 6, 1000 + k);
+    p += 8;
+    p = put(p, blHeader, sizeof(blHeader));
+    put16(p, 80 + k);
+    put16(p + 2, 443);
+    p += 4;
+    p = put(p, stmlHeader, sizeof(stmlHeader));
+    put16(p, 1000 + k);
+    put16(p + 2, 2000 + k);
+    return p + 4;
+}
+
+//  Builds a message in `msg` and returns its length: the templates, a set
+//  of the records numbered `base` and `base`+1, a template set for an
+//  unused template, and a set of the record numbered `base`+2.  `base` is a
+//  multiple of 10, and each earlier message held three records.
+static size_t
+buildMessage(
+    uint8_t   *msg,
+    unsigned   base)
+{
+    static const uint8_t header[] = {
+        0x00, 0x0a, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00
+    };
+    static const uint8_t tmplSet[] = {
+        0x00, 0x02, 0x00, 0x1c,
+        0x01, 0x00, 0x00, 0x03,  0x00, 0x55, 0x00, 0x08,
+        0x01, 0x23, 0xff, 0xff,  0x01, 0x25, 0xff, 0xff,
+        0x02, 0x00, 0x00, 0x01,  0x00, 0x07, 0x00, 0x02
+    };
+    static const uint8_t otherTmplSet[] = {
+        0x00, 0x02, 0x00, 0x0c,
+        0x03, 0x00, 0x00, 0x01,  0x00, 0x0b, 0x00, 0x02
+    };
+    uint8_t *p = msg;
+    uint8_t *set;
+
+    p = put(p, header, sizeof(header));
+    p = put(p, tmplSet, sizeof(tmplSet));
+    set = p;
+    p = putRecord(p + 4, base);
+    p = putRecord(p, base + 1);
+    put16(set, TID);
+    put16(set + 2, p - set);
+    p = put(p, otherTmplSet, sizeof(otherTmplSet));
+    set = p;
+    p = putRecord(p + 4, base + 2);
+    put16(set, TID);
+    put16(set + 2, p - set);
+    put16(msg + 2, p - msg);
+    put16(msg + 10, base / 10 * 3);
+    return p - msg;
+}
+
+//  Checks that `rec` holds the record numbered `k`.
+static void
+checkRecord(
+    const record_t  *rec,
+    unsigned         k)
+{
+    const fbSubTemplateMultiListEntry_t *entry;
+    const uint16_t *port;
+
+    CHECK(rec->octetTotalCount == 1000 + k);
+
+    CHECK(fbBasicListCountElements(&rec->ports) == 2);
+    port = fbBLNext(const uint16_t, &rec->ports, NULL);
+    CHECK(port && *port == 80 + k);
+    port = fbBLNext(const uint16_t, &rec->ports, port);
+    CHECK(port && *port == 443);
+    CHECK(fbBLNext(const uint16_t, &rec->ports, port) == NULL);
+
+    CHECK(fbSubTemplateMultiListCountElements(&rec->flows) == 1);
+    entry = fbSubTemplateMultiListGetFirstEntry(&rec->flows);
+    CHECK(fbSubTemplateMultiListEntryGetTemplateID(entry) == PORT_TID);
+    port = fbSTMLEntryNext(const uint16_t, entry, NULL);
+    CHECK(port && *port == 1000 + k);
+    port = fbSTMLEntryNext(const uint16_t, entry, port);
+    CHECK(port && *port == 2000 + k);
+}
+
+//  Reads the next record of `fbuf` into `rec`.
+static void
+readRecord(
+    fBuf_t    *fbuf,
+    record_t  *rec)
+{
+    size_t  len = sizeof(*rec);
+    GError *err = NULL;
+
+    if (!fBufNext(fbuf, (uint8_t *)rec, &len, &err))
+        FATAL(err);
+}
+
+//  Checks that `fbuf` has no more records in its message; `rec` is the
+//  record to read into.
+static void
+finishMessage(
+    fBuf_t    *fbuf,
+    record_t  *rec)
+{
+    size_t  len = sizeof(*rec);
+    GError *err = NULL;
+
+    CHECK(!fBufNext(fbuf, (uint8_t *)rec, &len, &err));
+    CHECK(g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_EOM));
+    g_clear_error(&err);
+}
+
+int main()
+{
+    fbInfoModel_t  *model;
+    fbSession_t    *session;
+    fbTemplate_t   *tmpl;
+    fBuf_t         *fbuf;
+    record_t        recs[RECORDS];
+    record_t        arenaRec;
+    uint8_t         msg[512];
+    size_t          msglen;
+    size_t          i;
+    GError         *err = NULL;
+
+    //  The deferred state is not kept in the list structures
+    CHECK(sizeof(fbBasicList_t) - offsetof(fbBasicList_t, fromArena)
+          <= sizeof(void *));
+    CHECK(sizeof(fbSubTemplateList_t) - offsetof(fbSubTemplateList_t,
+                                                 fromArena)
+          <= sizeof(void *));
+    CHECK(sizeof(fbSubTemplateMultiList_t)
+          - offsetof(fbSubTemplateMultiList_t, fromArena)
+          <= sizeof(void *));
+
+    model = fbInfoModelAlloc();
+    session = fbSessionAlloc(model);
+    tmpl = fbTemplateAlloc(model);
+    if (!fbTemplateAppendSpecArray(tmpl, recordSpec, ~0, &err))
+        FATAL(err);
+    if (!fbSessionAddTemplate(session, TRUE, TID, tmpl, NULL, &err))
+        FATAL(err);
+
+    fbuf = fBufAllocForCollection(session, NULL);
+    fBufSetAutomaticMode(fbuf, FALSE);
+    fBufSetLazyLists(fbuf, TRUE);
+    msglen = buildMessage(msg, 0);
+    fBufSetBuffer(fbuf, msg, msglen);
+    if (!fBufSetInternalTemplate(fbuf, TID, &err))
+        FATAL(err);
+    memset(recs, 0, sizeof(recs));
+
+    //  A list examined while its message is current
+    readRecord(fbuf, &recs[0]);
+    CHECK(fbBasicListGetSemantic(&recs[0].ports) == FB_LIST_SEM_ALL_OF);
+    CHECK(fbSubTemplateMultiListGetSemantic(&recs[0].flows)
+          == FB_LIST_SEM_ALL_OF);
+    checkRecord(&recs[0], 0);
+
+    //  A list examined after the Buffer reads a template set
+    readRecord(fbuf, &recs[1]);
+    readRecord(fbuf, &recs[2]);
+    checkRecord(&recs[1], 1);
+
+    //  A list examined after the message ends and is overwritten
+    finishMessage(fbuf, &recs[3]);
+    memset(msg, 0xff, sizeof(msg));
+    checkRecord(&recs[2], 2);
+
+    //  Free the lists before the next message replaces their templates
+    for (i = 0; i < 3; ++i) {
+        fBufListFree(tmpl, (uint8_t *)&recs[i]);
+    }
+
+    //  Reading lazily into a record that holds decoded lists releases them
+    msglen = buildMessage(msg, 10);
+    fBufSetBuffer(fbuf, msg, msglen);
+    fBufSetLazyLists(fbuf, FALSE);
+    readRecord(fbuf, &recs[3]);
+    fBufSetLazyLists(fbuf, TRUE);
+    readRecord(fbuf, &recs[3]);
+    checkRecord(&recs[3], 11);
+
+    //  As does reading into a record that holds examined deferred lists
+    readRecord(fbuf, &recs[3]);
+    checkRecord(&recs[3], 12);
+    finishMessage(fbuf, &recs[4]);
+    fBufListFree(tmpl, (uint8_t *)&recs[3]);
+
+    //  Or unexamined ones, or freeing deferred lists without examining them
+    msglen = buildMessage(msg, 20);
+    fBufSetBuffer(fbuf, msg, msglen);
+    readRecord(fbuf, &recs[4]);
+    readRecord(fbuf, &recs[4]);
+    checkRecord(&recs[4], 21);
+    readRecord(fbuf, &recs[5]);
+    fBufListFree(tmpl, (uint8_t *)&recs[5]);
+    finishMessage(fbuf, &recs[6]);
+    fBufListFree(tmpl, (uint8_t *)&recs[4]);
+
+    //  Deferred lists in a list arena are released with the arena
+    msglen = buildMessage(msg, 30);
+    fBufSetBuffer(fbuf, msg, msglen);
+    fBufSetListArena(fbuf, FB_LIST_ARENA_RECORD);
+    memset(&arenaRec, 0, sizeof(arenaRec));
+    readRecord(fbuf, &arenaRec);
+    checkRecord(&arenaRec, 30);
+    readRecord(fbuf, &arenaRec);
+
+    fBufFree(fbuf);
+    fbInfoModelFree(model);
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+//  Copyright 2023 Carnegie Mellon University
+//  See license information in LICENSE.txt.
+
+//  Appends records in automatic mode to a file exporter that rotates
+//  after every message, with both fBufAppend() and fBufAppendBatch(), and
+//  checks that every file starts with the templates and that no record
+//  is lost across a rotation.
+
+#include <fixbuf/public.h>
+#define FATAL(e)                                \
+    { fprintf(stderr, "Failed at %s:%d: %s\n",  \
+              __FILE__, __LINE__, e->message);  \
+        exit(1); }
+#define CHECK(c)                                        \
+    if (!(c)) {                                         \
+        fprintf(stderr, "Failed at %s:%d: %s\n",        \
+                __FILE__, __LINE__, #c);                \
+        exit(1);                                        \
+    }
+
+#define RECORD_COUNT    20000
+#define BATCH_SIZE      1000
+#define MAX_FILE_SIZE   1024
+#define TID             0x1234
+
+static fbInfoElementSpec_t recordSpec[] = {
+    {"octetTotalCount",                     8, 0 },
+    {"packetTotalCount",                    8, 0 },
+    FB_IESPEC_NULL
+};
+
+typedef struct record_st {
+    uint64_t  octetTotalCount;
+    uint64_t  packetTotalCount;
+} record_t;
+
+static void
+fileClosed(
+    fbExporter_t  *exporter,
+    const char    *path,
+    void          *ctx)
+{
+    g_ptr_array_add((GPtrArray *)ctx, g_strdup(path));
+}
+
+//  Reads the file at `path` on its own and returns its record count after
+//  checking the records are numbered from `*next`, which is advanced.
+static unsigned int
+readFile(
+    fbInfoModel_t  *model,
+    const char     *path,
+    uint64_t       *next)
+{
+    fbSession_t   *session;
+    fbCollector_t *collector;
+    fbTemplate_t  *tmpl;
+    fBuf_t        *fbuf;
+    record_t       rec;
+    size_t         len;
+    unsigned int   count = 0;
+    GError        *err = NULL;
+
+    session = fbSessionAlloc(model);
+    tmpl = fbTemplateAlloc(model);
+    if (!fbTemplateAppendSpecArray(tmpl, recordSpec, ~0, &err))
+        FATAL(err);
+    if (!fbSessionAddTemplate(session, TRUE, TID, tmpl, NULL, &err))
+        FATAL(err);
+    if (!(collector = fbCollectorAllocFile(NULL, path, &err)))
+        FATAL(err);
+    fbuf = fBufAllocForCollection(session, collector);
+    if (!fBufSetInternalTemplate(fbuf, TID, &err))
+        FATAL(err);
+
+    for (;;) {
+        len = sizeof(rec);
+        if (!fBufNext(fbuf, (uint8_t *)&rec, &len, &err)) {
+            CHECK(g_error_matches(err, FB_ERROR_DOMAIN, FB_ERROR_EOF));
+            g_clear_error(&err);
+            break;
+        }
+        CHECK(rec.octetTotalCount == *next);
+        CHECK(rec.packetTotalCount == *next * 2);
+        ++*next;
+        ++count;
+    }
+
+    fBufFree(fbuf);
+    return count;
+}
+
+int main()
+{
+    fbInfoModel_t  *model;
+    fbSession_t    *session;
+    fbExporter_t   *exporter;
+    fbTemplate_t   *tmpl;
+    fBuf_t         *fbuf;
+    GPtrArray      *files;
+    record_t       *recs;
+    char           *dir;
+    char           *path;
+    uint64_t        next;
+    unsigned int    total;
+    unsigned int    i;
+    GError         *err = NULL;
+
+    if (!(dir = g_dir_make_tmp("fixbuf-rotate-XXXXXX", &err)))
+        FATAL(err);
+    path = g_build_filename(dir, "rotate-%Y.ipfix", NULL);
+    files = g_ptr_array_new_with_free_func(g_free);
+
+    model = fbInfoModelAlloc();
+    session = fbSessionAlloc(model);
+    exporter = fbExporterAllocFile(path);
+    if (!fbExporterSetFileRotation(exporter, MAX_FILE_SIZE, 0,
+                                   fileClosed, files, &err))
+        FATAL(err);
+    fbuf = fBufAllocForExport(session, exporter);
+    fBufSetAutomaticMode(fbuf, TRUE);
+
+    tmpl = fbTemplateAlloc(model);
+    if (!fbTemplateAppendSpecArray(tmpl, recordSpec, ~0, &err))
+        FATAL(err);
+    if (!fbSessionAddTemplatesForExport(session, TID, tmpl, NULL, &err))
+        FATAL(err);
+    if (!fBufSetTemplatesForExport(fbuf, TID, &err))
+        FATAL(err);
+
+    //  Every message fills the file, so each message after the first that
+    //  the automatic mode emits follows a rotation.
+    recs = g_new0(record_t, BATCH_SIZE);
+    for (i = 0; i < RECORD_COUNT / 2; ++i) {
+        recs[0].octetTotalCount = i;
+        recs[0].packetTotalCount = 2 * i;
+        if (!fBufAppend(fbuf, (uint8_t *)recs, sizeof(record_t), &err))
+            FATAL(err);
+    }
+    for ( ; i < RECORD_COUNT; i += BATCH_SIZE) {
+        unsigned int j;
+        for (j = 0; j < BATCH_SIZE; ++j) {
+            recs[j].octetTotalCount = i + j;
+            recs[j].packetTotalCount = 2 * (i + j);
+        }
+        if (!fBufAppendBatch(fbuf, (uint8_t *)recs, sizeof(record_t),
+                             BATCH_SIZE, &err))
+            FATAL(err);
+    }
+    if (!fBufEmit(fbuf, &err))
+        FATAL(err);
+    fBufFree(fbuf);
+    g_free(recs);
+
+    //  All files were closed by fBufFree().  The final fBufEmit() rotated
+    //  too, so the last file holds only templates.
+    CHECK(files->len > 2);
+    next = 0;
+    total = 0;
+    for (i = 0; i < files->len; ++i) {
+        unsigned int count = readFile(model, files->pdata[i], &next);
+        CHECK(count > 0 || i == files->len - 1);
+        total += count;
+        remove(files->pdata[i]);
+    }
+    CHECK(total == RECORD_COUNT);
+
+    g_ptr_array_free(files, TRUE);
+    rmdir(dir);
+    g_free(path);
+    g_free(dir);
+    fbInfoModelFree(model);
+
+    return 0;
+}